@@ -32,9 +32,13 @@
 #ifndef RVIZ_COMMON__DISPLAY_HPP_
 #define RVIZ_COMMON__DISPLAY_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <string>
 
 #include <QIcon>  // NOLINT: cpplint is unable to handle the include order here
+#include <QMap>  // NOLINT: cpplint is unable to handle the include order here
 #include <QSet>  // NOLINT: cpplint is unable to handle the include order here
 
 #include "rclcpp/time.hpp"
@@ -166,6 +170,9 @@ public:
   /**
    * This is thread-safe.
    *
+   * Status changes are collected and shown in the property tree at most four times per
+   * second, only the last text set for each name before that is shown.
+   *
    * Every Display has a StatusList to indicate how it is doing.  The
    * StatusList has StatusProperty children indicating the status of
    * various subcomponents of the Display.  Each child of the status
@@ -345,6 +352,22 @@ protected:
   void
   clearStatuses();
 
+  /// Request a call of updateStatuses() from the main thread.
+  /**
+   * This is thread-safe and cheap enough to be called for every received message.
+   * Requests are coalesced, updateStatuses() is called at most four times per second.
+   */
+  void
+  requestStatusUpdate();
+
+  /// Override to set statuses derived from counters, see requestStatusUpdate().
+  /**
+   * This is called in the main thread.
+   */
+  virtual
+  void
+  updateStatuses();
+
   /// Called by setFixedFrame().
   /**
    * Override to respond to changes to fixed_frame_.
@@ -399,6 +422,12 @@ private Q_SLOTS:
   void
   clearStatusesInternal();
 
+  void
+  scheduleStatusFlush();
+
+  void
+  flushStatuses();
+
   void
   associatedPanelVisibilityChange(bool visible);
 
@@ -406,7 +435,25 @@ private Q_SLOTS:
   disable();
 
 private:
+  struct PendingStatus
+  {
+    bool deleted;
+    int level;
+    QString text;
+  };
+
+  void
+  requestStatusFlush();
+
   rviz_common::properties::StatusList * status_;
+
+  /// Status changes which were not shown yet, guarded by pending_statuses_mutex_
+  std::mutex pending_statuses_mutex_;
+  QMap<QString, PendingStatus> pending_statuses_;
+  bool pending_statuses_clear_;
+  std::atomic<bool> status_flush_requested_;
+  std::atomic<bool> updating_statuses_;
+  std::chrono::steady_clock::time_point last_status_flush_;
   QString class_id_;
   bool initialized_;
   uint32_t visibility_bits_;
@@ -33,7 +33,9 @@
 #define RVIZ_COMMON__DISPLAY_CONTEXT_HPP_
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <utility>
 
 #include <QObject>  // NOLINT: cpplint is unable to handle the include order here
 #include <QString>  // NOLINT: cpplint is unable to handle the include order here
@@ -224,6 +226,25 @@ public:
   void
   unlockRender() = 0;
 
+  /// Queue a change to the scene, applied right before the next frame is rendered.
+  /**
+   * Lets threads which prepare data in the background hand the result to the
+   * scene without locking the render mutex. Queued changes are applied in order,
+   * on the thread which renders, and also cause a render to be queued.
+   *
+   * The default implementation applies the change in the event loop of the thread
+   * owning the context instead, for contexts which do not apply queued changes themselves.
+   *
+   * \note This function can be called from any thread.
+   */
+  virtual
+  void
+  queueSceneUpdate(std::function<void()> update)
+  {
+    QMetaObject::invokeMethod(this, std::move(update), Qt::QueuedConnection);
+    queueRender();
+  }
+
 public Q_SLOTS:
   /// Queue a render.
   /**
@@ -32,12 +32,12 @@
 #define RVIZ_COMMON__MESSAGE_FILTER_DISPLAY_HPP_
 
 #include <tf2_ros/message_filter.h>
+#include <atomic>
 #include <memory>
 
-#include <message_filters/subscriber.hpp>
-
 #include "rviz_common/ros_topic_display.hpp"
 #include "rviz_common/properties/int_property.hpp"
+#include "rviz_common/ros_integration/topic_hub_subscriber.hpp"
 
 namespace rviz_common
 {
@@ -88,7 +88,7 @@ public:
 
   void reset() override
   {
-    Display::reset();
+    _RosTopicDisplay::reset();
     if (tf_filter_) {
       tf_filter_->clear();
     }
@@ -121,7 +121,7 @@ protected:
 
     try {
       rclcpp::Node::SharedPtr node = rviz_ros_node_.lock()->get_raw_node();
-      subscription_ = std::make_shared<message_filters::Subscriber<MessageType>>(
+      subscription_ = std::make_shared<ros_integration::TopicHubSubscriber<MessageType>>(
         node,
         topic_property_->getTopicStd(),
         qos_profile);
@@ -195,19 +195,36 @@ protected:
       return;
     }
 
+    ++messages_received_;
+    requestStatusUpdate();
+
     // Do not process message right away, tf2_ros::MessageFilter may be
     // calling back from tf2_ros::TransformListener dedicated thread.
     // Use type erased signal/slot machinery to ensure messages are
     // processed in the main thread.
-    Q_EMIT typeErasedMessageTaken(std::static_pointer_cast<const void>(msg));
+    auto type_erased_msg = std::static_pointer_cast<const void>(msg);
+    if (!conflateMessage(type_erased_msg)) {
+      Q_EMIT typeErasedMessageTaken(type_erased_msg);
+    }
   }
 
   void processTypeErasedMessage(std::shared_ptr<const void> type_erased_msg) override
   {
     auto msg = std::static_pointer_cast<const MessageType>(type_erased_msg);
 
-    ++messages_received_;
-    QString topic_str = QString::number(messages_received_) + " messages received";
+    processMessage(msg);
+    context_->queueRender();
+  }
+
+  void updateStatuses() override
+  {
+    _RosTopicDisplay::updateStatuses();
+
+    const uint32_t messages_received = messages_received_;
+    if (messages_received == 0) {
+      return;
+    }
+    QString topic_str = QString::number(messages_received) + " messages received";
     // Append topic subscription frequency if we can lock rviz_ros_node_.
     std::shared_ptr<ros_integration::RosNodeAbstractionIface> node_interface =
       rviz_ros_node_.lock();
@@ -215,15 +232,13 @@ protected:
       const double duration =
         (node_interface->get_raw_node()->now() - subscription_start_time_).seconds();
       const double subscription_frequency =
-        static_cast<double>(messages_received_) / duration;
+        static_cast<double>(messages_received) / duration;
       topic_str += " at " + QString::number(subscription_frequency, 'f', 1) + " hz.";
     }
     setStatus(
       properties::StatusProperty::Ok,
       "Topic",
       topic_str);
-
-    processMessage(msg);
   }
 
   /// Implement this to process the contents of a message.
@@ -232,10 +247,14 @@ protected:
    */
   virtual void processMessage(typename MessageType::ConstSharedPtr msg) = 0;
 
-  typename std::shared_ptr<message_filters::Subscriber<MessageType>> subscription_;
+  /// Feeds tf_filter_ from the subscription shared with the other displays of the same topic.
+  /**
+   * Provides the filter and subscriber interface of the former message_filters::Subscriber.
+   */
+  std::shared_ptr<ros_integration::TopicHubSubscriber<MessageType>> subscription_;
   rclcpp::Time subscription_start_time_;
   std::shared_ptr<tf2_ros::MessageFilter<MessageType, transformation::FrameTransformer>> tf_filter_;
-  uint32_t messages_received_;
+  std::atomic<uint32_t> messages_received_;
   properties::IntProperty * message_queue_property_;
 };
 
@@ -0,0 +1,84 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_COMMON__RENDER_SCHEDULER_HPP_
+#define RVIZ_COMMON__RENDER_SCHEDULER_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+#include "rviz_common/visibility_control.hpp"
+
+namespace rviz_common
+{
+
+/// Decides in which update cycles the scene is updated and rendered.
+/**
+ * By default every update cycle renders, as the update timer is the frame rate.
+ * In on demand mode, a cycle only updates the displays and renders when something
+ * called queueRender() since the last rendered cycle, or when the heartbeat at the
+ * idle rate is due.
+ */
+class RVIZ_COMMON_PUBLIC RenderScheduler
+{
+public:
+  RenderScheduler();
+
+  void setOnDemand(bool on_demand);
+  bool isOnDemand() const {return on_demand_;}
+
+  /// Rate in Hz at which an unchanged scene is still rendered in on demand mode, 0 to disable.
+  void setIdleRate(float rate);
+
+  /// Mark the scene as changed, the next cycle renders. Can be called from any thread.
+  void queueRender();
+
+  /// Start an update cycle.
+  /**
+   * \param wall_dt Wall time since the last rendered cycle in nanoseconds
+   * \return true if displays are to be updated and the scene rendered in this cycle
+   */
+  bool beginCycle(uint64_t wall_dt);
+
+  uint64_t getRenderedCycles() const {return rendered_cycles_;}
+  uint64_t getSkippedCycles() const {return skipped_cycles_;}
+
+private:
+  bool on_demand_;
+  uint64_t idle_period_;
+  std::atomic<bool> render_requested_;
+
+  uint64_t rendered_cycles_;
+  uint64_t skipped_cycles_;
+};
+
+}  // namespace rviz_common
+
+#endif  // RVIZ_COMMON__RENDER_SCHEDULER_HPP_
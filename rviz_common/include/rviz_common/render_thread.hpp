@@ -0,0 +1,112 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_COMMON__RENDER_THREAD_HPP_
+#define RVIZ_COMMON__RENDER_THREAD_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "rviz_common/visibility_control.hpp"
+
+namespace rviz_common
+{
+
+/// Renders frames on a dedicated thread while the thread owning the scene is idle.
+/**
+ * Ogre is not thread safe, so the scene and the GL context are handed back and forth
+ * instead of being shared. The owning thread, the GUI thread, holds them while it works.
+ * It releases them with releaseScene() when it is about to wait for events and takes them
+ * back with acquireScene() when it wakes up. Requested frames are rendered in between, so
+ * the GUI thread does not wait for the frame to be submitted and swapped, unless it needs
+ * the scene while a frame is in progress.
+ *
+ * Both sides hold the scene mutex while they have the scene, so lockRender() keeps
+ * working for other threads.
+ */
+class RVIZ_COMMON_PUBLIC RenderThread
+{
+public:
+  struct Callbacks
+  {
+    /// Render one frame, called on the render thread while it has the scene.
+    std::function<void ()> render_frame;
+    /// Make the GL context current on the calling thread.
+    std::function<void ()> acquire_context;
+    /// Release the GL context from the calling thread.
+    std::function<void ()> release_context;
+  };
+
+  RenderThread(std::recursive_mutex & scene_mutex, Callbacks callbacks);
+
+  /// Stops the thread, see stop().
+  ~RenderThread();
+
+  /// Start the render thread. The calling thread becomes the owner and has the scene.
+  void start();
+
+  /// Stop the render thread after the frame in progress. The owner keeps the scene.
+  void stop();
+
+  bool isRunning() const {return thread_.joinable();}
+
+  /// Hand the scene to the render thread. Only called by the owner.
+  void releaseScene();
+
+  /// Take the scene back, waiting for a frame in progress. Only called by the owner.
+  void acquireScene();
+
+  /// Render a frame the next time the owner releases the scene. Requests are coalesced.
+  void requestFrame();
+
+  uint64_t getRenderedFrames() const;
+
+private:
+  void run();
+
+  std::recursive_mutex & scene_mutex_;
+  Callbacks callbacks_;
+  std::thread thread_;
+
+  mutable std::mutex state_mutex_;
+  std::condition_variable state_changed_;
+  bool owner_has_scene_;
+  bool frame_requested_;
+  bool rendering_;
+  bool stopping_;
+  uint64_t rendered_frames_;
+};
+
+}  // namespace rviz_common
+
+#endif  // RVIZ_COMMON__RENDER_THREAD_HPP_
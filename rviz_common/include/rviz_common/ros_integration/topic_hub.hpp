@@ -0,0 +1,168 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_COMMON__ROS_INTEGRATION__TOPIC_HUB_HPP_
+#define RVIZ_COMMON__ROS_INTEGRATION__TOPIC_HUB_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+#include "rviz_common/visibility_control.hpp"
+
+namespace rviz_common
+{
+namespace ros_integration
+{
+
+/// Shares one subscription between all consumers of the same topic.
+/**
+ * Consumers which subscribe with the same node, topic, message type and QoS profile are
+ * attached to a single rclcpp::Subscription. Every message is therefore received and
+ * deserialized once, and all consumers get the same message instance.
+ * The subscription is created with the first consumer and destroyed with the last one.
+ *
+ * Transient local subscriptions are never shared: the publisher only sends its latched
+ * messages to new subscriptions, so a consumer joining a shared one would miss them.
+ *
+ * Callbacks are called from the executor spinning the node.
+ */
+class RVIZ_COMMON_PUBLIC TopicHub
+{
+  struct Channel;
+
+public:
+  using TypeErasedCallback = std::function<void (const std::shared_ptr<const void> &)>;
+  using MessageLostCallback = std::function<void (rclcpp::QOSMessageLostInfo &)>;
+
+  /// Keeps a consumer attached to its shared subscription until it is disconnected or destroyed.
+  class RVIZ_COMMON_PUBLIC Connection
+  {
+public:
+    Connection() = default;
+    Connection(Connection && other) noexcept;
+    Connection & operator=(Connection && other) noexcept;
+    Connection(const Connection &) = delete;
+    Connection & operator=(const Connection &) = delete;
+    ~Connection();
+
+    void disconnect();
+
+    bool isConnected() const;
+
+    /// The subscription shared by all consumers of the topic, or nullptr when disconnected.
+    rclcpp::SubscriptionBase::SharedPtr getSubscription() const;
+
+private:
+    friend class TopicHub;
+
+    Connection(TopicHub * hub, std::weak_ptr<Channel> channel, uint64_t consumer_id);
+
+    TopicHub * hub_ = nullptr;
+    std::weak_ptr<Channel> channel_;
+    uint64_t consumer_id_ = 0;
+  };
+
+  TopicHub() = default;
+  TopicHub(const TopicHub &) = delete;
+  TopicHub & operator=(const TopicHub &) = delete;
+
+  /// The hub used by the displays.
+  static TopicHub & getSingleton();
+
+  /// Attach a consumer to the shared subscription of the given topic.
+  /**
+   * \throws rclcpp::exceptions::InvalidTopicNameError if the first consumer uses an invalid topic
+   */
+  template<class MessageType>
+  Connection subscribe(
+    rclcpp::Node::SharedPtr node,
+    const std::string & topic,
+    const rclcpp::QoS & qos,
+    std::function<void(typename MessageType::ConstSharedPtr)> callback,
+    MessageLostCallback message_lost_callback = nullptr)
+  {
+    auto create_subscription =
+      [node, topic, qos](
+      TypeErasedCallback dispatch, MessageLostCallback dispatch_message_lost)
+      -> rclcpp::SubscriptionBase::SharedPtr
+      {
+        rclcpp::SubscriptionOptions sub_opts;
+        sub_opts.event_callbacks.message_lost_callback = dispatch_message_lost;
+        return node->template create_subscription<MessageType>(
+          topic,
+          qos,
+          [dispatch](const typename MessageType::ConstSharedPtr message) {dispatch(message);},
+          sub_opts);
+      };
+
+    return connect(
+      node, topic, rosidl_generator_traits::name<MessageType>(), qos, create_subscription,
+      [callback](const std::shared_ptr<const void> & message) {
+        callback(std::static_pointer_cast<const MessageType>(message));
+      },
+      std::move(message_lost_callback));
+  }
+
+  /// Number of subscriptions currently shared through this hub.
+  size_t getSubscriptionCount() const;
+
+  /// Number of consumers attached to the subscriptions of the given topic.
+  size_t getConsumerCount(const std::string & topic) const;
+
+private:
+  using SubscriptionFactory = std::function<rclcpp::SubscriptionBase::SharedPtr(
+        TypeErasedCallback, MessageLostCallback)>;
+
+  Connection connect(
+    const rclcpp::Node::SharedPtr & node,
+    const std::string & topic,
+    const std::string & message_type,
+    const rclcpp::QoS & qos,
+    const SubscriptionFactory & create_subscription,
+    TypeErasedCallback callback,
+    MessageLostCallback message_lost_callback);
+
+  void disconnect(const std::shared_ptr<Channel> & channel, uint64_t consumer_id);
+
+  mutable std::mutex mutex_;
+  std::vector<std::shared_ptr<Channel>> channels_;
+};
+
+}  // namespace ros_integration
+}  // namespace rviz_common
+
+#endif  // RVIZ_COMMON__ROS_INTEGRATION__TOPIC_HUB_HPP_
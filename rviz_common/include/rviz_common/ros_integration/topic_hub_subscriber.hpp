@@ -0,0 +1,110 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_COMMON__ROS_INTEGRATION__TOPIC_HUB_SUBSCRIBER_HPP_
+#define RVIZ_COMMON__ROS_INTEGRATION__TOPIC_HUB_SUBSCRIBER_HPP_
+
+#include <memory>
+#include <string>
+
+#include <message_filters/simple_filter.hpp>
+
+#include "rclcpp/rclcpp.hpp"
+
+#include "rviz_common/ros_integration/topic_hub.hpp"
+
+namespace rviz_common
+{
+namespace ros_integration
+{
+
+/// Message filter source which receives its messages through a TopicHub.
+/**
+ * Can be used wherever a message_filters::Subscriber is connected to a filter chain,
+ * but shares the underlying subscription with the other consumers of the topic.
+ * It mirrors the parts of the message_filters::Subscriber interface which make sense for a
+ * shared subscription.
+ */
+template<class MessageType>
+class TopicHubSubscriber : public message_filters::SimpleFilter<MessageType>
+{
+public:
+  TopicHubSubscriber(
+    rclcpp::Node::SharedPtr node,
+    const std::string & topic,
+    const rclcpp::QoS & qos,
+    TopicHub & hub = TopicHub::getSingleton())
+  : node_(node), topic_(topic), qos_(qos), hub_(hub)
+  {
+    subscribe();
+  }
+
+  /// Attach to the shared subscription again after unsubscribe().
+  void subscribe()
+  {
+    auto node = node_.lock();
+    if (!node || connection_.isConnected()) {
+      return;
+    }
+    connection_ = hub_.subscribe<MessageType>(
+      node, topic_, qos_,
+      [this](const typename MessageType::ConstSharedPtr message) {this->signalMessage(message);});
+  }
+
+  /// Stop receiving messages. The subscription is only destroyed with its last consumer.
+  void unsubscribe()
+  {
+    connection_.disconnect();
+  }
+
+  std::string getTopic() const
+  {
+    return topic_;
+  }
+
+  /// The subscription shared with the other consumers of the topic.
+  typename rclcpp::Subscription<MessageType>::SharedPtr getSubscriber() const
+  {
+    return std::dynamic_pointer_cast<rclcpp::Subscription<MessageType>>(
+      connection_.getSubscription());
+  }
+
+private:
+  rclcpp::Node::WeakPtr node_;
+  std::string topic_;
+  rclcpp::QoS qos_;
+  TopicHub & hub_;
+  TopicHub::Connection connection_;
+};
+
+}  // namespace ros_integration
+}  // namespace rviz_common
+
+#endif  // RVIZ_COMMON__ROS_INTEGRATION__TOPIC_HUB_SUBSCRIBER_HPP_
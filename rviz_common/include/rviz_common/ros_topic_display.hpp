@@ -33,7 +33,9 @@
 
 #ifndef Q_MOC_RUN
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -47,10 +49,12 @@
 #include "rviz_common/display.hpp"
 #include "rviz_common/display_context.hpp"
 #include "frame_manager_iface.hpp"
+#include "rviz_common/properties/bool_property.hpp"
 #include "rviz_common/properties/ros_topic_property.hpp"
 #include "rviz_common/properties/qos_profile_property.hpp"
 #include "rviz_common/properties/status_property.hpp"
 #include "rviz_common/ros_integration/ros_node_abstraction_iface.hpp"
+#include "rviz_common/ros_integration/topic_hub.hpp"
 #include "rviz_common/visibility_control.hpp"
 
 // Required, in combination with
@@ -72,7 +76,9 @@ class RVIZ_COMMON_PUBLIC _RosTopicDisplay : public Display
 public:
   _RosTopicDisplay()
   : rviz_ros_node_(),
-    qos_profile(5)
+    qos_profile(5),
+    conflate_(false),
+    messages_dropped_(0)
   {
     qRegisterMetaType<std::shared_ptr<const void>>();
 
@@ -81,6 +87,12 @@ public:
       "", "", this, SLOT(updateTopic()));
 
     qos_profile_property_ = new properties::QosProfileProperty(topic_property_, qos_profile);
+
+    conflate_property_ = new properties::BoolProperty(
+      "Conflate", false,
+      "Only process the newest message received since the last update and drop older ones. "
+      "Keeps high rate topics from delaying the display.",
+      topic_property_, SLOT(updateConflate()), this);
   }
 
   /**
@@ -114,6 +126,14 @@ public:
       Qt::QueuedConnection);
   }
 
+  void reset() override
+  {
+    Display::reset();
+    std::lock_guard<std::mutex> lock(mailbox_mutex_);
+    mailbox_.reset();
+    messages_dropped_ = 0;
+  }
+
 Q_SIGNALS:
   void typeErasedMessageTaken(std::shared_ptr<const void> type_erased_message);
 
@@ -131,7 +151,88 @@ protected Q_SLOTS:
   }
   virtual void updateTopic() = 0;
 
+  void updateConflate()
+  {
+    conflate_ = conflate_property_->getBool();
+    if (!conflate_) {
+      deleteStatus("Conflation");
+    }
+  }
+
+  /// Pass the message in the mailbox to processTypeErasedMessage().
+  void processMailbox()
+  {
+    std::shared_ptr<const void> type_erased_message;
+    {
+      std::lock_guard<std::mutex> lock(mailbox_mutex_);
+      type_erased_message = std::move(mailbox_);
+    }
+    if (type_erased_message) {
+      processTypeErasedMessage(type_erased_message);
+    }
+  }
+
 protected:
+  /// Put the message into the single slot mailbox if the display conflates messages.
+  /**
+   * A message still waiting in the mailbox is replaced and counted as dropped. The mailbox
+   * is emptied once per run of the main thread's event loop, so at most one message per
+   * update is processed, no matter how fast messages arrive.
+   *
+   * \note This function can be called from any thread.
+   * \return true if the message will be passed to processTypeErasedMessage() from the
+   *   main thread, false if conflation is disabled and the caller has to process it.
+   */
+  bool conflateMessage(std::shared_ptr<const void> type_erased_message)
+  {
+    if (!conflate_) {
+      return false;
+    }
+
+    if (postToMailbox(std::move(type_erased_message))) {
+      ++messages_dropped_;
+      requestStatusUpdate();
+    }
+    return true;
+  }
+
+  /// Put the message into the single slot mailbox, regardless of the "Conflate" option.
+  /**
+   * \note This function can be called from any thread.
+   * \return true if a message still waiting in the mailbox was replaced
+   */
+  bool postToMailbox(std::shared_ptr<const void> type_erased_message)
+  {
+    bool mailbox_was_empty;
+    {
+      std::lock_guard<std::mutex> lock(mailbox_mutex_);
+      mailbox_was_empty = !mailbox_;
+      mailbox_ = std::move(type_erased_message);
+    }
+    if (mailbox_was_empty) {
+      QMetaObject::invokeMethod(this, "processMailbox", Qt::QueuedConnection);
+    }
+    return !mailbox_was_empty;
+  }
+
+  /// Number of messages replaced in the mailbox by conflateMessage() since the last reset().
+  uint32_t getDroppedMessageCount() const
+  {
+    return messages_dropped_;
+  }
+
+  void updateStatuses() override
+  {
+    Display::updateStatuses();
+
+    const uint32_t messages_dropped = getDroppedMessageCount();
+    if (conflate_ && messages_dropped > 0) {
+      setStatus(
+        properties::StatusProperty::Ok, "Conflation",
+        QString::number(messages_dropped) + " outdated messages dropped");
+    }
+  }
+
   /** @brief A Node which is registered with the main executor (used in the "update" thread).
    *
    * This is configured after the constructor within the initialize() method of Display. */
@@ -139,6 +240,13 @@ protected:
   rclcpp::QoS qos_profile;
   properties::RosTopicProperty * topic_property_;
   properties::QosProfileProperty * qos_profile_property_;
+  properties::BoolProperty * conflate_property_;
+
+private:
+  std::atomic<bool> conflate_;
+  std::mutex mailbox_mutex_;
+  std::shared_ptr<const void> mailbox_;
+  std::atomic<uint32_t> messages_dropped_;
 };
 
 /** @brief Display subclass using a rclcpp::subscription, templated on the ROS message type.
@@ -170,7 +278,7 @@ public:
 
   void reset() override
   {
-    Display::reset();
+    _RosTopicDisplay::reset();
     messages_received_ = 0;
   }
 
@@ -204,25 +312,24 @@ protected:
     }
 
     try {
-      rclcpp::SubscriptionOptions sub_opts;
-      sub_opts.event_callbacks.message_lost_callback =
-        [&](rclcpp::QOSMessageLostInfo & info)
+      // Displays of the same topic share one subscription, so each message is only
+      // received and deserialized once.
+      rclcpp::Node::SharedPtr node = rviz_ros_node_.lock()->get_raw_node();
+      topic_hub_connection_ = ros_integration::TopicHub::getSingleton().subscribe<MessageType>(
+        node,
+        topic_property_->getTopicStd(),
+        qos_profile,
+        [this](const typename MessageType::ConstSharedPtr message) {incomingMessage(message);},
+        [this](rclcpp::QOSMessageLostInfo & info)
         {
           std::ostringstream sstm;
           sstm << "Some messages were lost:\n>\tNumber of new lost messages: " <<
             info.total_count_change << " \n>\tTotal number of messages lost: " <<
             info.total_count;
           setStatus(properties::StatusProperty::Warn, "Topic", QString(sstm.str().c_str()));
-        };
-
-      // TODO(anhosi,wjwwood): replace with abstraction for subscriptions once available
-      rclcpp::Node::SharedPtr node = rviz_ros_node_.lock()->get_raw_node();
-      subscription_ =
-        node->template create_subscription<MessageType>(
-        topic_property_->getTopicStd(),
-        qos_profile,
-        [this](const typename MessageType::ConstSharedPtr message) {incomingMessage(message);},
-        sub_opts);
+        });
+      subscription_ = std::dynamic_pointer_cast<rclcpp::Subscription<MessageType>>(
+        topic_hub_connection_.getSubscription());
       subscription_start_time_ = node->now();
       setStatus(properties::StatusProperty::Ok, "Topic", "OK");
     } catch (rclcpp::exceptions::InvalidTopicNameError & e) {
@@ -234,6 +341,7 @@ protected:
 
   virtual void unsubscribe()
   {
+    topic_hub_connection_.disconnect();
     subscription_.reset();
   }
 
@@ -263,7 +371,32 @@ protected:
     }
 
     ++messages_received_;
-    QString topic_str = QString::number(messages_received_) + " messages received";
+    requestStatusUpdate();
+
+    if (conflateMessage(msg)) {
+      return;
+    }
+
+    processMessage(msg);
+    context_->queueRender();
+  }
+
+  /// Process a message taken from the mailbox, see conflateMessage().
+  void processTypeErasedMessage(std::shared_ptr<const void> type_erased_message) override
+  {
+    processMessage(std::static_pointer_cast<const MessageType>(type_erased_message));
+    context_->queueRender();
+  }
+
+  void updateStatuses() override
+  {
+    _RosTopicDisplay::updateStatuses();
+
+    const uint32_t messages_received = messages_received_;
+    if (messages_received == 0) {
+      return;
+    }
+    QString topic_str = QString::number(messages_received) + " messages received";
     // Append topic subscription frequency if we can lock rviz_ros_node_.
     std::shared_ptr<ros_integration::RosNodeAbstractionIface> node_interface =
       rviz_ros_node_.lock();
@@ -271,15 +404,13 @@ protected:
       const double duration =
         (node_interface->get_raw_node()->now() - subscription_start_time_).seconds();
       const double subscription_frequency =
-        static_cast<double>(messages_received_) / duration;
+        static_cast<double>(messages_received) / duration;
       topic_str += " at " + QString::number(subscription_frequency, 'f', 1) + " hz.";
     }
     setStatus(
       properties::StatusProperty::Ok,
       "Topic",
       topic_str);
-
-    processMessage(msg);
   }
 
   /** @brief Implement this to process the contents of a message.
@@ -287,9 +418,14 @@ protected:
    * This is called by incomingMessage(). */
   virtual void processMessage(typename MessageType::ConstSharedPtr msg) = 0;
 
+  /// The subscription, which is shared with the other displays of the same topic.
+  /**
+   * Resetting it does not stop the display from receiving messages, use unsubscribe() instead.
+   */
   typename rclcpp::Subscription<MessageType>::SharedPtr subscription_;
+  ros_integration::TopicHub::Connection topic_hub_connection_;
   rclcpp::Time subscription_start_time_;
-  uint32_t messages_received_;
+  std::atomic<uint32_t> messages_received_;
 };
 
 }  // end namespace rviz_common
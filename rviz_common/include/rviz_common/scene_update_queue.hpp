@@ -0,0 +1,80 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_COMMON__SCENE_UPDATE_QUEUE_HPP_
+#define RVIZ_COMMON__SCENE_UPDATE_QUEUE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "rviz_common/visibility_control.hpp"
+
+namespace rviz_common
+{
+
+/// Double-buffered queue of changes to the scene, applied by the render loop between frames.
+/**
+ * Threads which prepare data in the background post the calls which apply the result
+ * to the scene, instead of locking the render mutex themselves. Posting only appends to
+ * the back buffer. The render loop swaps the buffers and applies the front buffer without
+ * holding the lock, so posting threads never wait for a frame and the scene never sees
+ * half of a change.
+ */
+class RVIZ_COMMON_PUBLIC SceneUpdateQueue
+{
+public:
+  using SceneUpdate = std::function<void ()>;
+
+  SceneUpdateQueue() = default;
+
+  /// Queue an update. Can be called from any thread.
+  void post(SceneUpdate update);
+
+  /// Apply all updates posted so far, in the order they were posted.
+  /**
+   * Only call from the thread which renders. Updates posted while applying are
+   * applied by the next call.
+   * \return number of applied updates
+   */
+  size_t apply();
+
+  bool empty() const;
+
+private:
+  mutable std::mutex mutex_;
+  std::vector<SceneUpdate> back_buffer_;
+  std::vector<SceneUpdate> front_buffer_;
+};
+
+}  // namespace rviz_common
+
+#endif  // RVIZ_COMMON__SCENE_UPDATE_QUEUE_HPP_
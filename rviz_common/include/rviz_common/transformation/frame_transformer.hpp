@@ -33,6 +33,7 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -43,6 +44,7 @@
 #include <QString>  // NOLINT
 
 #include "geometry_msgs/msg/pose_stamped.hpp"
+#include "geometry_msgs/msg/transform_stamped.hpp"
 
 #include "rviz_common/ros_integration/ros_node_abstraction.hpp"
 #include "rviz_common/visibility_control.hpp"
@@ -117,6 +119,35 @@ public:
   bool
   frameHasProblems(const std::string & frame, std::string & error) const = 0;
 
+  /// Look up the transforms of several frames in the same target frame.
+  /**
+   * Implementations may share the work common to all source frames, e.g. walking the path
+   * of the target frame. The default implementation looks up each frame on its own.
+   *
+   * \param target_frame The frame into which to transform
+   * \param source_frames The frames to transform
+   * \param time The time at which to look up the transforms, zero for the latest
+   * eturns For each source frame the transform, or nothing if it cannot be transformed
+   */
+  virtual
+  std::vector<std::optional<geometry_msgs::msg::TransformStamped>>
+  lookupTransforms(
+    const std::string & target_frame,
+    const std::vector<std::string> & source_frames,
+    const tf2::TimePoint & time) const
+  {
+    std::vector<std::optional<geometry_msgs::msg::TransformStamped>> transforms;
+    transforms.reserve(source_frames.size());
+    for (const auto & source_frame : source_frames) {
+      try {
+        transforms.emplace_back(lookupTransform(target_frame, source_frame, time));
+      } catch (const tf2::TransformException &) {
+        transforms.emplace_back(std::nullopt);
+      }
+    }
+    return transforms;
+  }
+
   /// Return the class id set by the PluginlibFactory.
   virtual
   QString
@@ -34,6 +34,7 @@
 
 #include <chrono>
 #include <deque>
+#include <functional>
 #include <memory>
 
 #include "rclcpp/clock.hpp"
@@ -44,7 +45,9 @@
 #include "rviz_common/config.hpp"
 #include "rviz_common/display_context.hpp"
 #include "rviz_common/frame_manager_iface.hpp"
+#include "rviz_common/render_scheduler.hpp"
 #include "rviz_common/ros_integration/ros_node_abstraction_iface.hpp"
+#include "rviz_common/scene_update_queue.hpp"
 #include "rviz_common/transformation/transformation_manager.hpp"
 
 class QTimer;
@@ -61,7 +64,9 @@ namespace rviz_common
 namespace properties
 {
 
+class BoolProperty;
 class ColorProperty;
+class FloatProperty;
 class IntProperty;
 class Property;
 class PropertyTreeModel;
@@ -239,6 +244,12 @@ public:
   /// Unlock a mutex, allowing calls to Ogre::Root::renderOneFrame().
   void unlockRender() override;
 
+  /// Queue a change to the scene, applied right before the next frame is rendered.
+  /**
+   * \note This function can be called from any thread.
+   */
+  void queueSceneUpdate(std::function<void()> update) override;
+
   /// Queues a render.
   /**
    * Multiple calls before a render happens will only cause a single render.
@@ -336,6 +347,9 @@ protected:
 
   void updateFrames();
 
+  /// Report how many update cycles were rendered since the last report, in on demand mode.
+  void reportRenderStatistics();
+
   /// Ogre Root.
   Ogre::Root * ogre_root_;
 
@@ -359,6 +373,11 @@ protected:
   properties::TfFrameProperty * fixed_frame_property_;
   properties::StatusList * global_status_;
   properties::IntProperty * fps_property_;
+  properties::BoolProperty * render_on_demand_property_;
+  properties::FloatProperty * idle_render_rate_property_;
+  properties::BoolProperty * order_independent_transparency_property_;
+  properties::IntProperty * point_budget_property_;
+  properties::BoolProperty * render_thread_property_;
 
   RenderPanel * render_panel_;
 
@@ -377,7 +396,10 @@ protected:
   std::shared_ptr<rviz_common::interaction::SelectionManagerIface> selection_manager_;
   std::shared_ptr<rviz_common::interaction::ViewPickerIface> view_picker_;
 
-  uint32_t render_requested_;
+  RenderScheduler render_scheduler_;
+  SceneUpdateQueue scene_update_queue_;
+  uint64_t reported_rendered_cycles_;
+  uint64_t reported_skipped_cycles_;
   uint64_t frame_count_;
 
   WindowManagerInterface * window_manager_;
@@ -393,6 +415,10 @@ private Q_SLOTS:
   void updateFixedFrame();
   void updateBackgroundColor();
   void updateFps();
+  void updateRenderOnDemand();
+  void updateOrderIndependentTransparency();
+  void updatePointBudget();
+  void updateRenderThread();
 
 private:
   DisplayFactory * display_factory_;
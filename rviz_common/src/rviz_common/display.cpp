@@ -42,6 +42,8 @@
 #include <QDockWidget>  // NOLINT: cpplint is unable to handle the include order here
 #include <QFont>  // NOLINT: cpplint is unable to handle the include order here
 #include <QMetaObject>  // NOLINT: cpplint is unable to handle the include order here
+#include <QThread>  // NOLINT: cpplint is unable to handle the include order here
+#include <QTimer>  // NOLINT: cpplint is unable to handle the include order here
 #include <QWidget>  // NOLINT: cpplint is unable to handle the include order here
 
 #include "rclcpp/time.hpp"
@@ -58,10 +60,20 @@
 namespace rviz_common
 {
 
+namespace
+{
+
+const std::chrono::milliseconds kStatusFlushInterval(250);
+
+}  // namespace
+
 Display::Display()
 : context_(nullptr),
   scene_node_(nullptr),
   status_(nullptr),
+  pending_statuses_clear_(false),
+  status_flush_requested_(false),
+  updating_statuses_(false),
   initialized_(false),
   visibility_bits_(0xFFFFFFFF),
   associated_widget_(nullptr),
@@ -193,11 +205,11 @@ void Display::setStatus(
   const QString & name,
   const QString & text)
 {
-  QMetaObject::invokeMethod(
-    this, "setStatusInternal", Qt::QueuedConnection,
-    Q_ARG(int, level),
-    Q_ARG(QString, name),
-    Q_ARG(QString, text));
+  {
+    std::lock_guard<std::mutex> lock(pending_statuses_mutex_);
+    pending_statuses_[name] = PendingStatus{false, level, text};
+  }
+  requestStatusFlush();
 }
 
 void Display::setStatusStd(
@@ -246,8 +258,11 @@ void Display::setStatusInternal(int level, const QString & name, const QString &
 
 void Display::deleteStatus(const QString & name)
 {
-  QMetaObject::invokeMethod(
-    this, "deleteStatusInternal", Qt::QueuedConnection, Q_ARG(QString, name));
+  {
+    std::lock_guard<std::mutex> lock(pending_statuses_mutex_);
+    pending_statuses_[name] = PendingStatus{true, 0, QString()};
+  }
+  requestStatusFlush();
 }
 
 void Display::deleteStatusInternal(const QString & name)
@@ -259,7 +274,75 @@ void Display::deleteStatusInternal(const QString & name)
 
 void Display::clearStatuses()
 {
-  QMetaObject::invokeMethod(this, "clearStatusesInternal", Qt::QueuedConnection);
+  {
+    std::lock_guard<std::mutex> lock(pending_statuses_mutex_);
+    pending_statuses_.clear();
+    pending_statuses_clear_ = true;
+  }
+  requestStatusFlush();
+}
+
+void Display::requestStatusUpdate()
+{
+  requestStatusFlush();
+}
+
+void Display::updateStatuses()
+{
+}
+
+void Display::requestStatusFlush()
+{
+  // Statuses set by updateStatuses() are shown by the running flush.
+  if (updating_statuses_ && QThread::currentThread() == thread()) {
+    return;
+  }
+  if (!status_flush_requested_.exchange(true)) {
+    QMetaObject::invokeMethod(this, "scheduleStatusFlush", Qt::QueuedConnection);
+  }
+}
+
+void Display::scheduleStatusFlush()
+{
+  auto elapsed = std::chrono::steady_clock::now() - last_status_flush_;
+  if (elapsed >= kStatusFlushInterval) {
+    flushStatuses();
+  } else {
+    auto remaining =
+      std::chrono::duration_cast<std::chrono::milliseconds>(kStatusFlushInterval - elapsed);
+    QTimer::singleShot(static_cast<int>(remaining.count()), this, SLOT(flushStatuses()));
+  }
+}
+
+void Display::flushStatuses()
+{
+  last_status_flush_ = std::chrono::steady_clock::now();
+  // Requests from now on need another flush.
+  status_flush_requested_ = false;
+
+  updating_statuses_ = true;
+  updateStatuses();
+  updating_statuses_ = false;
+
+  QMap<QString, PendingStatus> pending_statuses;
+  bool clear;
+  {
+    std::lock_guard<std::mutex> lock(pending_statuses_mutex_);
+    pending_statuses.swap(pending_statuses_);
+    clear = pending_statuses_clear_;
+    pending_statuses_clear_ = false;
+  }
+
+  if (clear) {
+    clearStatusesInternal();
+  }
+  for (auto it = pending_statuses.cbegin(); it != pending_statuses.cend(); ++it) {
+    if (it->deleted) {
+      deleteStatusInternal(it.key());
+    } else {
+      setStatusInternal(it->level, it.key(), it->text);
+    }
+  }
 }
 
 void Display::clearStatusesInternal()
@@ -122,7 +122,11 @@ void StatusList::setLevel(Level new_level)
 
 void StatusList::updateLabel()
 {
-  StatusProperty::setName(name_prefix_ + ": " + statusWord(getLevel()));
+  // Property::setName() always notifies the model, avoid redrawing the tree for nothing.
+  QString label = name_prefix_ + ": " + statusWord(getLevel());
+  if (label != getName()) {
+    StatusProperty::setName(label);
+  }
 }
 
 }  // namespace properties
@@ -0,0 +1,73 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_common/render_scheduler.hpp"
+
+namespace rviz_common
+{
+
+RenderScheduler::RenderScheduler()
+: on_demand_(false),
+  idle_period_(0),
+  render_requested_(true),
+  rendered_cycles_(0),
+  skipped_cycles_(0)
+{}
+
+void RenderScheduler::setOnDemand(bool on_demand)
+{
+  on_demand_ = on_demand;
+  render_requested_ = true;
+}
+
+void RenderScheduler::setIdleRate(float rate)
+{
+  idle_period_ = rate > 0.0f ? static_cast<uint64_t>(1000000000 / rate) : 0;
+}
+
+void RenderScheduler::queueRender()
+{
+  render_requested_ = true;
+}
+
+bool RenderScheduler::beginCycle(uint64_t wall_dt)
+{
+  bool heartbeat_due = idle_period_ > 0 && wall_dt >= idle_period_;
+  if (on_demand_ && !render_requested_ && !heartbeat_due) {
+    ++skipped_cycles_;
+    return false;
+  }
+
+  render_requested_ = false;
+  ++rendered_cycles_;
+  return true;
+}
+
+}  // namespace rviz_common
@@ -0,0 +1,158 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_common/render_thread.hpp"
+
+#include <mutex>
+#include <utility>
+
+namespace rviz_common
+{
+
+RenderThread::RenderThread(std::recursive_mutex & scene_mutex, Callbacks callbacks)
+: scene_mutex_(scene_mutex),
+  callbacks_(std::move(callbacks)),
+  owner_has_scene_(false),
+  frame_requested_(false),
+  rendering_(false),
+  stopping_(false),
+  rendered_frames_(0)
+{}
+
+RenderThread::~RenderThread()
+{
+  stop();
+}
+
+void RenderThread::start()
+{
+  if (isRunning()) {
+    return;
+  }
+  // The owner is working right now, it already has the GL context
+  scene_mutex_.lock();
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    owner_has_scene_ = true;
+    stopping_ = false;
+  }
+  thread_ = std::thread(&RenderThread::run, this);
+}
+
+void RenderThread::stop()
+{
+  if (!isRunning()) {
+    return;
+  }
+  acquireScene();
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    stopping_ = true;
+  }
+  state_changed_.notify_all();
+  thread_.join();
+
+  // Without the render thread the owner keeps the context, but not the lock
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  owner_has_scene_ = false;
+  scene_mutex_.unlock();
+}
+
+void RenderThread::releaseScene()
+{
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (!owner_has_scene_) {
+      return;
+    }
+    owner_has_scene_ = false;
+  }
+  callbacks_.release_context();
+  scene_mutex_.unlock();
+  state_changed_.notify_all();
+}
+
+void RenderThread::acquireScene()
+{
+  {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    if (owner_has_scene_) {
+      return;
+    }
+    state_changed_.wait(lock, [this]() {return !rendering_;});
+    owner_has_scene_ = true;
+  }
+  scene_mutex_.lock();
+  callbacks_.acquire_context();
+}
+
+void RenderThread::requestFrame()
+{
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    frame_requested_ = true;
+  }
+  state_changed_.notify_all();
+}
+
+uint64_t RenderThread::getRenderedFrames() const
+{
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  return rendered_frames_;
+}
+
+void RenderThread::run()
+{
+  std::unique_lock<std::mutex> lock(state_mutex_);
+  while (true) {
+    state_changed_.wait(
+      lock, [this]() {return stopping_ || (frame_requested_ && !owner_has_scene_);});
+    if (stopping_) {
+      return;
+    }
+    frame_requested_ = false;
+    rendering_ = true;
+    lock.unlock();
+
+    {
+      std::lock_guard<std::recursive_mutex> scene_lock(scene_mutex_);
+      callbacks_.acquire_context();
+      callbacks_.render_frame();
+      callbacks_.release_context();
+    }
+
+    lock.lock();
+    rendering_ = false;
+    ++rendered_frames_;
+    state_changed_.notify_all();
+  }
+}
+
+}  // namespace rviz_common
@@ -0,0 +1,266 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_common/ros_integration/topic_hub.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace rviz_common
+{
+namespace ros_integration
+{
+
+struct TopicHub::Channel
+{
+  struct Consumer
+  {
+    uint64_t id;
+    TypeErasedCallback callback;
+    MessageLostCallback message_lost_callback;
+  };
+  using Consumers = std::vector<std::shared_ptr<const Consumer>>;
+
+  Channel(
+    const rclcpp::Node::SharedPtr & node,
+    const std::string & topic,
+    const std::string & message_type,
+    const rclcpp::QoS & qos)
+  : node(node), topic(topic), message_type(message_type), qos(qos),
+    consumers(std::make_shared<Consumers>())
+  {}
+
+  bool matches(
+    const rclcpp::Node::SharedPtr & other_node,
+    const std::string & other_topic,
+    const std::string & other_message_type,
+    const rclcpp::QoS & other_qos) const
+  {
+    return node.lock() == other_node && topic == other_topic &&
+           message_type == other_message_type && qos == other_qos;
+  }
+
+  // Consumers are replaced instead of modified, so dispatching only has to hold the lock
+  // while copying the pointer and a consumer can disconnect from within its callback.
+  std::shared_ptr<const Consumers> getConsumers() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return consumers;
+  }
+
+  void dispatch(const std::shared_ptr<const void> & message) const
+  {
+    for (const auto & consumer : *getConsumers()) {
+      consumer->callback(message);
+    }
+  }
+
+  void dispatchMessageLost(rclcpp::QOSMessageLostInfo & info) const
+  {
+    for (const auto & consumer : *getConsumers()) {
+      if (consumer->message_lost_callback) {
+        consumer->message_lost_callback(info);
+      }
+    }
+  }
+
+  std::weak_ptr<rclcpp::Node> node;
+  std::string topic;
+  std::string message_type;
+  rclcpp::QoS qos;
+
+  mutable std::mutex mutex;
+  std::shared_ptr<const Consumers> consumers;
+  uint64_t next_consumer_id = 0;
+
+  rclcpp::SubscriptionBase::SharedPtr subscription;
+};
+
+TopicHub::Connection::Connection(
+  TopicHub * hub, std::weak_ptr<Channel> channel, uint64_t consumer_id)
+: hub_(hub), channel_(std::move(channel)), consumer_id_(consumer_id)
+{}
+
+TopicHub::Connection::Connection(Connection && other) noexcept
+: hub_(other.hub_), channel_(std::move(other.channel_)), consumer_id_(other.consumer_id_)
+{
+  other.hub_ = nullptr;
+}
+
+TopicHub::Connection & TopicHub::Connection::operator=(Connection && other) noexcept
+{
+  if (this != &other) {
+    disconnect();
+    hub_ = other.hub_;
+    channel_ = std::move(other.channel_);
+    consumer_id_ = other.consumer_id_;
+    other.hub_ = nullptr;
+  }
+  return *this;
+}
+
+TopicHub::Connection::~Connection()
+{
+  disconnect();
+}
+
+void TopicHub::Connection::disconnect()
+{
+  auto channel = channel_.lock();
+  if (hub_ && channel) {
+    hub_->disconnect(channel, consumer_id_);
+  }
+  hub_ = nullptr;
+  channel_.reset();
+}
+
+bool TopicHub::Connection::isConnected() const
+{
+  return hub_ != nullptr && !channel_.expired();
+}
+
+rclcpp::SubscriptionBase::SharedPtr TopicHub::Connection::getSubscription() const
+{
+  auto channel = channel_.lock();
+  if (!hub_ || !channel) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(hub_->mutex_);
+  return channel->subscription;
+}
+
+TopicHub & TopicHub::getSingleton()
+{
+  // Never destroyed, so that displays destroyed during static destruction can still disconnect.
+  static auto hub = new TopicHub();
+  return *hub;
+}
+
+size_t TopicHub::getSubscriptionCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return channels_.size();
+}
+
+size_t TopicHub::getConsumerCount(const std::string & topic) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t consumer_count = 0;
+  for (const auto & channel : channels_) {
+    if (channel->topic == topic) {
+      consumer_count += channel->getConsumers()->size();
+    }
+  }
+  return consumer_count;
+}
+
+TopicHub::Connection TopicHub::connect(
+  const rclcpp::Node::SharedPtr & node,
+  const std::string & topic,
+  const std::string & message_type,
+  const rclcpp::QoS & qos,
+  const SubscriptionFactory & create_subscription,
+  TypeErasedCallback callback,
+  MessageLostCallback message_lost_callback)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Late joiners need a subscription of their own to receive the latched messages.
+  const bool shareable =
+    qos.get_rmw_qos_profile().durability != RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  auto it = !shareable ? channels_.end() : std::find_if(
+    channels_.begin(), channels_.end(), [&](const std::shared_ptr<Channel> & channel) {
+      return channel->matches(node, topic, message_type, qos);
+    });
+
+  std::shared_ptr<Channel> channel;
+  if (it != channels_.end()) {
+    channel = *it;
+  } else {
+    channel = std::make_shared<Channel>(node, topic, message_type, qos);
+    std::weak_ptr<Channel> weak_channel = channel;
+    // May throw, in which case the channel is never registered.
+    channel->subscription = create_subscription(
+      [weak_channel](const std::shared_ptr<const void> & message) {
+        if (auto locked_channel = weak_channel.lock()) {
+          locked_channel->dispatch(message);
+        }
+      },
+      [weak_channel](rclcpp::QOSMessageLostInfo & info) {
+        if (auto locked_channel = weak_channel.lock()) {
+          locked_channel->dispatchMessageLost(info);
+        }
+      });
+    channels_.push_back(channel);
+  }
+
+  std::lock_guard<std::mutex> channel_lock(channel->mutex);
+  auto consumers = std::make_shared<Channel::Consumers>(*channel->consumers);
+  const uint64_t consumer_id = channel->next_consumer_id++;
+  consumers->push_back(
+    std::make_shared<const Channel::Consumer>(
+      Channel::Consumer{consumer_id, std::move(callback), std::move(message_lost_callback)}));
+  channel->consumers = consumers;
+
+  return Connection(this, channel, consumer_id);
+}
+
+void TopicHub::disconnect(const std::shared_ptr<Channel> & channel, uint64_t consumer_id)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool channel_unused = false;
+  {
+    std::lock_guard<std::mutex> channel_lock(channel->mutex);
+    auto consumers = std::make_shared<Channel::Consumers>(*channel->consumers);
+    consumers->erase(
+      std::remove_if(
+        consumers->begin(), consumers->end(),
+        [consumer_id](const std::shared_ptr<const Channel::Consumer> & consumer) {
+          return consumer->id == consumer_id;
+        }),
+      consumers->end());
+    channel_unused = consumers->empty();
+    channel->consumers = consumers;
+  }
+
+  if (channel_unused) {
+    channel->subscription.reset();
+    channels_.erase(std::remove(channels_.begin(), channels_.end(), channel), channels_.end());
+  }
+}
+
+}  // namespace ros_integration
+}  // namespace rviz_common
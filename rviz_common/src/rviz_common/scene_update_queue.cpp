@@ -0,0 +1,66 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_common/scene_update_queue.hpp"
+
+#include <utility>
+
+namespace rviz_common
+{
+
+void SceneUpdateQueue::post(SceneUpdate update)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  back_buffer_.push_back(std::move(update));
+}
+
+size_t SceneUpdateQueue::apply()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // keeps the capacity of both buffers, so posting rarely allocates
+    front_buffer_.swap(back_buffer_);
+  }
+
+  for (auto & update : front_buffer_) {
+    update();
+  }
+  size_t applied = front_buffer_.size();
+  front_buffer_.clear();
+  return applied;
+}
+
+bool SceneUpdateQueue::empty() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return back_buffer_.empty();
+}
+
+}  // namespace rviz_common
@@ -37,6 +37,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <OgreCamera.h>
@@ -50,6 +51,7 @@
 #include <OgreSharedPtr.h>
 #include <OgreViewport.h>
 
+#include <QAbstractEventDispatcher>  // NOLINT: cpplint cannot handle include order here
 #include <QApplication>  // NOLINT: cpplint cannot handle include order here
 #include <QCursor>  // NOLINT: cpplint cannot handle include order here
 #include <QKeyEvent>  // NOLINT: cpplint cannot handle include order here
@@ -59,7 +61,9 @@
 #include "rclcpp/clock.hpp"
 #include "rclcpp/time.hpp"
 #include "rviz_rendering/material_manager.hpp"
+#include "rviz_rendering/objects/point_budget.hpp"
 #include "rviz_rendering/render_window.hpp"
+#include "rviz_rendering/weighted_blended_transparency.hpp"
 
 #include "rviz_common/display.hpp"
 #include "./display_factory.hpp"
@@ -67,7 +71,9 @@
 #include "./displays_panel.hpp"
 #include "frame_manager.hpp"
 #include "rviz_common/load_resource.hpp"
+#include "rviz_common/properties/bool_property.hpp"
 #include "rviz_common/properties/color_property.hpp"
+#include "rviz_common/properties/float_property.hpp"
 #include "rviz_common/properties/int_property.hpp"
 #include "rviz_common/properties/parse_color.hpp"
 #include "rviz_common/properties/property.hpp"
@@ -75,6 +81,7 @@
 #include "rviz_common/properties/status_list.hpp"
 #include "rviz_common/properties/tf_frame_property.hpp"
 #include "rviz_common/render_panel.hpp"
+#include "rviz_common/render_thread.hpp"
 #include "rviz_common/interaction/handler_manager.hpp"
 #include "rviz_common/interaction/handler_manager_iface.hpp"
 #include "rviz_common/interaction/selection_manager.hpp"
@@ -89,7 +96,9 @@
 namespace rviz_common
 {
 
+using rviz_common::properties::BoolProperty;
 using rviz_common::properties::ColorProperty;
+using rviz_common::properties::FloatProperty;
 using rviz_common::properties::IntProperty;
 using rviz_common::properties::PropertyTreeModel;
 using rviz_common::properties::StatusList;
@@ -126,7 +135,11 @@ private:
 class VisualizationManagerPrivate
 {
 public:
-  std::mutex render_mutex_;
+  // recursive, as the GUI thread holds it all the time while the render thread is running
+  std::recursive_mutex render_mutex_;
+  std::unique_ptr<RenderThread> render_thread_;
+  QMetaObject::Connection about_to_block_connection_;
+  QMetaObject::Connection awake_connection_;
 };
 
 VisualizationManager::VisualizationManager(
@@ -141,7 +154,8 @@ VisualizationManager::VisualizationManager(
   ros_time_elapsed_(0),
   time_update_timer_(0.0f),
   frame_update_timer_(0.0f),
-  render_requested_(1),
+  reported_rendered_cycles_(0),
+  reported_skipped_cycles_(0),
   frame_count_(0),
   window_manager_(wm),
   clock_(clock),
@@ -168,6 +182,11 @@ VisualizationManager::VisualizationManager(
   display_property_tree_model_ = new PropertyTreeModel(root_display_group_);
   display_property_tree_model_->setDragDropClass("display");
   connect(display_property_tree_model_, SIGNAL(configChanged()), this, SIGNAL(configChanged()));
+  // Any change of a display property may change the scene
+  connect(
+    display_property_tree_model_, &PropertyTreeModel::configChanged, this, [this]() {
+      queueRender();
+    });
 
   tool_manager_ = new ToolManager(this);
   connect(tool_manager_, SIGNAL(configChanged()), this, SIGNAL(configChanged()));
@@ -198,16 +217,54 @@ VisualizationManager::VisualizationManager(
     "RViz will try to render this many frames per second.",
     global_options_, SLOT(updateFps()), this);
 
+  render_on_demand_property_ = new BoolProperty(
+    "Render On Demand", false,
+    "Only update displays and render when something changed, e.g. a message arrived or the "
+    "view moved. Saves CPU and GPU time when the scene is mostly static.",
+    global_options_, SLOT(updateRenderOnDemand()), this);
+
+  idle_render_rate_property_ = new FloatProperty(
+    "Idle Render Rate", 1.0f,
+    "Rate in Hz at which an unchanged scene is still updated and rendered, to pick up changes "
+    "which do not request a render themselves, like moving transforms. 0 disables it.",
+    render_on_demand_property_, SLOT(updateRenderOnDemand()), this);
+  idle_render_rate_property_->setMin(0.0f);
+
+  order_independent_transparency_property_ = new BoolProperty(
+    "Order-Independent Transparency", false,
+    "Blend translucent point clouds and markers without sorting them by depth. Overlapping "
+    "translucent objects no longer flicker when the view moves, at the cost of an approximation "
+    "of their colors and of rendering into additional buffers.",
+    global_options_, SLOT(updateOrderIndependentTransparency()), this);
+
+  point_budget_property_ = new IntProperty(
+    "Point Budget", 10000000,
+    "Maximum number of points drawn per frame by all point cloud displays with Adaptive Level "
+    "of Detail together. 0 means unlimited.",
+    global_options_, SLOT(updatePointBudget()), this);
+  point_budget_property_->setMin(0);
+
+  render_thread_property_ = new BoolProperty(
+    "Render Thread", false,
+    "Experimental: render frames on a dedicated thread while the GUI thread is idle, so the GUI "
+    "thread does not wait for frames to be submitted and shown. The GUI thread still waits for "
+    "a frame in progress when it wakes up to handle an event.",
+    global_options_, SLOT(updateRenderThread()), this);
+
   root_display_group_->initialize(this);   // only initialize() a Display
                                            // after its sub-properties are created.
   root_display_group_->setEnabled(true);
 
   updateFixedFrame();
   updateBackgroundColor();
+  updatePointBudget();
 
   global_status_ = new StatusList("Global Status", root_display_group_);
   global_status_->setReadOnly(true);
 
+  updateRenderOnDemand();
+  updateOrderIndependentTransparency();
+
   rviz_rendering::MaterialManager::createDefaultColorMaterials();
 
   handler_manager_ = std::make_shared<HandlerManager>();
@@ -229,6 +286,22 @@ VisualizationManager::VisualizationManager(
 
   executor_->add_node(rviz_ros_node_.lock()->get_raw_node());
 
+  // Ogre only has one GL context per window, which the render system makes current on the
+  // thread that has the scene.
+  RenderThread::Callbacks render_thread_callbacks;
+  render_thread_callbacks.render_frame = [this]() {
+      scene_update_queue_.apply();
+      ogre_root_->renderOneFrame();
+    };
+  render_thread_callbacks.acquire_context = [this]() {
+      ogre_root_->getRenderSystem()->postExtraThreadsStarted();
+    };
+  render_thread_callbacks.release_context = [this]() {
+      ogre_root_->getRenderSystem()->preExtraThreadsStarted();
+    };
+  private_->render_thread_ =
+    std::make_unique<RenderThread>(private_->render_mutex_, render_thread_callbacks);
+
   display_factory_ = new DisplayFactory();
 
   update_timer_ = new QTimer;
@@ -237,6 +310,10 @@ VisualizationManager::VisualizationManager(
 
 VisualizationManager::~VisualizationManager()
 {
+  disconnect(private_->about_to_block_connection_);
+  disconnect(private_->awake_connection_);
+  private_->render_thread_->stop();
+
   delete update_timer_;
 
   shutting_down_ = true;
@@ -291,7 +368,13 @@ void VisualizationManager::stopUpdate()
 
 void VisualizationManager::queueRender()
 {
-  render_requested_ = 1;
+  render_scheduler_.queueRender();
+}
+
+void VisualizationManager::queueSceneUpdate(std::function<void()> update)
+{
+  scene_update_queue_.post(std::move(update));
+  queueRender();
 }
 
 WindowManagerInterface * VisualizationManager::getWindowManager() const
@@ -336,9 +419,17 @@ BitAllocator * VisualizationManager::visibilityBits()
 
 void VisualizationManager::onUpdate()
 {
+  // Displays queue a render when they process the messages received here
+  executor_->spin_some(std::chrono::milliseconds(10));
+
   const auto wall_now = std::chrono::system_clock::now();
   const auto wall_diff = wall_now - last_update_wall_time_;
   const uint64_t wall_dt = std::chrono::duration_cast<std::chrono::nanoseconds>(wall_diff).count();
+  if (!render_scheduler_.beginCycle(wall_dt)) {
+    // Nothing changed. The time of this cycle is passed to the next update instead.
+    return;
+  }
+
   const auto ros_now = clock_->now();
   const uint64_t ros_dt = ros_now.nanoseconds() - last_update_ros_time_.nanoseconds();
   last_update_ros_time_ = ros_now;
@@ -348,8 +439,6 @@ void VisualizationManager::onUpdate()
     resetTime();
   }
 
-  executor_->spin_some(std::chrono::milliseconds(10));
-
   Q_EMIT preUpdate();
 
   frame_manager_->update();
@@ -374,6 +463,7 @@ void VisualizationManager::onUpdate()
     frame_update_timer_ = 0.0f;
 
     updateFrames();
+    reportRenderStatistics();
   }
 
   selection_manager_->update();
@@ -392,10 +482,29 @@ void VisualizationManager::onUpdate()
   }
 
   frame_count_++;
-  if (render_requested_ || wall_diff > std::chrono::milliseconds(10)) {
-    render_requested_ = 0;
-    std::lock_guard<std::mutex> lock(private_->render_mutex_);
-    ogre_root_->renderOneFrame();
+  if (private_->render_thread_->isRunning()) {
+    // Rendered by the render thread as soon as the GUI thread is idle
+    private_->render_thread_->requestFrame();
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> lock(private_->render_mutex_);
+  scene_update_queue_.apply();
+  ogre_root_->renderOneFrame();
+}
+
+void VisualizationManager::reportRenderStatistics()
+{
+  const uint64_t rendered_cycles = render_scheduler_.getRenderedCycles();
+  const uint64_t skipped_cycles = render_scheduler_.getSkippedCycles();
+  const uint64_t rendered = rendered_cycles - reported_rendered_cycles_;
+  const uint64_t total = rendered + skipped_cycles - reported_skipped_cycles_;
+  reported_rendered_cycles_ = rendered_cycles;
+  reported_skipped_cycles_ = skipped_cycles;
+
+  if (render_scheduler_.isOnDemand()) {
+    global_status_->setStatus(
+      StatusProperty::Ok, "Rendering",
+      QString("%1 of %2 update cycles rendered").arg(rendered).arg(total));
   }
 }
 
@@ -595,6 +704,67 @@ void VisualizationManager::updateBackgroundColor()
   queueRender();
 }
 
+void VisualizationManager::updateRenderOnDemand()
+{
+  render_scheduler_.setOnDemand(render_on_demand_property_->getBool());
+  render_scheduler_.setIdleRate(idle_render_rate_property_->getFloat());
+  idle_render_rate_property_->setHidden(!render_on_demand_property_->getBool());
+  if (!render_on_demand_property_->getBool()) {
+    global_status_->deleteStatus("Rendering");
+  }
+}
+
+void VisualizationManager::updateOrderIndependentTransparency()
+{
+  bool enabled = order_independent_transparency_property_->getBool();
+  auto viewport =
+    rviz_rendering::RenderWindowOgreAdapter::getOgreViewport(render_panel_->getRenderWindow());
+  if (viewport && !rviz_rendering::WeightedBlendedTransparency::setEnabled(viewport, enabled)) {
+    global_status_->setStatus(
+      StatusProperty::Warn, "Transparency",
+      "Order-independent transparency is not supported by the graphics driver.");
+    return;
+  }
+  global_status_->deleteStatus("Transparency");
+  queueRender();
+}
+
+void VisualizationManager::updatePointBudget()
+{
+  rviz_rendering::PointBudget::getGlobal()->setMaxPoints(
+    static_cast<uint64_t>(point_budget_property_->getInt()));
+  queueRender();
+}
+
+void VisualizationManager::updateRenderThread()
+{
+  auto & render_thread = private_->render_thread_;
+  bool enabled = render_thread_property_->getBool();
+  if (enabled == render_thread->isRunning()) {
+    return;
+  }
+
+  if (enabled) {
+    // Called while the GUI thread is working, so it starts out with the scene
+    render_thread->start();
+    // The GUI thread hands the scene over whenever its event loop waits for events
+    auto dispatcher = QAbstractEventDispatcher::instance();
+    private_->about_to_block_connection_ = connect(
+      dispatcher, &QAbstractEventDispatcher::aboutToBlock, this, [this]() {
+        private_->render_thread_->releaseScene();
+      });
+    private_->awake_connection_ = connect(
+      dispatcher, &QAbstractEventDispatcher::awake, this, [this]() {
+        private_->render_thread_->acquireScene();
+      });
+  } else {
+    disconnect(private_->about_to_block_connection_);
+    disconnect(private_->awake_connection_);
+    render_thread->stop();
+  }
+  queueRender();
+}
+
 void VisualizationManager::updateFps()
 {
   if (update_timer_->isActive()) {
@@ -37,6 +37,7 @@
 
 #include "rviz_common/properties/vector_property.hpp"
 #include "rviz_common/properties/color_property.hpp"
+#include "rviz_common/properties/status_list.hpp"
 #include "rviz_common/config.hpp"
 #include "rviz_common/yaml_config_reader.hpp"
 #include "rviz_common/yaml_config_writer.hpp"
@@ -193,6 +194,22 @@ TEST(DisplayGroup, save_properties) {
     ), out.toStdString());
 }
 
+TEST(Display, setStatus_shows_only_the_last_status_per_name) {
+  MockDisplay d;
+  d.setStatus(properties::StatusProperty::Error, "Topic", "first");
+  d.setStatus(properties::StatusProperty::Ok, "Topic", "second");
+  d.setStatus(properties::StatusProperty::Warn, "Transform", "missing");
+  d.deleteStatus("Transform");
+
+  QApplication::processEvents();
+
+  auto status = dynamic_cast<properties::StatusList *>(d.subProp("Status"));
+  ASSERT_NE(nullptr, status);
+  ASSERT_EQ(1, status->numChildren());
+  EXPECT_EQ("second", status->subProp("Topic")->getValue().toString().toStdString());
+  EXPECT_EQ(properties::StatusProperty::Ok, status->getLevel());
+}
+
 int main(int argc, char ** argv)
 {
   QApplication app(argc, argv);
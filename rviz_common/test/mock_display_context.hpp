@@ -33,6 +33,7 @@
 
 #include <gmock/gmock.h>
 
+#include <functional>
 #include <memory>
 
 #include "rviz_common/display_context.hpp"
@@ -81,6 +82,7 @@ public:
 
   MOCK_METHOD0(lockRender, void());
   MOCK_METHOD0(unlockRender, void());
+  MOCK_METHOD1(queueSceneUpdate, void(std::function<void()> update));
   MOCK_CONST_METHOD0(getRenderPanel, rviz_common::RenderPanel * ());
   MOCK_CONST_METHOD0(getHelpPath, QString());
 };
@@ -0,0 +1,127 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "rviz_common/render_scheduler.hpp"
+
+// Runs the update loop of VisualizationManager for a simulated minute at the default update
+// rate of 30 Hz and reports the rendered and skipped cycles and the CPU time they took.
+// A rendered cycle is stood in for by a fixed amount of vertex work.
+
+namespace
+{
+
+const uint64_t frame = 33000000;
+const int cycles = 1800;
+
+struct CycleStatistics
+{
+  uint64_t rendered;
+  uint64_t skipped;
+  double cpu_seconds;
+};
+
+float renderScene(std::vector<float> & vertices)
+{
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    vertices[i] = vertices[i] * 0.999f + 0.001f * static_cast<float>(i % 7);
+  }
+  return vertices.front();
+}
+
+/// \param message_period Cycles between two received messages, 0 for a static scene
+CycleStatistics runUpdateLoop(bool on_demand, int message_period)
+{
+  rviz_common::RenderScheduler scheduler;
+  scheduler.setOnDemand(on_demand);
+  scheduler.setIdleRate(1.0f);
+  std::vector<float> vertices(100000, 1.0f);
+  volatile float sink = 0.0f;
+
+  uint64_t wall_dt = 0;
+  std::clock_t start = std::clock();
+  for (int cycle = 0; cycle < cycles; ++cycle) {
+    if (message_period > 0 && cycle % message_period == 0) {
+      scheduler.queueRender();
+    }
+    wall_dt += frame;
+    if (scheduler.beginCycle(wall_dt)) {
+      wall_dt = 0;
+      sink = sink + renderScene(vertices);
+    }
+  }
+  double cpu_seconds = static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+
+  return {scheduler.getRenderedCycles(), scheduler.getSkippedCycles(), cpu_seconds};
+}
+
+void report(const std::string & scene, const std::string & mode, const CycleStatistics & stats)
+{
+  std::cout << "[ BENCHMARK ] " << scene << ", " << mode << ": " << stats.rendered <<
+    " rendered, " << stats.skipped << " skipped, " << std::fixed << std::setprecision(3) <<
+    stats.cpu_seconds << " s CPU" << std::endl;
+}
+
+}  // namespace
+
+TEST(RenderSchedulerBenchmark, static_scene) {
+  auto every_cycle = runUpdateLoop(false, 0);
+  auto on_demand = runUpdateLoop(true, 0);
+  report("static scene", "every cycle", every_cycle);
+  report("static scene", "on demand", on_demand);
+
+  EXPECT_EQ(static_cast<uint64_t>(cycles), every_cycle.rendered);
+  EXPECT_EQ(0u, every_cycle.skipped);
+  // the first cycle, then the heartbeat once a second, which is due after 31 cycles of 33 ms
+  const uint64_t heartbeats = 1 + (cycles - 1) / 31;
+  EXPECT_EQ(heartbeats, on_demand.rendered);
+  EXPECT_EQ(cycles - heartbeats, on_demand.skipped);
+  EXPECT_LT(on_demand.cpu_seconds, every_cycle.cpu_seconds);
+}
+
+TEST(RenderSchedulerBenchmark, message_driven_scene) {
+  // a 10 Hz topic
+  auto every_cycle = runUpdateLoop(false, 3);
+  auto on_demand = runUpdateLoop(true, 3);
+  report("10 Hz messages", "every cycle", every_cycle);
+  report("10 Hz messages", "on demand", on_demand);
+
+  EXPECT_EQ(static_cast<uint64_t>(cycles), every_cycle.rendered);
+  EXPECT_EQ(static_cast<uint64_t>(cycles / 3), on_demand.rendered);
+  EXPECT_EQ(static_cast<uint64_t>(cycles - cycles / 3), on_demand.skipped);
+  EXPECT_LT(on_demand.cpu_seconds, every_cycle.cpu_seconds);
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gtest/gtest.h>
+
+#include "rviz_common/render_scheduler.hpp"
+
+static const uint64_t frame = 33000000;
+
+TEST(RenderScheduler, renders_every_cycle_by_default) {
+  rviz_common::RenderScheduler scheduler;
+
+  EXPECT_TRUE(scheduler.beginCycle(frame));
+  EXPECT_TRUE(scheduler.beginCycle(frame));
+  EXPECT_TRUE(scheduler.beginCycle(frame));
+  EXPECT_EQ(3u, scheduler.getRenderedCycles());
+}
+
+TEST(RenderScheduler, skips_unchanged_cycles_on_demand) {
+  rviz_common::RenderScheduler scheduler;
+  scheduler.setOnDemand(true);
+
+  // switching modes renders once
+  EXPECT_TRUE(scheduler.beginCycle(frame));
+  EXPECT_FALSE(scheduler.beginCycle(frame));
+  EXPECT_FALSE(scheduler.beginCycle(frame));
+
+  scheduler.queueRender();
+  EXPECT_TRUE(scheduler.beginCycle(frame));
+  EXPECT_FALSE(scheduler.beginCycle(frame));
+
+  EXPECT_EQ(2u, scheduler.getRenderedCycles());
+  EXPECT_EQ(3u, scheduler.getSkippedCycles());
+}
+
+TEST(RenderScheduler, renders_at_the_idle_rate_on_demand) {
+  rviz_common::RenderScheduler scheduler;
+  scheduler.setOnDemand(true);
+  scheduler.setIdleRate(10.0f);
+  scheduler.beginCycle(frame);
+
+  // the time is counted from the last rendered cycle
+  EXPECT_FALSE(scheduler.beginCycle(frame));
+  EXPECT_FALSE(scheduler.beginCycle(2 * frame));
+  EXPECT_TRUE(scheduler.beginCycle(4 * frame));
+  EXPECT_FALSE(scheduler.beginCycle(frame));
+}
+
+TEST(RenderScheduler, switching_back_renders_every_cycle) {
+  rviz_common::RenderScheduler scheduler;
+  scheduler.setOnDemand(true);
+  scheduler.beginCycle(frame);
+  ASSERT_FALSE(scheduler.beginCycle(frame));
+
+  scheduler.setOnDemand(false);
+
+  EXPECT_TRUE(scheduler.beginCycle(frame));
+  EXPECT_TRUE(scheduler.beginCycle(frame));
+}
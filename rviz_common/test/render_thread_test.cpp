@@ -0,0 +1,202 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include <thread>
+
+#include "rviz_common/render_thread.hpp"
+
+namespace
+{
+
+class RenderThreadTest : public ::testing::Test
+{
+public:
+  RenderThreadTest()
+  : owner_thread_(std::this_thread::get_id()),
+    frames_(0),
+    frames_on_owner_thread_(0),
+    context_thread_(std::this_thread::get_id()),
+    context_errors_(0)
+  {
+    rviz_common::RenderThread::Callbacks callbacks;
+    callbacks.render_frame = [this]() {
+        if (std::this_thread::get_id() == owner_thread_) {
+          ++frames_on_owner_thread_;
+        }
+        if (context_thread_ != std::this_thread::get_id()) {
+          ++context_errors_;
+        }
+        ++frames_;
+      };
+    // like a GL context, it may only be current on one thread at a time
+    callbacks.acquire_context = [this]() {
+        std::lock_guard<std::mutex> lock(context_mutex_);
+        if (context_thread_ != std::thread::id()) {
+          ++context_errors_;
+        }
+        context_thread_ = std::this_thread::get_id();
+      };
+    callbacks.release_context = [this]() {
+        std::lock_guard<std::mutex> lock(context_mutex_);
+        if (context_thread_ != std::this_thread::get_id()) {
+          ++context_errors_;
+        }
+        context_thread_ = std::thread::id();
+      };
+    render_thread_ = std::make_unique<rviz_common::RenderThread>(scene_mutex_, callbacks);
+  }
+
+  bool waitForFrames(uint64_t frames)
+  {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (render_thread_->getRenderedFrames() < frames) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+  }
+
+  std::thread::id owner_thread_;
+  std::recursive_mutex scene_mutex_;
+  std::atomic<int> frames_;
+  std::atomic<int> frames_on_owner_thread_;
+
+  std::mutex context_mutex_;
+  std::thread::id context_thread_;
+  std::atomic<int> context_errors_;
+
+  std::unique_ptr<rviz_common::RenderThread> render_thread_;
+};
+
+}  // namespace
+
+TEST_F(RenderThreadTest, renders_requested_frames_only_while_the_owner_is_idle) {
+  render_thread_->start();
+  render_thread_->requestFrame();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(0, frames_);
+
+  render_thread_->releaseScene();
+  ASSERT_TRUE(waitForFrames(1));
+  render_thread_->acquireScene();
+
+  EXPECT_EQ(1, frames_);
+  EXPECT_EQ(0, frames_on_owner_thread_);
+  EXPECT_EQ(0, context_errors_);
+  EXPECT_EQ(owner_thread_, context_thread_);
+  render_thread_->stop();
+}
+
+TEST_F(RenderThreadTest, coalesces_frame_requests) {
+  render_thread_->start();
+  render_thread_->requestFrame();
+  render_thread_->requestFrame();
+  render_thread_->requestFrame();
+
+  render_thread_->releaseScene();
+  ASSERT_TRUE(waitForFrames(1));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  render_thread_->acquireScene();
+
+  EXPECT_EQ(1, frames_);
+  render_thread_->stop();
+}
+
+TEST_F(RenderThreadTest, owner_has_the_scene_mutex_until_it_releases_the_scene) {
+  render_thread_->start();
+
+  std::atomic<bool> locked_by_other_thread(false);
+  std::thread other([&]() {
+      std::lock_guard<std::recursive_mutex> lock(scene_mutex_);
+      locked_by_other_thread = true;
+    });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(locked_by_other_thread);
+
+  render_thread_->releaseScene();
+  other.join();
+  EXPECT_TRUE(locked_by_other_thread);
+  render_thread_->acquireScene();
+  render_thread_->stop();
+}
+
+TEST_F(RenderThreadTest, acquire_and_release_may_be_repeated) {
+  render_thread_->start();
+  render_thread_->acquireScene();
+  render_thread_->releaseScene();
+  render_thread_->releaseScene();
+  render_thread_->acquireScene();
+  render_thread_->acquireScene();
+
+  EXPECT_EQ(0, context_errors_);
+  EXPECT_EQ(owner_thread_, context_thread_);
+  render_thread_->stop();
+}
+
+TEST_F(RenderThreadTest, stop_leaves_the_scene_with_the_owner) {
+  render_thread_->start();
+  render_thread_->releaseScene();
+
+  render_thread_->stop();
+
+  EXPECT_FALSE(render_thread_->isRunning());
+  EXPECT_EQ(owner_thread_, context_thread_);
+  // the owner renders itself again, without holding the lock in between
+  std::thread other([this]() {std::lock_guard<std::recursive_mutex> lock(scene_mutex_);});
+  other.join();
+}
+
+TEST_F(RenderThreadTest, many_handovers_keep_the_context_on_one_thread) {
+  render_thread_->start();
+  for (int i = 0; i < 200; ++i) {
+    render_thread_->requestFrame();
+    render_thread_->releaseScene();
+    std::this_thread::yield();
+    render_thread_->acquireScene();
+  }
+  render_thread_->requestFrame();
+  render_thread_->releaseScene();
+  ASSERT_TRUE(waitForFrames(1));
+  render_thread_->acquireScene();
+  render_thread_->stop();
+
+  EXPECT_EQ(0, context_errors_);
+  EXPECT_EQ(0, frames_on_owner_thread_);
+  EXPECT_EQ(owner_thread_, context_thread_);
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QApplication>  // NOLINT cpplint cannot handle include order
+
+#include "std_msgs/msg/string.hpp"
+
+#include "rviz_common/properties/bool_property.hpp"
+#include "rviz_common/properties/status_list.hpp"
+#include "rviz_common/ros_topic_display.hpp"
+
+#include "mock_display_context.hpp"
+
+using namespace ::testing;  // NOLINT
+
+/// Records the processed messages instead of showing them.
+class RecordingDisplay : public rviz_common::RosTopicDisplay<std_msgs::msg::String>
+{
+public:
+  explicit RecordingDisplay(rviz_common::DisplayContext * context)
+  {
+    context_ = context;
+  }
+
+  void receive(const std::string & data)
+  {
+    auto message = std::make_shared<std_msgs::msg::String>();
+    message->data = data;
+    incomingMessage(message);
+  }
+
+  void setConflate(bool conflate)
+  {
+    conflate_property_->setBool(conflate);
+  }
+
+  bool post(const std::string & data)
+  {
+    auto message = std::make_shared<std_msgs::msg::String>();
+    message->data = data;
+    return postToMailbox(message);
+  }
+
+  using RTDClass::getDroppedMessageCount;
+  using RTDClass::processMailbox;
+
+  std::vector<std::string> processed_;
+
+protected:
+  void processMessage(std_msgs::msg::String::ConstSharedPtr message) override
+  {
+    processed_.push_back(message->data);
+  }
+};
+
+class RosTopicDisplayFixture : public Test
+{
+public:
+  RosTopicDisplayFixture()
+  {
+    context_ = std::make_shared<NiceMock<MockDisplayContext>>();
+    display_ = std::make_unique<RecordingDisplay>(context_.get());
+  }
+
+  std::shared_ptr<MockDisplayContext> context_;
+  std::unique_ptr<RecordingDisplay> display_;
+};
+
+TEST_F(RosTopicDisplayFixture, messages_are_processed_right_away_without_conflation) {
+  display_->receive("first");
+  display_->receive("second");
+
+  EXPECT_THAT(display_->processed_, ElementsAre("first", "second"));
+  EXPECT_THAT(display_->getDroppedMessageCount(), Eq(0u));
+}
+
+TEST_F(RosTopicDisplayFixture, conflated_messages_are_processed_by_the_event_loop) {
+  display_->setConflate(true);
+
+  display_->receive("first");
+  EXPECT_THAT(display_->processed_, IsEmpty());
+
+  QApplication::processEvents();
+  EXPECT_THAT(display_->processed_, ElementsAre("first"));
+}
+
+TEST_F(RosTopicDisplayFixture, a_waiting_message_is_replaced_by_a_newer_one) {
+  display_->setConflate(true);
+
+  display_->receive("first");
+  display_->receive("second");
+  display_->receive("third");
+  QApplication::processEvents();
+
+  EXPECT_THAT(display_->processed_, ElementsAre("third"));
+}
+
+TEST_F(RosTopicDisplayFixture, replaced_messages_are_counted_as_dropped) {
+  display_->setConflate(true);
+
+  display_->receive("first");
+  display_->receive("second");
+  display_->receive("third");
+  EXPECT_THAT(display_->getDroppedMessageCount(), Eq(2u));
+
+  QApplication::processEvents();
+  display_->receive("fourth");
+  QApplication::processEvents();
+
+  EXPECT_THAT(display_->processed_, ElementsAre("third", "fourth"));
+  EXPECT_THAT(display_->getDroppedMessageCount(), Eq(2u));
+
+  auto status = dynamic_cast<rviz_common::properties::StatusList *>(
+    display_->subProp("Status"));
+  ASSERT_NE(nullptr, status);
+  ASSERT_NE(nullptr, status->subProp("Conflation"));
+  EXPECT_THAT(
+    status->subProp("Conflation")->getValue().toString().toStdString(),
+    StrEq("2 outdated messages dropped"));
+}
+
+TEST_F(RosTopicDisplayFixture, post_to_mailbox_reports_replacing_a_waiting_message) {
+  EXPECT_FALSE(display_->post("first"));
+  EXPECT_TRUE(display_->post("second"));
+
+  display_->processMailbox();
+  EXPECT_THAT(display_->processed_, ElementsAre("second"));
+
+  EXPECT_FALSE(display_->post("third"));
+  // posting directly does not count as dropping a message
+  EXPECT_THAT(display_->getDroppedMessageCount(), Eq(0u));
+}
+
+TEST_F(RosTopicDisplayFixture, processing_an_empty_mailbox_does_nothing) {
+  display_->post("first");
+  display_->processMailbox();
+
+  // the queued call finds the mailbox already emptied
+  QApplication::processEvents();
+
+  EXPECT_THAT(display_->processed_, ElementsAre("first"));
+}
+
+TEST_F(RosTopicDisplayFixture, reset_clears_the_waiting_message_and_the_dropped_count) {
+  display_->setConflate(true);
+  display_->receive("first");
+  display_->receive("second");
+
+  display_->reset();
+  QApplication::processEvents();
+
+  EXPECT_THAT(display_->processed_, IsEmpty());
+  EXPECT_THAT(display_->getDroppedMessageCount(), Eq(0u));
+
+  display_->receive("third");
+  QApplication::processEvents();
+  EXPECT_THAT(display_->processed_, ElementsAre("third"));
+}
+
+int main(int argc, char ** argv)
+{
+  QApplication app(argc, argv);
+  InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "rviz_common/scene_update_queue.hpp"
+
+TEST(SceneUpdateQueue, applies_updates_in_order) {
+  rviz_common::SceneUpdateQueue queue;
+  std::vector<int> applied;
+
+  queue.post([&applied]() {applied.push_back(1);});
+  queue.post([&applied]() {applied.push_back(2);});
+
+  EXPECT_TRUE(applied.empty());
+  EXPECT_EQ(2u, queue.apply());
+  EXPECT_EQ(std::vector<int>({1, 2}), applied);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(0u, queue.apply());
+}
+
+TEST(SceneUpdateQueue, updates_posted_while_applying_wait_for_the_next_frame) {
+  rviz_common::SceneUpdateQueue queue;
+  int applied = 0;
+
+  queue.post(
+    [&]() {
+      ++applied;
+      queue.post([&applied]() {++applied;});
+    });
+
+  EXPECT_EQ(1u, queue.apply());
+  EXPECT_EQ(1, applied);
+  EXPECT_FALSE(queue.empty());
+
+  EXPECT_EQ(1u, queue.apply());
+  EXPECT_EQ(2, applied);
+}
+
+TEST(SceneUpdateQueue, accepts_updates_from_other_threads) {
+  rviz_common::SceneUpdateQueue queue;
+  int applied = 0;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back(
+      [&queue, &applied]() {
+        for (int j = 0; j < 100; ++j) {
+          queue.post([&applied]() {++applied;});
+        }
+      });
+  }
+  size_t total = 0;
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  total += queue.apply();
+
+  EXPECT_EQ(400u, total);
+  EXPECT_EQ(400, applied);
+}
@@ -0,0 +1,227 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "std_msgs/msg/string.hpp"
+
+#include "rviz_common/ros_integration/topic_hub.hpp"
+#include "rviz_common/ros_integration/topic_hub_subscriber.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_common::ros_integration::TopicHub;
+using rviz_common::ros_integration::TopicHubSubscriber;
+
+class TopicHubTestFixture : public Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node_ = rclcpp::Node::make_shared("topic_hub_test_node");
+    publisher_ = node_->create_publisher<std_msgs::msg::String>(topic_, qos_);
+    executor_.add_node(node_);
+  }
+
+  void TearDown() override
+  {
+    executor_.remove_node(node_);
+    publisher_.reset();
+    node_.reset();
+    rclcpp::shutdown();
+  }
+
+  TopicHub::Connection subscribe(std::vector<std_msgs::msg::String::ConstSharedPtr> & received)
+  {
+    return hub_.subscribe<std_msgs::msg::String>(
+      node_, topic_, qos_, [&received](std_msgs::msg::String::ConstSharedPtr message) {
+        received.push_back(message);
+      });
+  }
+
+  void publishAndSpinUntil(const std::function<bool()> & condition)
+  {
+    std_msgs::msg::String message;
+    message.data = "message";
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition() && std::chrono::steady_clock::now() < deadline) {
+      publisher_->publish(message);
+      executor_.spin_some(std::chrono::milliseconds(50));
+    }
+  }
+
+  std::string topic_ = "/topic_hub_test";
+  rclcpp::QoS qos_ = rclcpp::QoS(1).reliable();
+  rclcpp::Node::SharedPtr node_;
+  rclcpp::Publisher<std_msgs::msg::String>::SharedPtr publisher_;
+  rclcpp::executors::SingleThreadedExecutor executor_;
+  TopicHub hub_;
+};
+
+TEST_F(TopicHubTestFixture, consumers_of_the_same_topic_and_qos_share_one_subscription) {
+  std::vector<std_msgs::msg::String::ConstSharedPtr> first_received;
+  std::vector<std_msgs::msg::String::ConstSharedPtr> second_received;
+
+  auto first = subscribe(first_received);
+  auto second = subscribe(second_received);
+
+  EXPECT_THAT(hub_.getSubscriptionCount(), Eq(1u));
+  EXPECT_THAT(hub_.getConsumerCount(topic_), Eq(2u));
+}
+
+TEST_F(TopicHubTestFixture, consumers_with_different_qos_get_their_own_subscription) {
+  auto first = hub_.subscribe<std_msgs::msg::String>(
+    node_, topic_, rclcpp::QoS(1).reliable(), [](std_msgs::msg::String::ConstSharedPtr) {});
+  auto second = hub_.subscribe<std_msgs::msg::String>(
+    node_, topic_, rclcpp::QoS(1).best_effort(), [](std_msgs::msg::String::ConstSharedPtr) {});
+
+  EXPECT_THAT(hub_.getSubscriptionCount(), Eq(2u));
+}
+
+TEST_F(TopicHubTestFixture, transient_local_consumers_get_their_own_subscription) {
+  auto transient_local_qos = rclcpp::QoS(1).reliable().transient_local();
+  auto first = hub_.subscribe<std_msgs::msg::String>(
+    node_, topic_, transient_local_qos, [](std_msgs::msg::String::ConstSharedPtr) {});
+  auto second = hub_.subscribe<std_msgs::msg::String>(
+    node_, topic_, transient_local_qos, [](std_msgs::msg::String::ConstSharedPtr) {});
+
+  EXPECT_THAT(hub_.getSubscriptionCount(), Eq(2u));
+  EXPECT_THAT(first.getSubscription(), Ne(second.getSubscription()));
+}
+
+TEST_F(TopicHubTestFixture, late_joiners_receive_the_latched_message_of_a_transient_local_topic) {
+  auto transient_local_qos = rclcpp::QoS(1).reliable().transient_local();
+  const std::string latched_topic = "/topic_hub_test_latched";
+  auto latched_publisher =
+    node_->create_publisher<std_msgs::msg::String>(latched_topic, transient_local_qos);
+  std_msgs::msg::String message;
+  message.data = "latched";
+  latched_publisher->publish(message);
+
+  auto spin_until = [this](const std::function<bool()> & condition) {
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while (!condition() && std::chrono::steady_clock::now() < deadline) {
+        executor_.spin_some(std::chrono::milliseconds(50));
+      }
+    };
+
+  std::vector<std_msgs::msg::String::ConstSharedPtr> first_received;
+  auto first = hub_.subscribe<std_msgs::msg::String>(
+    node_, latched_topic, transient_local_qos,
+    [&first_received](std_msgs::msg::String::ConstSharedPtr received) {
+      first_received.push_back(received);
+    });
+  spin_until([&]() {return !first_received.empty();});
+  ASSERT_THAT(first_received, SizeIs(1u));
+
+  std::vector<std_msgs::msg::String::ConstSharedPtr> late_received;
+  auto late = hub_.subscribe<std_msgs::msg::String>(
+    node_, latched_topic, transient_local_qos,
+    [&late_received](std_msgs::msg::String::ConstSharedPtr received) {
+      late_received.push_back(received);
+    });
+  spin_until([&]() {return !late_received.empty();});
+
+  ASSERT_THAT(late_received, SizeIs(1u));
+  EXPECT_THAT(late_received[0]->data, StrEq("latched"));
+  EXPECT_THAT(first_received, SizeIs(1u));
+}
+
+TEST_F(TopicHubTestFixture, every_consumer_receives_the_same_message_instance) {
+  std::vector<std_msgs::msg::String::ConstSharedPtr> first_received;
+  std::vector<std_msgs::msg::String::ConstSharedPtr> second_received;
+  auto first = subscribe(first_received);
+  auto second = subscribe(second_received);
+
+  publishAndSpinUntil([&]() {return !first_received.empty();});
+
+  ASSERT_THAT(first_received, Not(IsEmpty()));
+  ASSERT_THAT(second_received, SizeIs(first_received.size()));
+  EXPECT_THAT(second_received[0].get(), Eq(first_received[0].get()));
+}
+
+TEST_F(TopicHubTestFixture, subscription_is_destroyed_with_its_last_consumer) {
+  std::vector<std_msgs::msg::String::ConstSharedPtr> first_received;
+  std::vector<std_msgs::msg::String::ConstSharedPtr> second_received;
+  auto first = subscribe(first_received);
+  {
+    auto second = subscribe(second_received);
+  }
+
+  EXPECT_THAT(hub_.getSubscriptionCount(), Eq(1u));
+  EXPECT_THAT(hub_.getConsumerCount(topic_), Eq(1u));
+
+  first.disconnect();
+
+  EXPECT_FALSE(first.isConnected());
+  EXPECT_THAT(hub_.getSubscriptionCount(), Eq(0u));
+}
+
+TEST_F(TopicHubTestFixture, topic_hub_subscriber_signals_messages_to_message_filters) {
+  std::vector<std_msgs::msg::String::ConstSharedPtr> first_received;
+  auto first = subscribe(first_received);
+  TopicHubSubscriber<std_msgs::msg::String> subscriber(node_, topic_, qos_, hub_);
+  std::vector<std_msgs::msg::String::ConstSharedPtr> filtered;
+  subscriber.registerCallback(
+    [&filtered](const std_msgs::msg::String::ConstSharedPtr & message) {
+      filtered.push_back(message);
+    });
+
+  publishAndSpinUntil([&]() {return !filtered.empty();});
+
+  EXPECT_THAT(hub_.getSubscriptionCount(), Eq(1u));
+  ASSERT_THAT(filtered, Not(IsEmpty()));
+  EXPECT_THAT(filtered[0].get(), Eq(first_received[0].get()));
+}
+
+TEST_F(TopicHubTestFixture, topic_hub_subscriber_exposes_the_shared_subscription) {
+  std::vector<std_msgs::msg::String::ConstSharedPtr> received;
+  auto connection = subscribe(received);
+  TopicHubSubscriber<std_msgs::msg::String> subscriber(node_, topic_, qos_, hub_);
+
+  ASSERT_TRUE(subscriber.getSubscriber());
+  EXPECT_THAT(subscriber.getSubscriber(), Eq(connection.getSubscription()));
+  EXPECT_THAT(subscriber.getTopic(), StrEq(topic_));
+
+  subscriber.unsubscribe();
+  EXPECT_FALSE(subscriber.getSubscriber());
+  EXPECT_THAT(hub_.getConsumerCount(topic_), Eq(1u));
+
+  subscriber.subscribe();
+  EXPECT_THAT(hub_.getConsumerCount(topic_), Eq(2u));
+}
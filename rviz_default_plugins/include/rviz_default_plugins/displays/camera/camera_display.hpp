@@ -33,6 +33,7 @@
 #ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__CAMERA__CAMERA_DISPLAY_HPP_
 #define RVIZ_DEFAULT_PLUGINS__DISPLAYS__CAMERA__CAMERA_DISPLAY_HPP_
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -46,12 +47,14 @@
 # include <OgrePlatform.h>
 # include <OgreRenderTargetListener.h>
 # include <OgreSharedPtr.h>
+# include <OgreTexture.h>
 
 #include <message_filters/cache.hpp>
 
 # include "sensor_msgs/msg/camera_info.hpp"
 # include "tf2_ros/message_filter.h"
 
+# include "rviz_default_plugins/displays/camera/camera_render_schedule.hpp"
 # include "rviz_default_plugins/displays/image/image_transport_display.hpp"
 # include "rviz_default_plugins/displays/image/ros_image_texture_iface.hpp"
 # include "rviz_default_plugins/visibility_control.hpp"
@@ -65,6 +68,9 @@ class SceneNode;
 class ManualObject;
 class Rectangle2D;
 class Camera;
+class RenderTarget;
+class SceneManager;
+class Viewport;
 }
 
 namespace rviz_common
@@ -153,6 +159,23 @@ private:
 
   Ogre::MaterialPtr createMaterial(std::string name) const;
 
+  bool showsBackgroundImage() const;
+
+  bool showsOverlayImage() const;
+
+  /// Choose the target the scene is rendered to and whether it is rendered this frame
+  void updateRenderTarget(float wall_dt);
+
+  void createCompositeScene();
+
+  void createSceneRenderTarget(Ogre::Viewport * window_viewport, int width, int height);
+
+  void destroySceneRenderTarget();
+
+  Ogre::RenderTarget * getSceneRenderTarget() const;
+
+  void reportRenderTime(float wall_dt);
+
   std::unique_ptr<Ogre::Rectangle2D> createScreenRectangle(
     const Ogre::AxisAlignedBox & bounding_box,
     const Ogre::MaterialPtr & material,
@@ -201,6 +224,30 @@ private:
   rviz_common::properties::FloatProperty * zoom_property_;
   rviz_common::properties::FloatProperty * far_plane_property_;
   rviz_common::properties::DisplayGroupVisibilityProperty * visibility_property_;
+  rviz_common::properties::FloatProperty * render_rate_property_;
+  rviz_common::properties::FloatProperty * render_scale_property_;
+
+  // Camera looking at the scene, the render window may show the offscreen render target instead
+  Ogre::Camera * scene_camera_;
+  // Target the scene is rendered to, either the render window or the offscreen render target
+  Ogre::RenderTarget * render_target_;
+  CameraRenderSchedule render_schedule_;
+
+  // Composites the camera image and the offscreen render target in the render window
+  Ogre::SceneManager * composite_scene_manager_;
+  Ogre::Camera * composite_camera_;
+  Ogre::SceneNode * composite_background_node_;
+  Ogre::SceneNode * composite_overlay_node_;
+  std::unique_ptr<Ogre::Rectangle2D> composite_background_rect_;
+  std::unique_ptr<Ogre::Rectangle2D> composite_screen_rect_;
+  std::unique_ptr<Ogre::Rectangle2D> composite_overlay_rect_;
+  Ogre::MaterialPtr composite_material_;
+  Ogre::TexturePtr scene_texture_;
+
+  std::chrono::steady_clock::time_point render_start_;
+  // exponential moving average of the CPU time spent rendering the scene, in milliseconds
+  float average_render_time_;
+  float render_time_report_timer_;
 
   sensor_msgs::msg::CameraInfo::ConstSharedPtr current_caminfo_;
   std::mutex caminfo_mutex_;
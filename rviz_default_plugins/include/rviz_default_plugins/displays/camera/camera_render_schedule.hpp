@@ -0,0 +1,84 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__CAMERA__CAMERA_RENDER_SCHEDULE_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__CAMERA__CAMERA_RENDER_SCHEDULE_HPP_
+
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+/// Decides where and when CameraDisplay renders the scene from the camera pose.
+/**
+ * The camera image is composited into the render panel with every frame. The scene is
+ * rendered directly into the panel, unless Render Rate or Render Scale limit it. Then it is
+ * rendered into an offscreen texture, which is only updated in the frames that are due, and
+ * the panel composites the last rendered texture between the background and overlay image.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC CameraRenderSchedule
+{
+public:
+  struct Target
+  {
+    bool offscreen;
+    /// Size of the offscreen texture
+    int width;
+    int height;
+  };
+
+  CameraRenderSchedule();
+
+  /// Where the scene is rendered for a render panel of the given size.
+  static Target getTarget(
+    int panel_width, int panel_height, float render_rate, float render_scale);
+
+  /// Advance the schedule by one frame.
+  /**
+   * \param render_rate maximum rate in Hz, 0 for every frame
+   * \param wall_dt time since the previous frame in nanoseconds
+   * \return true if the scene has to be rendered in this frame
+   */
+  bool advance(float render_rate, float wall_dt);
+
+  /// Let the next frame render the scene, e.g. after the offscreen texture was recreated.
+  void invalidate();
+
+private:
+  float timer_;
+  bool invalidated_;
+};
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__CAMERA__CAMERA_RENDER_SCHEDULE_HPP_
@@ -37,6 +37,8 @@
 
 #include <tf2_ros/message_filter.h>
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -61,6 +63,8 @@
 #include <rviz_common/properties/ros_topic_property.hpp>
 #include <rviz_common/transformation/frame_transformer.hpp>
 
+#include <rviz_default_plugins/displays/image/decode_statistics.hpp>
+#include <rviz_default_plugins/displays/image/decode_worker_pool.hpp>
 #include <rviz_default_plugins/displays/pointcloud/point_cloud_common.hpp>
 
 #include <sensor_msgs/msg/image.hpp>
@@ -129,11 +133,20 @@ protected:
 
   void fixedFrameChanged() override;
 
+  void updateStatuses() override;
+
   void subscribe();
   void unsubscribe();
 
   void clear();
 
+  /// Apply a change to the properties or the point cloud.
+  /**
+   * With parallel decoding the change is queued as a scene update, since messages are then
+   * processed on the decode worker pool instead of the GUI thread.
+   */
+  void applyToScene(std::function<void()> update);
+
   // thread-safe status updates
   // add status update to global status list
   void updateStatus(
@@ -143,7 +156,7 @@ protected:
   // use global status list to update rviz plugin status
   void setStatusList();
 
-  uint32_t messages_received_;
+  std::atomic<uint32_t> messages_received_;
 
   // ROS image subscription & synchronization
   std::unique_ptr<image_transport::ImageTransport> depthmap_it_;
@@ -174,9 +187,15 @@ protected:
   rviz_common::properties::EnumProperty * depth_transport_property_;
   rviz_common::properties::RosFilteredTopicProperty * color_topic_property_;
   rviz_common::properties::EnumProperty * color_transport_property_;
+  rviz_common::properties::BoolProperty * parallel_decoding_property_;
   rviz_common::properties::BoolProperty * use_occlusion_compensation_property_;
   rviz_common::properties::FloatProperty * occlusion_shadow_timeout_property_;
 
+  // Property values read by processMessage(), which may run on a decoding worker
+  std::atomic<bool> use_auto_size_;
+  std::atomic<float> auto_size_factor_;
+  std::atomic<bool> use_occlusion_compensation_;
+
   uint32_t queue_size_;
 
   std::unique_ptr<rviz_common::MultiLayerDepth> ml_depth_data_;
@@ -188,6 +207,14 @@ protected:
 
   std::unique_ptr<PointCloudCommon> pointcloud_common_;
 
+  // Decoding on the worker pool, see the "Parallel Decoding" property
+  std::atomic<bool> parallel_decoding_;
+  std::shared_ptr<DecodeWorkerPool> decode_worker_pool_;
+  rclcpp::CallbackGroup::SharedPtr decode_callback_group_;
+  rclcpp::Clock::SharedPtr decode_clock_;
+  std::shared_ptr<DecodeCallbackGate> decode_gate_;
+  DecodeStatistics decode_statistics_;
+
   std::set<std::string> transport_plugin_types_;
 };
 }  // namespace displays
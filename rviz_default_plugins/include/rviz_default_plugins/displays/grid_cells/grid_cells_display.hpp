@@ -51,6 +51,7 @@ namespace rviz_common
 {
 namespace properties
 {
+class BoolProperty;
 class ColorProperty;
 class FloatProperty;
 }  // properties
@@ -60,6 +61,7 @@ namespace rviz_default_plugins
 {
 namespace displays
 {
+class GridCellsTexture;
 
 // TODO(Martin-Idel-SI): This display previously used tf message filter. Use again once available.
 /**
@@ -89,6 +91,7 @@ public:
 private Q_SLOTS:
   void updateAlpha();
   void updateColor();
+  void updateRasterize();
 
 private:
   bool messageIsValid(nav_msgs::msg::GridCells::ConstSharedPtr msg);
@@ -96,9 +99,11 @@ private:
   bool setTransform(std_msgs::msg::Header const & header);
 
   std::shared_ptr<rviz_rendering::PointCloud> cloud_;
+  std::unique_ptr<GridCellsTexture> texture_;
 
   rviz_common::properties::ColorProperty * color_property_;
   rviz_common::properties::FloatProperty * alpha_property_;
+  rviz_common::properties::BoolProperty * rasterize_property_;
 
   uint64_t last_frame_count_;
 };
@@ -0,0 +1,145 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__GRID_CELLS__GRID_CELLS_TEXTURE_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__GRID_CELLS__GRID_CELLS_TEXTURE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <OgreColourValue.h>
+#include <OgreMaterial.h>
+#include <OgreTexture.h>
+
+#include "nav_msgs/msg/grid_cells.hpp"
+
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace Ogre
+{
+class ManualObject;
+class SceneManager;
+class SceneNode;
+}
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+/// Draws the cells of a nav_msgs::msg::GridCells message as one textured quad.
+/**
+ * Only works if all cells lie on a regular grid in one plane, which is the case for
+ * cells taken from a costmap. Every cell is one texel of an alpha texture, so the
+ * color and alpha of all cells are set on the material. The texture covers the
+ * cells with some margin and is kept as long as the cells of new messages fit into
+ * it, in which case only the rows which changed are uploaded.
+ */
+class GridCellsTexture
+{
+public:
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  GridCellsTexture(Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node);
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  ~GridCellsTexture();
+
+  /// Rasterize the cells of the message.
+  /**
+   * \return false if the cells are not on a regular grid or cover too large an area,
+   *   the texture is hidden in that case.
+   */
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  bool update(const nav_msgs::msg::GridCells & msg);
+
+  /// Remove all cells and hide the texture.
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  void clear();
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  void setColor(const Ogre::ColourValue & color, float alpha);
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  bool isVisible() const;
+
+  Ogre::SceneNode * getSceneNode() const {return scene_node_;}
+
+  /// Width and height of the texture in cells, exposed for testing
+  size_t getWidth() const {return width_;}
+  size_t getHeight() const {return height_;}
+
+  /// Occupancy of the texels, row by row, exposed for testing
+  const std::vector<uint8_t> & getTexels() const {return texels_;}
+
+  /// Number of texture rows uploaded by the last update, exposed for testing
+  size_t getUploadedRows() const {return uploaded_rows_;}
+
+  /// Largest width and height of the texture in cells
+  static const size_t MAX_SIZE;
+
+private:
+  /// Write the cells to new_texels_, moving the grid if the cells do not fit into it.
+  bool rasterize(const nav_msgs::msg::GridCells & msg, bool & grid_changed);
+  void resizeTexture();
+  void upload(size_t first_row, size_t end_row);
+  void setupMaterial();
+  void setupQuad();
+
+  Ogre::SceneManager * scene_manager_;
+  Ogre::SceneNode * scene_node_;
+  Ogre::ManualObject * quad_;
+  Ogre::MaterialPtr material_;
+  Ogre::TexturePtr texture_;
+
+  // grid of the texture: world position of the center of texel (0, 0) and size of a cell
+  double origin_x_;
+  double origin_y_;
+  double origin_z_;
+  double cell_width_;
+  double cell_height_;
+  size_t width_;
+  size_t height_;
+
+  std::vector<uint8_t> texels_;
+  std::vector<uint8_t> new_texels_;
+  // grid coordinates of the cells of the current message
+  std::vector<int64_t> cell_x_;
+  std::vector<int64_t> cell_y_;
+  size_t uploaded_rows_;
+
+  static size_t material_count_;
+  static size_t texture_count_;
+};
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__GRID_CELLS__GRID_CELLS_TEXTURE_HPP_
@@ -0,0 +1,101 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__DECODE_STATISTICS_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__DECODE_STATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include <QString>  // NOLINT: cpplint is unable to handle the include order here
+
+#include "rclcpp/time.hpp"
+
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+/// Throughput, latency and skipped frames of a display decoding on the DecodeWorkerPool.
+/**
+ * Frames are reported from the decoding threads, the summary is taken from the main thread.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC DecodeStatistics
+{
+public:
+  struct Summary
+  {
+    double frames_per_second;
+    /// Average time from the header stamp until the frame was decoded, in seconds.
+    double average_latency;
+    uint64_t frames_skipped;
+
+    QString toString() const;
+  };
+
+  DecodeStatistics();
+
+  /// Record a decoded frame.
+  /**
+   * Frames decoded at the same time may finish out of order, a frame which is slightly older
+   * than the newest decoded one is counted as skipped instead.
+   *
+   * \param stamp header stamp of the frame
+   * \param now current time of the clock the stamps refer to
+   * \return false if the frame is outdated and should not be displayed
+   */
+  bool frameDecoded(const rclcpp::Time & stamp, const rclcpp::Time & now);
+
+  /// Count a decoded frame which was replaced by a newer one before it was displayed.
+  void frameSkipped();
+
+  /// Summarize the frames decoded since the last call.
+  Summary takeSummary(
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+  void reset();
+
+private:
+  std::mutex mutex_;
+  rclcpp::Time newest_stamp_;
+  std::chrono::steady_clock::time_point period_start_;
+  uint64_t frames_decoded_;
+  uint64_t frames_with_latency_;
+  double latency_sum_;
+  uint64_t frames_skipped_;
+};
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__DECODE_STATISTICS_HPP_
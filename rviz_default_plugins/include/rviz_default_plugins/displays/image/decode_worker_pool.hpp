@@ -0,0 +1,130 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__DECODE_WORKER_POOL_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__DECODE_WORKER_POOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "rclcpp/rclcpp.hpp"
+
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+/// Runs the subscription callbacks of image transports on a pool of worker threads.
+/**
+ * Transports like "compressed" decode every image inside the subscription callback. Callbacks
+ * of a callback group added to the pool run on its threads instead of the main thread, so
+ * decoding does not delay rendering and several images are decoded at the same time.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC DecodeWorkerPool
+{
+public:
+  /// The pool shared by all displays, started by its first user and stopped with its last one.
+  static std::shared_ptr<DecodeWorkerPool> acquire();
+
+  explicit DecodeWorkerPool(size_t number_of_threads);
+  ~DecodeWorkerPool();
+
+  DecodeWorkerPool(const DecodeWorkerPool &) = delete;
+  DecodeWorkerPool & operator=(const DecodeWorkerPool &) = delete;
+
+  /// Create a callback group of the node which is run by the pool instead of the main executor.
+  /**
+   * Pass it as callback group in the subscription options of the transport subscriber.
+   * A reentrant group decodes several images of the same topic at once, a mutually exclusive
+   * group runs one callback at a time, e.g. for displays which are not thread safe.
+   */
+  rclcpp::CallbackGroup::SharedPtr addCallbackGroup(
+    const rclcpp::Node::SharedPtr & node, rclcpp::CallbackGroupType type);
+
+  /// Stop running the callbacks of the group, destroy its subscriptions before.
+  void removeCallbackGroup(const rclcpp::CallbackGroup::SharedPtr & callback_group);
+
+  size_t getNumberOfThreads() const;
+
+private:
+  size_t number_of_threads_;
+  rclcpp::executors::MultiThreadedExecutor executor_;
+  std::future<void> spinning_;
+};
+
+/// Lets callbacks running on the DecodeWorkerPool call a display until it unsubscribes.
+/**
+ * Removing a callback group does not wait for its running callbacks, so a display shares
+ * the gate with its callbacks and closes it before it is destroyed.
+ */
+class DecodeCallbackGate
+{
+public:
+  /// Call the function unless the gate is closed.
+  template<typename Function>
+  void pass(const Function & function)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (open_) {
+      function();
+    }
+  }
+
+  /// Keep out further calls, waits for a call which is running.
+  void close()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    open_ = false;
+  }
+
+  /// Whether the gate is open, without waiting for a running call.
+  /**
+   * Only reliable on the thread which closes the gate, e.g. for scene updates queued by a
+   * callback, which run on the GUI thread like the display.
+   */
+  bool isOpen() const
+  {
+    return open_;
+  }
+
+private:
+  std::mutex mutex_;
+  std::atomic<bool> open_{true};
+};
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__DECODE_WORKER_POOL_HPP_
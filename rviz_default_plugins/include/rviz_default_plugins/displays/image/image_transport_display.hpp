@@ -33,11 +33,16 @@
 #ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__IMAGE_TRANSPORT_DISPLAY_HPP_
 #define RVIZ_DEFAULT_PLUGINS__DISPLAYS__IMAGE__IMAGE_TRANSPORT_DISPLAY_HPP_
 
+#include <atomic>
+#include <functional>
 #include <memory>
 
+#include "decode_statistics.hpp"
+#include "decode_worker_pool.hpp"
 #include "get_transport_from_topic.hpp"
 #include "image_transport/image_transport.hpp"
 #include "image_transport/subscriber_filter.hpp"
+#include "rviz_common/properties/bool_property.hpp"
 #include "rviz_common/ros_topic_display.hpp"
 
 namespace rviz_default_plugins
@@ -56,11 +61,19 @@ public:
   typedef ImageTransportDisplay<MessageType> ITDClass;
 
   ImageTransportDisplay()
-  : messages_received_(0)
+  : messages_received_(0),
+    parallel_decoding_(false)
   {
     QString message_type = QString::fromStdString(rosidl_generator_traits::name<MessageType>());
     topic_property_->setMessageType(message_type);
     topic_property_->setDescription(message_type + " topic to subscribe to.");
+
+    parallel_decoding_property_ = new rviz_common::properties::BoolProperty(
+      "Parallel Decoding", false,
+      "Decode images on a pool of worker threads instead of the main thread. Speeds up "
+      "compressed transports of large images. Frames which are outdated once they are decoded "
+      "are skipped.",
+      topic_property_, SLOT(updateTopic()), this);
   }
 
 /**
@@ -79,8 +92,9 @@ public:
 
   void reset() override
   {
-    Display::reset();
+    _RosTopicDisplay::reset();
     messages_received_ = 0;
+    decode_statistics_.reset();
   }
 
   void setTopic(const QString & topic, const QString & datatype) override
@@ -111,15 +125,28 @@ protected:
     try {
       subscription_ = std::make_shared<image_transport::SubscriberFilter>();
       rclcpp::Node::SharedPtr node = rviz_ros_node_.lock()->get_raw_node();
+      rclcpp::SubscriptionOptions sub_opts;
+      parallel_decoding_ = parallel_decoding_property_->getBool();
+      if (parallel_decoding_) {
+        decode_worker_pool_ = DecodeWorkerPool::acquire();
+        decode_callback_group_ = decode_worker_pool_->addCallbackGroup(
+          node, rclcpp::CallbackGroupType::Reentrant);
+        decode_clock_ = node->get_clock();
+        sub_opts.callback_group = decode_callback_group_;
+      } else {
+        deleteStatus("Decoding");
+      }
       subscription_->subscribe(
         node.get(),
         getBaseTopicFromTopic(topic_property_->getTopicStd()),
         getTransportFromTopic(topic_property_->getTopicStd()),
-        qos_profile.get_rmw_qos_profile());
+        qos_profile.get_rmw_qos_profile(),
+        sub_opts);
       subscription_start_time_ = node->now();
-      subscription_callback_ = subscription_->registerCallback(
-        std::bind(
-          &ImageTransportDisplay<MessageType>::incomingMessage, this, std::placeholders::_1));
+      if (parallel_decoding_) {
+        decode_gate_ = std::make_shared<DecodeCallbackGate>();
+      }
+      subscription_callback_ = subscription_->registerCallback(makeIncomingMessageCallback());
       setStatus(rviz_common::properties::StatusProperty::Ok, "Topic", "OK");
     } catch (rclcpp::exceptions::InvalidTopicNameError & e) {
       setStatus(
@@ -128,6 +155,26 @@ protected:
     }
   }
 
+  /// Callback which hands messages to incomingMessage().
+  /**
+   * Derived classes which connect subscription_ to their own filters must use it as well.
+   * With parallel decoding, messages still being decoded when unsubscribe() is called
+   * are then dropped instead of reaching the display.
+   */
+  std::function<void(const typename MessageType::ConstSharedPtr)> makeIncomingMessageCallback()
+  {
+    std::function<void(const typename MessageType::ConstSharedPtr)> callback =
+      [this](const typename MessageType::ConstSharedPtr msg) {incomingMessage(msg);};
+    if (decode_gate_) {
+      callback =
+        [decode_gate = decode_gate_, callback](const typename MessageType::ConstSharedPtr msg)
+        {
+          decode_gate->pass([&callback, &msg]() {callback(msg);});
+        };
+    }
+    return callback;
+  }
+
   void transformerChangedCallback() override
   {
     resetSubscription();
@@ -143,7 +190,16 @@ protected:
 
   virtual void unsubscribe()
   {
+    if (decode_gate_) {
+      decode_gate_->close();
+      decode_gate_.reset();
+    }
     subscription_.reset();
+    if (decode_callback_group_) {
+      decode_worker_pool_->removeCallbackGroup(decode_callback_group_);
+      decode_callback_group_.reset();
+    }
+    decode_worker_pool_.reset();
   }
 
   void onEnable() override
@@ -162,6 +218,8 @@ protected:
 * Checks if the message pointer
 * is valid, increments messages_received_, then calls
 * processMessage().
+* With parallel decoding, this is called from the decoding threads and only the newest
+* frame is passed on to processMessage() in the main thread.
 */
   void incomingMessage(const typename MessageType::ConstSharedPtr msg)
   {
@@ -170,7 +228,48 @@ protected:
     }
 
     ++messages_received_;
-    QString topic_str = QString::number(messages_received_) + " messages received";
+    requestStatusUpdate();
+
+    if (parallel_decoding_) {
+      if (decode_statistics_.frameDecoded(rclcpp::Time(msg->header.stamp), decode_clock_->now()) &&
+        postToMailbox(msg))
+      {
+        decode_statistics_.frameSkipped();
+      }
+      return;
+    }
+
+    if (conflateMessage(msg)) {
+      return;
+    }
+
+    processMessage(msg);
+    context_->queueRender();
+  }
+
+/// Process a message taken from the mailbox, see conflateMessage().
+  void processTypeErasedMessage(std::shared_ptr<const void> type_erased_message) override
+  {
+    processMessage(std::static_pointer_cast<const MessageType>(type_erased_message));
+    context_->queueRender();
+  }
+
+
+  void updateStatuses() override
+  {
+    rviz_common::_RosTopicDisplay::updateStatuses();
+
+    if (parallel_decoding_) {
+      setStatus(
+        rviz_common::properties::StatusProperty::Ok, "Decoding",
+        decode_statistics_.takeSummary().toString());
+    }
+
+    const uint32_t messages_received = messages_received_;
+    if (messages_received == 0) {
+      return;
+    }
+    QString topic_str = QString::number(messages_received) + " messages received";
     // Append topic subscription frequency if we can lock rviz_ros_node_.
     std::shared_ptr<rviz_common::ros_integration::RosNodeAbstractionIface> node_interface =
       rviz_ros_node_.lock();
@@ -178,29 +277,36 @@ protected:
       const double duration =
         (node_interface->get_raw_node()->now() - subscription_start_time_).seconds();
       const double subscription_frequency =
-        static_cast<double>(messages_received_) / duration;
+        static_cast<double>(messages_received) / duration;
       topic_str += " at " + QString::number(subscription_frequency, 'f', 1) + " hz.";
     }
     setStatus(
       rviz_common::properties::StatusProperty::Ok,
       "Topic",
       topic_str);
-
-    processMessage(msg);
   }
 
-
 /// Implement this to process the contents of a message.
 /**
 * This is called by incomingMessage().
 */
   virtual void processMessage(typename MessageType::ConstSharedPtr msg) = 0;
 
-  uint32_t messages_received_;
+  std::atomic<uint32_t> messages_received_;
 
   std::shared_ptr<image_transport::SubscriberFilter> subscription_;
   rclcpp::Time subscription_start_time_;
   message_filters::Connection subscription_callback_;
+
+  rviz_common::properties::BoolProperty * parallel_decoding_property_;
+
+private:
+  std::atomic<bool> parallel_decoding_;
+  std::shared_ptr<DecodeWorkerPool> decode_worker_pool_;
+  rclcpp::CallbackGroup::SharedPtr decode_callback_group_;
+  rclcpp::Clock::SharedPtr decode_clock_;
+  std::shared_ptr<DecodeCallbackGate> decode_gate_;
+  DecodeStatistics decode_statistics_;
 };
 
 }  //  end namespace displays
@@ -58,6 +58,7 @@
 #include "rviz_rendering/objects/axes.hpp"
 
 #include "rviz_default_plugins/displays/interactive_markers/interactive_marker_control.hpp"
+#include "rviz_default_plugins/displays/interactive_markers/view_facing_controls.hpp"
 
 #include "rviz_default_plugins/visibility_control.hpp"
 
@@ -72,7 +73,9 @@ class RVIZ_DEFAULT_PLUGINS_PUBLIC InteractiveMarker : public QObject
 public:
   using SharedPtr = std::shared_ptr<InteractiveMarker>;
 
-  InteractiveMarker(Ogre::SceneNode * scene_node, rviz_common::DisplayContext * context);
+  InteractiveMarker(
+    Ogre::SceneNode * scene_node, rviz_common::DisplayContext * context,
+    std::shared_ptr<ViewFacingControls> view_facing_controls);
   virtual ~InteractiveMarker();
 
   /// Reset contents to reflect the data from a new message.
@@ -90,6 +93,13 @@ public:
   /// Called every frame update.
   void update();
 
+  /// Whether update() has anything to do.
+  /**
+   * Only markers which are locked to a frame or dragged change between messages,
+   * all others can skip update().
+   */
+  bool needsUpdate();
+
   /// Directly set the pose relative to the parent frame.
   /**
    * If publish is set to true, then the change is published.
@@ -185,6 +195,12 @@ public:
     bool mouse_point_valid = false,
     const Ogre::Vector3 & mouse_point_rel_world = Ogre::Vector3(0, 0, 0));
 
+  /// Turns the VIEW_FACING controls of this marker towards the camera.
+  inline std::shared_ptr<ViewFacingControls> getViewFacingControls()
+  {
+    return view_facing_controls_;
+  }
+
   inline bool hasMenu()
   {
     return has_menu_;
@@ -233,6 +249,8 @@ private:
 
   rviz_common::DisplayContext * context_;
 
+  std::shared_ptr<ViewFacingControls> view_facing_controls_;
+
   std::string reference_frame_;
 
   rclcpp::Time reference_time_;
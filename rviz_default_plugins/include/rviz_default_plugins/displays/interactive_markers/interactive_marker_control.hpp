@@ -41,7 +41,6 @@
 #include <OgreRay.h>
 #include <OgreVector.h>
 #include <OgreQuaternion.h>
-#include <OgreSceneManager.h>
 #endif
 
 #include <QCursor>
@@ -58,6 +57,7 @@
 namespace Ogre
 {
 class SceneNode;
+class Viewport;
 }
 
 namespace rviz_common
@@ -75,11 +75,11 @@ namespace rviz_default_plugins
 namespace displays
 {
 class InteractiveMarker;
+class ViewFacingControls;
 
 /// A single control element of an InteractiveMarker.
 class InteractiveMarkerControl
-  : public Ogre::SceneManager::Listener,
-  public rviz_common::InteractiveObject,
+  : public rviz_common::InteractiveObject,
   public std::enable_shared_from_this<InteractiveMarkerControl>
 {
 public:
@@ -219,13 +219,11 @@ public:
     show_visual_aids_ = show;
   }
 
-protected:
-  /// When this is called, we will face the camera.
-  virtual void preFindVisibleObjects(
-    Ogre::SceneManager * source,
-    Ogre::SceneManager::IlluminationRenderStage irs,
-    Ogre::Viewport * v);
+  /// Face a camera looking along camera_direction, called by ViewFacingControls.
+  void updateControlOrientationForViewFacing(
+    const Ogre::Vector3 & camera_direction, const Ogre::Vector3 & camera_up);
 
+protected:
   void updateControlOrientationForViewFacing(Ogre::Viewport * v);
 
   /// Calculate a mouse ray in the reference frame.
@@ -550,6 +548,9 @@ protected:
 
   bool view_facing_;
 
+  /// Turns this control towards the camera while it is VIEW_FACING.
+  std::shared_ptr<ViewFacingControls> view_facing_controls_;
+
   QCursor cursor_;
 
   QString status_msg_;
@@ -34,6 +34,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "visualization_msgs/msg/interactive_marker.hpp"
@@ -48,6 +49,7 @@
 #include "rviz_common/properties/bool_property.hpp"
 
 #include "rviz_default_plugins/displays/interactive_markers/interactive_marker.hpp"
+#include "rviz_default_plugins/displays/interactive_markers/view_facing_controls.hpp"
 #include "./interactive_marker_namespace_property.hpp"
 #include "rviz_default_plugins/displays/marker/markers/marker_base.hpp"
 
@@ -64,11 +66,25 @@ class InteractiveMarkerDisplay : public rviz_common::Display
 public:
   InteractiveMarkerDisplay();
 
+  // Constructor for testing, creates no InteractiveMarkerClient. Remove once ros_nodes can be
+  // mocked and call initialize() instead
+  explicit InteractiveMarkerDisplay(rviz_common::DisplayContext * context);
+
   // Overrides from Display
   void update(float wall_dt, float ros_dt) override;
 
   void reset() override;
 
+  // Exposed for testing, remove once the InteractiveMarkerClient can be mocked
+  /// Called by InteractiveMarkerClient when an update from a server is received.
+  void updateCallback(visualization_msgs::msg::InteractiveMarkerUpdate::ConstSharedPtr msg);
+
+  /// The marker with the given name, or nullptr if there is none, exposed for testing.
+  InteractiveMarker::SharedPtr getInteractiveMarker(const std::string & name) const;
+
+  /// Number of markers with a pose update waiting for the next frame, exposed for testing.
+  size_t getPendingPoseCount() const;
+
 protected:
   // Overrides from Display
   void fixedFrameChanged() override;
@@ -103,9 +119,6 @@ private:
   /// Called by InteractiveMarkerClient when successfully initialized.
   void initializeCallback(visualization_msgs::srv::GetInteractiveMarkers::Response::SharedPtr);
 
-  /// Called by InteractiveMarkerClient when an update from a server is received.
-  void updateCallback(visualization_msgs::msg::InteractiveMarkerUpdate::ConstSharedPtr msg);
-
   /// Called by InteractiveMarkerClient when it resets.
   void resetCallback();
 
@@ -116,9 +129,13 @@ private:
 
   void updateMarkers(const std::vector<visualization_msgs::msg::InteractiveMarker> & markers);
 
+  /// Queue pose updates, only the latest pose of every marker is kept until the next frame.
   void updatePoses(
     const std::vector<visualization_msgs::msg::InteractiveMarkerPose> & marker_poses);
 
+  /// Apply the queued pose updates, once per marker.
+  void applyPendingPoses();
+
   /// Erase all visualization markers.
   void eraseAllMarkers();
 
@@ -128,8 +145,14 @@ private:
    */
   void eraseMarkers(const std::vector<std::string> & names);
 
+  /// Shared by all markers, declared first so it outlives them
+  std::shared_ptr<ViewFacingControls> view_facing_controls_;
+
   std::map<std::string, InteractiveMarker::SharedPtr> interactive_markers_map_;
 
+  /// Latest pose update received for each marker since the last frame.
+  std::unordered_map<std::string, visualization_msgs::msg::InteractiveMarkerPose> pending_poses_;
+
   // Properties
   InteractiveMarkerNamespaceProperty * interactive_marker_namespace_property_;
   rviz_common::properties::BoolProperty * show_descriptions_property_;
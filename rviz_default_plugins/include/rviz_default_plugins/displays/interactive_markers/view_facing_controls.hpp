@@ -0,0 +1,105 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__INTERACTIVE_MARKERS__VIEW_FACING_CONTROLS_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__INTERACTIVE_MARKERS__VIEW_FACING_CONTROLS_HPP_
+
+#include <unordered_map>
+#include <vector>
+
+#include <OgreQuaternion.h>
+#include <OgreSceneManager.h>
+#include <OgreVector.h>
+
+namespace Ogre
+{
+class Camera;
+class SceneNode;
+class Viewport;
+}
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+class InteractiveMarkerControl;
+
+/// Turns all VIEW_FACING controls of a scene towards the camera in one pass.
+/**
+ * Registered once with the scene manager instead of once per control. Before each
+ * viewport is rendered, the controls are only turned again if the camera or the
+ * reference frame of their marker has turned since they were last updated, or
+ * if they have been invalidated.
+ */
+class ViewFacingControls : public Ogre::SceneManager::Listener
+{
+public:
+  explicit ViewFacingControls(Ogre::SceneManager * scene_manager);
+  ~ViewFacingControls() override;
+
+  /// Start turning the control, reference_node is the node of its marker's reference frame.
+  void add(InteractiveMarkerControl * control, Ogre::SceneNode * reference_node);
+
+  void remove(InteractiveMarkerControl * control);
+
+  /// Turn the control again before the next render, e.g. after its own rotation changed.
+  void invalidate(InteractiveMarkerControl * control);
+
+  size_t size() const {return entries_.size();}
+
+  void preFindVisibleObjects(
+    Ogre::SceneManager * source,
+    Ogre::SceneManager::IlluminationRenderStage irs,
+    Ogre::Viewport * v) override;
+
+private:
+  struct Entry
+  {
+    InteractiveMarkerControl * control;
+    Ogre::SceneNode * reference_node;
+    // world orientation of the reference node when the control was last turned
+    Ogre::Quaternion reference_orientation;
+    bool dirty;
+  };
+
+  Ogre::SceneManager * scene_manager_;
+
+  std::vector<Entry> entries_;
+  std::unordered_map<InteractiveMarkerControl *, size_t> indices_;
+
+  Ogre::Camera * last_camera_;
+  Ogre::Vector3 last_camera_direction_;
+  Ogre::Vector3 last_camera_up_;
+};
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__INTERACTIVE_MARKERS__VIEW_FACING_CONTROLS_HPP_
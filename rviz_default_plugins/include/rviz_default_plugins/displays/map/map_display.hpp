@@ -32,6 +32,7 @@
 #ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__MAP__MAP_DISPLAY_HPP_
 #define RVIZ_DEFAULT_PLUGINS__DISPLAYS__MAP__MAP_DISPLAY_HPP_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -107,7 +108,7 @@ public:
   size_t getWidth() {return width_;}
   size_t getHeight() {return height_;}
 
-  /** @brief Copy msg into current_map_ and call showMap(). */
+  /** @brief Keep msg as current_map_ and call showMap(). */
   void processMessage(nav_msgs::msg::OccupancyGrid::ConstSharedPtr msg) override;
 
 public Q_SLOTS:
@@ -135,6 +136,8 @@ protected:
 
   void onEnable() override;
 
+  void updateStatuses() override;
+
   /** @brief Copy update's data into current_map_ and call showMap(). */
   void incomingUpdate(map_msgs::msg::OccupancyGridUpdate::ConstSharedPtr update);
 
@@ -171,7 +174,10 @@ protected:
   size_t width_;
   size_t height_;
   std::string frame_;
-  nav_msgs::msg::OccupancyGrid current_map_;
+  /// The last map, shared with the message it was received in until an update changes it.
+  nav_msgs::msg::OccupancyGrid::ConstSharedPtr current_map_;
+  /// Copy of the last map owned by the display, once an update has been applied to it.
+  nav_msgs::msg::OccupancyGrid::SharedPtr updated_map_;
 
   rclcpp::Subscription<map_msgs::msg::OccupancyGridUpdate>::SharedPtr update_subscription_;
   rclcpp::QoS update_profile_;
@@ -191,7 +197,7 @@ protected:
   rviz_common::properties::BoolProperty * binary_view_property_;
   rviz_common::properties::IntProperty * binary_threshold_property_;
 
-  uint32_t update_messages_received_;
+  std::atomic<uint32_t> update_messages_received_;
 };
 
 }  // namespace displays
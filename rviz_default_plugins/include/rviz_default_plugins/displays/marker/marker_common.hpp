@@ -32,6 +32,9 @@
 #ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__MARKER__MARKER_COMMON_HPP_
 #define RVIZ_DEFAULT_PLUGINS__DISPLAYS__MARKER__MARKER_COMMON_HPP_
 
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -59,10 +62,16 @@ class QueueSizeProperty;
 
 namespace properties
 {
+class FloatProperty;
 class IntProperty;
 }
 }  // namespace rviz_common
 
+namespace rviz_rendering
+{
+class TextBatch;
+}
+
 using rviz_common::properties::StatusLevel;
 
 namespace rviz_default_plugins
@@ -110,7 +119,7 @@ public:
   void processMessage(visualization_msgs::msg::Marker::ConstSharedPtr message);
 
   /**
-   * \brief Removes all the markers
+   * \brief Removes all the markers, including queued messages which have not been applied yet
    */
   void clearMarkers();
 
@@ -120,6 +129,15 @@ public:
   void setMarkerStatus(MarkerID id, StatusLevel level, const std::string & text);
   void deleteMarkerStatus(MarkerID id);
 
+  /**
+   * \brief Number of markers in the last update() whose content was identical to the previous
+   * message, so their geometry was kept and at most their pose was updated.
+   */
+  size_t getSkippedMarkerCount() const {return skipped_marker_count_;}
+
+  /// Batch shared by the TEXT_VIEW_FACING markers, nullptr unless "Batch Text" is enabled.
+  rviz_rendering::TextBatch * getTextBatch() const {return text_batch_.get();}
+
 private:
   /** @brief Delete all the markers within the given namespace. */
   void deleteMarkersInNamespace(const std::string & ns);
@@ -137,9 +155,27 @@ private:
 
   typedef std::vector<visualization_msgs::msg::Marker::ConstSharedPtr> V_MarkerMessage;
   V_MarkerMessage takeSnapshotOfMessageQueue();
-  void processNewMessages(const V_MarkerMessage & local_queue);
+  /**
+   * \brief Moves messages into the pending queue, replacing queued messages for the same marker.
+   *
+   * Messages queued before a DELETEALL which affects them are dropped.
+   */
+  void queueNewMessages(const V_MarkerMessage & local_queue);
+  void dropPendingMessages(const std::string & ns);
+  /// Processes pending messages until the queue is empty or the time budget is used up.
+  void processPendingMessages();
+  void updateQueueStatus();
+  /// Creates or destroys the text batch after "Batch Text" changed and moves the text markers.
+  void updateTextBatching();
+  /// Reports getSkippedMarkerCount() in relation to the messages processed in this update.
+  void updateSkippedStatus(size_t processed);
+  /// Deletes the markers whose lifetime is over, only looking at the ones which are due.
   void removeExpiredMarkers();
+  void scheduleExpiration(const MarkerBasePtr & marker);
+  /// Removes the marker from the bookkeeping of expiring and frame-locked markers.
+  void untrackMarker(const MarkerBasePtr & marker);
 
+  /// Moves the frame-locked markers, with one transform lookup per frame.
   void updateMarkersWithLockedFrame() const;
   QHash<QString, MarkerNamespace *>::const_iterator getMarkerNamespace(
     const visualization_msgs::msg::Marker::ConstSharedPtr & message);
@@ -149,26 +185,59 @@ private:
   void configureMarker(
     const visualization_msgs::msg::Marker::ConstSharedPtr & message, MarkerBasePtr & marker);
 
+  ///< Declared before markers_, so the labels of the markers are removed before the batch
+  std::unique_ptr<rviz_rendering::TextBatch> text_batch_;
   typedef std::map<MarkerID, MarkerBasePtr> M_IDToMarker;
   typedef std::set<MarkerBasePtr> S_MarkerBase;
   M_IDToMarker markers_;                  ///< Map of marker id to the marker info structure
   S_MarkerBase markers_with_expiration_;
-  S_MarkerBase frame_locked_markers_;
+  ///< Frame-locked markers by frame id
+  std::map<std::string, S_MarkerBase> frame_locked_markers_;
+
+  struct ScheduledExpiration
+  {
+    int64_t expiration;  ///< nanoseconds
+    std::weak_ptr<markers::MarkerBase> marker;
+
+    bool operator>(const ScheduledExpiration & other) const
+    {
+      return expiration > other.expiration;
+    }
+  };
+  ///< Min-heap of the expiration times of markers_with_expiration_. Entries of markers which
+  ///< were deleted or got a new expiration are left in place and skipped once they are due.
+  std::vector<ScheduledExpiration> expiration_queue_;
   ///< Marker message queue.  Messages are added to this as they are received, and then processed
   ///< in our update() function
   V_MarkerMessage message_queue_;
   std::mutex queue_mutex_;
 
+  struct PendingMessage
+  {
+    visualization_msgs::msg::Marker::ConstSharedPtr message;  ///< nullptr if dropped
+    std::chrono::steady_clock::time_point queued_time;
+  };
+  ///< Messages taken from message_queue_ which were not processed yet, because the time budget
+  ///< of the previous frames was used up
+  std::deque<PendingMessage> pending_messages_;
+  uint64_t first_pending_sequence_;  ///< sequence number of pending_messages_.front()
+  std::map<MarkerID, uint64_t> pending_sequence_by_id_;
+  bool queue_status_shown_;
+
   typedef QHash<QString, MarkerNamespace *> M_Namespace;
   M_Namespace namespaces_;
 
   rviz_common::properties::Property * namespaces_category_;
+  rviz_common::properties::FloatProperty * processing_budget_property_;
+  rviz_common::properties::BoolProperty * batch_text_property_;
 
   typedef std::map<QString, bool> M_EnabledState;
   M_EnabledState namespace_config_enabled_state_;
 
   std::unique_ptr<markers::MarkerFactory> marker_factory_;
 
+  size_t skipped_marker_count_;
+
   rviz_common::Display * display_;
   rviz_common::DisplayContext * context_;
   Ogre::SceneNode * scene_node_;
@@ -72,6 +72,7 @@ public:
 protected:
   void onNewMessage(
     const MarkerConstSharedPtr & old_message, const MarkerConstSharedPtr & new_message) override;
+  bool onNewPose(const MarkerConstSharedPtr & new_message) override;
 
   virtual void convertNewMessageToBillboardLine(const MarkerConstSharedPtr & new_message) = 0;
   virtual bool additionalConstraintsAreNotMet(const MarkerConstSharedPtr & new_message)
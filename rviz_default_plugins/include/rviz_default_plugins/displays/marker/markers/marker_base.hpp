@@ -37,6 +37,7 @@
 #include <string>
 #include <utility>
 
+#include <OgreQuaternion.h>
 #include <OgreVector.h>
 
 #include "visualization_msgs/msg/marker.hpp"
@@ -96,9 +97,30 @@ public:
 
   void setMessage(const MarkerConstSharedPtr & message);
 
+  /**
+   * \brief Like setMessage(), but keeps the current geometry if the content did not change.
+   *
+   * If only header or pose differ from the current message, the marker is just moved,
+   * if nothing differs, only the expiration time is updated.
+   * \return true if the geometry of the marker was rebuilt
+   */
+  bool updateMessage(const MarkerConstSharedPtr & message);
+
   bool expired();
 
-  void updateFrameLocked();
+  const rclcpp::Time & getExpiration() const {return expiration_;}
+
+  /// Current transform of a frame, looked up once for all markers locked to it
+  struct LockedFrameTransform
+  {
+    bool valid = false;
+    Ogre::Vector3 position = Ogre::Vector3::ZERO;
+    Ogre::Quaternion orientation = Ogre::Quaternion::IDENTITY;
+    std::string error;  ///< Reported if the transform is not valid
+  };
+
+  /// Moves a frame-locked marker along with its frame, which has the given transform.
+  void updateFrameLocked(const LockedFrameTransform & frame_transform);
 
   const MarkerConstSharedPtr & getMessage() const {return message_;}
 
@@ -132,6 +154,12 @@ protected:
     const MarkerConstSharedPtr & old_message,
     const MarkerConstSharedPtr & new_message) = 0;
 
+  /**
+   * Called instead of onNewMessage() if only header or pose of the message changed.
+   * \return false if the marker cannot update its pose alone and has to be rebuilt
+   */
+  virtual bool onNewPose(const MarkerConstSharedPtr & new_message);
+
   void extractMaterials(Ogre::Entity * entity, S_MaterialPtr & materials);
 
   MarkerCommon * owner_;
@@ -144,6 +172,19 @@ protected:
   rclcpp::Time expiration_;
 
   std::shared_ptr<MarkerSelectionHandler> handler_;
+
+private:
+  void rebuild(const MarkerConstSharedPtr & old_message);
+  bool transformWithLockedFrame(
+    const MarkerConstSharedPtr & message,
+    Ogre::Vector3 & pos,
+    Ogre::Quaternion & orient,
+    Ogre::Vector3 & scale);
+
+  /// Whether the last call to transform() succeeded, i.e. the geometry is complete
+  bool transform_succeeded_;
+  /// Used by transform() instead of a lookup while updateFrameLocked() runs
+  const LockedFrameTransform * locked_frame_transform_;
 };
 
 }  // namespace markers
@@ -66,6 +66,7 @@ public:
 protected:
   void onNewMessage(
     const MarkerConstSharedPtr & old_message, const MarkerConstSharedPtr & new_message) override;
+  bool onNewPose(const MarkerConstSharedPtr & new_message) override;
   void transformAndSetVisibility(
     const MarkerConstSharedPtr & new_message,
     Ogre::Vector3 & position,
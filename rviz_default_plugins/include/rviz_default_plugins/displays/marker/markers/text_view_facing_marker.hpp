@@ -32,6 +32,8 @@
 #ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__MARKER__MARKERS__TEXT_VIEW_FACING_MARKER_HPP_
 #define RVIZ_DEFAULT_PLUGINS__DISPLAYS__MARKER__MARKERS__TEXT_VIEW_FACING_MARKER_HPP_
 
+#include <cstdint>
+
 #include "rviz_default_plugins/displays/marker/markers/marker_base.hpp"
 #include "rviz_default_plugins/visibility_control.hpp"
 
@@ -43,6 +45,7 @@ class SceneNode;
 namespace rviz_rendering
 {
 class MovableText;
+class TextBatch;
 }
 
 namespace rviz_default_plugins
@@ -60,15 +63,32 @@ public:
 
   ~TextViewFacingMarker() override;
 
+  void setPosition(const Ogre::Vector3 & position) override;
+
   void setOrientation(const Ogre::Quaternion & orientation) override {(void) orientation;}
 
   S_MaterialPtr getMaterials() override;
 
+  /**
+   * \brief Moves the text into the given batch of the owner, or back into an own MovableText.
+   *
+   * Batched text is drawn together with the other labels of the batch, but cannot be selected.
+   * @param text_batch The batch to use, nullptr for an own MovableText
+   */
+  void setTextBatch(rviz_rendering::TextBatch * text_batch);
+
 protected:
   void onNewMessage(
     const MarkerConstSharedPtr & old_message, const MarkerConstSharedPtr & new_message) override;
 
+  void createText(const MarkerConstSharedPtr & message);
+  void destroyText();
+  void setTextVisible(bool visible);
+
   rviz_rendering::MovableText * text_;
+  rviz_rendering::TextBatch * text_batch_;  ///< Batch holding the text instead of text_
+  bool has_label_;
+  uint32_t label_;  ///< Label of the text in text_batch_, if has_label_
 };
 
 }  // namespace markers
@@ -75,6 +75,7 @@ public:
 protected:
   void onNewMessage(
     const MarkerConstSharedPtr & old_message, const MarkerConstSharedPtr & new_message) override;
+  bool onNewPose(const MarkerConstSharedPtr & new_message) override;
 
   Ogre::ManualObject * manual_object_;
   Ogre::MaterialPtr material_;
@@ -34,6 +34,10 @@
 #include <deque>
 #include <memory>
 
+#include <OgreColourValue.h>
+#include <OgreQuaternion.h>
+#include <OgreVector.h>
+
 #ifndef Q_MOC_RUN
 
 // TODO(Martin-Idel-SI): Reenable once available
@@ -47,8 +51,8 @@
 
 namespace rviz_rendering
 {
-class Arrow;
-class Axes;
+class ArrowBatch;
+class AxesBatch;
 }  // namespace rviz_rendering
 
 namespace rviz_common
@@ -119,21 +123,26 @@ private Q_SLOTS:
   void updateAxisGeometry();
 
 private:
+  struct OdometryPose
+  {
+    Ogre::Vector3 position;
+    Ogre::Quaternion orientation;
+  };
+
   void setupProperties();
 
-  void updateArrow(const std::unique_ptr<rviz_rendering::Arrow> & arrow);
+  void createShapes();
 
-  void updateAxes(const std::unique_ptr<rviz_rendering::Axes> & axes);
+  /// Refill the batches from poses_, after poses were removed.
+  void rebuildShapes();
 
-  bool messageIsValid(nav_msgs::msg::Odometry::ConstSharedPtr message);
+  void addShapes(const OdometryPose & pose, const Ogre::ColourValue & color);
 
-  bool messageIsSimilarToPrevious(nav_msgs::msg::Odometry::ConstSharedPtr message);
+  Ogre::ColourValue getArrowColor() const;
 
-  std::unique_ptr<rviz_rendering::Arrow> createAndSetArrow(
-    const Ogre::Vector3 & position, const Ogre::Quaternion & orientation, bool use_arrow);
+  bool messageIsValid(nav_msgs::msg::Odometry::ConstSharedPtr message);
 
-  std::unique_ptr<rviz_rendering::Axes> createAndSetAxes(
-    const Ogre::Vector3 & position, const Ogre::Quaternion & orientation, bool use_axes);
+  bool messageIsSimilarToPrevious(nav_msgs::msg::Odometry::ConstSharedPtr message);
 
   std::unique_ptr<rviz_rendering::CovarianceVisual> createAndSetCovarianceVisual(
     const Ogre::Vector3 & position,
@@ -142,8 +151,11 @@ private:
 
   void clear();
 
-  std::deque<std::unique_ptr<rviz_rendering::Arrow>> arrows_;
-  std::deque<std::unique_ptr<rviz_rendering::Axes>> axes_;
+  std::deque<OdometryPose> poses_;
+  // all arrows and all axes are drawn as one batch each, instead of one scene node per pose
+  std::unique_ptr<rviz_rendering::ArrowBatch> arrows_;
+  std::unique_ptr<rviz_rendering::AxesBatch> axes_;
+  // the covariance of every message has its own shape, so these stay separate visuals
   std::deque<std::unique_ptr<rviz_rendering::CovarianceVisual>> covariances_;
 
   nav_msgs::msg::Odometry::ConstSharedPtr last_used_message_;
@@ -38,9 +38,9 @@
 
 #include "rviz_common/message_filter_display.hpp"
 
-#include "rviz_rendering/objects/arrow.hpp"
-#include "rviz_rendering/objects/axes.hpp"
-#include "rviz_rendering/objects/billboard_line.hpp"
+#include "rviz_rendering/objects/arrow_batch.hpp"
+#include "rviz_rendering/objects/axes_batch.hpp"
+#include "rviz_rendering/objects/thick_line.hpp"
 
 #include "rviz_default_plugins/visibility_control.hpp"
 
@@ -103,29 +103,28 @@ private Q_SLOTS:
 
 private:
   void destroyObjects();
-  void allocateArrowVector(std::vector<rviz_rendering::Arrow *> & arrow_vect, size_t num);
-  void allocateAxesVector(std::vector<rviz_rendering::Axes *> & axes_vect, size_t num);
   void destroyPoseAxesChain();
   void destroyPoseArrowChain();
   void updateManualObject(
     Ogre::ManualObject * manual_object, nav_msgs::msg::Path::ConstSharedPtr msg,
     const Ogre::Matrix4 & transform);
   void updateBillBoardLine(
-    rviz_rendering::BillboardLine * billboard_line, nav_msgs::msg::Path::ConstSharedPtr msg,
+    rviz_rendering::ThickLine * billboard_line, nav_msgs::msg::Path::ConstSharedPtr msg,
     const Ogre::Matrix4 & transform);
   void updatePoseMarkers(
     size_t buffer_index, nav_msgs::msg::Path::ConstSharedPtr msg, const Ogre::Matrix4 & transform);
   void updateAxesMarkers(
-    std::vector<rviz_rendering::Axes *> & axes_vect, nav_msgs::msg::Path::ConstSharedPtr msg,
+    rviz_rendering::AxesBatch * axes, nav_msgs::msg::Path::ConstSharedPtr msg,
     const Ogre::Matrix4 & transform);
   void updateArrowMarkers(
-    std::vector<rviz_rendering::Arrow *> & arrow_vect, nav_msgs::msg::Path::ConstSharedPtr msg,
+    rviz_rendering::ArrowBatch * arrows, nav_msgs::msg::Path::ConstSharedPtr msg,
     const Ogre::Matrix4 & transform);
 
   std::vector<Ogre::ManualObject *> manual_objects_;
-  std::vector<rviz_rendering::BillboardLine *> billboard_lines_;
-  std::vector<std::vector<rviz_rendering::Axes *>> axes_chain_;
-  std::vector<std::vector<rviz_rendering::Arrow *>> arrow_chain_;
+  std::vector<rviz_rendering::ThickLine *> billboard_lines_;
+  // one batch of pose markers per buffered path, created when first needed
+  std::vector<rviz_rendering::AxesBatch *> axes_chain_;
+  std::vector<rviz_rendering::ArrowBatch *> arrow_chain_;
   Ogre::MaterialPtr lines_material_;
 
   rviz_common::properties::EnumProperty * style_property_;
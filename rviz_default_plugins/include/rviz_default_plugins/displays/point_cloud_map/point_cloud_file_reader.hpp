@@ -0,0 +1,68 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_FILE_READER_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_FILE_READER_HPP_
+
+#include <string>
+#include <vector>
+
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_octree.hpp"
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+/**
+ * \brief Read the points of a PCD or PLY file, chosen by file extension.
+ *
+ * Supported are ascii and binary (little endian) files with x, y and z fields and
+ * optional color, either as PCD rgb/rgba field or as PLY red, green, blue (and alpha)
+ * properties. Points without color are white.
+ *
+ * \return false, with a message in error, if the file could not be read.
+ */
+RVIZ_DEFAULT_PLUGINS_PUBLIC
+bool readPointCloudFile(
+  const std::string & path, std::vector<OctreeFilePoint> & points, std::string & error);
+
+RVIZ_DEFAULT_PLUGINS_PUBLIC
+bool readPcdFile(
+  const std::string & path, std::vector<OctreeFilePoint> & points, std::string & error);
+
+RVIZ_DEFAULT_PLUGINS_PUBLIC
+bool readPlyFile(
+  const std::string & path, std::vector<OctreeFilePoint> & points, std::string & error);
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_FILE_READER_HPP_
@@ -0,0 +1,171 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_MAP_DISPLAY_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_MAP_DISPLAY_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rviz_common/display.hpp"
+#include "rviz_rendering/objects/point_cloud.hpp"
+
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_octree.hpp"
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace Ogre
+{
+class Camera;
+}
+
+namespace rviz_common
+{
+namespace properties
+{
+class EnumProperty;
+class FilePickerProperty;
+class FloatProperty;
+class IntProperty;
+class TfFrameProperty;
+}
+}
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+/**
+ * \class PointCloudMapDisplay
+ * \brief Displays a large, static point cloud map from an octree file.
+ *
+ * The file is written by the point_cloud_octree_converter executable from a PCD or PLY file.
+ * It is memory mapped and only the octree nodes which are visible and large enough on screen
+ * are decoded by a background thread and uploaded, coarse nodes first. Decoded nodes are kept
+ * in a least recently used cache bounded by the memory budget.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC PointCloudMapDisplay : public rviz_common::Display
+{
+  Q_OBJECT
+
+public:
+  PointCloudMapDisplay();
+
+  ~PointCloudMapDisplay() override;
+
+  void onInitialize() override;
+
+  void update(float wall_dt, float ros_dt) override;
+
+  void reset() override;
+
+protected:
+  void onEnable() override;
+
+  void onDisable() override;
+
+private Q_SLOTS:
+  void updateFile();
+  void updateStyle();
+  void updateBillboardSize();
+  void updateAlpha();
+  void updateMemoryBudget();
+
+private:
+  using Points = std::vector<rviz_rendering::PointCloud::CompactPoint>;
+
+  struct CachedNode
+  {
+    Points points;
+    std::list<uint32_t>::iterator lru_position;
+  };
+
+  void openFile();
+  void closeFile();
+
+  void startLoader();
+  void stopLoader();
+  void loaderThread();
+
+  bool updateReferenceFrame();
+  void selectNodes(Ogre::Camera * camera, std::vector<uint32_t> & selected);
+  float getProjectedSize(Ogre::Camera * camera, const OctreeFileNode & node) const;
+  void requestNodes(const std::vector<uint32_t> & selected);
+  void insertLoadedNodes();
+  void showNodes(const std::vector<uint32_t> & selected);
+  void showNode(uint32_t index, CachedNode & cached);
+  void hideAllNodes();
+  void touchCachedNode(CachedNode & cached);
+  void evictCachedNodes();
+  void clearCache();
+
+  float getPointSize() const;
+  static size_t getCachedSize(const CachedNode & cached);
+
+  rviz_common::properties::FilePickerProperty * file_property_;
+  rviz_common::properties::TfFrameProperty * frame_property_;
+  rviz_common::properties::EnumProperty * style_property_;
+  rviz_common::properties::FloatProperty * point_world_size_property_;
+  rviz_common::properties::FloatProperty * point_pixel_size_property_;
+  rviz_common::properties::FloatProperty * alpha_property_;
+  rviz_common::properties::IntProperty * point_budget_property_;
+  rviz_common::properties::IntProperty * memory_budget_property_;
+  rviz_common::properties::FloatProperty * min_node_size_property_;
+
+  std::shared_ptr<PointCloudOctree> octree_;
+
+  std::map<uint32_t, std::shared_ptr<rviz_rendering::PointCloud>> visible_nodes_;
+
+  std::unordered_map<uint32_t, CachedNode> cache_;
+  std::list<uint32_t> lru_;  // most recently used first
+  size_t cache_size_;
+
+  // Shared with the loader thread
+  std::thread loader_;
+  std::mutex loader_mutex_;
+  std::condition_variable loader_condition_;
+  std::deque<uint32_t> requested_nodes_;
+  std::vector<std::pair<uint32_t, Points>> loaded_nodes_;
+  int64_t loading_node_;  // -1 while idle
+  bool stop_loader_;
+};
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_MAP_DISPLAY_HPP_
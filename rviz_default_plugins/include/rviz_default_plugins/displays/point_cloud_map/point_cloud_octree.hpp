@@ -0,0 +1,176 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_OCTREE_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_OCTREE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+/**
+ * Layout of a point cloud octree file. All values are little endian.
+ *
+ * The file starts with an OctreeFileHeader, followed by node_count OctreeFileNodes, followed
+ * by the points of all nodes. Every node stores a spatially uniform sample of the points
+ * below it, its children only store the points which were not sampled by their ancestors.
+ * Drawing a node together with some of its ancestors is therefore always a valid, less
+ * detailed view of the cloud.
+ */
+struct OctreeFilePoint
+{
+  float x;
+  float y;
+  float z;
+  uint8_t r;
+  uint8_t g;
+  uint8_t b;
+  uint8_t a;
+};
+static_assert(sizeof(OctreeFilePoint) == 16, "unexpected padding in OctreeFilePoint");
+
+struct OctreeFileNode
+{
+  float center[3];
+  float half_size;
+  uint64_t first_point;
+  uint32_t point_count;
+  /// index of each child node, 0 if the child does not exist (the root is never a child)
+  uint32_t children[8];
+  uint32_t depth;
+};
+static_assert(sizeof(OctreeFileNode) == 64, "unexpected padding in OctreeFileNode");
+
+struct OctreeFileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t node_count;
+  uint64_t point_count;
+  uint64_t nodes_offset;
+  uint64_t points_offset;
+};
+static_assert(sizeof(OctreeFileHeader) == 40, "unexpected padding in OctreeFileHeader");
+
+/**
+ * \class PointCloudOctree
+ * \brief Read-only, memory-mapped view of a point cloud octree file.
+ *
+ * Only the pages of the nodes which are actually accessed are read from disk, so files
+ * much larger than the available memory can be opened.
+ * All const member functions are safe to call from several threads.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC PointCloudOctree
+{
+public:
+  PointCloudOctree();
+  ~PointCloudOctree();
+
+  PointCloudOctree(const PointCloudOctree &) = delete;
+  PointCloudOctree & operator=(const PointCloudOctree &) = delete;
+
+  /// Map the given file, returns false and sets an error message if it is not a valid octree.
+  bool open(const std::string & path, std::string & error);
+  void close();
+
+  bool isOpen() const;
+  uint32_t getNodeCount() const;
+  uint64_t getPointCount() const;
+
+  const OctreeFileNode & getNode(uint32_t index) const;
+  const OctreeFilePoint * getPoints(const OctreeFileNode & node) const;
+
+private:
+  bool validate(std::string & error) const;
+
+  void * mapping_;
+  size_t size_;
+#ifdef _WIN32
+  void * file_handle_;
+  void * mapping_handle_;
+#endif
+  const OctreeFileHeader * header_;
+  const OctreeFileNode * nodes_;
+  const OctreeFilePoint * points_;
+};
+
+/**
+ * \class PointCloudOctreeBuilder
+ * \brief Sorts points into an octree and writes it in the format read by PointCloudOctree.
+ *
+ * All points are kept in memory while building.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC PointCloudOctreeBuilder
+{
+public:
+  /**
+   * \param max_points_per_node Nodes with more points below them are split
+   * \param sample_grid_size Cells per axis of the grid used to sample points into inner nodes
+   */
+  explicit PointCloudOctreeBuilder(
+    uint32_t max_points_per_node = 65536, uint32_t sample_grid_size = 128);
+
+  void build(std::vector<OctreeFilePoint> points);
+
+  bool write(const std::string & path, std::string & error) const;
+
+  const std::vector<OctreeFileNode> & getNodes() const {return nodes_;}
+  const std::vector<OctreeFilePoint> & getPoints() const {return points_;}
+
+private:
+  struct PendingNode
+  {
+    uint32_t node;
+    size_t begin;
+    size_t end;
+  };
+
+  void buildNode(
+    std::vector<OctreeFilePoint> & input, const PendingNode & pending,
+    std::vector<PendingNode> & queue);
+
+  uint32_t max_points_per_node_;
+  uint32_t sample_grid_size_;
+
+  std::vector<OctreeFileNode> nodes_;
+  std::vector<OctreeFilePoint> points_;
+};
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINT_CLOUD_MAP__POINT_CLOUD_OCTREE_HPP_
@@ -56,6 +56,8 @@ namespace displays
 struct Offsets
 {
   uint32_t x, y, z;
+  // datatype of x, y and z, FLOAT32 or FLOAT64
+  uint8_t datatype;
 };
 
 // TODO(greimela) This display originally extended the MessageFilterDisplay. Revisit when available
@@ -82,7 +84,8 @@ public:
    * will get their points put off in lala land, but it means they still do get processed/rendered
    * which can be a big performance hit
    * @param cloud The cloud to be filtered
-   * @return A new cloud containing only the filtered points
+   * @return A new cloud containing only the filtered points, or cloud itself if all of its points
+   *   are valid
    */
   sensor_msgs::msg::PointCloud2::ConstSharedPtr filterOutInvalidPoints(
     sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud) const;
@@ -105,8 +108,10 @@ protected:
 private:
   std::unique_ptr<PointCloudCommon> point_cloud_common_;
 
-  sensor_msgs::msg::PointCloud2::_data_type
-  filterData(sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud) const;
+  sensor_msgs::msg::PointCloud2::_data_type filterData(
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud,
+    sensor_msgs::msg::PointCloud2::_data_type::const_iterator first_invalid_point,
+    Offsets offsets) const;
 
   bool validateFloatsAtPosition(
     sensor_msgs::msg::PointCloud2::_data_type::const_iterator position, Offsets offsets) const;
@@ -60,6 +60,7 @@
 #include "point_cloud_transformer.hpp"
 #include "point_cloud_selection_handler.hpp"
 
+#include "rviz_default_plugins/displays/pointcloud/point_cloud_downsampler.hpp"
 #include "rviz_default_plugins/displays/pointcloud/point_cloud_selection_handler.hpp"
 #include "rviz_default_plugins/displays/pointcloud/point_cloud_transformer.hpp"
 #include "rviz_default_plugins/displays/pointcloud/point_cloud_transformer_factory.hpp"
@@ -79,6 +80,7 @@ namespace properties
 class BoolProperty;
 class EnumProperty;
 class FloatProperty;
+class IntProperty;
 
 }  // namespace properties
 
@@ -104,6 +106,12 @@ struct RVIZ_DEFAULT_PLUGINS_PUBLIC CloudInfo
   void setSelectable(
     bool selectable, float selection_box_size, rviz_common::DisplayContext * context);
 
+  /// Map the index of a rendered point back to the index of the point in message_
+  uint64_t getMessageIndex(uint64_t index) const;
+
+  /// Transformed points, held by cloud_ once it is created
+  const std::vector<rviz_rendering::PointCloud::CompactPoint> & getPoints() const;
+
   rclcpp::Time receive_time_;
 
   Ogre::SceneManager * manager_;
@@ -114,7 +122,11 @@ struct RVIZ_DEFAULT_PLUGINS_PUBLIC CloudInfo
   std::shared_ptr<rviz_rendering::PointCloud> cloud_;
   PointCloudSelectionHandlerPtr selection_handler_;
 
-  std::vector<rviz_rendering::PointCloud::Point> transformed_points_;
+  // moved into cloud_ when it is filled, so the points are only kept once
+  std::vector<rviz_rendering::PointCloud::CompactPoint> transformed_points_;
+  // message index of each transformed point, empty if no points were filtered out
+  std::vector<uint32_t> point_indices_;
+  size_t unfiltered_point_count_;
 
   Ogre::Quaternion orientation_;
   Ogre::Vector3 position_;
@@ -162,6 +174,10 @@ public:
   rviz_common::properties::EnumProperty * color_transformer_property_;
   rviz_common::properties::EnumProperty * style_property_;
   rviz_common::properties::FloatProperty * decay_time_property_;
+  rviz_common::properties::EnumProperty * downsampling_property_;
+  rviz_common::properties::FloatProperty * voxel_size_property_;
+  rviz_common::properties::IntProperty * target_point_count_property_;
+  rviz_common::properties::BoolProperty * level_of_detail_property_;
 
   void setAutoSize(bool auto_size);
 
@@ -175,6 +191,8 @@ private Q_SLOTS:
   void updateAlpha();
   void updateXyzTransformer();
   void updateColorTransformer();
+  void updateDownsampling();
+  void updateLevelOfDetail();
   void setXyzTransformerOptions(rviz_common::properties::EnumProperty * prop);
   void setColorTransformerOptions(rviz_common::properties::EnumProperty * prop);
 
@@ -253,6 +271,9 @@ private:
 
   std::unique_ptr<PointCloudTransformerFactory> transformer_factory_;
 
+  // guarded by transformers_mutex_, as it is applied right after the transformers
+  PointCloudDownsampler downsampler_;
+
   rviz_common::Display * display_;
   rviz_common::DisplayContext * context_;
   rclcpp::Clock::SharedPtr clock_;
@@ -0,0 +1,118 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_CLOUD_DOWNSAMPLER_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_CLOUD_DOWNSAMPLER_HPP_
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "rviz_default_plugins/displays/pointcloud/point_cloud_transformer.hpp"
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+
+/**
+ * \class PointCloudDownsampler
+ * \brief Reduces a transformed point cloud before it is handed to the renderer.
+ *
+ * The downsampler keeps its scratch buffers between calls, so once it has seen a cloud of a
+ * given size, filtering further clouds of that size does not allocate.
+ * Surviving points are compacted in place and keep their original order.
+ * It selects points by their positions only, so it runs before the points are colored.
+ * Filtering is single threaded and runs on the thread processing the messages, which is the
+ * GUI thread spinning the executor.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC PointCloudDownsampler
+{
+public:
+  enum Mode
+  {
+    None = 0,
+    VoxelGrid = 1,
+    RandomSubsample = 2,
+  };
+
+  PointCloudDownsampler();
+
+  void setMode(Mode mode);
+  Mode getMode() const {return mode_;}
+
+  /// Edge length of a voxel in meters, used by the VoxelGrid mode.
+  void setVoxelSize(float voxel_size);
+  float getVoxelSize() const {return voxel_size_;}
+
+  /// Maximum number of points to keep, used by the RandomSubsample mode.
+  void setTargetPointCount(uint32_t target_point_count);
+  uint32_t getTargetPointCount() const {return target_point_count_;}
+
+  /**
+   * \brief Filter points in place.
+   * \param points The points to filter. On return only the kept points remain.
+   * \param kept_indices On return holds, for each kept point, its index in the input,
+   *        or is empty if no point was removed.
+   * \return true if any point was removed.
+   */
+  bool filter(V_PointCloudPoint & points, std::vector<uint32_t> & kept_indices);
+
+private:
+  // Integer voxel coordinates are kept at full width, so distant points do not share a voxel.
+  struct VoxelKey
+  {
+    int64_t x;
+    int64_t y;
+    int64_t z;
+    uint32_t index;
+
+    bool sameVoxel(const VoxelKey & other) const
+    {
+      return x == other.x && y == other.y && z == other.z;
+    }
+  };
+
+  void selectVoxelRepresentatives(const V_PointCloudPoint & points);
+  void selectRandomSubset(size_t point_count);
+  void compact(V_PointCloudPoint & points, std::vector<uint32_t> & kept_indices) const;
+
+  Mode mode_;
+  float voxel_size_;
+  uint32_t target_point_count_;
+
+  std::minstd_rand random_engine_;
+
+  // scratch buffers, reused between calls
+  std::vector<VoxelKey> voxel_keys_;
+  std::vector<uint32_t> selected_;
+};
+
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_CLOUD_DOWNSAMPLER_HPP_
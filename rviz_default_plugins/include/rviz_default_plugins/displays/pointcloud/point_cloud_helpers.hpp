@@ -39,6 +39,7 @@
 #include "rviz_common/properties/property.hpp"
 
 #include "rviz_default_plugins/displays/pointcloud/point_cloud_transformer.hpp"
+#include "rviz_default_plugins/displays/pointcloud/point_field_decoder.hpp"
 
 namespace rviz_common
 {
@@ -72,6 +73,7 @@ inline int32_t findChannelIndex(
   return -1;
 }
 
+/// Value of a single point, use decodePointField() for all points of a cloud.
 template<typename T>
 inline T valueFromCloud(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
@@ -83,47 +85,10 @@ inline T valueFromCloud(
   const uint8_t * data = &cloud->data[(point_step * index) + offset];
   T ret = 0;
 
-  switch (type) {
-    case sensor_msgs::msg::PointField::INT8:
-    case sensor_msgs::msg::PointField::UINT8:
-      {
-        uint8_t val = *reinterpret_cast<const uint8_t *>(data);
-        ret = static_cast<T>(val);
-        break;
-      }
-
-    case sensor_msgs::msg::PointField::INT16:
-    case sensor_msgs::msg::PointField::UINT16:
-      {
-        uint16_t val = *reinterpret_cast<const uint16_t *>(data);
-        ret = static_cast<T>(val);
-        break;
-      }
-
-    case sensor_msgs::msg::PointField::INT32:
-    case sensor_msgs::msg::PointField::UINT32:
-      {
-        uint32_t val = *reinterpret_cast<const uint32_t *>(data);
-        ret = static_cast<T>(val);
-        break;
-      }
-
-    case sensor_msgs::msg::PointField::FLOAT32:
-      {
-        float val = *reinterpret_cast<const float *>(data);
-        ret = static_cast<T>(val);
-        break;
-      }
-
-    case sensor_msgs::msg::PointField::FLOAT64:
-      {
-        double val = *reinterpret_cast<const double *>(data);
-        ret = static_cast<T>(val);
-        break;
-      }
-    default:
-      break;
-  }
+  dispatchPointFieldType(
+    type, [&](auto value) {
+      ret = static_cast<T>(readPointFieldValue<decltype(value)>(data));
+    });
 
   return ret;
 }
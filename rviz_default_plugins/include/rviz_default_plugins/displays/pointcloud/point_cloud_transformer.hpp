@@ -43,6 +43,7 @@
 
 #include "rviz_rendering/objects/point_cloud.hpp"
 
+#include "rviz_default_plugins/displays/pointcloud/point_field_decoder.hpp"
 #include "rviz_default_plugins/visibility_control.hpp"
 #endif
 
@@ -100,6 +101,22 @@ public:
     const Ogre::Matrix4 & transform,
     V_PointCloudPoint & out) = 0;
 
+  /**
+   * \brief Like transform(), but only for the points of the cloud kept by a downsampling filter.
+   * out holds one point per index, in the order of indices. Transformers which compute
+   * bounds over the cloud should override this to compute them over all points, the
+   * default implementation transforms a copy of the cloud which only holds the kept points.
+   */
+  virtual bool transformSelected(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+    uint32_t mask,
+    const Ogre::Matrix4 & transform,
+    const std::vector<uint32_t> & indices,
+    V_PointCloudPoint & out)
+  {
+    return this->transform(copySelectedPoints(*cloud, indices), mask, transform, out);
+  }
+
   /**
    * \brief "Score" a message for how well supported the message is.  For example, a "flat color" transformer can support any cloud, but will
    * return a score of 0 here since it should not be preferred over others that explicitly support fields in the message.  This allows that
@@ -31,6 +31,7 @@
 #ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_CLOUD_TRANSPORT_DISPLAY_HPP_
 #define RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_CLOUD_TRANSPORT_DISPLAY_HPP_
 
+#include <atomic>
 #include <memory>
 
 #include "get_transport_from_topic.hpp"
@@ -77,7 +78,7 @@ public:
 
   void reset() override
   {
-    Display::reset();
+    _RosTopicDisplay::reset();
     messages_received_ = 0;
   }
 
@@ -167,7 +168,33 @@ protected:
     }
 
     ++messages_received_;
-    QString topic_str = QString::number(messages_received_) + " messages received";
+    requestStatusUpdate();
+
+    if (conflateMessage(msg)) {
+      return;
+    }
+
+    processMessage(msg);
+    context_->queueRender();
+  }
+
+/// Process a message taken from the mailbox, see conflateMessage().
+  void processTypeErasedMessage(std::shared_ptr<const void> type_erased_message) override
+  {
+    processMessage(std::static_pointer_cast<const MessageType>(type_erased_message));
+    context_->queueRender();
+  }
+
+
+  void updateStatuses() override
+  {
+    rviz_common::_RosTopicDisplay::updateStatuses();
+
+    const uint32_t messages_received = messages_received_;
+    if (messages_received == 0) {
+      return;
+    }
+    QString topic_str = QString::number(messages_received) + " messages received";
     // Append topic subscription frequency if we can lock rviz_ros_node_.
     std::shared_ptr<rviz_common::ros_integration::RosNodeAbstractionIface> node_interface =
       rviz_ros_node_.lock();
@@ -175,25 +202,22 @@ protected:
       const double duration =
         (node_interface->get_raw_node()->now() - subscription_start_time_).seconds();
       const double subscription_frequency =
-        static_cast<double>(messages_received_) / duration;
+        static_cast<double>(messages_received) / duration;
       topic_str += " at " + QString::number(subscription_frequency, 'f', 1) + " hz.";
     }
     setStatus(
       rviz_common::properties::StatusProperty::Ok,
       "Topic",
       topic_str);
-
-    processMessage(msg);
   }
 
-
 /// Implement this to process the contents of a message.
 /**
 * This is called by incomingMessage().
 */
   virtual void processMessage(typename MessageType::ConstSharedPtr msg) = 0;
 
-  uint32_t messages_received_;
+  std::atomic<uint32_t> messages_received_;
   rclcpp::Time subscription_start_time_;
 
   std::shared_ptr<point_cloud_transport::SubscriberFilter> subscription_;
@@ -0,0 +1,202 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_FIELD_DECODER_HPP_
+#define RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_FIELD_DECODER_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "sensor_msgs/msg/point_cloud2.hpp"
+#include "sensor_msgs/msg/point_field.hpp"
+
+namespace rviz_default_plugins
+{
+
+/// C++ type of the values of a sensor_msgs::msg::PointField datatype
+template<uint8_t datatype>
+struct PointFieldValue;
+
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::INT8> {using type = int8_t;};
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::UINT8> {using type = uint8_t;};
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::INT16> {using type = int16_t;};
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::UINT16> {using type = uint16_t;};
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::INT32> {using type = int32_t;};
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::UINT32> {using type = uint32_t;};
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::FLOAT32> {using type = float;};
+template<>
+struct PointFieldValue<sensor_msgs::msg::PointField::FLOAT64> {using type = double;};
+
+/// Read a value from cloud data, which need not be aligned for T.
+template<typename T>
+inline T readPointFieldValue(const uint8_t * data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+/// Call function with a value of the C++ type of datatype, e.g. with float() for FLOAT32.
+/**
+ * The function is instantiated once per datatype, so loops over the points inside of it
+ * read the values directly instead of looking at the datatype for every point.
+ *
+ * \return false if the datatype is unknown, the function is not called then
+ */
+template<typename Function>
+inline bool dispatchPointFieldType(uint8_t datatype, Function && function)
+{
+  using sensor_msgs::msg::PointField;
+  switch (datatype) {
+    case PointField::INT8:
+      function(PointFieldValue<PointField::INT8>::type());
+      return true;
+    case PointField::UINT8:
+      function(PointFieldValue<PointField::UINT8>::type());
+      return true;
+    case PointField::INT16:
+      function(PointFieldValue<PointField::INT16>::type());
+      return true;
+    case PointField::UINT16:
+      function(PointFieldValue<PointField::UINT16>::type());
+      return true;
+    case PointField::INT32:
+      function(PointFieldValue<PointField::INT32>::type());
+      return true;
+    case PointField::UINT32:
+      function(PointFieldValue<PointField::UINT32>::type());
+      return true;
+    case PointField::FLOAT32:
+      function(PointFieldValue<PointField::FLOAT32>::type());
+      return true;
+    case PointField::FLOAT64:
+      function(PointFieldValue<PointField::FLOAT64>::type());
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Decode a field of type T of count points, which are point_step bytes apart.
+template<typename T, typename OutputT>
+inline void decodePointField(
+  const uint8_t * data, uint32_t point_step, size_t count, OutputT * output)
+{
+  for (size_t i = 0; i < count; ++i) {
+    output[i] = static_cast<OutputT>(readPointFieldValue<T>(data + i * point_step));
+  }
+}
+
+/// Decode a field of every point of the cloud into values, one per point.
+/**
+ * \return false if the datatype of the field is unknown
+ */
+template<typename OutputT>
+inline bool decodePointField(
+  const sensor_msgs::msg::PointCloud2 & cloud,
+  const sensor_msgs::msg::PointField & field,
+  std::vector<OutputT> & values)
+{
+  const size_t num_points = static_cast<size_t>(cloud.width) * cloud.height;
+  values.resize(num_points);
+  const uint8_t * data = cloud.data.data() + field.offset;
+  return dispatchPointFieldType(
+    field.datatype, [&](auto value) {
+      decodePointField<decltype(value)>(data, cloud.point_step, num_points, values.data());
+    });
+}
+
+/// Call function(index, x, y, z) with the position of every point of the cloud as floats.
+/**
+ * \return false if the three fields do not have the same, known datatype
+ */
+template<typename Function>
+inline bool forEachPointPosition(
+  const sensor_msgs::msg::PointCloud2 & cloud,
+  const sensor_msgs::msg::PointField & x_field,
+  const sensor_msgs::msg::PointField & y_field,
+  const sensor_msgs::msg::PointField & z_field,
+  Function && function)
+{
+  if (x_field.datatype != y_field.datatype || x_field.datatype != z_field.datatype) {
+    return false;
+  }
+
+  const size_t num_points = static_cast<size_t>(cloud.width) * cloud.height;
+  const uint32_t point_step = cloud.point_step;
+  const uint8_t * point = cloud.data.data();
+  return dispatchPointFieldType(
+    x_field.datatype, [&](auto value) {
+      using T = decltype(value);
+      for (size_t i = 0; i < num_points; ++i, point += point_step) {
+        function(
+          i,
+          static_cast<float>(readPointFieldValue<T>(point + x_field.offset)),
+          static_cast<float>(readPointFieldValue<T>(point + y_field.offset)),
+          static_cast<float>(readPointFieldValue<T>(point + z_field.offset)));
+      }
+    });
+}
+
+/// Copy of the cloud which only holds the points at the given indices, as a single row.
+inline sensor_msgs::msg::PointCloud2::SharedPtr copySelectedPoints(
+  const sensor_msgs::msg::PointCloud2 & cloud, const std::vector<uint32_t> & indices)
+{
+  auto selected = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  selected->header = cloud.header;
+  selected->height = 1;
+  selected->width = static_cast<uint32_t>(indices.size());
+  selected->fields = cloud.fields;
+  selected->is_bigendian = cloud.is_bigendian;
+  selected->point_step = cloud.point_step;
+  selected->row_step = cloud.point_step * selected->width;
+  selected->is_dense = cloud.is_dense;
+  selected->data.resize(static_cast<size_t>(selected->row_step));
+  uint8_t * output = selected->data.data();
+  for (uint32_t index : indices) {
+    std::memcpy(
+      output, cloud.data.data() + static_cast<size_t>(index) * cloud.point_step, cloud.point_step);
+    output += cloud.point_step;
+  }
+  return selected;
+}
+
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__POINT_FIELD_DECODER_HPP_
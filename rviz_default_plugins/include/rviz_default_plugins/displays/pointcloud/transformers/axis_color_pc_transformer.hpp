@@ -58,6 +58,14 @@ public:
     const Ogre::Matrix4 & transform,
     rviz_default_plugins::V_PointCloudPoint & points_out) override;
 
+  /// Bounds are computed over all points, but only the selected points are colored.
+  bool transformSelected(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+    uint32_t mask,
+    const Ogre::Matrix4 & transform,
+    const std::vector<uint32_t> & indices,
+    V_PointCloudPoint & points_out) override;
+
   void createProperties(
     rviz_common::properties::Property * parent_property,
     uint32_t mask,
@@ -78,6 +86,13 @@ private Q_SLOTS:
   void updateAutoComputeBounds();
 
 private:
+  /// Color points_out[i] by point indices[i] of the cloud, or by point i without indices.
+  bool colorPoints(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+    const Ogre::Matrix4 & transform,
+    const std::vector<uint32_t> * indices,
+    V_PointCloudPoint & points_out);
+
   rviz_common::properties::BoolProperty * auto_compute_bounds_property_;
   rviz_common::properties::FloatProperty * min_value_property_;
   rviz_common::properties::FloatProperty * max_value_property_;
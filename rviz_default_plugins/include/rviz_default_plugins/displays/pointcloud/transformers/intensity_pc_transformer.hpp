@@ -31,6 +31,8 @@
 #ifndef RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__TRANSFORMERS__INTENSITY_PC_TRANSFORMER_HPP_
 #define RVIZ_DEFAULT_PLUGINS__DISPLAYS__POINTCLOUD__TRANSFORMERS__INTENSITY_PC_TRANSFORMER_HPP_
 
+#include <vector>
+
 #include "rviz_common/properties/editable_enum_property.hpp"
 #include "rviz_common/properties/bool_property.hpp"
 #include "rviz_common/properties/color_property.hpp"
@@ -56,6 +58,14 @@ public:
     const Ogre::Matrix4 & transform,
     V_PointCloudPoint & points_out) override;
 
+  /// Bounds are computed over all points, but only the selected points are colored.
+  bool transformSelected(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+    uint32_t mask,
+    const Ogre::Matrix4 & transform,
+    const std::vector<uint32_t> & indices,
+    V_PointCloudPoint & points_out) override;
+
   uint8_t score(const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud) override;
 
   void createProperties(
@@ -73,6 +83,12 @@ private Q_SLOTS:
   void updateAutoComputeIntensityBounds();
 
 private:
+  /// Color points_out[i] by point indices[i] of the cloud, or by point i without indices.
+  bool colorPoints(
+    const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+    const std::vector<uint32_t> * indices,
+    V_PointCloudPoint & points_out);
+
   V_string available_channels_;
 
   rviz_common::properties::ColorProperty * min_color_property_;
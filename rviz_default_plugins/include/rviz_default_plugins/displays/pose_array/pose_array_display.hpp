@@ -62,8 +62,8 @@ class FloatProperty;
 
 namespace rviz_rendering
 {
-class Arrow;
-class Axes;
+class ArrowBatch;
+class AxesBatch;
 }  // namespace rviz_rendering
 
 namespace rviz_default_plugins
@@ -123,16 +123,12 @@ private:
   void updateArrows2d();
   void updateArrows3d();
   void updateAxes();
-  std::unique_ptr<rviz_rendering::Axes> makeAxes();
-  std::unique_ptr<rviz_rendering::Arrow> makeArrow3d();
+  void createShapes(Ogre::SceneNode * scene_node);
 
   std::vector<OgrePose> poses_;
   std::unique_ptr<FlatArrowsArray> arrows2d_;
-  std::vector<std::unique_ptr<rviz_rendering::Arrow>> arrows3d_;
-  std::vector<std::unique_ptr<rviz_rendering::Axes>> axes_;
-
-  Ogre::SceneNode * arrow_node_;
-  Ogre::SceneNode * axes_node_;
+  std::unique_ptr<rviz_rendering::ArrowBatch> arrows3d_;
+  std::unique_ptr<rviz_rendering::AxesBatch> axes_;
 
   rviz_common::properties::EnumProperty * shape_property_;
   rviz_common::properties::ColorProperty * arrow_color_property_;
@@ -104,8 +104,7 @@ public:
   rviz_common::interaction::CollObjectHandle axes_coll_;
   FrameSelectionHandlerPtr selection_handler_;
   rviz_rendering::Arrow * parent_arrow_;
-  rviz_rendering::MovableText * name_text_;
-  Ogre::SceneNode * name_node_;
+  rviz_rendering::TextBatch::LabelId name_label_;
 
   float distance_to_parent_;
   Ogre::Quaternion arrow_orientation_;
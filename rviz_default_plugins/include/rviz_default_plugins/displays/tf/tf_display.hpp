@@ -49,6 +49,8 @@
 #include "rviz_common/interaction/forwards.hpp"
 #include "rviz_common/display.hpp"
 
+#include "rviz_rendering/objects/text_batch.hpp"
+
 #include "rviz_default_plugins/transformation/transformer_guard.hpp"
 #include "rviz_default_plugins/transformation/tf_frame_transformer.hpp"
 #include "rviz_default_plugins/visibility_control.hpp"
@@ -62,7 +64,6 @@ namespace rviz_rendering
 {
 class Arrow;
 class Axes;
-class MovableText;
 }
 
 namespace rviz_common
@@ -130,6 +131,8 @@ private:
 
   Ogre::SceneNode * root_node_;
   Ogre::SceneNode * names_node_;
+  // the names of all frames are drawn by one batch instead of one MovableText per frame
+  std::unique_ptr<rviz_rendering::TextBatch> names_;
   Ogre::SceneNode * arrows_node_;
   Ogre::SceneNode * axes_node_;
 
@@ -0,0 +1,247 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__TRANSFORMATION__SHARDED_TF_FRAME_TRANSFORMER_HPP_
+#define RVIZ_DEFAULT_PLUGINS__TRANSFORMATION__SHARDED_TF_FRAME_TRANSFORMER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "tf2_msgs/msg/tf_message.hpp"
+
+#include "rviz_common/transformation/frame_transformer.hpp"
+#include "rviz_common/ros_integration/ros_node_abstraction.hpp"
+#include "rviz_default_plugins/transformation/sharded_transform_cache.hpp"
+#include "rviz_default_plugins/transformation/tf_frame_transformer.hpp"
+#include "rviz_default_plugins/transformation/tf_wrapper.hpp"
+
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace transformation
+{
+
+/// TF transformer which answers lookups and waits from a ShardedTransformCache.
+/**
+ * The tf2 buffer of the TFFrameTransformer serializes every lookup with one mutex, which the
+ * listener, the message filters of all displays and the main thread compete for. This
+ * transformer receives the transforms itself and answers all lookups and waits, e.g. of the
+ * message filters, from the cache only.
+ *
+ * The TF and laser scan displays read the tf2 buffer of the connector directly, so a worker
+ * thread still copies the transforms into it. The requests waiting for a transform are answered
+ * by the same thread once their transform has been copied, so that these displays find it.
+ * Lookups never take the mutex of the tf2 buffer.
+ */
+class ShardedTFFrameTransformer : public TFFrameTransformer
+{
+public:
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  ShardedTFFrameTransformer();
+
+  /// Use an initialized wrapper, transforms are then only added through setTransform().
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  explicit ShardedTFFrameTransformer(std::shared_ptr<TFWrapper> wrapper);
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  ~ShardedTFFrameTransformer() override;
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  void
+  initialize(
+    rviz_common::ros_integration::RosNodeAbstractionIface::WeakPtr rviz_ros_node,
+    rclcpp::Clock::SharedPtr clock) override;
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  void
+  clear() override;
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  std::vector<std::string>
+  getAllFrameNames() const override;
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  geometry_msgs::msg::PoseStamped
+  transform(
+    const geometry_msgs::msg::PoseStamped & pose_in,
+    const std::string & target_frame) override;
+
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  bool
+  frameHasProblems(const std::string & frame, std::string & error) const override;
+
+  geometry_msgs::msg::TransformStamped
+  lookupTransform(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time) const override;
+
+  geometry_msgs::msg::TransformStamped
+  lookupTransform(
+    const std::string & target_frame,
+    const tf2::TimePoint & target_time,
+    const std::string & source_frame,
+    const tf2::TimePoint & source_time,
+    const std::string & fixed_frame) const override;
+
+  bool
+  canTransform(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time,
+    std::string * error_msg) const override;
+
+  bool
+  canTransform(
+    const std::string & target_frame,
+    const tf2::TimePoint & target_time,
+    const std::string & source_frame,
+    const tf2::TimePoint & source_time,
+    const std::string & fixed_frame,
+    std::string * error_msg) const override;
+
+  /// Timeouts are measured on the steady clock rather than the ROS clock.
+  tf2_ros::TransformStampedFuture
+  waitForTransform(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time,
+    const tf2::Duration & timeout,
+    tf2_ros::TransformReadyCallback callback) override;
+
+  void
+  cancel(const tf2_ros::TransformStampedFuture & ts_future) override;
+
+  /// Walks the path of the target frame in the cache only once for all source frames.
+  std::vector<std::optional<geometry_msgs::msg::TransformStamped>>
+  lookupTransforms(
+    const std::string & target_frame,
+    const std::vector<std::string> & source_frames,
+    const tf2::TimePoint & time) const override;
+
+  /// Add a transform to the cache, it reaches the tf2 buffer through the worker thread.
+  RVIZ_DEFAULT_PLUGINS_PUBLIC
+  void
+  setTransform(
+    const geometry_msgs::msg::TransformStamped & transform,
+    const std::string & authority,
+    bool is_static);
+
+private:
+  struct TransformRequest
+  {
+    std::string target_frame;
+    std::string source_frame;
+    tf2::TimePoint time;
+    std::promise<geometry_msgs::msg::TransformStamped> promise;
+    tf2_ros::TransformStampedFuture future;
+    tf2_ros::TransformReadyCallback callback;
+  };
+
+  struct RequestTimeout
+  {
+    std::chrono::steady_clock::time_point deadline;
+    tf2::TransformableRequestHandle handle;
+    std::shared_ptr<TransformRequest> request;
+  };
+
+  void
+  startListening();
+
+  void
+  setTransforms(
+    const tf2_msgs::msg::TFMessage::ConstSharedPtr & message,
+    const std::string & authority,
+    bool is_static);
+
+  /// Run the task on the worker thread after all tasks posted before.
+  void
+  post(std::function<void()> task);
+
+  /// Worker thread: runs the posted tasks and times out requests.
+  void
+  work();
+
+  void
+  stopWorking();
+
+  void
+  answer(
+    const std::shared_ptr<TransformRequest> & request, tf2::TransformableRequestHandle handle);
+
+  void
+  timeOut(const RequestTimeout & timeout);
+
+  /// Build the error message of canTransform() like the TFFrameTransformer.
+  void
+  describeTransformError(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const std::string & tf2_error,
+    std::string & error) const;
+
+  geometry_msgs::msg::TransformStamped
+  lookupTransformInCache(
+    const std::string & target_frame,
+    const tf2::TimePoint & target_time,
+    const std::string & source_frame,
+    const tf2::TimePoint & source_time,
+    const std::string & fixed_frame) const;
+
+  std::unique_ptr<ShardedTransformCache> cache_;
+
+  rclcpp::Node::SharedPtr listener_node_;
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr tf_subscription_;
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr tf_static_subscription_;
+  rclcpp::executors::SingleThreadedExecutor listener_executor_;
+  std::future<void> listening_;
+
+  std::mutex worker_mutex_;
+  std::condition_variable worker_condition_;
+  std::vector<std::function<void()>> tasks_;
+  std::vector<RequestTimeout> timeouts_;
+  bool stopping_ = false;
+  std::thread worker_;
+};
+
+}  // namespace transformation
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__TRANSFORMATION__SHARDED_TF_FRAME_TRANSFORMER_HPP_
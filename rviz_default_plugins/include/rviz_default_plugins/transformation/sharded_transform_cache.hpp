@@ -0,0 +1,260 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_DEFAULT_PLUGINS__TRANSFORMATION__SHARDED_TRANSFORM_CACHE_HPP_
+#define RVIZ_DEFAULT_PLUGINS__TRANSFORMATION__SHARDED_TRANSFORM_CACHE_HPP_
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "geometry_msgs/msg/transform_stamped.hpp"
+#include "tf2/buffer_core.h"
+#include "tf2/LinearMath/Transform.h"
+#include "tf2/time.h"
+
+#include "rviz_default_plugins/visibility_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace transformation
+{
+
+/// Transform history of all frames, built for many concurrent lookups.
+/**
+ * Unlike tf2::BufferCore, which protects all frames with one mutex, the frames are spread
+ * over shards by their id and every frame guards its own history with a reader-writer lock.
+ * Lookups only take shared locks along their path, so they never wait for each other, and
+ * a new transform only holds up the lookups passing through its own frame.
+ *
+ * Lookups follow the semantics of tf2::BufferCore: a time of zero means the latest time
+ * available in all frames of the path, and transforms are interpolated between samples.
+ *
+ * Requests waiting for a transform are kept apart from the frames behind a mutex of their own,
+ * which lookups never take.
+ */
+class RVIZ_DEFAULT_PLUGINS_PUBLIC ShardedTransformCache
+{
+public:
+  explicit ShardedTransformCache(
+    tf2::Duration cache_time = tf2::BUFFER_CORE_DEFAULT_CACHE_TIME);
+
+  using TransformableCallback = std::function<void (tf2::TransformableRequestHandle)>;
+
+  /// Add a transform from its header frame to its child frame.
+  /**
+   * Invalid transforms are ignored.
+   */
+  void setTransform(const geometry_msgs::msg::TransformStamped & transform, bool is_static);
+
+  /// Add several transforms, the waiting requests are tested only once for all of them.
+  void setTransforms(
+    const std::vector<geometry_msgs::msg::TransformStamped> & transforms, bool is_static);
+
+  /// Call the callback once the source frame can be looked up in the target frame at the time.
+  /**
+   * Like tf2::BufferCore, the callback is also called if the time has become too old to ever be
+   * looked up, a lookup then reports why. It is called with the handle of the request by the
+   * thread adding the transform which answers it.
+   *
+   * \return a handle to cancel the request, or 0 if it can be answered right away, the
+   *   callback is then not called
+   */
+  tf2::TransformableRequestHandle addTransformableRequest(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time,
+    TransformableCallback callback);
+
+  /// Forget a request without calling its callback.
+  /**
+   * \return false if the request has already been answered or cancelled
+   */
+  bool cancelTransformableRequest(tf2::TransformableRequestHandle handle);
+
+  /// Look up the transform of the source frame in the target frame.
+  /**
+   * \throws tf2::LookupException if one of the frames does not exist
+   * \throws tf2::ConnectivityException if the frames are not connected
+   * \throws tf2::ExtrapolationException if a frame of the path has no data at the time
+   */
+  geometry_msgs::msg::TransformStamped lookupTransform(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time) const;
+
+  /// Look up the transforms of several source frames in the same target frame.
+  /**
+   * The path of the target frame is walked only once for all sources.
+   *
+   * \return for each source frame the transform, or nothing if it cannot be transformed
+   */
+  std::vector<std::optional<geometry_msgs::msg::TransformStamped>> lookupTransforms(
+    const std::string & target_frame,
+    const std::vector<std::string> & source_frames,
+    const tf2::TimePoint & time) const;
+
+  bool canTransform(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time,
+    std::string * error_msg = nullptr) const;
+
+  bool frameExists(const std::string & frame) const;
+
+  std::vector<std::string> getAllFrameNames() const;
+
+  void clear();
+
+private:
+  struct Sample
+  {
+    tf2::TimePoint stamp;
+    std::string parent;
+    tf2::Transform transform;
+  };
+
+  struct Frame
+  {
+    mutable std::shared_mutex mutex;
+    bool is_static = false;
+    std::deque<Sample> samples;
+  };
+
+  struct Shard
+  {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<Frame>> frames;
+  };
+
+  struct TransformableRequest
+  {
+    tf2::TransformableRequestHandle handle;
+    std::string target_frame;
+    std::string source_frame;
+    tf2::TimePoint time;
+    TransformableCallback callback;
+  };
+
+  // Transforms of a frame into each of its ancestors.
+  using Ancestors = std::unordered_map<std::string, tf2::Transform>;
+
+  static constexpr size_t kShardCount = 16;
+  static constexpr size_t kMaxGraphDepth = 1000;
+
+  /// Whether the transform can be added, tf2::BufferCore rejects the same transforms.
+  static bool isValid(const geometry_msgs::msg::TransformStamped & transform);
+
+  void addTransform(const geometry_msgs::msg::TransformStamped & transform, bool is_static);
+
+  /// Call the callbacks of all requests which can be answered now.
+  void testTransformableRequests();
+
+  /// Whether a lookup succeeds, or will never succeed, without throwing an exception.
+  bool isAnswerable(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time) const;
+
+  Shard & getShard(const std::string & frame) const;
+  std::shared_ptr<Frame> findFrame(const std::string & frame) const;
+  std::shared_ptr<Frame> findOrAddFrame(const std::string & frame);
+
+  /// The parent of the frame and the stamp of the latest transform into it, if not static.
+  /**
+   * \return false if the frame has no parent
+   */
+  bool getLatestParent(
+    const std::string & frame,
+    std::string & parent,
+    std::optional<tf2::TimePoint> & stamp) const;
+
+  /// The parent of the frame and the transform into it at the given time.
+  /**
+   * \return false if the frame has no parent
+   * \throws tf2::ExtrapolationException if the frame has no data at the time
+   */
+  bool getParentTransform(
+    const std::string & frame,
+    const tf2::TimePoint & time,
+    std::string & parent,
+    tf2::Transform & transform) const;
+
+  /// Replace a time of zero by the latest time available in all frames between the two frames.
+  /**
+   * \param common_ancestor set to the lowest frame shared by the paths of both frames to their
+   *   roots, or to an empty string if they are not connected
+   */
+  tf2::TimePoint resolveTime(
+    const std::string & target_frame,
+    const std::string & source_frame,
+    const tf2::TimePoint & time,
+    std::string & common_ancestor) const;
+
+  /// Walk up from the frame until last_frame or the root is reached.
+  /**
+   * Links above the common ancestor are not needed by a lookup, so they are not required to
+   * have data at the time.
+   */
+  Ancestors getAncestors(
+    const std::string & frame, const tf2::TimePoint & time, const std::string & last_frame) const;
+
+  /// Walk up from the source frame until one of the target's ancestors is reached.
+  /**
+   * \return the transform of the source frame in the target frame
+   * \throws tf2::ConnectivityException if no ancestor is reached
+   */
+  tf2::Transform lookupInAncestors(
+    const std::string & target_frame,
+    const Ancestors & target_ancestors,
+    const std::string & source_frame,
+    const tf2::TimePoint & time) const;
+
+  void checkFrameExists(const std::string & frame, const char * argument) const;
+
+  tf2::Duration cache_time_;
+  mutable std::array<Shard, kShardCount> shards_;
+
+  std::mutex requests_mutex_;
+  std::vector<TransformableRequest> requests_;
+  tf2::TransformableRequestHandle next_request_handle_ = 1;
+};
+
+}  // namespace transformation
+}  // namespace rviz_default_plugins
+
+#endif  // RVIZ_DEFAULT_PLUGINS__TRANSFORMATION__SHARDED_TRANSFORM_CACHE_HPP_
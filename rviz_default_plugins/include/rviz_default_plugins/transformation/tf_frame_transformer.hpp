@@ -129,7 +129,7 @@ public:
   cancel(
     const tf2_ros::TransformStampedFuture & ts_future) override;
 
-private:
+protected:
   std::shared_ptr<TFWrapper> tf_wrapper_;
 };
 }  // namespace transformation
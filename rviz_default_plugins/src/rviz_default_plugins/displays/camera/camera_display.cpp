@@ -32,15 +32,20 @@
 
 #include "rviz_default_plugins/displays/camera/camera_display.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <sstream>
 
+#include <OgreHardwarePixelBuffer.h>
 #include <OgreManualObject.h>
 #include <OgreMaterialManager.h>
 #include <OgreRectangle2D.h>
 #include <OgreRenderSystem.h>
+#include <OgreRenderTexture.h>
 #include <OgreRenderWindow.h>
+#include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <OgreSceneNode.h>
 #include <OgreTextureManager.h>
@@ -80,6 +85,7 @@ using rviz_common::properties::StatusLevel;
 
 static const char * const CAM_INFO_STATUS = "Camera Info";
 static const char * const TIME_STATUS = "Time";
+static const char * const RENDER_TIME_STATUS = "Render Time";
 
 const QString CameraDisplay::BACKGROUND("background");
 const QString CameraDisplay::OVERLAY("overlay");
@@ -122,7 +128,15 @@ CameraDisplay::CameraDisplay()
   texture_(std::make_unique<ROSImageTexture>()),
   new_caminfo_(false),
   caminfo_ok_(false),
-  force_render_(false)
+  force_render_(false),
+  scene_camera_(nullptr),
+  render_target_(nullptr),
+  composite_scene_manager_(nullptr),
+  composite_camera_(nullptr),
+  composite_background_node_(nullptr),
+  composite_overlay_node_(nullptr),
+  average_render_time_(0.0f),
+  render_time_report_timer_(0.0f)
 {
   image_position_property_ = new rviz_common::properties::EnumProperty(
     "Image Rendering", BOTH,
@@ -152,6 +166,22 @@ CameraDisplay::CameraDisplay()
     this);
   far_plane_property_->setMin(0.00001f);
   far_plane_property_->setMax(100000.0f);
+
+  render_rate_property_ = new rviz_common::properties::FloatProperty(
+    "Render Rate", 0.0f,
+    "Maximum rate in Hz at which the scene is rendered from the camera pose. "
+    "The camera image is still shown with every frame. "
+    "0 renders the scene with every frame of the main view.",
+    this);
+  render_rate_property_->setMin(0.0f);
+
+  render_scale_property_ = new rviz_common::properties::FloatProperty(
+    "Render Scale", 1.0f,
+    "Fraction of the panel resolution at which the camera view is rendered and then scaled up. "
+    "Lower values make every camera view cheaper to render.",
+    this);
+  render_scale_property_->setMin(0.1f);
+  render_scale_property_->setMax(1.0f);
 }
 
 CameraDisplay::~CameraDisplay()
@@ -160,6 +190,16 @@ CameraDisplay::~CameraDisplay()
     unsubscribe();
     context_->visibilityBits()->freeBits(vis_bit_);
     rviz_rendering::RenderWindowOgreAdapter::removeListener(render_panel_->getRenderWindow(), this);
+    destroySceneRenderTarget();
+    if (composite_scene_manager_) {
+      composite_scene_manager_->getRootSceneNode()->removeAndDestroyAllChildren();
+      composite_scene_manager_->getRootSceneNode()->detachAllObjects();
+      composite_background_rect_.reset();
+      composite_screen_rect_.reset();
+      composite_overlay_rect_.reset();
+      Ogre::Root::getSingletonPtr()->destroySceneManager(composite_scene_manager_);
+      Ogre::MaterialManager::getSingleton().remove(composite_material_);
+    }
   }
 }
 
@@ -172,6 +212,7 @@ void CameraDisplay::onInitialize()
 
   auto render_window = render_panel_->getRenderWindow();
   rviz_rendering::RenderWindowOgreAdapter::addListener(render_window, this);
+  scene_camera_ = rviz_rendering::RenderWindowOgreAdapter::getOgreCamera(render_window);
 
   vis_bit_ = context_->visibilityBits()->allocBit();
   rviz_rendering::RenderWindowOgreAdapter::setVisibilityMask(render_window, vis_bit_);
@@ -264,14 +305,31 @@ Ogre::MaterialPtr CameraDisplay::createMaterial(std::string name) const
   return material;
 }
 
-void CameraDisplay::preRenderTargetUpdate(const Ogre::RenderTargetEvent & evt)
+bool CameraDisplay::showsBackgroundImage() const
+{
+  QString image_position = image_position_property_->getString();
+  return caminfo_ok_ && (image_position == BACKGROUND || image_position == BOTH);
+}
+
+bool CameraDisplay::showsOverlayImage() const
 {
-  (void) evt;
   QString image_position = image_position_property_->getString();
-  background_scene_node_->setVisible(
-    caminfo_ok_ && (image_position == BACKGROUND || image_position == BOTH));
-  overlay_scene_node_->setVisible(
-    caminfo_ok_ && (image_position == OVERLAY || image_position == BOTH));
+  return caminfo_ok_ && (image_position == OVERLAY || image_position == BOTH);
+}
+
+void CameraDisplay::preRenderTargetUpdate(const Ogre::RenderTargetEvent & evt)
+{
+  if (scene_texture_ && evt.source != getSceneRenderTarget()) {
+    // The render window composites the camera image around the last rendered scene
+    composite_background_node_->setVisible(showsBackgroundImage());
+    composite_overlay_node_->setVisible(showsOverlayImage());
+    return;
+  }
+  render_start_ = std::chrono::steady_clock::now();
+
+  // The offscreen scene leaves the camera image to the composition
+  background_scene_node_->setVisible(!scene_texture_ && showsBackgroundImage());
+  overlay_scene_node_->setVisible(!scene_texture_ && showsOverlayImage());
 
   // set view flags on all displays
   visibility_property_->update();
@@ -279,9 +337,162 @@ void CameraDisplay::preRenderTargetUpdate(const Ogre::RenderTargetEvent & evt)
 
 void CameraDisplay::postRenderTargetUpdate(const Ogre::RenderTargetEvent & evt)
 {
-  (void) evt;
+  if (scene_texture_ && evt.source != getSceneRenderTarget()) {
+    return;
+  }
   background_scene_node_->setVisible(false);
   overlay_scene_node_->setVisible(false);
+
+  std::chrono::duration<float, std::milli> render_time =
+    std::chrono::steady_clock::now() - render_start_;
+  if (average_render_time_ == 0.0f) {
+    average_render_time_ = render_time.count();
+  } else {
+    average_render_time_ = 0.9f * average_render_time_ + 0.1f * render_time.count();
+  }
+}
+
+void CameraDisplay::updateRenderTarget(float wall_dt)
+{
+  auto render_window = render_panel_->getRenderWindow();
+  Ogre::Viewport * window_viewport =
+    rviz_rendering::RenderWindowOgreAdapter::getOgreViewport(render_window);
+  if (!window_viewport) {
+    // the render panel has not been shown yet
+    return;
+  }
+
+  float render_rate = render_rate_property_->getFloat();
+  auto target = CameraRenderSchedule::getTarget(
+    window_viewport->getActualWidth(), window_viewport->getActualHeight(),
+    render_rate, render_scale_property_->getFloat());
+  if (target.offscreen) {
+    if (!scene_texture_ ||
+      static_cast<int>(scene_texture_->getWidth()) != target.width ||
+      static_cast<int>(scene_texture_->getHeight()) != target.height)
+    {
+      createSceneRenderTarget(window_viewport, target.width, target.height);
+      render_schedule_.invalidate();
+    }
+    render_target_ = getSceneRenderTarget();
+  } else {
+    if (scene_texture_) {
+      destroySceneRenderTarget();
+      rviz_rendering::RenderWindowOgreAdapter::setOgreCamera(render_window, scene_camera_);
+    }
+    render_target_ = window_viewport->getTarget();
+  }
+
+  // The render window is updated with every frame, so the camera image stays current, only
+  // the offscreen scene is limited to the frames due at the render rate.
+  window_viewport->getTarget()->setAutoUpdated(true);
+  if (scene_texture_) {
+    render_target_->setAutoUpdated(render_schedule_.advance(render_rate, wall_dt));
+  }
+}
+
+void CameraDisplay::createCompositeScene()
+{
+  static int count = 0;
+  std::string name = "CameraDisplayComposite" + std::to_string(count++);
+
+  composite_scene_manager_ = Ogre::Root::getSingletonPtr()->createSceneManager();
+  composite_camera_ = composite_scene_manager_->createCamera(name + "Camera");
+  composite_scene_manager_->getRootSceneNode()->attachObject(composite_camera_);
+
+  composite_material_ =
+    rviz_rendering::MaterialManager::createMaterialWithNoLighting(name + "Material");
+  composite_material_->setDepthWriteEnabled(false);
+  composite_material_->setDepthCheckEnabled(false);
+  composite_material_->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
+  composite_material_->getTechnique(0)->getPass(0)->createTextureUnitState();
+
+  // Same layering as in the scene: background image, scene, overlay image
+  Ogre::AxisAlignedBox aabInf;
+  aabInf.setInfinite();
+  composite_background_rect_ = createScreenRectangle(
+    aabInf, background_material_, Ogre::RENDER_QUEUE_BACKGROUND);
+  composite_screen_rect_ = createScreenRectangle(
+    aabInf, composite_material_, Ogre::RENDER_QUEUE_MAIN);
+  composite_overlay_rect_ = createScreenRectangle(
+    aabInf, overlay_material_, Ogre::RENDER_QUEUE_OVERLAY - 1);
+
+  auto root_node = composite_scene_manager_->getRootSceneNode();
+  composite_background_node_ = root_node->createChildSceneNode();
+  composite_background_node_->attachObject(composite_background_rect_.get());
+  root_node->attachObject(composite_screen_rect_.get());
+  composite_overlay_node_ = root_node->createChildSceneNode();
+  composite_overlay_node_->attachObject(composite_overlay_rect_.get());
+
+  // updateCamera() fits the image rectangles to the camera info
+  force_render_ = true;
+}
+
+void CameraDisplay::createSceneRenderTarget(
+  Ogre::Viewport * window_viewport, int width, int height)
+{
+  destroySceneRenderTarget();
+
+  if (!composite_scene_manager_) {
+    createCompositeScene();
+  }
+
+  static int count = 0;
+  std::string name = "CameraDisplaySceneRender" + std::to_string(count++);
+
+  // The alpha channel lets the background image show through where nothing was rendered
+  scene_texture_ = Ogre::TextureManager::getSingleton().createManual(
+    name, "rviz_rendering", Ogre::TEX_TYPE_2D, width, height, 0, Ogre::PF_A8R8G8B8,
+    Ogre::TU_RENDERTARGET);
+
+  Ogre::RenderTarget * render_target = getSceneRenderTarget();
+  Ogre::Viewport * viewport = render_target->addViewport(scene_camera_);
+  Ogre::ColourValue background_color = window_viewport->getBackgroundColour();
+  background_color.a = 0.0f;
+  viewport->setBackgroundColour(background_color);
+  viewport->setVisibilityMask(vis_bit_);
+  viewport->setOverlaysEnabled(false);
+  render_target->addListener(this);
+
+  Ogre::TextureUnitState * tu =
+    composite_material_->getTechnique(0)->getPass(0)->getTextureUnitState(0);
+  tu->setTextureName(scene_texture_->getName());
+  tu->setTextureFiltering(Ogre::TFO_BILINEAR);
+  tu->setTextureAddressingMode(Ogre::TextureUnitState::TAM_CLAMP);
+
+  rviz_rendering::RenderWindowOgreAdapter::setOgreCamera(
+    render_panel_->getRenderWindow(), composite_camera_);
+}
+
+void CameraDisplay::destroySceneRenderTarget()
+{
+  if (!scene_texture_) {
+    return;
+  }
+  getSceneRenderTarget()->removeListener(this);
+  if (render_target_ == getSceneRenderTarget()) {
+    render_target_ = nullptr;
+  }
+  Ogre::TextureManager::getSingleton().remove(scene_texture_);
+  scene_texture_.reset();
+}
+
+Ogre::RenderTarget * CameraDisplay::getSceneRenderTarget() const
+{
+  return scene_texture_->getBuffer()->getRenderTarget();
+}
+
+void CameraDisplay::reportRenderTime(float wall_dt)
+{
+  render_time_report_timer_ += wall_dt;
+  if (render_time_report_timer_ < 1000000000 || average_render_time_ == 0.0f) {
+    return;
+  }
+  render_time_report_timer_ = 0.0f;
+
+  setStatus(
+    StatusLevel::Ok, RENDER_TIME_STATUS,
+    QString::number(average_render_time_, 'f', 2) + " ms CPU time per rendered frame");
 }
 
 void CameraDisplay::onEnable()
@@ -326,10 +537,7 @@ void CameraDisplay::subscribe()
     fixed_frame_.toStdString(), 10, rviz_ros_node_.lock()->get_raw_node());
 
   tf_filter_->connectInput(*subscription_);
-  tf_filter_->registerCallback(
-    [this](const sensor_msgs::msg::Image::ConstSharedPtr msg) {
-      this->incomingMessage(msg);
-    });
+  tf_filter_->registerCallback(makeIncomingMessageCallback());
 
   if ((!isEnabled()) || (topic_property_->getTopicStd().empty())) {
     return;
@@ -428,8 +636,10 @@ void CameraDisplay::clear()
 
 void CameraDisplay::update(float wall_dt, float ros_dt)
 {
-  (void) wall_dt;
   (void) ros_dt;
+  updateRenderTarget(wall_dt);
+  reportRenderTime(wall_dt);
+
   try {
     if (texture_->update() || force_render_) {
       caminfo_ok_ = updateCamera();
@@ -535,8 +745,7 @@ bool CameraDisplay::updateCamera()
   Ogre::Vector2 zoom = getZoomFromInfo(info, dimensions);
   Ogre::Matrix4 proj_matrix = calculateProjectionMatrix(info, dimensions, zoom);
 
-  rviz_rendering::RenderWindowOgreAdapter::getOgreCamera(render_window)
-  ->setCustomProjectionMatrix(true, proj_matrix);
+  scene_camera_->setCustomProjectionMatrix(true, proj_matrix);
 
   setStatus(StatusLevel::Ok, CAM_INFO_STATUS, "OK");
 
@@ -549,6 +758,12 @@ bool CameraDisplay::updateCamera()
   aabInf.setInfinite();
   background_screen_rect_->setBoundingBox(aabInf);
   overlay_screen_rect_->setBoundingBox(aabInf);
+  if (composite_scene_manager_) {
+    composite_background_rect_->setCorners(corners.x, corners.y, corners.z, corners.w);
+    composite_overlay_rect_->setCorners(corners.x, corners.y, corners.z, corners.w);
+    composite_background_rect_->setBoundingBox(aabInf);
+    composite_overlay_rect_->setBoundingBox(aabInf);
+  }
 
   setStatus(StatusLevel::Ok, TIME_STATUS, "ok");
   setStatus(StatusLevel::Ok, CAM_INFO_STATUS, "ok");
@@ -0,0 +1,82 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_default_plugins/displays/camera/camera_render_schedule.hpp"
+
+#include <algorithm>
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+CameraRenderSchedule::CameraRenderSchedule()
+: timer_(0.0f),
+  invalidated_(true)
+{}
+
+CameraRenderSchedule::Target CameraRenderSchedule::getTarget(
+  int panel_width, int panel_height, float render_rate, float render_scale)
+{
+  Target target;
+  target.offscreen = render_rate > 0.0f || render_scale < 1.0f;
+  float scale = std::min(render_scale, 1.0f);
+  target.width = std::max(1, static_cast<int>(panel_width * scale));
+  target.height = std::max(1, static_cast<int>(panel_height * scale));
+  return target;
+}
+
+bool CameraRenderSchedule::advance(float render_rate, float wall_dt)
+{
+  if (render_rate <= 0.0f) {
+    return true;
+  }
+
+  const float period = 1000000000 / render_rate;
+  timer_ += wall_dt;
+  if (!invalidated_ && timer_ < period) {
+    return false;
+  }
+  invalidated_ = false;
+  // Keep the remainder, so the average rate matches, but do not catch up on long frames
+  timer_ = std::max(timer_ - period, 0.0f);
+  if (timer_ >= period) {
+    timer_ = 0.0f;
+  }
+  return true;
+}
+
+void CameraRenderSchedule::invalidate()
+{
+  invalidated_ = true;
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
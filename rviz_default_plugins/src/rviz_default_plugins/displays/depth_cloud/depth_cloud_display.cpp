@@ -78,6 +78,10 @@ DepthCloudDisplay::DepthCloudDisplay()
   , queue_size_(5)
   , angular_thres_(0.5f)
   , trans_thres_(0.01f)
+  , use_auto_size_(true)
+  , auto_size_factor_(1.0f)
+  , use_occlusion_compensation_(false)
+  , parallel_decoding_(false)
 {
   ml_depth_data_ = std::make_unique<rviz_common::MultiLayerDepth>();
   // Depth map properties
@@ -139,6 +143,12 @@ DepthCloudDisplay::DepthCloudDisplay()
 
   color_transport_property_->setStdString("raw");
 
+  parallel_decoding_property_ = new rviz_common::properties::BoolProperty(
+    "Parallel Decoding", false,
+    "Decode the depth and color images and compute the point cloud on a pool of worker threads "
+    "instead of the main thread. Frames which are outdated once they are decoded are skipped.",
+    this, SLOT(updateTopic()));
+
   // Queue size property
   queue_size_property_ =
     new rviz_common::properties::IntProperty(
@@ -263,6 +273,7 @@ void DepthCloudDisplay::updateQueueSize()
 void DepthCloudDisplay::updateUseAutoSize()
 {
   bool use_auto_size = use_auto_size_property_->getBool();
+  use_auto_size_ = use_auto_size;
   pointcloud_common_->point_world_size_property_->setReadOnly(use_auto_size);
   pointcloud_common_->setAutoSize(use_auto_size);
   auto_size_factor_property_->setHidden(!use_auto_size);
@@ -273,6 +284,7 @@ void DepthCloudDisplay::updateUseAutoSize()
 
 void DepthCloudDisplay::updateAutoSizeFactor()
 {
+  auto_size_factor_ = auto_size_factor_property_->getFloat();
 }
 
 void DepthCloudDisplay::updateTopicFilter()
@@ -285,6 +297,7 @@ void DepthCloudDisplay::updateTopicFilter()
 void DepthCloudDisplay::updateUseOcclusionCompensation()
 {
   bool use_occlusion_compensation = use_occlusion_compensation_property_->getBool();
+  use_occlusion_compensation_ = use_occlusion_compensation;
   occlusion_shadow_timeout_property_->setHidden(!use_occlusion_compensation);
 
   if (use_occlusion_compensation) {
@@ -339,13 +352,28 @@ void DepthCloudDisplay::subscribe()
 
     auto rviz_ros_node_ = context_->getRosNodeAbstraction().lock();
 
+    // The display is not thread safe, so its callbacks run one at a time.
+    rclcpp::SubscriptionOptions image_sub_opts;
+    parallel_decoding_ = parallel_decoding_property_->getBool();
+    if (parallel_decoding_) {
+      decode_worker_pool_ = DecodeWorkerPool::acquire();
+      decode_callback_group_ = decode_worker_pool_->addCallbackGroup(
+        rviz_ros_node_->get_raw_node(), rclcpp::CallbackGroupType::MutuallyExclusive);
+      decode_clock_ = rviz_ros_node_->get_raw_node()->get_clock();
+      decode_gate_ = std::make_shared<DecodeCallbackGate>();
+      image_sub_opts.callback_group = decode_callback_group_;
+    } else {
+      deleteStatus("Decoding");
+    }
+
     if (!depthmap_topic.empty() && !depthmap_transport.empty()) {
       // subscribe to depth map topic
       depthmap_sub_->subscribe(
         rviz_ros_node_->get_raw_node().get(),
         depthmap_topic,
         depthmap_transport,
-        qos_profile_);
+        qos_profile_,
+        image_sub_opts);
 
       depthmap_tf_filter_ =
         std::make_shared<tf2_ros::MessageFilter<sensor_msgs::msg::Image,
@@ -387,18 +415,36 @@ void DepthCloudDisplay::subscribe()
         // subscribe to color image topic
         rgb_sub_->subscribe(
           rviz_ros_node_->get_raw_node().get(),
-          color_topic, color_transport, qos_profile_);
+          color_topic, color_transport, qos_profile_, image_sub_opts);
 
         // connect message filters to synchronizer
         sync_depth_color_->connectInput(*depthmap_tf_filter_, *rgb_sub_);
         sync_depth_color_->setInterMessageLowerBound(0, rclcpp::Duration(0, 0.5 * 1e+9));
         sync_depth_color_->setInterMessageLowerBound(1, rclcpp::Duration(0, 0.5 * 1e+9));
-        sync_depth_color_->registerCallback(
-          std::bind(
-            &DepthCloudDisplay::processMessage, this,
-            std::placeholders::_1, std::placeholders::_2));
+        if (parallel_decoding_) {
+          // Bound, as the synchronizer calls back with the unused slots of its nine inputs too.
+          sync_depth_color_->registerCallback(
+            std::bind(
+              [this, decode_gate = decode_gate_](
+                const sensor_msgs::msg::Image::ConstSharedPtr & depth_msg,
+                const sensor_msgs::msg::Image::ConstSharedPtr & rgb_msg) {
+                decode_gate->pass([&]() {processMessage(depth_msg, rgb_msg);});
+              },
+              std::placeholders::_1, std::placeholders::_2));
+        } else {
+          sync_depth_color_->registerCallback(
+            std::bind(
+              &DepthCloudDisplay::processMessage, this,
+              std::placeholders::_1, std::placeholders::_2));
+        }
 
         pointcloud_common_->color_transformer_property_->setValue("RGB8");
+      } else if (parallel_decoding_) {
+        depthmap_tf_filter_->registerCallback(
+          [this, decode_gate = decode_gate_](
+            const sensor_msgs::msg::Image::ConstSharedPtr & depth_msg) {
+            decode_gate->pass([&]() {processDepthMessage(depth_msg);});
+          });
       } else {
         depthmap_tf_filter_->registerCallback(
           std::bind(&DepthCloudDisplay::processDepthMessage, this, std::placeholders::_1));
@@ -420,6 +466,12 @@ void DepthCloudDisplay::caminfoCallback(sensor_msgs::msg::CameraInfo::ConstShare
 
 void DepthCloudDisplay::unsubscribe()
 {
+  // Close the gate first, so that no callback still decoding can add a cloud after clear().
+  if (decode_gate_) {
+    decode_gate_->close();
+    decode_gate_.reset();
+  }
+
   clear();
 
   sync_depth_color_.reset(new SynchronizerDepthColor(SyncPolicyDepthColor(queue_size_)));
@@ -427,6 +479,12 @@ void DepthCloudDisplay::unsubscribe()
   depthmap_sub_.reset();
   rgb_sub_.reset();
   cam_info_sub_.reset();
+
+  if (decode_callback_group_) {
+    decode_worker_pool_->removeCallbackGroup(decode_callback_group_);
+    decode_callback_group_.reset();
+  }
+  decode_worker_pool_.reset();
 }
 
 void DepthCloudDisplay::clear()
@@ -437,6 +495,21 @@ void DepthCloudDisplay::clear()
   }
 }
 
+void DepthCloudDisplay::applyToScene(std::function<void()> update)
+{
+  if (!parallel_decoding_) {
+    update();
+    return;
+  }
+  // The gate is closed on the GUI thread, where the update runs as well.
+  context_->queueSceneUpdate(
+    [decode_gate = decode_gate_, update = std::move(update)]() {
+      if (decode_gate->isOpen()) {
+        update();
+      }
+    });
+}
+
 void DepthCloudDisplay::update(float wall_dt, float ros_dt)
 {
   pointcloud_common_->update(wall_dt, ros_dt);
@@ -446,10 +519,39 @@ void DepthCloudDisplay::reset()
 {
   clear();
   messages_received_ = 0;
+  decode_statistics_.reset();
   setStatus(rviz_common::properties::StatusProperty::Ok, "Depth Map", "0 depth maps received");
   setStatus(rviz_common::properties::StatusProperty::Ok, "Message", "Ok");
 }
 
+void DepthCloudDisplay::updateStatuses()
+{
+  rviz_common::Display::updateStatuses();
+
+  if (parallel_decoding_) {
+    setStatus(
+      rviz_common::properties::StatusProperty::Ok, "Decoding",
+      decode_statistics_.takeSummary().toString());
+  }
+
+  const uint32_t messages_received = messages_received_;
+  if (messages_received == 0) {
+    return;
+  }
+  auto rviz_ros_node_ = context_->getRosNodeAbstraction().lock();
+  QString topic_str = QString::number(messages_received) + " messages received";
+  // Append topic subscription frequency if we can lock rviz_ros_node_.
+  if (rviz_ros_node_ != nullptr) {
+    const double duration =
+      (rviz_ros_node_->get_raw_node()->now() - subscription_start_time_).seconds();
+    const double subscription_frequency =
+      static_cast<double>(messages_received) / duration;
+    topic_str += " at " + QString::number(subscription_frequency, 'f', 1) + " hz.";
+  }
+  setStatus(
+    rviz_common::properties::StatusProperty::Ok, "Depth Map", topic_str);
+}
+
 void DepthCloudDisplay::processDepthMessage(const sensor_msgs::msg::Image::ConstSharedPtr depth_msg)
 {
   processMessage(depth_msg, sensor_msgs::msg::Image::ConstSharedPtr());
@@ -465,21 +567,14 @@ void DepthCloudDisplay::processMessage(
 
   std::ostringstream s;
 
+  ++messages_received_;
+  requestStatusUpdate();
+  setStatus(rviz_common::properties::StatusProperty::Ok, "Message", "Ok");
+
+  if (parallel_decoding_ && depth_msg &&
+    !decode_statistics_.frameDecoded(rclcpp::Time(depth_msg->header.stamp), decode_clock_->now()))
   {
-    ++messages_received_;
-    auto rviz_ros_node_ = context_->getRosNodeAbstraction().lock();
-    QString topic_str = QString::number(messages_received_) + " messages received";
-    // Append topic subscription frequency if we can lock rviz_ros_node_.
-    if (rviz_ros_node_ != nullptr) {
-      const double duration =
-        (rviz_ros_node_->get_raw_node()->now() - subscription_start_time_).seconds();
-      const double subscription_frequency =
-        static_cast<double>(messages_received_) / duration;
-      topic_str += " at " + QString::number(subscription_frequency, 'f', 1) + " hz.";
-    }
-    setStatus(
-      rviz_common::properties::StatusProperty::Ok, "Depth Map", topic_str);
-    setStatus(rviz_common::properties::StatusProperty::Ok, "Message", "Ok");
+    return;
   }
 
   sensor_msgs::msg::CameraInfo::ConstSharedPtr cam_info;
@@ -510,16 +605,17 @@ void DepthCloudDisplay::processMessage(
     }
   }
 
-  if (use_auto_size_property_->getBool()) {
+  if (use_auto_size_) {
     float f = cam_info->k[0];
     float bx = cam_info->binning_x > 0 ? cam_info->binning_x : 1.0;
-    float s = auto_size_factor_property_->getFloat();
-    pointcloud_common_->point_world_size_property_->setFloat(s / f * bx);
+    float s = auto_size_factor_;
+    applyToScene(
+      [this, point_world_size = s / f * bx]() {
+        pointcloud_common_->point_world_size_property_->setFloat(point_world_size);
+      });
   }
 
-  bool use_occlusion_compensation = use_occlusion_compensation_property_->getBool();
-
-  if (use_occlusion_compensation) {
+  if (use_occlusion_compensation_) {
     // reset depth cloud display if camera moves
     Ogre::Quaternion orientation;
     Ogre::Vector3 position;
@@ -575,7 +671,7 @@ void DepthCloudDisplay::processMessage(
     cloud_msg->header = depth_msg->header;
 
     // add point cloud message to pointcloud_common to be visualized
-    pointcloud_common_->addMessage(cloud_msg);
+    applyToScene([this, cloud_msg]() {pointcloud_common_->addMessage(cloud_msg);});
   } catch (rviz_common::MultiLayerDepthException & e) {
     setStatus(
       rviz_common::properties::StatusProperty::Error, "Message",
@@ -33,6 +33,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <OgreBillboardSet.h>
@@ -41,11 +42,14 @@
 #include "rviz_rendering/objects/arrow.hpp"
 #include "rviz_rendering/objects/point_cloud.hpp"
 #include "rviz_common/logging.hpp"
+#include "rviz_common/properties/bool_property.hpp"
 #include "rviz_common/properties/color_property.hpp"
 #include "rviz_common/properties/float_property.hpp"
 #include "rviz_common/properties/parse_color.hpp"
 #include "rviz_common/validate_floats.hpp"
 
+#include "rviz_default_plugins/displays/grid_cells/grid_cells_texture.hpp"
+
 namespace rviz_default_plugins
 {
 namespace displays
@@ -72,6 +76,12 @@ GridCellsDisplay::GridCellsDisplay()
     this, SLOT(updateAlpha()));
   alpha_property_->setMin(0);
   alpha_property_->setMax(1);
+
+  rasterize_property_ = new rviz_common::properties::BoolProperty(
+    "Rasterize Cells", true,
+    "Draw cells which lie on a regular grid as a single texture, which is updated "
+    "incrementally. Other cells are always drawn as tiles.",
+    this, SLOT(updateRasterize()));
 }
 
 void GridCellsDisplay::onInitialize()
@@ -89,6 +99,8 @@ void GridCellsDisplay::setupCloud()
   cloud_->setCommonDirection(Ogre::Vector3::UNIT_Z);
   cloud_->setCommonUpVector(Ogre::Vector3::UNIT_Y);
   scene_node_->attachObject(cloud_.get());
+
+  texture_ = std::make_unique<GridCellsTexture>(scene_manager_, scene_node_);
 }
 
 GridCellsDisplay::~GridCellsDisplay()
@@ -96,17 +108,30 @@ GridCellsDisplay::~GridCellsDisplay()
   if (initialized()) {
     scene_node_->detachObject(cloud_.get());
   }
+  texture_.reset();
 }
 
 void GridCellsDisplay::updateAlpha()
 {
   cloud_->setAlpha(alpha_property_->getFloat());
+  texture_->setColor(
+    rviz_common::properties::qtToOgre(color_property_->getColor()), alpha_property_->getFloat());
   context_->queueRender();
 }
 
 void GridCellsDisplay::updateColor()
 {
   cloud_->setColor(rviz_common::properties::qtToOgre(color_property_->getColor()));
+  texture_->setColor(
+    rviz_common::properties::qtToOgre(color_property_->getColor()), alpha_property_->getFloat());
+  context_->queueRender();
+}
+
+void GridCellsDisplay::updateRasterize()
+{
+  // the cells are drawn again with the next message
+  cloud_->clearAndRemoveAllPoints();
+  texture_->clear();
   context_->queueRender();
 }
 
@@ -119,13 +144,15 @@ void GridCellsDisplay::processMessage(nav_msgs::msg::GridCells::ConstSharedPtr m
 
   cloud_->clearAndRemoveAllPoints();
 
-  if (!messageIsValid(msg)) {
+  if (!messageIsValid(msg) || !setTransform(msg->header)) {
+    texture_->clear();
     return;
   }
 
-  if (!setTransform(msg->header)) {
+  if (rasterize_property_->getBool() && texture_->update(*msg)) {
     return;
   }
+  texture_->clear();
 
   convertMessageToCloud(msg);
 }
@@ -183,17 +210,13 @@ void GridCellsDisplay::convertMessageToCloud(nav_msgs::msg::GridCells::ConstShar
 
   Ogre::ColourValue color_int = rviz_common::properties::qtToOgre(color_property_->getColor());
 
-  std::vector<rviz_rendering::PointCloud::Point> points;
+  std::vector<rviz_rendering::PointCloud::CompactPoint> points;
+  points.reserve(msg->cells.size());
   for (const auto & point : msg->cells) {
-    rviz_rendering::PointCloud::Point rendering_point;
-    rendering_point.position.x = point.x;
-    rendering_point.position.y = point.y;
-    rendering_point.position.z = point.z;
-    rendering_point.color = color_int;
-    points.push_back(rendering_point);
+    points.emplace_back(Ogre::Vector3(point.x, point.y, point.z), color_int);
   }
 
-  cloud_->addPoints(points.begin(), points.end());
+  cloud_->addPoints(std::move(points));
 }
 
 }  // namespace displays
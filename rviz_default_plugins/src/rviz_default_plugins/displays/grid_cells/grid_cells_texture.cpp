@@ -0,0 +1,297 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_default_plugins/displays/grid_cells/grid_cells_texture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <OgreHardwarePixelBuffer.h>
+#include <OgreManualObject.h>
+#include <OgreMaterialManager.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreTechnique.h>
+#include <OgreTextureManager.h>
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+namespace
+{
+// largest distance of a cell from the grid, as a fraction of the cell size
+const double kGridTolerance = 1e-3;
+// the size of the texture is rounded up to blocks of this many cells, with the cells
+// centered in it, so that cells moving around a little do not cause it to be replaced
+const int64_t kBlockSize = 64;
+
+int64_t roundUpToBlock(int64_t size)
+{
+  return (size + kBlockSize - 1) / kBlockSize * kBlockSize;
+}
+}  // namespace
+
+const size_t GridCellsTexture::MAX_SIZE = 4096;
+
+size_t GridCellsTexture::material_count_ = 0;
+size_t GridCellsTexture::texture_count_ = 0;
+
+GridCellsTexture::GridCellsTexture(
+  Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node)
+: scene_manager_(scene_manager),
+  scene_node_(parent_node->createChildSceneNode()),
+  quad_(nullptr),
+  origin_x_(0),
+  origin_y_(0),
+  origin_z_(0),
+  cell_width_(0),
+  cell_height_(0),
+  width_(0),
+  height_(0),
+  uploaded_rows_(0)
+{
+  setupMaterial();
+  setupQuad();
+  quad_->setVisible(false);
+}
+
+GridCellsTexture::~GridCellsTexture()
+{
+  scene_manager_->destroyManualObject(quad_);
+  scene_manager_->destroySceneNode(scene_node_);
+  Ogre::MaterialManager::getSingleton().remove(material_);
+  if (texture_) {
+    Ogre::TextureManager::getSingleton().remove(texture_);
+  }
+}
+
+bool GridCellsTexture::update(const nav_msgs::msg::GridCells & msg)
+{
+  bool grid_changed = false;
+  if (msg.cells.empty() || msg.cell_width <= 0 || msg.cell_height <= 0 ||
+    !rasterize(msg, grid_changed))
+  {
+    clear();
+    return false;
+  }
+
+  if (grid_changed) {
+    resizeTexture();
+    texels_.swap(new_texels_);
+    upload(0, height_);
+  } else {
+    size_t first_row = height_;
+    size_t end_row = 0;
+    for (size_t row = 0; row < height_; ++row) {
+      if (std::memcmp(&texels_[row * width_], &new_texels_[row * width_], width_) != 0) {
+        first_row = std::min(first_row, row);
+        end_row = row + 1;
+      }
+    }
+    texels_.swap(new_texels_);
+    uploaded_rows_ = 0;
+    if (first_row < end_row) {
+      upload(first_row, end_row);
+    }
+  }
+
+  // texel centers lie on the cell centers
+  scene_node_->setPosition(
+    static_cast<float>(origin_x_ - cell_width_ / 2),
+    static_cast<float>(origin_y_ - cell_height_ / 2),
+    static_cast<float>(origin_z_));
+  scene_node_->setScale(
+    static_cast<float>(width_ * cell_width_), static_cast<float>(height_ * cell_height_), 1.0f);
+  quad_->setVisible(true);
+  return true;
+}
+
+void GridCellsTexture::clear()
+{
+  // the texture is kept, the next cells on the same grid only upload what changed
+  quad_->setVisible(false);
+}
+
+void GridCellsTexture::setColor(const Ogre::ColourValue & color, float alpha)
+{
+  Ogre::TextureUnitState * texture_unit =
+    material_->getTechnique(0)->getPass(0)->getTextureUnitState(0);
+  texture_unit->setColourOperationEx(
+    Ogre::LBX_SOURCE1, Ogre::LBS_MANUAL, Ogre::LBS_CURRENT, color);
+  texture_unit->setAlphaOperation(
+    Ogre::LBX_MODULATE, Ogre::LBS_TEXTURE, Ogre::LBS_MANUAL, 1.0, alpha);
+}
+
+bool GridCellsTexture::isVisible() const
+{
+  return quad_->getVisible();
+}
+
+bool GridCellsTexture::rasterize(const nav_msgs::msg::GridCells & msg, bool & grid_changed)
+{
+  const double cell_width = msg.cell_width;
+  const double cell_height = msg.cell_height;
+  const double z = msg.cells[0].z;
+  const double z_tolerance = kGridTolerance * std::min(cell_width, cell_height);
+
+  bool keep_grid = width_ > 0 && cell_width == cell_width_ && cell_height == cell_height_ &&
+    z == origin_z_;
+  double anchor_x = keep_grid ? origin_x_ : msg.cells[0].x;
+  double anchor_y = keep_grid ? origin_y_ : msg.cells[0].y;
+
+  cell_x_.resize(msg.cells.size());
+  cell_y_.resize(msg.cells.size());
+  int64_t min_x = std::numeric_limits<int64_t>::max();
+  int64_t min_y = std::numeric_limits<int64_t>::max();
+  int64_t max_x = std::numeric_limits<int64_t>::min();
+  int64_t max_y = std::numeric_limits<int64_t>::min();
+  for (size_t i = 0; i < msg.cells.size(); ++i) {
+    const auto & cell = msg.cells[i];
+    double x = (cell.x - anchor_x) / cell_width;
+    double y = (cell.y - anchor_y) / cell_height;
+    double grid_x = std::round(x);
+    double grid_y = std::round(y);
+    if (std::abs(x - grid_x) > kGridTolerance || std::abs(y - grid_y) > kGridTolerance ||
+      std::abs(cell.z - z) > z_tolerance ||
+      std::abs(grid_x) > MAX_SIZE * 1024.0 || std::abs(grid_y) > MAX_SIZE * 1024.0)
+    {
+      return false;
+    }
+    cell_x_[i] = static_cast<int64_t>(grid_x);
+    cell_y_[i] = static_cast<int64_t>(grid_y);
+    min_x = std::min(min_x, cell_x_[i]);
+    min_y = std::min(min_y, cell_y_[i]);
+    max_x = std::max(max_x, cell_x_[i]);
+    max_y = std::max(max_y, cell_y_[i]);
+  }
+
+  int64_t first_x = 0;
+  int64_t first_y = 0;
+  grid_changed = !keep_grid || min_x < 0 || min_y < 0 ||
+    max_x >= static_cast<int64_t>(width_) || max_y >= static_cast<int64_t>(height_);
+  if (grid_changed) {
+    int64_t width = roundUpToBlock(max_x - min_x + 1);
+    int64_t height = roundUpToBlock(max_y - min_y + 1);
+    first_x = min_x - (width - (max_x - min_x + 1)) / 2;
+    first_y = min_y - (height - (max_y - min_y + 1)) / 2;
+    if (width > static_cast<int64_t>(MAX_SIZE) || height > static_cast<int64_t>(MAX_SIZE)) {
+      return false;
+    }
+
+    origin_x_ = anchor_x + first_x * cell_width;
+    origin_y_ = anchor_y + first_y * cell_height;
+    origin_z_ = z;
+    cell_width_ = cell_width;
+    cell_height_ = cell_height;
+    width_ = static_cast<size_t>(width);
+    height_ = static_cast<size_t>(height);
+  }
+
+  new_texels_.assign(width_ * height_, 0);
+  for (size_t i = 0; i < cell_x_.size(); ++i) {
+    new_texels_[(cell_y_[i] - first_y) * width_ + (cell_x_[i] - first_x)] = 255;
+  }
+  return true;
+}
+
+void GridCellsTexture::resizeTexture()
+{
+  if (texture_ && texture_->getWidth() == width_ && texture_->getHeight() == height_) {
+    return;
+  }
+  if (texture_) {
+    Ogre::TextureManager::getSingleton().remove(texture_);
+  }
+
+  texture_ = Ogre::TextureManager::getSingleton().createManual(
+    "GridCellsTexture" + std::to_string(texture_count_++),
+    "rviz_rendering",
+    Ogre::TEX_TYPE_2D,
+    static_cast<Ogre::uint>(width_), static_cast<Ogre::uint>(height_), 0,
+    Ogre::PF_A8, Ogre::TU_DYNAMIC_WRITE_ONLY);
+  material_->getTechnique(0)->getPass(0)->getTextureUnitState(0)->setTexture(texture_);
+}
+
+void GridCellsTexture::upload(size_t first_row, size_t end_row)
+{
+  Ogre::PixelBox rows(
+    static_cast<uint32_t>(width_), static_cast<uint32_t>(end_row - first_row), 1,
+    Ogre::PF_A8, &texels_[first_row * width_]);
+  texture_->getBuffer()->blitFromMemory(
+    rows,
+    Ogre::Box(
+      0, static_cast<uint32_t>(first_row),
+      static_cast<uint32_t>(width_), static_cast<uint32_t>(end_row)));
+  uploaded_rows_ = end_row - first_row;
+}
+
+void GridCellsTexture::setupMaterial()
+{
+  material_ = Ogre::MaterialManager::getSingleton().create(
+    "GridCellsMaterial" + std::to_string(material_count_++), "rviz_rendering");
+
+  Ogre::Pass * pass = material_->getTechnique(0)->getPass(0);
+  material_->setReceiveShadows(false);
+  pass->setLightingEnabled(false);
+  pass->setCullingMode(Ogre::CULL_NONE);
+  pass->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
+  // empty cells must neither be drawn nor hide what is behind them
+  pass->setAlphaRejectSettings(Ogre::CMPF_GREATER, 0);
+
+  Ogre::TextureUnitState * texture_unit = pass->createTextureUnitState();
+  texture_unit->setTextureFiltering(Ogre::TFO_NONE);
+  texture_unit->setTextureAddressingMode(Ogre::TextureUnitState::TAM_CLAMP);
+  setColor(Ogre::ColourValue::White, 1.0f);
+}
+
+void GridCellsTexture::setupQuad()
+{
+  quad_ = scene_manager_->createManualObject();
+  quad_->begin(material_->getName(), Ogre::RenderOperation::OT_TRIANGLE_LIST, "rviz_rendering");
+
+  const float corners[6][2] = {{0, 0}, {1, 1}, {0, 1}, {0, 0}, {1, 0}, {1, 1}};
+  for (const auto & corner : corners) {
+    quad_->position(corner[0], corner[1], 0.0f);
+    quad_->textureCoord(corner[0], corner[1]);
+    quad_->normal(0.0f, 0.0f, 1.0f);
+  }
+
+  quad_->end();
+  scene_node_->attachObject(quad_);
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
@@ -0,0 +1,116 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_default_plugins/displays/image/decode_statistics.hpp"
+
+#include <chrono>
+#include <mutex>
+
+#include "rclcpp/time.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+QString DecodeStatistics::Summary::toString() const
+{
+  QString text = QString::number(frames_per_second, 'f', 1) + " frames per second";
+  if (average_latency > 0) {
+    text += ", " + QString::number(average_latency * 1000, 'f', 1) + " ms latency";
+  }
+  if (frames_skipped > 0) {
+    text += ", " + QString::number(frames_skipped) + " outdated frames skipped";
+  }
+  return text;
+}
+
+DecodeStatistics::DecodeStatistics()
+{
+  reset();
+}
+
+bool DecodeStatistics::frameDecoded(const rclcpp::Time & stamp, const rclcpp::Time & now)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  // A jump back by more than a second is a restarted source, e.g. a looping bag file.
+  if (stamp < newest_stamp_ && (newest_stamp_ - stamp).seconds() < 1.0) {
+    ++frames_skipped_;
+    return false;
+  }
+  newest_stamp_ = stamp;
+  ++frames_decoded_;
+  // Unstamped frames have no meaningful latency.
+  if (stamp.nanoseconds() > 0) {
+    latency_sum_ += (now - stamp).seconds();
+    ++frames_with_latency_;
+  }
+  return true;
+}
+
+void DecodeStatistics::frameSkipped()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++frames_skipped_;
+}
+
+DecodeStatistics::Summary DecodeStatistics::takeSummary(std::chrono::steady_clock::time_point now)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  Summary summary{};
+  const double period = std::chrono::duration<double>(now - period_start_).count();
+  if (period > 0) {
+    summary.frames_per_second = static_cast<double>(frames_decoded_) / period;
+  }
+  if (frames_with_latency_ > 0) {
+    summary.average_latency = latency_sum_ / static_cast<double>(frames_with_latency_);
+  }
+  summary.frames_skipped = frames_skipped_;
+
+  period_start_ = now;
+  frames_decoded_ = 0;
+  frames_with_latency_ = 0;
+  latency_sum_ = 0;
+  return summary;
+}
+
+void DecodeStatistics::reset()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  newest_stamp_ = rclcpp::Time(0, 0, RCL_ROS_TIME);
+  period_start_ = std::chrono::steady_clock::now();
+  frames_decoded_ = 0;
+  frames_with_latency_ = 0;
+  latency_sum_ = 0;
+  frames_skipped_ = 0;
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
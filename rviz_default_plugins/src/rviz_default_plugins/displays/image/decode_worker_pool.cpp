@@ -0,0 +1,99 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_default_plugins/displays/image/decode_worker_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+std::shared_ptr<DecodeWorkerPool> DecodeWorkerPool::acquire()
+{
+  static std::mutex mutex;
+  static std::weak_ptr<DecodeWorkerPool> shared_pool;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto pool = shared_pool.lock();
+  if (!pool) {
+    // Leave half of the cores to rendering and the main executor.
+    pool = std::make_shared<DecodeWorkerPool>(
+      std::max<size_t>(2, std::thread::hardware_concurrency() / 2));
+    shared_pool = pool;
+  }
+  return pool;
+}
+
+DecodeWorkerPool::DecodeWorkerPool(size_t number_of_threads)
+: number_of_threads_(number_of_threads),
+  executor_(rclcpp::ExecutorOptions(), number_of_threads)
+{
+  spinning_ = std::async(std::launch::async, [this]() {executor_.spin();});
+}
+
+DecodeWorkerPool::~DecodeWorkerPool()
+{
+  // Cancelling before the executor started spinning has no effect, so repeat until it stopped.
+  do {
+    executor_.cancel();
+  } while (spinning_.wait_for(std::chrono::milliseconds(10)) != std::future_status::ready);
+}
+
+rclcpp::CallbackGroup::SharedPtr DecodeWorkerPool::addCallbackGroup(
+  const rclcpp::Node::SharedPtr & node, rclcpp::CallbackGroupType type)
+{
+  // Not added to the executors of the node, otherwise the main executor would run it as well.
+  auto callback_group = node->create_callback_group(type, false);
+  executor_.add_callback_group(callback_group, node->get_node_base_interface());
+  return callback_group;
+}
+
+void DecodeWorkerPool::removeCallbackGroup(
+  const rclcpp::CallbackGroup::SharedPtr & callback_group)
+{
+  executor_.remove_callback_group(callback_group);
+}
+
+size_t DecodeWorkerPool::getNumberOfThreads() const
+{
+  return number_of_threads_;
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
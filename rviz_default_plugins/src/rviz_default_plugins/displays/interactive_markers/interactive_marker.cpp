@@ -65,8 +65,10 @@ namespace displays
 {
 
 InteractiveMarker::InteractiveMarker(
-  Ogre::SceneNode * scene_node, rviz_common::DisplayContext * context)
+  Ogre::SceneNode * scene_node, rviz_common::DisplayContext * context,
+  std::shared_ptr<ViewFacingControls> view_facing_controls)
 : context_(context),
+  view_facing_controls_(view_facing_controls),
   pose_changed_(false),
   dragging_(false),
   pose_update_requested_(false),
@@ -98,11 +100,23 @@ void InteractiveMarker::processMessage(
     orientation.w = 1.0;
   }
 
+  bool reference_frame_changed = reference_frame_ != message.header.frame_id;
   reference_time_ = rclcpp::Time(message.header.stamp, RCL_ROS_TIME);
   reference_frame_ = message.header.frame_id;
   frame_locked_ = (message.header.stamp == builtin_interfaces::msg::Time());
 
-  requestPoseUpdate(position, orientation);
+  if (dragging_) {
+    pose_update_requested_ = true;
+    requested_position_ = position;
+    requested_orientation_ = orientation;
+  } else {
+    // frame-locked markers look up their reference pose in update() anyway, so pose
+    // updates only need to move the controls
+    if (!frame_locked_ || reference_frame_changed) {
+      updateReferencePose();
+    }
+    setPose(position, orientation, "");
+  }
   context_->queueRender();
 }
 
@@ -189,6 +203,12 @@ void InteractiveMarker::update()
   }
 }
 
+bool InteractiveMarker::needsUpdate()
+{
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  return frame_locked_ || dragging_;
+}
+
 void InteractiveMarker::setPose(
   Ogre::Vector3 position, Ogre::Quaternion orientation, const std::string & control_name)
 {
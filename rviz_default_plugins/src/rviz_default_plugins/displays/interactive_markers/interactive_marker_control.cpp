@@ -68,6 +68,7 @@
 
 #include "rviz_default_plugins/displays/interactive_markers/interactive_marker.hpp"
 #include "rviz_default_plugins/displays/interactive_markers/interactive_marker_control.hpp"
+#include "rviz_default_plugins/displays/interactive_markers/view_facing_controls.hpp"
 
 static const float kNoHighlightValue = 0.0f;
 static const float kActiveHightlightValue = 0.5f;
@@ -95,6 +96,7 @@ InteractiveMarkerControl::InteractiveMarkerControl(
   interaction_enabled_(false),
   visible_(true),
   view_facing_(false),
+  view_facing_controls_(parent->getViewFacingControls()),
   mouse_down_(false),
   show_visual_aids_(false),
   line_(new rviz_rendering::Line(context->getSceneManager(), control_frame_node_))
@@ -196,7 +198,7 @@ InteractiveMarkerControl::~InteractiveMarkerControl()
   context_->getSceneManager()->destroySceneNode(markers_node_);
 
   if (view_facing_) {
-    context_->getSceneManager()->removeListener(this);
+    view_facing_controls_->remove(this);
   }
 }
 
@@ -215,14 +217,13 @@ void InteractiveMarkerControl::processMessage(
 
   bool new_view_facingness =
     (message.orientation_mode == visualization_msgs::msg::InteractiveMarkerControl::VIEW_FACING);
-  if (new_view_facingness != view_facing_) {
-    if (new_view_facingness) {
-      context_->getSceneManager()->addListener(this);
-    } else {
-      context_->getSceneManager()->removeListener(this);
-    }
-    view_facing_ = new_view_facingness;
+  if (new_view_facingness) {
+    // also turns the control again if it was view facing before, its orientation may have changed
+    view_facing_controls_->add(this, reference_node_);
+  } else if (view_facing_) {
+    view_facing_controls_->remove(this);
   }
+  view_facing_ = new_view_facingness;
 
   independent_marker_orientation_ = message.independent_marker_orientation;
 
@@ -321,30 +322,24 @@ void InteractiveMarkerControl::processMessage(
   enableInteraction(context_->getHandlerManager()->getInteractionEnabled());
 }
 
-// This is an Ogre::SceneManager::Listener function, and is configured
-// to be called only if this is a VIEW_FACING control.
-void InteractiveMarkerControl::preFindVisibleObjects(
-  Ogre::SceneManager * source,
-  Ogre::SceneManager::IlluminationRenderStage irs,
-  Ogre::Viewport * v)
+void InteractiveMarkerControl::updateControlOrientationForViewFacing(Ogre::Viewport * v)
 {
-  (void)source;
-  (void)irs;
-  updateControlOrientationForViewFacing(v);
+  updateControlOrientationForViewFacing(
+    v->getCamera()->getDerivedDirection(), v->getCamera()->getDerivedUp());
 }
 
-void InteractiveMarkerControl::updateControlOrientationForViewFacing(Ogre::Viewport * v)
+void InteractiveMarkerControl::updateControlOrientationForViewFacing(
+  const Ogre::Vector3 & camera_direction, const Ogre::Vector3 & camera_up)
 {
   Ogre::Quaternion x_view_facing_rotation = control_orientation_.xAxis().getRotationTo(
-    v->getCamera()->getDerivedDirection());
+    camera_direction);
 
   // rotate so z axis is up
   Ogre::Vector3 z_axis_2 = x_view_facing_rotation * control_orientation_.zAxis();
-  Ogre::Quaternion align_yz_rotation = z_axis_2.getRotationTo(v->getCamera()->getDerivedUp());
+  Ogre::Quaternion align_yz_rotation = z_axis_2.getRotationTo(camera_up);
 
   // rotate
-  Ogre::Quaternion rotate_around_x = Ogre::Quaternion(
-    rotation_, v->getCamera()->getDerivedDirection());
+  Ogre::Quaternion rotate_around_x = Ogre::Quaternion(rotation_, camera_direction);
 
   Ogre::Quaternion rotation = reference_node_->convertWorldToLocalOrientation(
     rotate_around_x * align_yz_rotation * x_view_facing_rotation);
@@ -419,6 +414,8 @@ void InteractiveMarkerControl::interactiveMarkerPoseChanged(
       if (drag_viewport_) {
         updateControlOrientationForViewFacing(drag_viewport_);
       }
+      // the rotation around the view axis may have changed while dragging
+      view_facing_controls_->invalidate(this);
       if (independent_marker_orientation_) {
         markers_node_->setOrientation(int_marker_orientation);
       }
@@ -31,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -103,8 +104,19 @@ InteractiveMarkerDisplay::InteractiveMarkerDisplay()
     SLOT(updateEnableTransparency()));
 }
 
+InteractiveMarkerDisplay::InteractiveMarkerDisplay(rviz_common::DisplayContext * context)
+: InteractiveMarkerDisplay()
+{
+  context_ = context;
+  scene_manager_ = context_->getSceneManager();
+  scene_node_ = scene_manager_->getRootSceneNode()->createChildSceneNode();
+  view_facing_controls_ = std::make_shared<ViewFacingControls>(scene_manager_);
+}
+
 void InteractiveMarkerDisplay::onInitialize()
 {
+  view_facing_controls_ = std::make_shared<ViewFacingControls>(scene_manager_);
+
   auto ros_node_abstraction = context_->getRosNodeAbstraction().lock();
   if (!ros_node_abstraction) {
     return;
@@ -173,7 +185,7 @@ void InteractiveMarkerDisplay::namespaceChanged()
 void InteractiveMarkerDisplay::subscribe()
 {
   const std::string topic_namespace = interactive_marker_namespace_property_->getNamespaceStd();
-  if (isEnabled() && !topic_namespace.empty()) {
+  if (interactive_marker_client_ && isEnabled() && !topic_namespace.empty()) {
     interactive_marker_client_->connect(topic_namespace);
   }
 }
@@ -181,7 +193,9 @@ void InteractiveMarkerDisplay::subscribe()
 void InteractiveMarkerDisplay::publishFeedback(
   visualization_msgs::msg::InteractiveMarkerFeedback & feedback)
 {
-  interactive_marker_client_->publishFeedback(feedback);
+  if (interactive_marker_client_) {
+    interactive_marker_client_->publishFeedback(feedback);
+  }
 }
 
 void InteractiveMarkerDisplay::onStatusUpdate(
@@ -205,10 +219,15 @@ void InteractiveMarkerDisplay::update(float wall_dt, float ros_dt)
   (void) wall_dt;
   (void) ros_dt;
 
-  interactive_marker_client_->update();
+  if (interactive_marker_client_) {
+    interactive_marker_client_->update();
+  }
+  applyPendingPoses();
 
   for (const auto & name_marker_pair : interactive_markers_map_) {
-    name_marker_pair.second->update();
+    if (name_marker_pair.second->needsUpdate()) {
+      name_marker_pair.second->update();
+    }
   }
 }
 
@@ -226,13 +245,17 @@ void InteractiveMarkerDisplay::updateMarkers(
     RVIZ_COMMON_LOG_DEBUG_STREAM(
       "Processing interactive marker '" << marker.name << "'. " << marker.controls.size());
 
+    // the full message carries a newer pose than any pose update received before
+    pending_poses_.erase(marker.name);
+
     auto int_marker_entry = interactive_markers_map_.find(marker.name);
 
     if (int_marker_entry == interactive_markers_map_.end()) {
       int_marker_entry = interactive_markers_map_.insert(
         std::make_pair(
           marker.name,
-          std::make_shared<InteractiveMarker>(getSceneNode(), context_))).first;
+          std::make_shared<InteractiveMarker>(
+            getSceneNode(), context_, view_facing_controls_))).first;
       connect(
         int_marker_entry->second.get(),
         SIGNAL(userFeedback(visualization_msgs::msg::InteractiveMarkerFeedback&)),
@@ -264,9 +287,25 @@ void InteractiveMarkerDisplay::updateMarkers(
   }
 }
 
+InteractiveMarker::SharedPtr InteractiveMarkerDisplay::getInteractiveMarker(
+  const std::string & name) const
+{
+  auto int_marker_entry = interactive_markers_map_.find(name);
+  if (int_marker_entry == interactive_markers_map_.end()) {
+    return nullptr;
+  }
+  return int_marker_entry->second;
+}
+
+size_t InteractiveMarkerDisplay::getPendingPoseCount() const
+{
+  return pending_poses_.size();
+}
+
 void InteractiveMarkerDisplay::eraseAllMarkers()
 {
   interactive_markers_map_.clear();
+  pending_poses_.clear();
   deleteStatusStd("Interactive Marker Client");
 }
 
@@ -274,6 +313,7 @@ void InteractiveMarkerDisplay::eraseMarkers(const std::vector<std::string> & era
 {
   for (const std::string & marker_name : erases) {
     interactive_markers_map_.erase(marker_name);
+    pending_poses_.erase(marker_name);
     deleteStatusStd(marker_name);
   }
 }
@@ -290,15 +330,27 @@ void InteractiveMarkerDisplay::updatePoses(
       return;
     }
 
-    auto int_marker_entry = interactive_markers_map_.find(marker_pose.name);
+    pending_poses_[marker_pose.name] = marker_pose;
+  }
+}
+
+void InteractiveMarkerDisplay::applyPendingPoses()
+{
+  // A server streaming poses can send several updates per marker between two frames,
+  // only the latest of them is visible.
+  auto pending_poses = std::move(pending_poses_);
+  pending_poses_.clear();
+
+  for (const auto & name_pose_pair : pending_poses) {
+    auto int_marker_entry = interactive_markers_map_.find(name_pose_pair.first);
 
     if (int_marker_entry != interactive_markers_map_.end()) {
-      int_marker_entry->second->processMessage(marker_pose);
+      int_marker_entry->second->processMessage(name_pose_pair.second);
     } else {
       setStatusStd(
         rviz_common::properties::StatusProperty::Error,
-        marker_pose.name,
-        "Pose received for non-existing marker '" + marker_pose.name);
+        name_pose_pair.first,
+        "Pose received for non-existing marker '" + name_pose_pair.first);
       unsubscribe();
       return;
     }
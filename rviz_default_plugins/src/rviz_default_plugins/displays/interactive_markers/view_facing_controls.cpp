@@ -0,0 +1,129 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_default_plugins/displays/interactive_markers/view_facing_controls.hpp"
+
+#include <OgreCamera.h>
+#include <OgreSceneNode.h>
+#include <OgreViewport.h>
+
+#include "rviz_default_plugins/displays/interactive_markers/interactive_marker_control.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+ViewFacingControls::ViewFacingControls(Ogre::SceneManager * scene_manager)
+: scene_manager_(scene_manager),
+  last_camera_(nullptr),
+  last_camera_direction_(Ogre::Vector3::ZERO),
+  last_camera_up_(Ogre::Vector3::ZERO)
+{
+  scene_manager_->addListener(this);
+}
+
+ViewFacingControls::~ViewFacingControls()
+{
+  scene_manager_->removeListener(this);
+}
+
+void ViewFacingControls::add(
+  InteractiveMarkerControl * control, Ogre::SceneNode * reference_node)
+{
+  if (indices_.count(control) > 0) {
+    invalidate(control);
+    return;
+  }
+  indices_[control] = entries_.size();
+  entries_.push_back({control, reference_node, Ogre::Quaternion::IDENTITY, true});
+}
+
+void ViewFacingControls::remove(InteractiveMarkerControl * control)
+{
+  auto index_entry = indices_.find(control);
+  if (index_entry == indices_.end()) {
+    return;
+  }
+
+  size_t index = index_entry->second;
+  indices_.erase(index_entry);
+  if (index != entries_.size() - 1) {
+    entries_[index] = entries_.back();
+    indices_[entries_[index].control] = index;
+  }
+  entries_.pop_back();
+}
+
+void ViewFacingControls::invalidate(InteractiveMarkerControl * control)
+{
+  auto index_entry = indices_.find(control);
+  if (index_entry != indices_.end()) {
+    entries_[index_entry->second].dirty = true;
+  }
+}
+
+void ViewFacingControls::preFindVisibleObjects(
+  Ogre::SceneManager * source,
+  Ogre::SceneManager::IlluminationRenderStage irs,
+  Ogre::Viewport * v)
+{
+  (void) source;
+  (void) irs;
+
+  Ogre::Camera * camera = v->getCamera();
+  if (!camera || entries_.empty()) {
+    return;
+  }
+
+  const Ogre::Vector3 camera_direction = camera->getDerivedDirection();
+  const Ogre::Vector3 camera_up = camera->getDerivedUp();
+  bool camera_turned = camera != last_camera_ ||
+    camera_direction != last_camera_direction_ ||
+    camera_up != last_camera_up_;
+  last_camera_ = camera;
+  last_camera_direction_ = camera_direction;
+  last_camera_up_ = camera_up;
+
+  for (auto & entry : entries_) {
+    const Ogre::Quaternion & reference_orientation =
+      entry.reference_node->_getDerivedOrientation();
+    if (!camera_turned && !entry.dirty && reference_orientation == entry.reference_orientation) {
+      continue;
+    }
+
+    entry.reference_orientation = reference_orientation;
+    entry.dirty = false;
+    entry.control->updateControlOrientationForViewFacing(camera_direction, camera_up);
+  }
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
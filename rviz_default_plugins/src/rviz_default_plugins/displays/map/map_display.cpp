@@ -345,21 +345,23 @@ bool validateFloats(const nav_msgs::msg::OccupancyGrid & msg)
 
 void MapDisplay::processMessage(nav_msgs::msg::OccupancyGrid::ConstSharedPtr msg)
 {
-  current_map_ = *msg;
+  // Keep the message instead of copying it, it is only copied when an update changes it.
+  current_map_ = msg;
+  updated_map_.reset();
   loaded_ = true;
   // updated via signal in case ros spinner is in a different thread
   Q_EMIT mapUpdated();
 }
 
-void MapDisplay::incomingUpdate(const map_msgs::msg::OccupancyGridUpdate::ConstSharedPtr update)
+void MapDisplay::updateStatuses()
 {
-  // Only update the map if we have gotten a full one first.
-  if (!loaded_) {
+  MFDClass::updateStatuses();
+
+  const uint32_t update_messages_received = update_messages_received_;
+  if (update_messages_received == 0) {
     return;
   }
-
-  ++update_messages_received_;
-  QString topic_str = QString::number(messages_received_) + " update messages received";
+  QString topic_str = QString::number(update_messages_received) + " update messages received";
   // Append topic subscription frequency if we can lock rviz_ros_node_.
   std::shared_ptr<rviz_common::ros_integration::RosNodeAbstractionIface> node_interface =
     rviz_ros_node_.lock();
@@ -367,13 +369,25 @@ void MapDisplay::incomingUpdate(const map_msgs::msg::OccupancyGridUpdate::ConstS
     const double duration =
       (node_interface->get_raw_node()->now() - subscription_start_time_).seconds();
     const double subscription_frequency =
-      static_cast<double>(messages_received_) / duration;
+      static_cast<double>(update_messages_received) / duration;
     topic_str += " at " + QString::number(subscription_frequency, 'f', 1) + " hz.";
   }
+  // Not "Topic", which MFDClass uses for the count of full maps
   setStatus(
     rviz_common::properties::StatusProperty::Ok,
-    "Topic",
+    "Updates",
     topic_str);
+}
+
+void MapDisplay::incomingUpdate(const map_msgs::msg::OccupancyGridUpdate::ConstSharedPtr update)
+{
+  // Only update the map if we have gotten a full one first.
+  if (!loaded_) {
+    return;
+  }
+
+  ++update_messages_received_;
+  requestStatusUpdate();
 
   if (updateDataOutOfBounds(update)) {
     setStatus(
@@ -394,27 +408,32 @@ bool MapDisplay::updateDataOutOfBounds(
 {
   return update->x < 0 ||
          update->y < 0 ||
-         current_map_.info.width < update->x + update->width ||
-         current_map_.info.height < update->y + update->height;
+         current_map_->info.width < update->x + update->width ||
+         current_map_->info.height < update->y + update->height;
 }
 
 void MapDisplay::updateMapDataInMemory(
   const map_msgs::msg::OccupancyGridUpdate::ConstSharedPtr update)
 {
+  if (!updated_map_) {
+    updated_map_ = std::make_shared<nav_msgs::msg::OccupancyGrid>(*current_map_);
+    current_map_ = updated_map_;
+  }
+
   for (size_t y = 0; y < update->height; y++) {
     auto offset = update->data.begin() + y * update->width;
     std::copy(
       offset,
       offset + update->width,
-      current_map_.data.begin() + (update->y + y) * current_map_.info.width + update->x);
+      updated_map_->data.begin() + (update->y + y) * updated_map_->info.width + update->x);
   }
 }
 
 void MapDisplay::createSwatches()
 {
-  size_t width = current_map_.info.width;
-  size_t height = current_map_.info.height;
-  float resolution = current_map_.info.resolution;
+  size_t width = current_map_->info.width;
+  size_t height = current_map_->info.height;
+  float resolution = current_map_->info.resolution;
 
   size_t swatch_width = width;
   size_t swatch_height = height;
@@ -484,7 +503,7 @@ void MapDisplay::tryCreateSwatches(
         resolution,
         draw_under_property_->getValue().toBool()));
 
-    swatches_[i]->updateData(current_map_);
+    swatches_[i]->updateData(*current_map_);
 
     x += effective_width;
     if (x >= width) {
@@ -507,19 +526,19 @@ size_t MapDisplay::getEffectiveDimension(
 
 void MapDisplay::showMap()
 {
-  if (current_map_.data.empty()) {
+  if (!current_map_ || current_map_->data.empty()) {
     return;
   }
 
-  if (!validateFloats(current_map_)) {
+  if (!validateFloats(*current_map_)) {
     setStatus(
       rviz_common::properties::StatusProperty::Error, "Map",
       "Message contained invalid floating point values (nans or infs)");
     return;
   }
 
-  size_t width = current_map_.info.width;
-  size_t height = current_map_.info.height;
+  size_t width = current_map_->info.width;
+  size_t height = current_map_->info.height;
 
   if (width * height == 0) {
     std::string message =
@@ -529,10 +548,10 @@ void MapDisplay::showMap()
     return;
   }
 
-  if (width * height != current_map_.data.size()) {
+  if (width * height != current_map_->data.size()) {
     std::string message =
       "Data size doesn't match width*height: width = " + std::to_string(width) + ", height = " +
-      std::to_string(height) + ", data size = " + std::to_string(current_map_.data.size());
+      std::to_string(height) + ", data size = " + std::to_string(current_map_->data.size());
     setStatus(
       rviz_common::properties::StatusProperty::Error, "Map", QString::fromStdString(message));
     return;
@@ -541,22 +560,22 @@ void MapDisplay::showMap()
   setStatus(rviz_common::properties::StatusProperty::Ok, "Message", "Map received");
 
   RVIZ_COMMON_LOG_DEBUG_STREAM(
-    "Received a " << current_map_.info.width << " X " <<
-      current_map_.info.height << " map @ " << current_map_.info.resolution << "m/pix\n");
+    "Received a " << current_map_->info.width << " X " <<
+      current_map_->info.height << " map @ " << current_map_->info.resolution << "m/pix\n");
 
   showValidMap();
 }
 
 void MapDisplay::showValidMap()
 {
-  size_t width = current_map_.info.width;
-  size_t height = current_map_.info.height;
+  size_t width = current_map_->info.width;
+  size_t height = current_map_->info.height;
 
-  float resolution = current_map_.info.resolution;
+  float resolution = current_map_->info.resolution;
 
   resetSwatchesIfNecessary(width, height, resolution);
 
-  frame_ = current_map_.header.frame_id;
+  frame_ = current_map_->header.frame_id;
   if (frame_.empty()) {
     frame_ = "/map";
   }
@@ -570,9 +589,9 @@ void MapDisplay::showValidMap()
   width_property_->setValue(static_cast<unsigned int>(width));
   height_property_->setValue(static_cast<unsigned int>(height));
 
-  position_property_->setVector(rviz_common::pointMsgToOgre(current_map_.info.origin.position));
+  position_property_->setVector(rviz_common::pointMsgToOgre(current_map_->info.origin.position));
   orientation_property_->setQuaternion(
-    rviz_common::quaternionMsgToOgre(current_map_.info.origin.orientation));
+    rviz_common::quaternionMsgToOgre(current_map_->info.origin.orientation));
 
   transformMap();
 
@@ -594,7 +613,7 @@ void MapDisplay::resetSwatchesIfNecessary(size_t width, size_t height, float res
 void MapDisplay::updateSwatches() const
 {
   for (const auto & swatch : swatches_) {
-    swatch->updateData(current_map_);
+    swatch->updateData(*current_map_);
 
     Ogre::Pass * pass = swatch->getTechniquePass();
     Ogre::TextureUnitState * tex_unit = nullptr;
@@ -646,16 +665,16 @@ void MapDisplay::transformMap()
   rclcpp::Time transform_time = context_->getClock()->now();
 
   if (transform_timestamp_property_->getBool()) {
-    transform_time = rclcpp::Time(current_map_.header.stamp, RCL_ROS_TIME);
+    transform_time = rclcpp::Time(current_map_->header.stamp, RCL_ROS_TIME);
   }
 
   Ogre::Vector3 position;
   Ogre::Quaternion orientation;
   if (!context_->getFrameManager()->transform(
-      frame_, transform_time, current_map_.info.origin, position, orientation) &&
+      frame_, transform_time, current_map_->info.origin, position, orientation) &&
     !context_->getFrameManager()->transform(
       frame_, rclcpp::Time(0, 0, context_->getClock()->get_clock_type()),
-      current_map_.info.origin, position, orientation))
+      current_map_->info.origin, position, orientation))
   {
     setMissingTransformToFixedFrame(frame_);
     scene_node_->setVisible(false);
@@ -31,6 +31,9 @@
 
 #include "rviz_default_plugins/displays/marker/marker_common.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <set>
 #include <sstream>
@@ -42,10 +45,16 @@
 
 #include "rviz_common/display.hpp"
 #include "rviz_common/display_context.hpp"
+#include "rviz_common/frame_manager_iface.hpp"
+#include "rviz_common/properties/float_property.hpp"
 #include "rviz_common/properties/property.hpp"
 #include "rviz_common/validate_floats.hpp"
+#include "rviz_rendering/objects/movable_text.hpp"
+#include "rviz_rendering/objects/text_batch.hpp"
 
+#include "rviz_default_plugins/displays/marker/markers/marker_base.hpp"
 #include "rviz_default_plugins/displays/marker/markers/marker_factory.hpp"
+#include "rviz_default_plugins/displays/marker/markers/text_view_facing_marker.hpp"
 
 namespace rviz_default_plugins
 {
@@ -53,8 +62,24 @@ namespace displays
 {
 
 MarkerCommon::MarkerCommon(rviz_common::Display * display)
-: display_(display)
+: first_pending_sequence_(0),
+  queue_status_shown_(false),
+  skipped_marker_count_(0),
+  display_(display)
 {
+  processing_budget_property_ = new rviz_common::properties::FloatProperty(
+    "Processing Budget (ms)", 10.0f,
+    "Maximum time per frame spent on applying received markers. Markers which do not fit are "
+    "applied in the following frames. 0 applies all received markers at once.",
+    display_);
+  processing_budget_property_->setMin(0.0f);
+
+  batch_text_property_ = new rviz_common::properties::BoolProperty(
+    "Batch Text", false,
+    "Draw all TEXT_VIEW_FACING markers with a few draw calls instead of one text object each. "
+    "Batched text markers cannot be selected.",
+    display_);
+
   namespaces_category_ = new rviz_common::properties::Property(
     "Namespaces", QVariant(), "", display_);
   marker_factory_ = std::make_unique<markers::MarkerFactory>();
@@ -89,9 +114,19 @@ void MarkerCommon::clearMarkers()
 {
   markers_.clear();
   markers_with_expiration_.clear();
+  expiration_queue_.clear();
   frame_locked_markers_.clear();
   namespaces_category_->removeChildren();
   namespaces_.clear();
+
+  // Messages which have not been applied yet would otherwise reappear after a reset
+  {
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    message_queue_.clear();
+  }
+  dropPendingMessages("");
+  skipped_marker_count_ = 0;
+  display_->deleteStatusStd("Unchanged Markers");
 }
 
 void MarkerCommon::deleteMarker(MarkerID id)
@@ -100,12 +135,27 @@ void MarkerCommon::deleteMarker(MarkerID id)
 
   auto it = markers_.find(id);
   if (it != markers_.end()) {
-    markers_with_expiration_.erase(it->second);
-    frame_locked_markers_.erase(it->second);
+    untrackMarker(it->second);
     markers_.erase(it);
   }
 }
 
+void MarkerCommon::untrackMarker(const MarkerBasePtr & marker)
+{
+  markers_with_expiration_.erase(marker);
+
+  const auto & message = marker->getMessage();
+  if (message && message->frame_locked) {
+    auto frame = frame_locked_markers_.find(message->header.frame_id);
+    if (frame != frame_locked_markers_.end()) {
+      frame->second.erase(marker);
+      if (frame->second.empty()) {
+        frame_locked_markers_.erase(frame);
+      }
+    }
+  }
+}
+
 void MarkerCommon::deleteMarkersInNamespace(const std::string & ns)
 {
   std::vector<MarkerID> to_delete;
@@ -278,8 +328,7 @@ MarkerBasePtr MarkerCommon::createOrGetOldMarker(
   auto it = markers_.find(MarkerID(message->ns, message->id));
   if (it != markers_.end()) {
     marker = it->second;
-    markers_with_expiration_.erase(marker);
-    frame_locked_markers_.erase(marker);
+    untrackMarker(marker);
     if (message->type != marker->getMessage()->type) {
       markers_.erase(it);
       marker = createMarker(message);
@@ -301,14 +350,17 @@ MarkerBasePtr MarkerCommon::createMarker(
 void MarkerCommon::configureMarker(
   const visualization_msgs::msg::Marker::ConstSharedPtr & message, MarkerBasePtr & marker)
 {
-  marker->setMessage(message);
+  if (!marker->updateMessage(message)) {
+    ++skipped_marker_count_;
+  }
 
   if (rclcpp::Duration(message->lifetime).nanoseconds() > 100000) {
     markers_with_expiration_.insert(marker);
+    scheduleExpiration(marker);
   }
 
   if (message->frame_locked) {
-    frame_locked_markers_.insert(marker);
+    frame_locked_markers_[message->header.frame_id].insert(marker);
   }
 
   context_->queueRender();
@@ -326,8 +378,11 @@ void MarkerCommon::update(float wall_dt, float ros_dt)
   (void) wall_dt;
   (void) ros_dt;
 
+  updateTextBatching();
+
   MarkerCommon::V_MarkerMessage local_queue = takeSnapshotOfMessageQueue();
-  processNewMessages(local_queue);
+  queueNewMessages(local_queue);
+  processPendingMessages();
   removeExpiredMarkers();
   updateMarkersWithLockedFrame();
 }
@@ -342,20 +397,180 @@ MarkerCommon::V_MarkerMessage MarkerCommon::takeSnapshotOfMessageQueue()
   return local_queue;
 }
 
-void MarkerCommon::processNewMessages(const MarkerCommon::V_MarkerMessage & local_queue)
+void MarkerCommon::queueNewMessages(const MarkerCommon::V_MarkerMessage & local_queue)
+{
+  auto now = std::chrono::steady_clock::now();
+  for (auto const & message : local_queue) {
+    if (message->action == visualization_msgs::msg::Marker::DELETEALL) {
+      dropPendingMessages(message->ns);
+      pending_messages_.push_back({message, now});
+      continue;
+    }
+
+    MarkerID id(message->ns, message->id);
+    auto it = pending_sequence_by_id_.find(id);
+    if (it != pending_sequence_by_id_.end()) {
+      // Only the latest state of a marker is of interest, keep the place of the older message
+      pending_messages_[it->second - first_pending_sequence_].message = message;
+      continue;
+    }
+    pending_sequence_by_id_[id] = first_pending_sequence_ + pending_messages_.size();
+    pending_messages_.push_back({message, now});
+  }
+}
+
+void MarkerCommon::dropPendingMessages(const std::string & ns)
+{
+  if (ns.empty()) {
+    first_pending_sequence_ += pending_messages_.size();
+    pending_messages_.clear();
+    pending_sequence_by_id_.clear();
+    return;
+  }
+
+  for (auto & pending : pending_messages_) {
+    if (pending.message && pending.message->ns == ns) {
+      pending_sequence_by_id_.erase(MarkerID(pending.message->ns, pending.message->id));
+      pending.message.reset();
+    }
+  }
+}
+
+void MarkerCommon::processPendingMessages()
+{
+  skipped_marker_count_ = 0;
+
+  using Milliseconds = std::chrono::duration<float, std::milli>;
+  const Milliseconds budget(processing_budget_property_->getFloat());
+  const auto start = std::chrono::steady_clock::now();
+
+  size_t processed = 0;
+  while (!pending_messages_.empty()) {
+    // Checking the clock is cheap compared to a marker update, but not free
+    if (budget.count() > 0 && processed > 0 && processed % 16 == 0 &&
+      std::chrono::steady_clock::now() - start > budget)
+    {
+      break;
+    }
+
+    auto message = std::move(pending_messages_.front().message);
+    pending_messages_.pop_front();
+    uint64_t sequence = first_pending_sequence_++;
+    if (!message) {
+      continue;
+    }
+    if (message->action != visualization_msgs::msg::Marker::DELETEALL) {
+      auto it = pending_sequence_by_id_.find(MarkerID(message->ns, message->id));
+      if (it != pending_sequence_by_id_.end() && it->second == sequence) {
+        pending_sequence_by_id_.erase(it);
+      }
+    }
+
+    processMessage(message);
+    ++processed;
+  }
+
+  updateQueueStatus();
+  updateSkippedStatus(processed);
+}
+
+void MarkerCommon::updateSkippedStatus(size_t processed)
+{
+  // Frames without messages keep the previous entry, so a streaming topic does not flicker
+  if (processed == 0) {
+    return;
+  }
+  display_->setStatusStd(
+    rviz_common::properties::StatusProperty::Ok,
+    "Unchanged Markers",
+    std::to_string(skipped_marker_count_) + " of " + std::to_string(processed) +
+    " markers in the last update were unchanged and kept their geometry");
+}
+
+void MarkerCommon::updateTextBatching()
+{
+  if (batch_text_property_->getBool() == static_cast<bool>(text_batch_)) {
+    return;
+  }
+
+  std::unique_ptr<rviz_rendering::TextBatch> old_batch = std::move(text_batch_);
+  if (batch_text_property_->getBool()) {
+    text_batch_ = std::make_unique<rviz_rendering::TextBatch>(
+      context_->getSceneManager(), scene_node_);
+    text_batch_->setTextAlignment(
+      rviz_rendering::MovableText::H_CENTER, rviz_rendering::MovableText::V_CENTER);
+  }
+
+  for (auto const & id_and_marker : markers_) {
+    auto text_marker =
+      std::dynamic_pointer_cast<markers::TextViewFacingMarker>(id_and_marker.second);
+    if (text_marker) {
+      text_marker->setTextBatch(text_batch_.get());
+    }
+  }
+  context_->queueRender();
+}
+
+void MarkerCommon::updateQueueStatus()
+{
+  const char * kQueueStatus = "Marker Queue";
+  if (pending_messages_.empty()) {
+    if (queue_status_shown_) {
+      display_->deleteStatusStd(kQueueStatus);
+      queue_status_shown_ = false;
+    }
+    return;
+  }
+
+  auto lag = std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - pending_messages_.front().queued_time);
+  display_->setStatusStd(
+    rviz_common::properties::StatusProperty::Warn,
+    kQueueStatus,
+    std::to_string(pending_messages_.size()) + " markers queued, lagging " +
+    std::to_string(lag.count()) + " ms behind");
+  queue_status_shown_ = true;
+
+  // Continue with the remaining markers in the next frame
+  context_->queueRender();
+}
+
+void MarkerCommon::scheduleExpiration(const MarkerBasePtr & marker)
 {
-  if (!local_queue.empty()) {
-    for (auto const & message : local_queue) {
-      processMessage(message);
+  expiration_queue_.push_back({marker->getExpiration().nanoseconds(), marker});
+  std::push_heap(
+    expiration_queue_.begin(), expiration_queue_.end(), std::greater<ScheduledExpiration>());
+
+  // markers which are renewed faster than they expire leave many outdated entries behind
+  if (expiration_queue_.size() > 2 * markers_with_expiration_.size() + 64) {
+    expiration_queue_.clear();
+    for (const auto & expiring_marker : markers_with_expiration_) {
+      expiration_queue_.push_back(
+        {expiring_marker->getExpiration().nanoseconds(), expiring_marker});
     }
+    std::make_heap(
+      expiration_queue_.begin(), expiration_queue_.end(), std::greater<ScheduledExpiration>());
   }
 }
 
 void MarkerCommon::removeExpiredMarkers()
 {
+  if (expiration_queue_.empty()) {
+    return;
+  }
+
+  const int64_t now = context_->getClock()->now().nanoseconds();
   std::vector<MarkerBasePtr> markers_to_delete;
-  for (const auto & marker : markers_with_expiration_) {
-    if (marker->expired()) {
+  while (!expiration_queue_.empty() && expiration_queue_.front().expiration <= now) {
+    std::pop_heap(
+      expiration_queue_.begin(), expiration_queue_.end(), std::greater<ScheduledExpiration>());
+    auto marker = expiration_queue_.back().marker.lock();
+    int64_t expiration = expiration_queue_.back().expiration;
+    expiration_queue_.pop_back();
+
+    if (marker && marker->getExpiration().nanoseconds() == expiration &&
+      markers_with_expiration_.count(marker) > 0)
+    {
       markers_to_delete.push_back(marker);
     }
   }
@@ -366,8 +581,18 @@ void MarkerCommon::removeExpiredMarkers()
 
 void MarkerCommon::updateMarkersWithLockedFrame() const
 {
-  for (auto const & locked_marker : frame_locked_markers_) {
-    locked_marker->updateFrameLocked();
+  auto frame_manager = context_->getFrameManager();
+  rclcpp::Time latest(0, 0, context_->getClock()->get_clock_type());
+  for (auto const & frame : frame_locked_markers_) {
+    markers::MarkerBase::LockedFrameTransform frame_transform;
+    frame_transform.valid = frame_manager->getTransform(
+      frame.first, latest, frame_transform.position, frame_transform.orientation);
+    if (!frame_transform.valid) {
+      frame_manager->transformHasProblems(frame.first, latest, frame_transform.error);
+    }
+    for (auto const & locked_marker : frame.second) {
+      locked_marker->updateFrameLocked(frame_transform);
+    }
   }
 }
 
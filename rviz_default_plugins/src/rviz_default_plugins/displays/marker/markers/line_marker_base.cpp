@@ -100,6 +100,21 @@ void LineMarkerBase::onNewMessage(
   convertNewMessageToBillboardLine(new_message);
 }
 
+bool LineMarkerBase::onNewPose(const MarkerConstSharedPtr & new_message)
+{
+  Ogre::Vector3 pos, scale;
+  Ogre::Quaternion orient;
+  if (!transform(new_message, pos, orient, scale)) {  // NOLINT: is super class method
+    scene_node_->setVisible(false);
+    return true;
+  }
+  scene_node_->setVisible(true);
+
+  setPosition(pos);
+  setOrientation(orient);
+  return true;
+}
+
 void LineMarkerBase::addPoint(
   const MarkerBase::MarkerConstSharedPtr & new_message, size_t point_number) const
 {
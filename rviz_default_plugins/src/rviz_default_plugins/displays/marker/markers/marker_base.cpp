@@ -56,13 +56,47 @@ namespace displays
 namespace markers
 {
 
+namespace
+{
+
+bool hasSameContent(const MarkerBase::Marker & lhs, const MarkerBase::Marker & rhs)
+{
+  // compare the small fields first, so most changed messages are detected without
+  // walking the point arrays
+  return lhs.type == rhs.type &&
+         lhs.scale == rhs.scale &&
+         lhs.color == rhs.color &&
+         lhs.mesh_use_embedded_materials == rhs.mesh_use_embedded_materials &&
+         lhs.text == rhs.text &&
+         lhs.mesh_resource == rhs.mesh_resource &&
+         lhs.texture_resource == rhs.texture_resource &&
+         lhs.points.size() == rhs.points.size() &&
+         lhs.colors.size() == rhs.colors.size() &&
+         lhs.uv_coordinates.size() == rhs.uv_coordinates.size() &&
+         lhs.points == rhs.points &&
+         lhs.colors == rhs.colors &&
+         lhs.uv_coordinates == rhs.uv_coordinates &&
+         lhs.texture == rhs.texture;
+}
+
+bool hasSamePose(const MarkerBase::Marker & lhs, const MarkerBase::Marker & rhs)
+{
+  return lhs.header == rhs.header &&
+         lhs.pose == rhs.pose &&
+         lhs.frame_locked == rhs.frame_locked;
+}
+
+}  // namespace
+
 MarkerBase::MarkerBase(
   MarkerCommon * owner,
   rviz_common::DisplayContext * context,
   Ogre::SceneNode * parent_node)
 : owner_(owner),
   context_(context),
-  scene_node_(parent_node->createChildSceneNode())
+  scene_node_(parent_node->createChildSceneNode()),
+  transform_succeeded_(false),
+  locked_frame_transform_(nullptr)
 {}
 
 MarkerBase::~MarkerBase()
@@ -84,13 +118,50 @@ void MarkerBase::setMessage(const MarkerConstSharedPtr & message)
 
   expiration_ = context_->getClock()->now() + message->lifetime;
 
-  onNewMessage(old, message);
+  rebuild(old);
+}
+
+bool MarkerBase::updateMessage(const MarkerConstSharedPtr & message)
+{
+  // A message modified in place cannot be compared with its previous content.
+  if (!message_ || message_ == message || !transform_succeeded_ ||
+    !hasSameContent(*message_, *message))
+  {
+    setMessage(message);
+    return true;
+  }
+
+  MarkerConstSharedPtr old = message_;
+  message_ = message;
+  expiration_ = context_->getClock()->now() + message->lifetime;
+
+  if (!hasSamePose(*old, *message) && !onNewPose(message)) {
+    rebuild(old);
+    return true;
+  }
+  return false;
 }
 
-void MarkerBase::updateFrameLocked()
+void MarkerBase::updateFrameLocked(const LockedFrameTransform & frame_transform)
 {
   assert(message_ && message_->frame_locked);
-  onNewMessage(message_, message_);
+  locked_frame_transform_ = &frame_transform;
+  if (!transform_succeeded_ || !onNewPose(message_)) {
+    rebuild(message_);
+  }
+  locked_frame_transform_ = nullptr;
+}
+
+bool MarkerBase::onNewPose(const MarkerConstSharedPtr & new_message)
+{
+  (void) new_message;
+  return false;
+}
+
+void MarkerBase::rebuild(const MarkerConstSharedPtr & old_message)
+{
+  transform_succeeded_ = false;
+  onNewMessage(old_message, message_);
 }
 
 bool MarkerBase::expired()
@@ -104,6 +175,10 @@ bool MarkerBase::transform(
   Ogre::Quaternion & orient,
   Ogre::Vector3 & scale)
 {
+  if (message->frame_locked && locked_frame_transform_) {
+    return transformWithLockedFrame(message, pos, orient, scale);
+  }
+
   rclcpp::Time stamp(message->header.stamp, RCL_ROS_TIME);
   if (message->frame_locked) {
     stamp = rclcpp::Time(0, 0, context_->getClock()->get_clock_type());
@@ -120,9 +195,39 @@ bool MarkerBase::transform(
       owner_->setMarkerStatus(getID(), rviz_common::properties::StatusProperty::Error, error);
     }
     RVIZ_COMMON_LOG_DEBUG("Unable to transform marker message");
+    transform_succeeded_ = false;
+    return false;
+  }
+  transform_succeeded_ = true;
+
+  scale = Ogre::Vector3(message->scale.x, message->scale.y, message->scale.z);
+
+  return true;
+}
+
+bool MarkerBase::transformWithLockedFrame(
+  const MarkerConstSharedPtr & message,
+  Ogre::Vector3 & pos,
+  Ogre::Quaternion & orient,
+  Ogre::Vector3 & scale)
+{
+  if (!locked_frame_transform_->valid) {
+    if (owner_) {
+      owner_->setMarkerStatus(
+        getID(), rviz_common::properties::StatusProperty::Error, locked_frame_transform_->error);
+    }
+    transform_succeeded_ = false;
     return false;
   }
+  transform_succeeded_ = true;
 
+  // same as transforming the pose with the frame manager, without another lookup
+  const auto & position = message->pose.position;
+  const auto & orientation = message->pose.orientation;
+  pos = locked_frame_transform_->position + locked_frame_transform_->orientation *
+    Ogre::Vector3(position.x, position.y, position.z);
+  orient = locked_frame_transform_->orientation *
+    Ogre::Quaternion(orientation.w, orientation.x, orientation.y, orientation.z);
   scale = Ogre::Vector3(message->scale.x, message->scale.y, message->scale.z);
 
   return true;
@@ -31,6 +31,7 @@
 
 #include "rviz_default_plugins/displays/marker/markers/points_marker.hpp"
 
+#include <utility>
 #include <vector>
 
 #include "rviz_common/interaction/selection_manager.hpp"
@@ -100,6 +101,21 @@ void PointsMarker::onNewMessage(
   addPointsFromMessage(new_message);
 }
 
+bool PointsMarker::onNewPose(const MarkerConstSharedPtr & new_message)
+{
+  Ogre::Vector3 pose, scale;
+  Ogre::Quaternion orientation;
+  if (!transform(new_message, pose, orientation, scale)) {  // NOLINT: is super class method
+    scene_node_->setVisible(false);
+    return true;
+  }
+  scene_node_->setVisible(true);
+
+  setPosition(pose);
+  setOrientation(orientation);
+  return true;
+}
+
 void PointsMarker::setRenderModeAndDimensions(
   const MarkerConstSharedPtr & new_message, Ogre::Vector3 & scale)
 {
@@ -131,12 +147,12 @@ void PointsMarker::addPointsFromMessage(const MarkerConstSharedPtr & new_message
   bool has_nonzero_alpha = false;
   bool has_per_point_alpha = false;
 
-  std::vector<rviz_rendering::PointCloud::Point> points;
+  std::vector<rviz_rendering::PointCloud::CompactPoint> points;
   points.resize(new_message->points.size());
 
   for (size_t i = 0; i < points.size(); i++) {
     const geometry_msgs::msg::Point & message_point = new_message->points[i];
-    rviz_rendering::PointCloud::Point & point_cloud_point = points[i];
+    rviz_rendering::PointCloud::CompactPoint & point_cloud_point = points[i];
 
     Ogre::Vector3 message_point_position(message_point.x, message_point.y, message_point.z);
     point_cloud_point.position.x = message_point_position.x;
@@ -153,7 +169,7 @@ void PointsMarker::addPointsFromMessage(const MarkerConstSharedPtr & new_message
       has_per_point_alpha = has_per_point_alpha || alpha != 1.0;
     }
 
-    point_cloud_point.setColor(red, green, blue, alpha);
+    point_cloud_point.setColor(Ogre::ColourValue(red, green, blue, alpha));
   }
 
   if (has_per_point_color) {
@@ -168,7 +184,7 @@ void PointsMarker::addPointsFromMessage(const MarkerConstSharedPtr & new_message
     points_->setAlpha(alpha);
   }
 
-  points_->addPoints(points.begin(), points.end());
+  points_->addPoints(std::move(points));
 }
 
 void PointsMarker::setHighlightColor(float r, float g, float b)
@@ -35,8 +35,10 @@
 #include <OgreSceneManager.h>
 
 #include "rviz_rendering/objects/movable_text.hpp"
+#include "rviz_rendering/objects/text_batch.hpp"
 #include "rviz_common/display_context.hpp"
 
+#include "rviz_default_plugins/displays/marker/marker_common.hpp"
 #include "rviz_default_plugins/displays/marker/markers/marker_selection_handler.hpp"
 
 namespace rviz_default_plugins
@@ -49,13 +51,15 @@ namespace markers
 TextViewFacingMarker::TextViewFacingMarker(
   MarkerCommon * owner, rviz_common::DisplayContext * context, Ogre::SceneNode * parent_node)
 : MarkerBase(owner, context, parent_node),
-  text_(nullptr)
+  text_(nullptr),
+  text_batch_(owner ? owner->getTextBatch() : nullptr),
+  has_label_(false),
+  label_(0)
 {}
 
 TextViewFacingMarker::~TextViewFacingMarker()
 {
-  scene_node_->detachObject(text_);
-  delete text_;
+  destroyText();
 }
 
 void TextViewFacingMarker::onNewMessage(
@@ -65,37 +69,98 @@ void TextViewFacingMarker::onNewMessage(
 
   assert(new_message->type == visualization_msgs::msg::Marker::TEXT_VIEW_FACING);
 
-  if (!text_) {
-    text_ = new rviz_rendering::MovableText(new_message->text);
-    text_->setTextAlignment(
-      rviz_rendering::MovableText::H_CENTER, rviz_rendering::MovableText::V_CENTER);
-    scene_node_->attachObject(text_);
-
-    handler_ = rviz_common::interaction::createSelectionHandler<MarkerSelectionHandler>(
-      this, MarkerID(new_message->ns, new_message->id), context_);
-    handler_->addTrackedObject(text_);
+  if (!text_ && !has_label_) {
+    createText(new_message);
   }
 
   Ogre::Vector3 pos, scale;
   Ogre::Quaternion orient;
   if (!transform(new_message, pos, orient, scale)) {  // NOLINT: is super class method
-    scene_node_->setVisible(false);
+    setTextVisible(false);
     return;
   }
-  scene_node_->setVisible(true);
+  setTextVisible(true);
 
   setPosition(pos);
+  Ogre::ColourValue color(
+    new_message->color.r, new_message->color.g, new_message->color.b, new_message->color.a);
+  if (has_label_) {
+    text_batch_->setCharacterHeight(label_, new_message->scale.z);
+    text_batch_->setColor(label_, color);
+    text_batch_->setCaption(label_, new_message->text);
+    return;
+  }
   text_->setCharacterHeight(new_message->scale.z);
-  text_->setColor(
-    Ogre::ColourValue(
-      new_message->color.r, new_message->color.g, new_message->color.b, new_message->color.a));
+  text_->setColor(color);
   text_->setCaption(new_message->text);
 }
 
+void TextViewFacingMarker::setPosition(const Ogre::Vector3 & position)
+{
+  MarkerBase::setPosition(position);
+  if (has_label_) {
+    text_batch_->setPosition(label_, position);
+  }
+}
+
+void TextViewFacingMarker::setTextBatch(rviz_rendering::TextBatch * text_batch)
+{
+  if (text_batch == text_batch_) {
+    return;
+  }
+  destroyText();
+  text_batch_ = text_batch;
+  if (message_) {
+    onNewMessage(message_, message_);
+  }
+}
+
+void TextViewFacingMarker::createText(const MarkerConstSharedPtr & message)
+{
+  if (text_batch_) {
+    // Labels are placed relative to the node of the batch, which shares the parent of scene_node_
+    label_ = text_batch_->addLabel(message->text, scene_node_->getPosition(), message->scale.z);
+    has_label_ = true;
+    return;
+  }
+
+  text_ = new rviz_rendering::MovableText(message->text);
+  text_->setTextAlignment(
+    rviz_rendering::MovableText::H_CENTER, rviz_rendering::MovableText::V_CENTER);
+  scene_node_->attachObject(text_);
+
+  handler_ = rviz_common::interaction::createSelectionHandler<MarkerSelectionHandler>(
+    this, MarkerID(message->ns, message->id), context_);
+  handler_->addTrackedObject(text_);
+}
+
+void TextViewFacingMarker::destroyText()
+{
+  if (has_label_) {
+    text_batch_->removeLabel(label_);
+    has_label_ = false;
+  }
+  if (text_) {
+    handler_.reset();
+    scene_node_->detachObject(text_);
+    delete text_;
+    text_ = nullptr;
+  }
+}
+
+void TextViewFacingMarker::setTextVisible(bool visible)
+{
+  scene_node_->setVisible(visible);
+  if (has_label_) {
+    text_batch_->setVisible(label_, visible);
+  }
+}
+
 S_MaterialPtr TextViewFacingMarker::getMaterials()
 {
   S_MaterialPtr materials;
-  if (text_->getMaterial().get() ) {
+  // The material of a batch is shared with the labels of other markers
+  if (text_ && text_->getMaterial().get() ) {
     materials.insert(text_->getMaterial() );
   }
   return materials;
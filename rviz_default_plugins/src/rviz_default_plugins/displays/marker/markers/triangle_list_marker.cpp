@@ -115,6 +115,21 @@ void TriangleListMarker::onNewMessage(
   handler_->addTrackedObject(manual_object_);
 }
 
+bool TriangleListMarker::onNewPose(const MarkerConstSharedPtr & new_message)
+{
+  Ogre::Vector3 pos, scale;
+  Ogre::Quaternion orient;
+  if (!transform(new_message, pos, orient, scale)) {  // NOLINT: is super class method
+    scene_node_->setVisible(false);
+    return true;
+  }
+  scene_node_->setVisible(true);
+
+  setPosition(pos);
+  setOrientation(orient);
+  return true;
+}
+
 bool TriangleListMarker::wrongNumberOfPoints(const MarkerConstSharedPtr & new_message)
 {
   size_t num_points = new_message->points.size();
@@ -34,8 +34,8 @@
 #include <memory>
 #include <string>
 
-#include "rviz_rendering/objects/arrow.hpp"
-#include "rviz_rendering/objects/axes.hpp"
+#include "rviz_rendering/objects/arrow_batch.hpp"
+#include "rviz_rendering/objects/axes_batch.hpp"
 
 #include "rviz_common/logging.hpp"
 #include "rviz_common/msg_conversions.hpp"
@@ -59,6 +59,7 @@ OdometryDisplay::OdometryDisplay(
   context_ = display_context;
   scene_node_ = scene_node;
   scene_manager_ = context_->getSceneManager();
+  createShapes();
 }
 
 OdometryDisplay::OdometryDisplay()
@@ -144,9 +145,53 @@ OdometryDisplay::~OdometryDisplay() = default;
 void OdometryDisplay::onInitialize()
 {
   MFDClass::onInitialize();
+  createShapes();
   updateShapeChoice();
 }
 
+void OdometryDisplay::createShapes()
+{
+  arrows_ = std::make_unique<rviz_rendering::ArrowBatch>(
+    scene_manager_, scene_node_,
+    shaft_length_property_->getFloat(),
+    shaft_radius_property_->getFloat(),
+    head_length_property_->getFloat(),
+    head_radius_property_->getFloat());
+  axes_ = std::make_unique<rviz_rendering::AxesBatch>(
+    scene_manager_, scene_node_,
+    axes_length_property_->getFloat(),
+    axes_radius_property_->getFloat());
+}
+
+void OdometryDisplay::rebuildShapes()
+{
+  Ogre::ColourValue color = getArrowColor();
+  arrows_->clear();
+  axes_->clear();
+  arrows_->reserve(poses_.size());
+  axes_->reserve(poses_.size());
+  for (const auto & pose : poses_) {
+    addShapes(pose, color);
+  }
+}
+
+void OdometryDisplay::addShapes(const OdometryPose & pose, const Ogre::ColourValue & color)
+{
+  // Remember the arrow points in -Z direction, so rotate the orientation before display.
+  arrows_->addArrow(
+    pose.position,
+    pose.orientation * Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_Y),
+    color);
+  axes_->addAxes(pose.position, pose.orientation);
+}
+
+Ogre::ColourValue OdometryDisplay::getArrowColor() const
+{
+  QColor color = color_property_->getColor();
+  return Ogre::ColourValue(
+    color.redF(), color.greenF(), color.blueF(), alpha_property_->getFloat());
+}
+
 void OdometryDisplay::onEnable()
 {
   MFDClass::onEnable();
@@ -155,8 +200,11 @@ void OdometryDisplay::onEnable()
 
 void OdometryDisplay::clear()
 {
-  arrows_.clear();
-  axes_.clear();
+  poses_.clear();
+  if (arrows_) {
+    arrows_->clear();
+    axes_->clear();
+  }
   covariances_.clear();
 
   if (last_used_message_) {
@@ -166,31 +214,23 @@ void OdometryDisplay::clear()
 
 void OdometryDisplay::updateColorAndAlpha()
 {
-  QColor color = color_property_->getColor();
-  float red = color.redF();
-  float green = color.greenF();
-  float blue = color.blueF();
-  float alpha = alpha_property_->getFloat();
-
-  for (const auto & arrow : arrows_) {
-    arrow->setColor(red, green, blue, alpha);
-  }
+  arrows_->setColor(getArrowColor());
   queueRender();
 }
 
 void OdometryDisplay::updateArrowsGeometry()
 {
-  for (const auto & arrow : arrows_) {
-    updateArrow(arrow);
-  }
+  arrows_->set(
+    shaft_length_property_->getFloat(),
+    shaft_radius_property_->getFloat(),
+    head_length_property_->getFloat(),
+    head_radius_property_->getFloat());
   queueRender();
 }
 
 void OdometryDisplay::updateAxisGeometry()
 {
-  for (const auto & axes : axes_) {
-    updateAxes(axes);
-  }
+  axes_->set(axes_length_property_->getFloat(), axes_radius_property_->getFloat());
   queueRender();
 }
 
@@ -202,20 +242,6 @@ void OdometryDisplay::updateCovariances()
   queueRender();
 }
 
-void OdometryDisplay::updateAxes(const std::unique_ptr<rviz_rendering::Axes> & axes)
-{
-  axes->set(axes_length_property_->getFloat(), axes_radius_property_->getFloat());
-}
-
-void OdometryDisplay::updateArrow(const std::unique_ptr<rviz_rendering::Arrow> & arrow)
-{
-  arrow->set(
-    shaft_length_property_->getFloat(),
-    shaft_radius_property_->getFloat(),
-    head_length_property_->getFloat(),
-    head_radius_property_->getFloat());
-}
-
 void OdometryDisplay::updateShapeChoice()
 {
   bool use_arrow = (shape_property_->getOptionInt() == ArrowShape);
@@ -239,13 +265,8 @@ void OdometryDisplay::updateShapeVisibility()
 {
   bool use_arrow = (shape_property_->getOptionInt() == ArrowShape);
 
-  for (const auto & arrow : arrows_) {
-    arrow->getSceneNode()->setVisible(use_arrow);
-  }
-
-  for (const auto & axes : axes_) {
-    axes->getSceneNode()->setVisible(!use_arrow);
-  }
+  arrows_->getSceneNode()->setVisible(use_arrow);
+  axes_->getSceneNode()->setVisible(!use_arrow);
 }
 
 bool validateFloats(nav_msgs::msg::Odometry msg)
@@ -280,9 +301,8 @@ void OdometryDisplay::processMessage(nav_msgs::msg::Odometry::ConstSharedPtr msg
   }
   setTransformOk();
 
-  bool use_arrow = (shape_property_->getOptionInt() == ArrowShape);
-  arrows_.push_back(createAndSetArrow(position, orientation, use_arrow));
-  axes_.push_back(createAndSetAxes(position, orientation, !use_arrow));
+  poses_.push_back({position, orientation});
+  addShapes(poses_.back(), getArrowColor());
   covariances_.push_back(createAndSetCovarianceVisual(position, orientation, msg));
 
   last_used_message_ = msg;
@@ -332,41 +352,6 @@ bool OdometryDisplay::messageIsSimilarToPrevious(nav_msgs::msg::Odometry::ConstS
   return position_difference_is_within_tolerance && angle_difference_is_within_tolerance;
 }
 
-std::unique_ptr<rviz_rendering::Arrow> OdometryDisplay::createAndSetArrow(
-  const Ogre::Vector3 & position, const Ogre::Quaternion & orientation, bool use_arrow)
-{
-  QColor color = color_property_->getColor();
-  float alpha = alpha_property_->getFloat();
-
-  auto arrow = std::make_unique<rviz_rendering::Arrow>(
-    scene_manager_, scene_node_->createChildSceneNode(),
-    shaft_length_property_->getFloat(),
-    shaft_radius_property_->getFloat(),
-    head_length_property_->getFloat(),
-    head_radius_property_->getFloat());
-  arrow->setPosition(position);
-  // Remember the arrow points in -Z direction, so rotate the orientation before display.
-  arrow->setOrientation(orientation * Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_Y));
-  arrow->setColor(color.redF(), color.greenF(), color.blueF(), alpha);
-  arrow->getSceneNode()->setVisible(use_arrow);
-
-  return arrow;
-}
-
-std::unique_ptr<rviz_rendering::Axes> OdometryDisplay::createAndSetAxes(
-  const Ogre::Vector3 & position, const Ogre::Quaternion & orientation, bool use_axes)
-{
-  auto axes = std::make_unique<rviz_rendering::Axes>(
-    scene_manager_, scene_node_->createChildSceneNode(),
-    axes_length_property_->getFloat(),
-    axes_radius_property_->getFloat());
-  axes->setPosition(position);
-  axes->setOrientation(orientation);
-  axes->getSceneNode()->setVisible(use_axes);
-
-  return axes;
-}
-
 std::unique_ptr<rviz_rendering::CovarianceVisual> OdometryDisplay::createAndSetCovarianceVisual(
   const Ogre::Vector3 & position,
   const Ogre::Quaternion & orientation,
@@ -390,16 +375,15 @@ void OdometryDisplay::update(float wall_dt, float ros_dt)
   (void) ros_dt;
 
   size_t keep = keep_property_->getInt();
-  if (keep > 0) {
-    while (arrows_.size() > keep) {
-      arrows_.pop_front();
+  if (keep > 0 && poses_.size() > keep) {
+    while (poses_.size() > keep) {
+      poses_.pop_front();
       covariances_.pop_front();
-      axes_.pop_front();
     }
+    rebuildShapes();
   }
 
-  assert(arrows_.size() == axes_.size());
-  assert(axes_.size() == covariances_.size());
+  assert(poses_.size() == covariances_.size());
 }
 
 void OdometryDisplay::reset()
@@ -181,54 +181,18 @@ void PathDisplay::reset()
 }
 
 
-void PathDisplay::allocateAxesVector(std::vector<rviz_rendering::Axes *> & axes_vect, size_t num)
-{
-  auto vector_size = axes_vect.size();
-  if (num > vector_size) {
-    axes_vect.reserve(num);
-    for (auto i = vector_size; i < num; ++i) {
-      axes_vect.push_back(
-        new rviz_rendering::Axes(
-          scene_manager_, scene_node_,
-          pose_axes_length_property_->getFloat(),
-          pose_axes_radius_property_->getFloat()));
-    }
-  } else if (num < vector_size) {
-    for (auto i = num; i < vector_size; ++i) {
-      delete axes_vect[i];
-    }
-    axes_vect.resize(num);
-  }
-}
-
-void PathDisplay::allocateArrowVector(std::vector<rviz_rendering::Arrow *> & arrow_vect, size_t num)
-{
-  auto vector_size = arrow_vect.size();
-  if (num > vector_size) {
-    arrow_vect.reserve(num);
-    for (auto i = vector_size; i < num; ++i) {
-      arrow_vect.push_back(new rviz_rendering::Arrow(scene_manager_, scene_node_));
-    }
-  } else if (num < vector_size) {
-    for (auto i = num; i < vector_size; ++i) {
-      delete arrow_vect[i];
-    }
-    arrow_vect.resize(num);
-  }
-}
-
 void PathDisplay::destroyPoseAxesChain()
 {
-  for (auto & axes_vect : axes_chain_) {
-    allocateAxesVector(axes_vect, 0);
+  for (auto axes : axes_chain_) {
+    delete axes;
   }
   axes_chain_.clear();
 }
 
 void PathDisplay::destroyPoseArrowChain()
 {
-  for (auto & arrow_vect : arrow_chain_) {
-    allocateArrowVector(arrow_vect, 0);
+  for (auto arrows : arrow_chain_) {
+    delete arrows;
   }
   arrow_chain_.clear();
 }
@@ -303,8 +267,8 @@ void PathDisplay::updatePoseStyle()
 
 void PathDisplay::updatePoseAxisGeometry()
 {
-  for (auto & axes_vect : axes_chain_) {
-    for (auto & axes : axes_vect) {
+  for (auto axes : axes_chain_) {
+    if (axes) {
       axes->set(
         pose_axes_length_property_->getFloat(),
         pose_axes_radius_property_->getFloat() );
@@ -317,9 +281,9 @@ void PathDisplay::updatePoseArrowColor()
 {
   QColor color = pose_arrow_color_property_->getColor();
 
-  for (auto & arrow_vect : arrow_chain_) {
-    for (auto & arrow : arrow_vect) {
-      arrow->setColor(color.redF(), color.greenF(), color.blueF(), 1.0f);
+  for (auto arrows : arrow_chain_) {
+    if (arrows) {
+      arrows->setColor(Ogre::ColourValue(color.redF(), color.greenF(), color.blueF(), 1.0f));
     }
   }
   context_->queueRender();
@@ -327,9 +291,9 @@ void PathDisplay::updatePoseArrowColor()
 
 void PathDisplay::updatePoseArrowGeometry()
 {
-  for (auto & arrow_vect : arrow_chain_) {
-    for (auto & arrow : arrow_vect) {
-      arrow->set(
+  for (auto arrows : arrow_chain_) {
+    if (arrows) {
+      arrows->set(
         pose_arrow_shaft_length_property_->getFloat(),
         pose_arrow_shaft_diameter_property_->getFloat(),
         pose_arrow_head_length_property_->getFloat(),
@@ -384,13 +348,13 @@ void PathDisplay::updateBufferLength()
     case BILLBOARDS:  // billboards with configurable width
       billboard_lines_.reserve(buffer_length);
       for (size_t i = 0; i < buffer_length; i++) {
-        auto billboard_line = new rviz_rendering::BillboardLine(scene_manager_, scene_node_);
+        auto billboard_line = new rviz_rendering::ThickLine(scene_manager_, scene_node_);
         billboard_lines_.push_back(billboard_line);
       }
       break;
   }
-  axes_chain_.resize(buffer_length);
-  arrow_chain_.resize(buffer_length);
+  axes_chain_.resize(buffer_length, nullptr);
+  arrow_chain_.resize(buffer_length, nullptr);
 }
 
 bool validateFloats(const nav_msgs::msg::Path & msg)
@@ -407,7 +371,7 @@ void PathDisplay::processMessage(nav_msgs::msg::Path::ConstSharedPtr msg)
 
   auto style = static_cast<LineStyle>(style_property_->getOptionInt());
   Ogre::ManualObject * manual_object = nullptr;
-  rviz_rendering::BillboardLine * billboard_line = nullptr;
+  rviz_rendering::ThickLine * billboard_line = nullptr;
 
   // Delete oldest element
   switch (style) {
@@ -478,7 +442,7 @@ void PathDisplay::updateManualObject(
 }
 
 void PathDisplay::updateBillBoardLine(
-  rviz_rendering::BillboardLine * billboard_line, nav_msgs::msg::Path::ConstSharedPtr msg,
+  rviz_rendering::ThickLine * billboard_line, nav_msgs::msg::Path::ConstSharedPtr msg,
   const Ogre::Matrix4 & transform)
 {
   auto color = color_property_->getOgreColor();
@@ -498,60 +462,74 @@ void PathDisplay::updatePoseMarkers(
   size_t buffer_index, nav_msgs::msg::Path::ConstSharedPtr msg, const Ogre::Matrix4 & transform)
 {
   auto pose_style = static_cast<PoseStyle>(pose_style_property_->getOptionInt());
-  auto & arrow_vect = arrow_chain_[buffer_index];
-  auto & axes_vect = axes_chain_[buffer_index];
+  auto & arrows = arrow_chain_[buffer_index];
+  auto & axes = axes_chain_[buffer_index];
 
   if (pose_style == AXES) {
-    updateAxesMarkers(axes_vect, msg, transform);
+    if (!axes) {
+      axes = new rviz_rendering::AxesBatch(
+        scene_manager_, scene_node_,
+        pose_axes_length_property_->getFloat(),
+        pose_axes_radius_property_->getFloat());
+    }
+    updateAxesMarkers(axes, msg, transform);
+  } else if (axes) {
+    axes->clear();
   }
   if (pose_style == ARROWS) {
-    updateArrowMarkers(arrow_vect, msg, transform);
+    if (!arrows) {
+      arrows = new rviz_rendering::ArrowBatch(
+        scene_manager_, scene_node_,
+        pose_arrow_shaft_length_property_->getFloat(),
+        pose_arrow_shaft_diameter_property_->getFloat(),
+        pose_arrow_head_length_property_->getFloat(),
+        pose_arrow_head_diameter_property_->getFloat());
+    }
+    updateArrowMarkers(arrows, msg, transform);
+  } else if (arrows) {
+    arrows->clear();
   }
 }
 
 void PathDisplay::updateAxesMarkers(
-  std::vector<rviz_rendering::Axes *> & axes_vect, nav_msgs::msg::Path::ConstSharedPtr msg,
+  rviz_rendering::AxesBatch * axes, nav_msgs::msg::Path::ConstSharedPtr msg,
   const Ogre::Matrix4 & transform)
 {
-  auto num_points = msg->poses.size();
-  allocateAxesVector(axes_vect, num_points);
-  for (size_t i = 0; i < num_points; ++i) {
-    const geometry_msgs::msg::Point & pos = msg->poses[i].pose.position;
-    axes_vect[i]->setPosition(transform * rviz_common::pointMsgToOgre(pos));
-    Ogre::Quaternion orientation(rviz_common::quaternionMsgToOgre(msg->poses[i].pose.orientation));
+  // Extract the rotation part of the transformation matrix as a quaternion
+  Ogre::Quaternion transform_orientation = transform.linear();
 
-    // Extract the rotation part of the transformation matrix as a quaternion
-    Ogre::Quaternion transform_orientation = transform.linear();
+  axes->clear();
+  axes->reserve(msg->poses.size());
+  for (const auto & pose_stamped : msg->poses) {
+    const geometry_msgs::msg::Point & pos = pose_stamped.pose.position;
+    Ogre::Quaternion orientation(rviz_common::quaternionMsgToOgre(pose_stamped.pose.orientation));
 
-    axes_vect[i]->setOrientation(transform_orientation * orientation);
+    axes->addAxes(
+      transform * rviz_common::pointMsgToOgre(pos), transform_orientation * orientation);
   }
 }
 
 void PathDisplay::updateArrowMarkers(
-  std::vector<rviz_rendering::Arrow *> & arrow_vect, nav_msgs::msg::Path::ConstSharedPtr msg,
+  rviz_rendering::ArrowBatch * arrows, nav_msgs::msg::Path::ConstSharedPtr msg,
   const Ogre::Matrix4 & transform)
 {
-  auto num_points = msg->poses.size();
-  allocateArrowVector(arrow_vect, num_points);
-  for (size_t i = 0; i < num_points; ++i) {
-    QColor color = pose_arrow_color_property_->getColor();
-    arrow_vect[i]->setColor(color.redF(), color.greenF(), color.blueF(), 1.0f);
-
-    arrow_vect[i]->set(
-      pose_arrow_shaft_length_property_->getFloat(),
-      pose_arrow_shaft_diameter_property_->getFloat(),
-      pose_arrow_head_length_property_->getFloat(),
-      pose_arrow_head_diameter_property_->getFloat());
-    const geometry_msgs::msg::Point & pos = msg->poses[i].pose.position;
-    arrow_vect[i]->setPosition(transform * rviz_common::pointMsgToOgre(pos));
-    Ogre::Quaternion orientation(rviz_common::quaternionMsgToOgre(msg->poses[i].pose.orientation));
-
-    // Extract the rotation part of the transformation matrix as a quaternion
-    Ogre::Quaternion transform_orientation = transform.linear();
+  QColor color = pose_arrow_color_property_->getColor();
+  Ogre::ColourValue arrow_color(color.redF(), color.greenF(), color.blueF(), 1.0f);
+
+  // Extract the rotation part of the transformation matrix as a quaternion
+  Ogre::Quaternion transform_orientation = transform.linear();
+
+  arrows->clear();
+  arrows->reserve(msg->poses.size());
+  for (const auto & pose_stamped : msg->poses) {
+    const geometry_msgs::msg::Point & pos = pose_stamped.pose.position;
+    Ogre::Quaternion orientation(rviz_common::quaternionMsgToOgre(pose_stamped.pose.orientation));
 
     Ogre::Vector3 dir(1, 0, 0);
     dir = transform_orientation * orientation * dir;
-    arrow_vect[i]->setDirection(dir);
+    arrows->addArrow(
+      transform * rviz_common::pointMsgToOgre(pos),
+      Ogre::Vector3::NEGATIVE_UNIT_Z.getRotationTo(dir), arrow_color);
   }
 }
 
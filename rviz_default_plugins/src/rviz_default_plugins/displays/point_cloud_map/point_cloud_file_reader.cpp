@@ -0,0 +1,451 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_file_reader.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+namespace
+{
+
+struct Field
+{
+  std::string name;
+  char type;  // 'I'nt, 'U'nsigned or 'F'loat
+  size_t size;
+  size_t offset;
+};
+
+struct Layout
+{
+  std::vector<Field> fields;
+  size_t record_size = 0;
+
+  int find(const std::string & name) const
+  {
+    for (size_t i = 0; i < fields.size(); ++i) {
+      if (fields[i].name == name) {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
+  void add(const std::string & name, char type, size_t size)
+  {
+    fields.push_back({name, type, size, record_size});
+    record_size += size;
+  }
+};
+
+template<typename T>
+double read(const uint8_t * data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(value));
+  return static_cast<double>(value);
+}
+
+double decode(const uint8_t * data, const Field & field)
+{
+  if (field.type == 'F') {
+    return field.size == 8 ? read<double>(data) : read<float>(data);
+  }
+  if (field.type == 'I') {
+    switch (field.size) {
+      case 1:
+        return read<int8_t>(data);
+      case 2:
+        return read<int16_t>(data);
+      case 4:
+        return read<int32_t>(data);
+      default:
+        return read<int64_t>(data);
+    }
+  }
+  switch (field.size) {
+    case 1:
+      return read<uint8_t>(data);
+    case 2:
+      return read<uint16_t>(data);
+    case 4:
+      return read<uint32_t>(data);
+    default:
+      return read<uint64_t>(data);
+  }
+}
+
+uint32_t decodePackedColor(const uint8_t * data, const Field & field)
+{
+  // PCL stores packed colors in the bits of a float or in an unsigned integer
+  uint32_t value = 0;
+  std::memcpy(&value, data, std::min<size_t>(field.size, sizeof(value)));
+  return value;
+}
+
+uint8_t toColorComponent(double value, const Field & field)
+{
+  if (field.type == 'F') {
+    value *= 255.0;
+  }
+  return static_cast<uint8_t>(std::min(std::max(value, 0.0), 255.0));
+}
+
+/// Converts records in the given layout into points.
+class RecordDecoder
+{
+public:
+  explicit RecordDecoder(const Layout & layout)
+  : layout_(layout),
+    x_(layout.find("x")), y_(layout.find("y")), z_(layout.find("z")),
+    rgb_(layout.find("rgb") >= 0 ? layout.find("rgb") : layout.find("rgba")),
+    has_alpha_(layout.find("rgba") >= 0),
+    red_(layout.find("red")), green_(layout.find("green")), blue_(layout.find("blue")),
+    alpha_(layout.find("alpha"))
+  {}
+
+  bool isValid() const {return x_ >= 0 && y_ >= 0 && z_ >= 0;}
+
+  OctreeFilePoint decodeRecord(const uint8_t * record) const
+  {
+    OctreeFilePoint point{};
+    point.x = static_cast<float>(decodeField(record, x_));
+    point.y = static_cast<float>(decodeField(record, y_));
+    point.z = static_cast<float>(decodeField(record, z_));
+    point.r = point.g = point.b = point.a = 255;
+
+    if (rgb_ >= 0) {
+      uint32_t color = decodePackedColor(record + field(rgb_).offset, field(rgb_));
+      point.r = static_cast<uint8_t>(color >> 16);
+      point.g = static_cast<uint8_t>(color >> 8);
+      point.b = static_cast<uint8_t>(color);
+      if (has_alpha_) {
+        point.a = static_cast<uint8_t>(color >> 24);
+      }
+    } else if (red_ >= 0 && green_ >= 0 && blue_ >= 0) {
+      point.r = toColorComponent(decodeField(record, red_), field(red_));
+      point.g = toColorComponent(decodeField(record, green_), field(green_));
+      point.b = toColorComponent(decodeField(record, blue_), field(blue_));
+      if (alpha_ >= 0) {
+        point.a = toColorComponent(decodeField(record, alpha_), field(alpha_));
+      }
+    }
+    return point;
+  }
+
+private:
+  const Field & field(int index) const {return layout_.fields[index];}
+
+  double decodeField(const uint8_t * record, int index) const
+  {
+    return decode(record + field(index).offset, field(index));
+  }
+
+  const Layout & layout_;
+  int x_, y_, z_, rgb_;
+  bool has_alpha_;
+  int red_, green_, blue_, alpha_;
+};
+
+/// Encode one ascii value into the binary record, so ascii and binary share the decoder.
+void encodeAscii(const std::string & token, const Field & field, uint8_t * destination)
+{
+  if (field.type == 'F') {
+    if (field.size == 8) {
+      double value = std::stod(token);
+      std::memcpy(destination, &value, sizeof(value));
+    } else {
+      float value = std::stof(token);
+      std::memcpy(destination, &value, sizeof(value));
+    }
+  } else if (field.type == 'I') {
+    int64_t value = std::stoll(token);
+    std::memcpy(destination, &value, field.size);  // little endian truncation
+  } else {
+    uint64_t value = std::stoull(token);
+    std::memcpy(destination, &value, field.size);
+  }
+}
+
+bool readAsciiRecords(
+  std::istream & stream, const Layout & layout, uint64_t count,
+  std::vector<OctreeFilePoint> & points, std::string & error)
+{
+  RecordDecoder decoder(layout);
+  std::vector<uint8_t> record(layout.record_size);
+  std::string line;
+  std::string token;
+  uint64_t read = 0;
+  while (read < count && std::getline(stream, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream tokens(line);
+    for (const auto & field : layout.fields) {
+      if (!(tokens >> token)) {
+        error = "Not enough values in line " + std::to_string(read);
+        return false;
+      }
+      try {
+        encodeAscii(token, field, record.data() + field.offset);
+      } catch (const std::exception &) {
+        error = "Could not parse value [" + token + "]";
+        return false;
+      }
+    }
+    points.push_back(decoder.decodeRecord(record.data()));
+    ++read;
+  }
+  if (read < count) {
+    error = "File contains fewer points than declared";
+    return false;
+  }
+  return true;
+}
+
+bool readBinaryRecords(
+  std::istream & stream, const Layout & layout, uint64_t count,
+  std::vector<OctreeFilePoint> & points, std::string & error)
+{
+  RecordDecoder decoder(layout);
+  const uint64_t records_per_chunk = 65536;
+  std::vector<uint8_t> chunk(layout.record_size * records_per_chunk);
+  for (uint64_t read = 0; read < count; read += records_per_chunk) {
+    uint64_t records = std::min(records_per_chunk, count - read);
+    stream.read(reinterpret_cast<char *>(chunk.data()), records * layout.record_size);
+    if (static_cast<uint64_t>(stream.gcount()) != records * layout.record_size) {
+      error = "File contains fewer points than declared";
+      return false;
+    }
+    for (uint64_t i = 0; i < records; ++i) {
+      points.push_back(decoder.decodeRecord(chunk.data() + i * layout.record_size));
+    }
+  }
+  return true;
+}
+
+bool endsWith(const std::string & value, const std::string & suffix)
+{
+  if (value.size() < suffix.size()) {
+    return false;
+  }
+  return std::equal(
+    suffix.rbegin(), suffix.rend(), value.rbegin(), [](char a, char b) {
+      return std::tolower(a) == std::tolower(b);
+    });
+}
+
+bool plyType(const std::string & name, char & type, size_t & size)
+{
+  static const struct {const char * name; char type; size_t size;} types[] = {
+    {"char", 'I', 1}, {"int8", 'I', 1}, {"uchar", 'U', 1}, {"uint8", 'U', 1},
+    {"short", 'I', 2}, {"int16", 'I', 2}, {"ushort", 'U', 2}, {"uint16", 'U', 2},
+    {"int", 'I', 4}, {"int32", 'I', 4}, {"uint", 'U', 4}, {"uint32", 'U', 4},
+    {"float", 'F', 4}, {"float32", 'F', 4}, {"double", 'F', 8}, {"float64", 'F', 8},
+  };
+  for (const auto & entry : types) {
+    if (name == entry.name) {
+      type = entry.type;
+      size = entry.size;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+bool readPointCloudFile(
+  const std::string & path, std::vector<OctreeFilePoint> & points, std::string & error)
+{
+  if (endsWith(path, ".pcd")) {
+    return readPcdFile(path, points, error);
+  }
+  if (endsWith(path, ".ply")) {
+    return readPlyFile(path, points, error);
+  }
+  error = "Unknown file type, expected .pcd or .ply";
+  return false;
+}
+
+bool readPcdFile(
+  const std::string & path, std::vector<OctreeFilePoint> & points, std::string & error)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    error = "Could not open [" + path + "]";
+    return false;
+  }
+
+  std::vector<std::string> names;
+  std::vector<size_t> sizes;
+  std::vector<char> types;
+  std::vector<size_t> counts;
+  uint64_t point_count = 0;
+  std::string data;
+
+  std::string line;
+  while (data.empty() && std::getline(file, line)) {
+    std::istringstream tokens(line);
+    std::string key;
+    if (!(tokens >> key) || key[0] == '#') {
+      continue;
+    }
+    std::string value;
+    if (key == "FIELDS") {
+      while (tokens >> value) {names.push_back(value);}
+    } else if (key == "SIZE") {
+      while (tokens >> value) {sizes.push_back(std::stoul(value));}
+    } else if (key == "TYPE") {
+      while (tokens >> value) {types.push_back(value[0]);}
+    } else if (key == "COUNT") {
+      while (tokens >> value) {counts.push_back(std::stoul(value));}
+    } else if (key == "POINTS") {
+      tokens >> point_count;
+    } else if (key == "DATA") {
+      tokens >> data;
+    }
+  }
+
+  if (counts.empty()) {
+    counts.assign(names.size(), 1);
+  }
+  if (names.empty() || names.size() != sizes.size() || names.size() != types.size() ||
+    names.size() != counts.size())
+  {
+    error = "Invalid PCD header";
+    return false;
+  }
+
+  Layout layout;
+  for (size_t i = 0; i < names.size(); ++i) {
+    for (size_t element = 0; element < counts[i]; ++element) {
+      layout.add(element == 0 ? names[i] : names[i] + "_" + std::to_string(element),
+        types[i], sizes[i]);
+    }
+  }
+  if (!RecordDecoder(layout).isValid()) {
+    error = "PCD file has no x, y and z fields";
+    return false;
+  }
+
+  points.reserve(points.size() + point_count);
+  if (data == "ascii") {
+    return readAsciiRecords(file, layout, point_count, points, error);
+  }
+  if (data == "binary") {
+    return readBinaryRecords(file, layout, point_count, points, error);
+  }
+  error = "Unsupported PCD data type [" + data + "]";
+  return false;
+}
+
+bool readPlyFile(
+  const std::string & path, std::vector<OctreeFilePoint> & points, std::string & error)
+{
+  std::ifstream file(path, std::ios::binary);
+  std::string line;
+  if (!file || !std::getline(file, line) || line.compare(0, 3, "ply") != 0) {
+    error = "[" + path + "] is not a PLY file";
+    return false;
+  }
+
+  std::string format;
+  uint64_t vertex_count = 0;
+  bool in_vertex_element = false;
+  bool seen_vertex_element = false;
+  Layout layout;
+
+  while (std::getline(file, line)) {
+    std::istringstream tokens(line);
+    std::string key;
+    tokens >> key;
+    if (key == "format") {
+      tokens >> format;
+    } else if (key == "element") {
+      std::string name;
+      tokens >> name;
+      if (seen_vertex_element) {
+        // later elements (faces, ...) are not needed
+        in_vertex_element = false;
+        continue;
+      }
+      if (name != "vertex") {
+        error = "PLY files with elements before the vertices are not supported";
+        return false;
+      }
+      tokens >> vertex_count;
+      in_vertex_element = seen_vertex_element = true;
+    } else if (key == "property" && in_vertex_element) {
+      std::string type_name;
+      std::string name;
+      tokens >> type_name >> name;
+      char type;
+      size_t size;
+      if (type_name == "list" || !plyType(type_name, type, size)) {
+        error = "Unsupported PLY vertex property type [" + type_name + "]";
+        return false;
+      }
+      layout.add(name, type, size);
+    } else if (key == "end_header") {
+      break;
+    }
+  }
+
+  if (!RecordDecoder(layout).isValid()) {
+    error = "PLY file has no x, y and z vertex properties";
+    return false;
+  }
+
+  points.reserve(points.size() + vertex_count);
+  if (format == "ascii") {
+    return readAsciiRecords(file, layout, vertex_count, points, error);
+  }
+  if (format == "binary_little_endian") {
+    return readBinaryRecords(file, layout, vertex_count, points, error);
+  }
+  error = "Unsupported PLY format [" + format + "]";
+  return false;
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
@@ -0,0 +1,547 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_map_display.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <OgreAxisAlignedBox.h>
+#include <OgreCamera.h>
+#include <OgreSceneNode.h>
+#include <OgreViewport.h>
+
+#include "rviz_common/display_context.hpp"
+#include "rviz_common/properties/enum_property.hpp"
+#include "rviz_common/properties/file_picker_property.hpp"
+#include "rviz_common/properties/float_property.hpp"
+#include "rviz_common/properties/int_property.hpp"
+#include "rviz_common/properties/status_property.hpp"
+#include "rviz_common/properties/tf_frame_property.hpp"
+#include "rviz_common/view_controller.hpp"
+#include "rviz_common/view_manager.hpp"
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+namespace
+{
+constexpr int kMinPointBudget = 1000;
+}  // namespace
+
+PointCloudMapDisplay::PointCloudMapDisplay()
+: cache_size_(0),
+  loading_node_(-1),
+  stop_loader_(false)
+{
+  file_property_ = new rviz_common::properties::FilePickerProperty(
+    "File", "",
+    "Point cloud octree file, as written by point_cloud_octree_converter.",
+    this, SLOT(updateFile()));
+
+  frame_property_ = new rviz_common::properties::TfFrameProperty(
+    "Reference Frame",
+    rviz_common::properties::TfFrameProperty::FIXED_FRAME_STRING,
+    "The TF frame the points of the map are expressed in.",
+    this, nullptr, true);
+
+  style_property_ = new rviz_common::properties::EnumProperty(
+    "Style", "Flat Squares",
+    "Rendering mode to use, in order of computational complexity.",
+    this, SLOT(updateStyle()));
+  style_property_->addOption("Points", rviz_rendering::PointCloud::RM_POINTS);
+  style_property_->addOption("Squares", rviz_rendering::PointCloud::RM_SQUARES);
+  style_property_->addOption("Flat Squares", rviz_rendering::PointCloud::RM_FLAT_SQUARES);
+  style_property_->addOption("Spheres", rviz_rendering::PointCloud::RM_SPHERES);
+  style_property_->addOption("Boxes", rviz_rendering::PointCloud::RM_BOXES);
+
+  point_world_size_property_ = new rviz_common::properties::FloatProperty(
+    "Size (m)", 0.05f,
+    "Point size in meters.",
+    this, SLOT(updateBillboardSize()));
+  point_world_size_property_->setMin(0.0001f);
+
+  point_pixel_size_property_ = new rviz_common::properties::FloatProperty(
+    "Size (Pixels)", 2,
+    "Point size in pixels.",
+    this, SLOT(updateBillboardSize()));
+  point_pixel_size_property_->setMin(1);
+
+  alpha_property_ = new rviz_common::properties::FloatProperty(
+    "Alpha", 1.0f,
+    "Amount of transparency to apply to the points.",
+    this, SLOT(updateAlpha()));
+  alpha_property_->setMin(0);
+  alpha_property_->setMax(1);
+
+  point_budget_property_ = new rviz_common::properties::IntProperty(
+    "Point Budget", 5000000,
+    "Maximum number of points uploaded to the GPU at the same time.",
+    this, SLOT(queueRender()));
+  point_budget_property_->setMin(kMinPointBudget);
+
+  memory_budget_property_ = new rviz_common::properties::IntProperty(
+    "Memory Budget (MB)", 1024,
+    "Maximum amount of memory used to keep decoded nodes, including the visible ones.",
+    this, SLOT(updateMemoryBudget()));
+  memory_budget_property_->setMin(16);
+
+  min_node_size_property_ = new rviz_common::properties::FloatProperty(
+    "Minimum Node Size (Pixels)", 100.0f,
+    "Nodes which appear smaller than this on screen are not refined any further. "
+    "Lower values show more detail.",
+    this, SLOT(queueRender()));
+  min_node_size_property_->setMin(1.0f);
+}
+
+PointCloudMapDisplay::~PointCloudMapDisplay()
+{
+  if (initialized()) {
+    closeFile();
+  }
+}
+
+void PointCloudMapDisplay::onInitialize()
+{
+  frame_property_->setFrameManager(context_->getFrameManager());
+  updateStyle();
+}
+
+void PointCloudMapDisplay::onEnable()
+{
+  openFile();
+}
+
+void PointCloudMapDisplay::onDisable()
+{
+  closeFile();
+}
+
+void PointCloudMapDisplay::reset()
+{
+  Display::reset();
+  closeFile();
+  if (isEnabled()) {
+    openFile();
+  }
+}
+
+void PointCloudMapDisplay::updateFile()
+{
+  if (isEnabled()) {
+    closeFile();
+    openFile();
+  }
+}
+
+void PointCloudMapDisplay::updateStyle()
+{
+  auto mode = static_cast<rviz_rendering::PointCloud::RenderMode>(style_property_->getOptionInt());
+  if (mode == rviz_rendering::PointCloud::RM_POINTS) {
+    point_world_size_property_->hide();
+    point_pixel_size_property_->show();
+  } else {
+    point_world_size_property_->show();
+    point_pixel_size_property_->hide();
+  }
+  for (auto & visible_node : visible_nodes_) {
+    visible_node.second->setRenderMode(mode);
+  }
+  updateBillboardSize();
+}
+
+void PointCloudMapDisplay::updateBillboardSize()
+{
+  float size = getPointSize();
+  for (auto & visible_node : visible_nodes_) {
+    visible_node.second->setDimensions(size, size, size);
+  }
+  context_->queueRender();
+}
+
+void PointCloudMapDisplay::updateAlpha()
+{
+  for (auto & visible_node : visible_nodes_) {
+    visible_node.second->setAlpha(alpha_property_->getFloat());
+  }
+  context_->queueRender();
+}
+
+void PointCloudMapDisplay::updateMemoryBudget()
+{
+  evictCachedNodes();
+  context_->queueRender();
+}
+
+float PointCloudMapDisplay::getPointSize() const
+{
+  if (style_property_->getOptionInt() == rviz_rendering::PointCloud::RM_POINTS) {
+    return point_pixel_size_property_->getFloat();
+  }
+  return point_world_size_property_->getFloat();
+}
+
+void PointCloudMapDisplay::openFile()
+{
+  std::string path = file_property_->getStdString();
+  if (path.empty()) {
+    setStatusStd(rviz_common::properties::StatusProperty::Warn, "File", "No file selected");
+    return;
+  }
+
+  auto octree = std::make_shared<PointCloudOctree>();
+  std::string error;
+  if (!octree->open(path, error)) {
+    setStatusStd(rviz_common::properties::StatusProperty::Error, "File", error);
+    return;
+  }
+
+  octree_ = octree;
+  // The root is always drawn, so a smaller budget could not be met.
+  const int root_point_count = static_cast<int>(
+    std::min<uint64_t>(octree_->getNode(0).point_count, std::numeric_limits<int>::max()));
+  point_budget_property_->setMin(std::max(kMinPointBudget, root_point_count));
+  if (point_budget_property_->getInt() < root_point_count) {
+    point_budget_property_->setInt(root_point_count);
+  }
+  setStatusStd(
+    rviz_common::properties::StatusProperty::Ok, "File",
+    std::to_string(octree_->getPointCount()) + " points in " +
+    std::to_string(octree_->getNodeCount()) + " nodes");
+  startLoader();
+  context_->queueRender();
+}
+
+void PointCloudMapDisplay::closeFile()
+{
+  stopLoader();
+  hideAllNodes();
+  clearCache();
+  octree_.reset();
+  point_budget_property_->setMin(kMinPointBudget);
+  deleteStatusStd("Points");
+}
+
+void PointCloudMapDisplay::startLoader()
+{
+  stop_loader_ = false;
+  loader_ = std::thread(&PointCloudMapDisplay::loaderThread, this);
+}
+
+void PointCloudMapDisplay::stopLoader()
+{
+  if (!loader_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(loader_mutex_);
+    stop_loader_ = true;
+    requested_nodes_.clear();
+  }
+  loader_condition_.notify_one();
+  loader_.join();
+  loaded_nodes_.clear();
+  loading_node_ = -1;
+}
+
+void PointCloudMapDisplay::loaderThread()
+{
+  std::shared_ptr<PointCloudOctree> octree = octree_;
+
+  std::unique_lock<std::mutex> lock(loader_mutex_);
+  while (true) {
+    loader_condition_.wait(lock, [this] {return stop_loader_ || !requested_nodes_.empty();});
+    if (stop_loader_) {
+      return;
+    }
+    uint32_t index = requested_nodes_.front();
+    requested_nodes_.pop_front();
+    loading_node_ = index;
+    lock.unlock();
+
+    // Reading the points touches the mapped pages, this is where the disk is accessed.
+    const OctreeFileNode & node = octree->getNode(index);
+    const OctreeFilePoint * source = octree->getPoints(node);
+    Points points(node.point_count);
+    for (uint32_t i = 0; i < node.point_count; ++i) {
+      points[i].position = Ogre::Vector3(source[i].x, source[i].y, source[i].z);
+      points[i].setColor(
+        Ogre::ColourValue(
+          source[i].r / 255.0f, source[i].g / 255.0f, source[i].b / 255.0f, source[i].a / 255.0f));
+    }
+
+    lock.lock();
+    loaded_nodes_.emplace_back(index, std::move(points));
+    loading_node_ = -1;
+  }
+}
+
+void PointCloudMapDisplay::update(float wall_dt, float ros_dt)
+{
+  (void) wall_dt;
+  (void) ros_dt;
+
+  if (!octree_ || !updateReferenceFrame()) {
+    return;
+  }
+
+  auto view_controller = context_->getViewManager()->getCurrent();
+  Ogre::Camera * camera = view_controller ? view_controller->getCamera() : nullptr;
+  if (!camera || !camera->getViewport()) {
+    return;
+  }
+
+  insertLoadedNodes();
+
+  std::vector<uint32_t> selected;
+  selectNodes(camera, selected);
+  showNodes(selected);
+  requestNodes(selected);
+  evictCachedNodes();
+
+  uint64_t visible_points = 0;
+  for (const auto & visible_node : visible_nodes_) {
+    visible_points += octree_->getNode(visible_node.first).point_count;
+  }
+  setStatusStd(
+    rviz_common::properties::StatusProperty::Ok, "Points",
+    "Showing " + std::to_string(visible_points) + " points in " +
+    std::to_string(visible_nodes_.size()) + " of " + std::to_string(selected.size()) +
+    " selected nodes, " + std::to_string(cache_.size()) + " nodes (" +
+    std::to_string(cache_size_ / (1024 * 1024)) + " MB) cached");
+}
+
+bool PointCloudMapDisplay::updateReferenceFrame()
+{
+  std::string frame = frame_property_->getFrameStd();
+  if (!updateFrame(frame)) {
+    setMissingTransformToFixedFrame(frame);
+    return false;
+  }
+  setTransformOk();
+  return true;
+}
+
+void PointCloudMapDisplay::selectNodes(Ogre::Camera * camera, std::vector<uint32_t> & selected)
+{
+  const Ogre::Affine3 & transform = scene_node_->_getFullTransform();
+  const float min_size = min_node_size_property_->getFloat();
+  const uint64_t budget = static_cast<uint64_t>(point_budget_property_->getInt());
+
+  // Refine the nodes which appear largest on screen first, so that when the budget is
+  // exhausted the remaining points are spread evenly over the view.
+  std::priority_queue<std::pair<float, uint32_t>> candidates;
+  candidates.emplace(std::numeric_limits<float>::max(), 0);
+  uint64_t point_count = 0;
+
+  while (!candidates.empty()) {
+    uint32_t index = candidates.top().second;
+    candidates.pop();
+
+    const OctreeFileNode & node = octree_->getNode(index);
+    Ogre::Vector3 center(node.center[0], node.center[1], node.center[2]);
+    Ogre::AxisAlignedBox box(center - node.half_size, center + node.half_size);
+    box.transform(transform);
+    if (!camera->isVisible(box)) {
+      continue;
+    }
+    // The root is always drawn, with a budget below its sample nothing would be shown.
+    if (index != 0 && point_count + node.point_count > budget) {
+      break;
+    }
+    point_count += node.point_count;
+    selected.push_back(index);
+
+    for (uint32_t child : node.children) {
+      if (child == 0) {
+        continue;
+      }
+      float size = getProjectedSize(camera, octree_->getNode(child));
+      if (size >= min_size) {
+        candidates.emplace(size, child);
+      }
+    }
+  }
+}
+
+float PointCloudMapDisplay::getProjectedSize(
+  Ogre::Camera * camera, const OctreeFileNode & node) const
+{
+  const float viewport_height = static_cast<float>(camera->getViewport()->getActualHeight());
+  const float extent = 2.0f * node.half_size;
+
+  if (camera->getProjectionType() == Ogre::PT_ORTHOGRAPHIC) {
+    return extent / camera->getOrthoWindowHeight() * viewport_height;
+  }
+
+  Ogre::Vector3 center = scene_node_->_getFullTransform() *
+    Ogre::Vector3(node.center[0], node.center[1], node.center[2]);
+  float distance = center.distance(camera->getDerivedPosition()) - node.half_size;
+  if (distance <= 0.0f) {
+    return std::numeric_limits<float>::max();
+  }
+  float tan_half_fov = std::tan(camera->getFOVy().valueRadians() / 2.0f);
+  return extent / (2.0f * distance * tan_half_fov) * viewport_height;
+}
+
+void PointCloudMapDisplay::requestNodes(const std::vector<uint32_t> & selected)
+{
+  std::lock_guard<std::mutex> lock(loader_mutex_);
+  std::unordered_set<uint32_t> pending;
+  for (const auto & loaded : loaded_nodes_) {
+    pending.insert(loaded.first);
+  }
+
+  // selected is ordered from coarse to fine, which is also the order in which to load
+  requested_nodes_.clear();
+  for (uint32_t index : selected) {
+    if (cache_.count(index) == 0 && pending.count(index) == 0 &&
+      static_cast<int64_t>(index) != loading_node_)
+    {
+      requested_nodes_.push_back(index);
+    }
+  }
+  if (!requested_nodes_.empty()) {
+    loader_condition_.notify_one();
+  }
+}
+
+void PointCloudMapDisplay::insertLoadedNodes()
+{
+  std::vector<std::pair<uint32_t, Points>> loaded;
+  {
+    std::lock_guard<std::mutex> lock(loader_mutex_);
+    loaded.swap(loaded_nodes_);
+  }
+
+  for (auto & node : loaded) {
+    if (cache_.count(node.first) != 0) {
+      continue;
+    }
+    lru_.push_front(node.first);
+    CachedNode & cached = cache_[node.first];
+    cached.points = std::move(node.second);
+    cached.lru_position = lru_.begin();
+    cache_size_ += getCachedSize(cached);
+  }
+  if (!loaded.empty()) {
+    context_->queueRender();
+  }
+}
+
+void PointCloudMapDisplay::showNodes(const std::vector<uint32_t> & selected)
+{
+  std::unordered_set<uint32_t> selected_set(selected.begin(), selected.end());
+  for (auto it = visible_nodes_.begin(); it != visible_nodes_.end(); ) {
+    if (selected_set.count(it->first) == 0) {
+      scene_node_->detachObject(it->second.get());
+      it = visible_nodes_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  for (uint32_t index : selected) {
+    auto cached = cache_.find(index);
+    if (cached == cache_.end()) {
+      continue;
+    }
+    touchCachedNode(cached->second);
+    if (visible_nodes_.count(index) == 0) {
+      showNode(index, cached->second);
+    }
+  }
+}
+
+void PointCloudMapDisplay::showNode(uint32_t index, CachedNode & cached)
+{
+  auto mode = static_cast<rviz_rendering::PointCloud::RenderMode>(style_property_->getOptionInt());
+  float size = getPointSize();
+
+  auto cloud = std::make_shared<rviz_rendering::PointCloud>();
+  cloud->setRenderMode(mode);
+  cloud->setDimensions(size, size, size);
+  cloud->addPoints(cached.points.cbegin(), cached.points.cend());
+  cloud->setAlpha(alpha_property_->getFloat());
+  scene_node_->attachObject(cloud.get());
+  visible_nodes_[index] = cloud;
+}
+
+void PointCloudMapDisplay::hideAllNodes()
+{
+  for (auto & visible_node : visible_nodes_) {
+    scene_node_->detachObject(visible_node.second.get());
+  }
+  visible_nodes_.clear();
+}
+
+void PointCloudMapDisplay::touchCachedNode(CachedNode & cached)
+{
+  lru_.splice(lru_.begin(), lru_, cached.lru_position);
+}
+
+void PointCloudMapDisplay::evictCachedNodes()
+{
+  const size_t budget = static_cast<size_t>(memory_budget_property_->getInt()) * 1024 * 1024;
+
+  // Visible nodes are touched every frame, so they are never behind an invisible one.
+  while (cache_size_ > budget && !lru_.empty() && visible_nodes_.count(lru_.back()) == 0) {
+    auto cached = cache_.find(lru_.back());
+    cache_size_ -= getCachedSize(cached->second);
+    cache_.erase(cached);
+    lru_.pop_back();
+  }
+}
+
+void PointCloudMapDisplay::clearCache()
+{
+  cache_.clear();
+  lru_.clear();
+  cache_size_ = 0;
+}
+
+size_t PointCloudMapDisplay::getCachedSize(const CachedNode & cached)
+{
+  return cached.points.capacity() * sizeof(rviz_rendering::PointCloud::CompactPoint);
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
+
+#include <pluginlib/class_list_macros.hpp>  // NOLINT
+PLUGINLIB_EXPORT_CLASS(rviz_default_plugins::displays::PointCloudMapDisplay, rviz_common::Display)
@@ -0,0 +1,415 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_octree.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace rviz_default_plugins
+{
+namespace displays
+{
+
+namespace
+{
+
+const char kMagic[8] = {'R', 'V', 'I', 'Z', 'O', 'C', 'T', '\0'};
+const uint32_t kVersion = 1;
+const uint32_t kMaxDepth = 24;
+
+}  // namespace
+
+PointCloudOctree::PointCloudOctree()
+: mapping_(nullptr),
+  size_(0),
+#ifdef _WIN32
+  file_handle_(INVALID_HANDLE_VALUE),
+  mapping_handle_(nullptr),
+#endif
+  header_(nullptr),
+  nodes_(nullptr),
+  points_(nullptr)
+{}
+
+PointCloudOctree::~PointCloudOctree()
+{
+  close();
+}
+
+bool PointCloudOctree::open(const std::string & path, std::string & error)
+{
+  close();
+
+#ifdef _WIN32
+  file_handle_ = CreateFileA(
+    path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle_ == INVALID_HANDLE_VALUE) {
+    error = "Could not open file [" + path + "]";
+    return false;
+  }
+  LARGE_INTEGER file_size;
+  GetFileSizeEx(file_handle_, &file_size);
+  size_ = static_cast<size_t>(file_size.QuadPart);
+  mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping_handle_) {
+    mapping_ = MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0);
+  }
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    error = "Could not open file [" + path + "]: " + std::strerror(errno);
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+    size_ = static_cast<size_t>(file_stat.st_size);
+    mapping_ = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping_ == MAP_FAILED) {
+      mapping_ = nullptr;
+    }
+  }
+  ::close(fd);
+#endif
+
+  if (!mapping_) {
+    error = "Could not map file [" + path + "]";
+    close();
+    return false;
+  }
+
+  header_ = static_cast<const OctreeFileHeader *>(mapping_);
+  if (!validate(error)) {
+    close();
+    return false;
+  }
+
+  const auto * bytes = static_cast<const uint8_t *>(mapping_);
+  nodes_ = reinterpret_cast<const OctreeFileNode *>(bytes + header_->nodes_offset);
+  points_ = reinterpret_cast<const OctreeFilePoint *>(bytes + header_->points_offset);
+  return true;
+}
+
+bool PointCloudOctree::validate(std::string & error) const
+{
+  if (size_ < sizeof(OctreeFileHeader) ||
+    std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0)
+  {
+    error = "Not a point cloud octree file";
+    return false;
+  }
+  if (header_->version != kVersion) {
+    error = "Unsupported octree file version " + std::to_string(header_->version);
+    return false;
+  }
+  // compared by subtraction, so that offsets and counts close to their maximum cannot overflow
+  if (header_->node_count == 0 ||
+    header_->nodes_offset > size_ ||
+    header_->node_count > (size_ - header_->nodes_offset) / sizeof(OctreeFileNode) ||
+    header_->points_offset > size_ ||
+    header_->point_count > (size_ - header_->points_offset) / sizeof(OctreeFilePoint))
+  {
+    error = "Octree file is truncated";
+    return false;
+  }
+  // The sections are accessed in place, so they must not overlap the header and be aligned.
+  if (header_->nodes_offset < sizeof(OctreeFileHeader) ||
+    header_->points_offset < sizeof(OctreeFileHeader) ||
+    header_->nodes_offset % alignof(OctreeFileNode) != 0 ||
+    header_->points_offset % alignof(OctreeFilePoint) != 0)
+  {
+    error = "Octree file has misaligned sections";
+    return false;
+  }
+
+  const auto * nodes = reinterpret_cast<const OctreeFileNode *>(
+    static_cast<const uint8_t *>(mapping_) + header_->nodes_offset);
+  for (uint32_t i = 0; i < header_->node_count; ++i) {
+    if (nodes[i].first_point > header_->point_count ||
+      nodes[i].point_count > header_->point_count - nodes[i].first_point)
+    {
+      error = "Octree node " + std::to_string(i) + " references points outside of the file";
+      return false;
+    }
+    // Nodes are stored breadth-first, so a child always follows its parent. Anything else
+    // could be a cycle, which would make every traversal of the tree loop forever.
+    for (uint32_t child : nodes[i].children) {
+      if (child != 0 && (child <= i || child >= header_->node_count)) {
+        error = "Octree node " + std::to_string(i) + " references an invalid child";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void PointCloudOctree::close()
+{
+#ifdef _WIN32
+  if (mapping_) {
+    UnmapViewOfFile(mapping_);
+  }
+  if (mapping_handle_) {
+    CloseHandle(mapping_handle_);
+    mapping_handle_ = nullptr;
+  }
+  if (file_handle_ != INVALID_HANDLE_VALUE) {
+    CloseHandle(file_handle_);
+    file_handle_ = INVALID_HANDLE_VALUE;
+  }
+#else
+  if (mapping_) {
+    munmap(mapping_, size_);
+  }
+#endif
+  mapping_ = nullptr;
+  size_ = 0;
+  header_ = nullptr;
+  nodes_ = nullptr;
+  points_ = nullptr;
+}
+
+bool PointCloudOctree::isOpen() const
+{
+  return header_ != nullptr;
+}
+
+uint32_t PointCloudOctree::getNodeCount() const
+{
+  return header_ ? header_->node_count : 0;
+}
+
+uint64_t PointCloudOctree::getPointCount() const
+{
+  return header_ ? header_->point_count : 0;
+}
+
+const OctreeFileNode & PointCloudOctree::getNode(uint32_t index) const
+{
+  return nodes_[index];
+}
+
+const OctreeFilePoint * PointCloudOctree::getPoints(const OctreeFileNode & node) const
+{
+  return points_ + node.first_point;
+}
+
+PointCloudOctreeBuilder::PointCloudOctreeBuilder(
+  uint32_t max_points_per_node, uint32_t sample_grid_size)
+: max_points_per_node_(std::max(max_points_per_node, 1u)),
+  sample_grid_size_(std::min(std::max(sample_grid_size, 1u), 1024u))
+{}
+
+void PointCloudOctreeBuilder::build(std::vector<OctreeFilePoint> points)
+{
+  nodes_.clear();
+  points_.clear();
+  points_.reserve(points.size());
+
+  // non-finite points can not be placed in the tree
+  points.erase(
+    std::remove_if(
+      points.begin(), points.end(), [](const OctreeFilePoint & point) {
+        return !std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z);
+      }), points.end());
+
+  float min[3] = {0.0f, 0.0f, 0.0f};
+  float max[3] = {0.0f, 0.0f, 0.0f};
+  if (!points.empty()) {
+    min[0] = max[0] = points[0].x;
+    min[1] = max[1] = points[0].y;
+    min[2] = max[2] = points[0].z;
+  }
+  for (const auto & point : points) {
+    min[0] = std::min(min[0], point.x);
+    min[1] = std::min(min[1], point.y);
+    min[2] = std::min(min[2], point.z);
+    max[0] = std::max(max[0], point.x);
+    max[1] = std::max(max[1], point.y);
+    max[2] = std::max(max[2], point.z);
+  }
+
+  OctreeFileNode root{};
+  float extent = 0.0f;
+  for (int axis = 0; axis < 3; ++axis) {
+    root.center[axis] = (min[axis] + max[axis]) * 0.5f;
+    extent = std::max(extent, max[axis] - min[axis]);
+  }
+  // slightly enlarged, so points on the boundary are inside
+  root.half_size = std::max(extent * 0.5f * 1.001f, 1e-3f);
+  nodes_.push_back(root);
+
+  // breadth first, so that node indices and point ranges are both in processing order
+  std::vector<PendingNode> queue{{0, 0, points.size()}};
+  for (size_t i = 0; i < queue.size(); ++i) {
+    PendingNode pending = queue[i];
+    buildNode(points, pending, queue);
+  }
+}
+
+void PointCloudOctreeBuilder::buildNode(
+  std::vector<OctreeFilePoint> & input, const PendingNode & pending,
+  std::vector<PendingNode> & queue)
+{
+  nodes_[pending.node].first_point = points_.size();
+
+  auto begin = input.begin() + pending.begin;
+  auto end = input.begin() + pending.end;
+  size_t count = pending.end - pending.begin;
+
+  if (count <= max_points_per_node_ || nodes_[pending.node].depth >= kMaxDepth) {
+    points_.insert(points_.end(), begin, end);
+    nodes_[pending.node].point_count = static_cast<uint32_t>(count);
+    return;
+  }
+
+  const OctreeFileNode node = nodes_[pending.node];
+  const float cell_scale = static_cast<float>(sample_grid_size_) / (2.0f * node.half_size);
+  const auto max_cell = static_cast<int64_t>(sample_grid_size_ - 1);
+  auto cell_of = [&](const OctreeFilePoint & point) {
+      int64_t cell[3];
+      const float position[3] = {point.x, point.y, point.z};
+      for (int axis = 0; axis < 3; ++axis) {
+        auto c = static_cast<int64_t>(
+          std::floor((position[axis] - node.center[axis] + node.half_size) * cell_scale));
+        cell[axis] = std::min(std::max(c, int64_t(0)), max_cell);
+      }
+      return (cell[0] * (max_cell + 1) + cell[1]) * (max_cell + 1) + cell[2];
+    };
+
+  // keep the first point of every grid cell in this node, pass the others on to the children
+  std::stable_sort(
+    begin, end, [&](const OctreeFilePoint & a, const OctreeFilePoint & b) {
+      return cell_of(a) < cell_of(b);
+    });
+  auto remaining_end = begin;
+  int64_t previous_cell = -1;
+  for (auto it = begin; it != end; ++it) {
+    int64_t cell = cell_of(*it);
+    if (cell != previous_cell) {
+      points_.push_back(*it);
+      previous_cell = cell;
+    } else {
+      *remaining_end++ = *it;
+    }
+  }
+  nodes_[pending.node].point_count =
+    static_cast<uint32_t>(points_.size() - nodes_[pending.node].first_point);
+
+  auto octant_of = [&node](const OctreeFilePoint & point) {
+      return (point.x >= node.center[0] ? 1 : 0) |
+             (point.y >= node.center[1] ? 2 : 0) |
+             (point.z >= node.center[2] ? 4 : 0);
+    };
+  std::sort(
+    begin, remaining_end, [&](const OctreeFilePoint & a, const OctreeFilePoint & b) {
+      return octant_of(a) < octant_of(b);
+    });
+
+  auto child_begin = begin;
+  while (child_begin != remaining_end) {
+    int octant = octant_of(*child_begin);
+    auto child_end = std::find_if(
+      child_begin, remaining_end, [&](const OctreeFilePoint & point) {
+        return octant_of(point) != octant;
+      });
+
+    OctreeFileNode child{};
+    child.half_size = node.half_size * 0.5f;
+    child.center[0] = node.center[0] + ((octant & 1) ? child.half_size : -child.half_size);
+    child.center[1] = node.center[1] + ((octant & 2) ? child.half_size : -child.half_size);
+    child.center[2] = node.center[2] + ((octant & 4) ? child.half_size : -child.half_size);
+    child.depth = node.depth + 1;
+
+    auto child_index = static_cast<uint32_t>(nodes_.size());
+    nodes_.push_back(child);
+    nodes_[pending.node].children[octant] = child_index;
+    queue.push_back(
+      {child_index, static_cast<size_t>(child_begin - input.begin()),
+        static_cast<size_t>(child_end - input.begin())});
+
+    child_begin = child_end;
+  }
+}
+
+bool PointCloudOctreeBuilder::write(const std::string & path, std::string & error) const
+{
+  if (nodes_.empty()) {
+    error = "Octree is empty";
+    return false;
+  }
+  if (nodes_.size() > std::numeric_limits<uint32_t>::max()) {
+    error = "Too many octree nodes";
+    return false;
+  }
+
+  OctreeFileHeader header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.node_count = static_cast<uint32_t>(nodes_.size());
+  header.point_count = points_.size();
+  header.nodes_offset = sizeof(OctreeFileHeader);
+  header.points_offset = header.nodes_offset + nodes_.size() * sizeof(OctreeFileNode);
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    error = "Could not open [" + path + "] for writing";
+    return false;
+  }
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(
+    reinterpret_cast<const char *>(nodes_.data()), nodes_.size() * sizeof(OctreeFileNode));
+  file.write(
+    reinterpret_cast<const char *>(points_.data()), points_.size() * sizeof(OctreeFilePoint));
+  if (!file) {
+    error = "Could not write [" + path + "]";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace displays
+}  // namespace rviz_default_plugins
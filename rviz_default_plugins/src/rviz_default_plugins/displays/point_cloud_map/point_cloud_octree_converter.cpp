@@ -0,0 +1,72 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_file_reader.hpp"
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_octree.hpp"
+
+using rviz_default_plugins::displays::OctreeFilePoint;
+using rviz_default_plugins::displays::PointCloudOctreeBuilder;
+
+int main(int argc, char ** argv)
+{
+  if (argc < 3 || argc > 4) {
+    std::cerr << "Usage: " << argv[0] << " <input.pcd|input.ply> <output.octree> "
+      "[max points per node]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  uint32_t max_points_per_node = 65536;
+  if (argc == 4) {
+    max_points_per_node = static_cast<uint32_t>(std::stoul(argv[3]));
+  }
+
+  std::string error;
+  std::vector<OctreeFilePoint> points;
+  if (!rviz_default_plugins::displays::readPointCloudFile(argv[1], points, error)) {
+    std::cerr << "Could not read " << argv[1] << ": " << error << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Read " << points.size() << " points" << std::endl;
+
+  PointCloudOctreeBuilder builder(max_points_per_node);
+  builder.build(std::move(points));
+  if (!builder.write(argv[2], error)) {
+    std::cerr << "Could not write " << argv[2] << ": " << error << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Wrote " << builder.getPoints().size() << " points in " <<
+    builder.getNodes().size() << " nodes to " << argv[2] << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -96,12 +96,22 @@ bool PointCloud2Display::cloudDataMatchesDimensions(
 sensor_msgs::msg::PointCloud2::ConstSharedPtr PointCloud2Display::filterOutInvalidPoints(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud) const
 {
-  auto filtered = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  const Offsets offsets = determineOffsets(cloud);
+  auto first_invalid_point = cloud->data.cbegin();
+  while (first_invalid_point < cloud->data.cend() &&
+    validateFloatsAtPosition(first_invalid_point, offsets))
+  {
+    first_invalid_point += cloud->point_step;
+  }
 
-  if (cloud->width * cloud->height > 0) {
-    filtered->data = filterData(cloud);
+  // Clouds without invalid points are passed on as they are, which saves copying their data.
+  if (first_invalid_point >= cloud->data.cend()) {
+    return cloud;
   }
 
+  auto filtered = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  filtered->data = filterData(cloud, first_invalid_point, offsets);
+
   filtered->header = cloud->header;
   filtered->fields = cloud->fields;
   filtered->height = 1;
@@ -114,15 +124,20 @@ sensor_msgs::msg::PointCloud2::ConstSharedPtr PointCloud2Display::filterOutInval
 }
 
 sensor_msgs::msg::PointCloud2::_data_type
-PointCloud2Display::filterData(sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud) const
+PointCloud2Display::filterData(
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud,
+  sensor_msgs::msg::PointCloud2::_data_type::const_iterator first_invalid_point,
+  const Offsets offsets) const
 {
   sensor_msgs::msg::PointCloud2::_data_type filteredData;
   filteredData.reserve(cloud->data.size());
+  filteredData.insert(filteredData.end(), cloud->data.begin(), first_invalid_point);
 
-  Offsets offsets = determineOffsets(cloud);
   size_t points_to_copy = 0;
   sensor_msgs::msg::PointCloud2::_data_type::const_iterator copy_start_pos;
-  for (auto it = cloud->data.begin(); it < cloud->data.end(); it += cloud->point_step) {
+  for (auto it = first_invalid_point + cloud->point_step; it < cloud->data.end();
+    it += cloud->point_step)
+  {
     if (validateFloatsAtPosition(it, offsets)) {
       if (points_to_copy == 0) {
         copy_start_pos = it;
@@ -150,10 +165,12 @@ PointCloud2Display::filterData(sensor_msgs::msg::PointCloud2::ConstSharedPtr clo
 Offsets PointCloud2Display::determineOffsets(
   const sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud) const
 {
+  const auto & x_field = cloud->fields[findChannelIndex(cloud, "x")];
   Offsets offsets{
-    cloud->fields[findChannelIndex(cloud, "x")].offset,
+    x_field.offset,
     cloud->fields[findChannelIndex(cloud, "y")].offset,
-    cloud->fields[findChannelIndex(cloud, "z")].offset
+    cloud->fields[findChannelIndex(cloud, "z")].offset,
+    x_field.datatype
   };
   return offsets;
 }
@@ -162,9 +179,16 @@ bool PointCloud2Display::validateFloatsAtPosition(
   sensor_msgs::msg::PointCloud2::_data_type::const_iterator position,
   const Offsets offsets) const
 {
-  float x = *reinterpret_cast<const float *>(&*(position + offsets.x));
-  float y = *reinterpret_cast<const float *>(&*(position + offsets.y));
-  float z = *reinterpret_cast<const float *>(&*(position + offsets.z));
+  const uint8_t * point = &*position;
+  if (offsets.datatype == sensor_msgs::msg::PointField::FLOAT64) {
+    return rviz_common::validateFloats(readPointFieldValue<double>(point + offsets.x)) &&
+           rviz_common::validateFloats(readPointFieldValue<double>(point + offsets.y)) &&
+           rviz_common::validateFloats(readPointFieldValue<double>(point + offsets.z));
+  }
+
+  float x = readPointFieldValue<float>(point + offsets.x);
+  float y = readPointFieldValue<float>(point + offsets.y);
+  float z = readPointFieldValue<float>(point + offsets.z);
 
   return rviz_common::validateFloats(x) &&
          rviz_common::validateFloats(y) &&
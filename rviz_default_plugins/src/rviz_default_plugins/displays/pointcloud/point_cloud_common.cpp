@@ -30,8 +30,10 @@
 
 #include "rviz_default_plugins/displays/pointcloud/point_cloud_common.hpp"
 
+#include <iomanip>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <utility>
@@ -47,9 +49,12 @@
 #include "rviz_common/display_context.hpp"
 #include "rviz_common/properties/enum_property.hpp"
 #include "rviz_common/properties/float_property.hpp"
+#include "rviz_common/properties/int_property.hpp"
 #include "rviz_common/properties/vector_property.hpp"
 #include "rviz_common/uniform_string_stream.hpp"
 #include "rviz_common/validate_floats.hpp"
+#include "rviz_rendering/objects/point_budget.hpp"
+#include "rviz_rendering/vertex_buffer_pool.hpp"
 
 namespace rviz_default_plugins
 {
@@ -57,6 +62,7 @@ namespace rviz_default_plugins
 CloudInfo::CloudInfo()
 : manager_(nullptr),
   scene_node_(nullptr),
+  unfiltered_point_count_(0),
   position_(Ogre::Vector3::ZERO)
 {}
 
@@ -73,6 +79,11 @@ void CloudInfo::clear()
   }
 }
 
+const std::vector<rviz_rendering::PointCloud::CompactPoint> & CloudInfo::getPoints() const
+{
+  return cloud_ ? cloud_->getCompactPoints() : transformed_points_;
+}
+
 void CloudInfo::setSelectable(
   bool selectable, float selection_box_size, rviz_common::DisplayContext * context)
 {
@@ -88,6 +99,11 @@ void CloudInfo::setSelectable(
   }
 }
 
+uint64_t CloudInfo::getMessageIndex(uint64_t index) const
+{
+  return point_indices_.empty() ? index : point_indices_[index];
+}
+
 const std::string PointCloudCommon::message_status_name_ = "Message";  // NOLINT allow std::string
 
 PointCloudCommon::PointCloudCommon(rviz_common::Display * display)
@@ -140,6 +156,33 @@ PointCloudCommon::PointCloudCommon(rviz_common::Display * display)
     display_, SLOT(queueRender()));
   decay_time_property_->setMin(0);
 
+  downsampling_property_ = new rviz_common::properties::EnumProperty(
+    "Downsampling", "None",
+    "Reduce the number of points before they are rendered.",
+    display_, SLOT(updateDownsampling()), this);
+  downsampling_property_->addOption("None", PointCloudDownsampler::None);
+  downsampling_property_->addOption("Voxel Grid", PointCloudDownsampler::VoxelGrid);
+  downsampling_property_->addOption("Random Subsample", PointCloudDownsampler::RandomSubsample);
+
+  voxel_size_property_ = new rviz_common::properties::FloatProperty(
+    "Voxel Size (m)", 0.05f,
+    "Edge length of the voxels. Only one point is kept per voxel.",
+    downsampling_property_, SLOT(updateDownsampling()), this);
+  voxel_size_property_->setMin(0.001f);
+
+  target_point_count_property_ = new rviz_common::properties::IntProperty(
+    "Target Points", 100000,
+    "Maximum number of points to keep from each message.",
+    downsampling_property_, SLOT(updateDownsampling()), this);
+  target_point_count_property_->setMin(1);
+
+  level_of_detail_property_ = new rviz_common::properties::BoolProperty(
+    "Adaptive Level of Detail", false,
+    "Skip parts of the cloud outside of the view and draw distant parts with fewer points. "
+    "Useful for large clouds accumulated over a long decay time. The number of points drawn "
+    "is limited by the Point Budget of the Global Options.",
+    display_, SLOT(updateLevelOfDetail()), this);
+
   xyz_transformer_property_ = new rviz_common::properties::EnumProperty(
     "Position Transformer", "",
     "Set the transformer to use to set the position of the points.",
@@ -174,6 +217,8 @@ void PointCloudCommon::initialize(
   updateBillboardSize();
   updateAlpha();
   updateSelectable();
+  updateDownsampling();
+  updateLevelOfDetail();
 }
 
 void PointCloudCommon::loadTransformers()
@@ -274,6 +319,32 @@ void PointCloudCommon::updateBillboardSize()
   context_->queueRender();
 }
 
+void PointCloudCommon::updateDownsampling()
+{
+  auto mode = static_cast<PointCloudDownsampler::Mode>(downsampling_property_->getOptionInt());
+  voxel_size_property_->setHidden(mode != PointCloudDownsampler::VoxelGrid);
+  target_point_count_property_->setHidden(mode != PointCloudDownsampler::RandomSubsample);
+
+  {
+    std::unique_lock<std::recursive_mutex> lock(transformers_mutex_);
+    downsampler_.setMode(mode);
+    downsampler_.setVoxelSize(voxel_size_property_->getFloat());
+    downsampler_.setTargetPointCount(
+      static_cast<uint32_t>(target_point_count_property_->getInt()));
+  }
+  causeRetransform();
+}
+
+void PointCloudCommon::updateLevelOfDetail()
+{
+  bool level_of_detail = level_of_detail_property_->getBool();
+
+  for (auto const & cloud_info : cloud_infos_) {
+    cloud_info->cloud_->setLevelOfDetailEnabled(level_of_detail);
+  }
+  context_->queueRender();
+}
+
 void PointCloudCommon::reset()
 {
   std::unique_lock<std::mutex> lock(new_clouds_mutex_);
@@ -331,8 +402,10 @@ void PointCloudCommon::insertNewClouds(float point_decay_time, const rclcpp::Tim
 
       cloud_info->cloud_.reset(new rviz_rendering::PointCloud());
       cloud_info->cloud_->setRenderMode(mode);
-      cloud_info->cloud_->addPoints(
-        cloud_info->transformed_points_.begin(), cloud_info->transformed_points_.end());
+      cloud_info->cloud_->setLevelOfDetailEnabled(level_of_detail_property_->getBool());
+      cloud_info->cloud_->setPointBudget(rviz_rendering::PointBudget::getGlobal());
+      cloud_info->cloud_->addPoints(std::move(cloud_info->transformed_points_));
+      cloud_info->transformed_points_.clear();
       cloud_info->cloud_->setAlpha(alpha_property_->getFloat(), per_point_alpha);
       cloud_info->cloud_->setDimensions(size, size, size);
       cloud_info->cloud_->setAutoSize(auto_size_);
@@ -496,12 +569,30 @@ void PointCloudCommon::updateStatus()
 {
   std::stringstream ss;
   uint64_t total_point_count = 0;
+  uint64_t unfiltered_point_count = 0;
+  size_t point_memory = 0;
+  size_t vertex_buffer_memory = 0;
   for (const auto & cloud_info : cloud_infos_) {
-    total_point_count += cloud_info->transformed_points_.size();
+    total_point_count += cloud_info->getPoints().size();
+    unfiltered_point_count += cloud_info->unfiltered_point_count_;
+    point_memory += cloud_info->cloud_->getMemoryUsage();
+    vertex_buffer_memory += cloud_info->cloud_->getVertexBufferMemoryUsage();
   }
-  ss << "Showing [" << total_point_count << "] points from [" << cloud_infos_.size() <<
-    "] messages";
+  ss << "Showing [" << total_point_count << "] ";
+  if (downsampling_property_->getOptionInt() != PointCloudDownsampler::None) {
+    ss << "of [" << unfiltered_point_count << "] ";
+  }
+  ss << "points from [" << cloud_infos_.size() << "] messages";
   display_->setStatusStd(rviz_common::properties::StatusProperty::Ok, "Points", ss.str());
+
+  std::stringstream memory;
+  memory << std::fixed << std::setprecision(1) << point_memory / (1024.0 * 1024.0) <<
+    " MiB of points, " << vertex_buffer_memory / (1024.0 * 1024.0) << " MiB of vertex buffers";
+  // the pool is shared by all clouds
+  auto pool = rviz_rendering::VertexBufferPool::getSingleton().getStatistics();
+  memory << " (pool: " << pool.resident_bytes / (1024.0 * 1024.0) << " MiB resident, " <<
+    std::setprecision(0) << pool.getHitRate() * 100.0 << "% reused)";
+  display_->setStatusStd(rviz_common::properties::StatusProperty::Ok, "Memory", memory.str());
 }
 
 void PointCloudCommon::processMessage(const sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud)
@@ -576,9 +667,9 @@ void PointCloudCommon::retransform()
 
   for (auto const & cloud_info : cloud_infos_) {
     transformCloud(cloud_info, false);
-    cloud_info->cloud_->clear();
-    cloud_info->cloud_->addPoints(
-      cloud_info->transformed_points_.begin(), cloud_info->transformed_points_.end());
+    cloud_info->cloud_->clearAndRemoveAllPoints();
+    cloud_info->cloud_->addPoints(std::move(cloud_info->transformed_points_));
+    cloud_info->transformed_points_.clear();
   }
 }
 
@@ -598,18 +689,23 @@ bool PointCloudCommon::transformCloud(const CloudInfoPtr & cloud_info, bool upda
   // Remove outdated error message
   display_->deleteStatusStd(message_status_name_);
 
-  V_PointCloudPoint & cloud_points = cloud_info->transformed_points_;
-  cloud_points.clear();
+  cloud_info->transformed_points_.clear();
 
+  // the transformers write full points, they are only kept in compact form
   size_t size = cloud_info->message_->width * cloud_info->message_->height;
   rviz_rendering::PointCloud::Point default_pt = {Ogre::Vector3::ZERO, Ogre::ColourValue(1, 1, 1)};
-  cloud_points.resize(size, default_pt);
+  V_PointCloudPoint cloud_points(size, default_pt);
 
   if (!transformPoints(cloud_info, cloud_points, update_transformers)) {
     return false;
   }
 
   setProblematicPointsToInfinity(cloud_points);
+
+  cloud_info->transformed_points_.reserve(cloud_points.size());
+  for (const auto & cloud_point : cloud_points) {
+    cloud_info->transformed_points_.emplace_back(cloud_point);
+  }
   return true;
 }
 
@@ -651,8 +747,17 @@ bool PointCloudCommon::transformPoints(
 
   xyz_trans->transform(
     cloud_info->message_, PointCloudTransformer::Support_XYZ, transform, cloud_points);
-  color_trans->transform(
-    cloud_info->message_, PointCloudTransformer::Support_Color, transform, cloud_points);
+
+  // The points are selected from their positions, so only the kept points are colored.
+  cloud_info->unfiltered_point_count_ = cloud_points.size();
+  if (downsampler_.filter(cloud_points, cloud_info->point_indices_)) {
+    color_trans->transformSelected(
+      cloud_info->message_, PointCloudTransformer::Support_Color, transform,
+      cloud_info->point_indices_, cloud_points);
+  } else {
+    color_trans->transform(
+      cloud_info->message_, PointCloudTransformer::Support_Color, transform, cloud_points);
+  }
   return true;
 }
 
@@ -0,0 +1,167 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "rviz_default_plugins/displays/pointcloud/point_cloud_downsampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+namespace rviz_default_plugins
+{
+
+namespace
+{
+
+// Only keeps the conversion defined for coordinates beyond the range of int64_t.
+constexpr double kVoxelCoordinateLimit = 4611686018427387904.0;  // 2^62
+
+inline int64_t voxelCoordinate(float value, float inverse_voxel_size)
+{
+  double coordinate = std::floor(static_cast<double>(value) * inverse_voxel_size);
+  return static_cast<int64_t>(
+    std::min(std::max(coordinate, -kVoxelCoordinateLimit), kVoxelCoordinateLimit));
+}
+
+}  // namespace
+
+PointCloudDownsampler::PointCloudDownsampler()
+: mode_(None),
+  voxel_size_(0.05f),
+  target_point_count_(100000)
+{}
+
+void PointCloudDownsampler::setMode(Mode mode)
+{
+  mode_ = mode;
+}
+
+void PointCloudDownsampler::setVoxelSize(float voxel_size)
+{
+  voxel_size_ = voxel_size;
+}
+
+void PointCloudDownsampler::setTargetPointCount(uint32_t target_point_count)
+{
+  target_point_count_ = target_point_count;
+}
+
+bool PointCloudDownsampler::filter(
+  V_PointCloudPoint & points, std::vector<uint32_t> & kept_indices)
+{
+  kept_indices.clear();
+
+  switch (mode_) {
+    case VoxelGrid:
+      if (voxel_size_ <= 0.0f) {
+        return false;
+      }
+      selectVoxelRepresentatives(points);
+      break;
+    case RandomSubsample:
+      if (points.size() <= target_point_count_) {
+        return false;
+      }
+      selectRandomSubset(points.size());
+      break;
+    default:
+      return false;
+  }
+
+  if (selected_.size() == points.size()) {
+    return false;
+  }
+
+  compact(points, kept_indices);
+  return true;
+}
+
+void PointCloudDownsampler::selectVoxelRepresentatives(const V_PointCloudPoint & points)
+{
+  const float inverse_voxel_size = 1.0f / voxel_size_;
+
+  voxel_keys_.clear();
+  for (size_t i = 0; i < points.size(); ++i) {
+    const Ogre::Vector3 & position = points[i].position;
+    if (!std::isfinite(position.x) || !std::isfinite(position.y) || !std::isfinite(position.z)) {
+      continue;
+    }
+    voxel_keys_.push_back(
+      VoxelKey{
+        voxelCoordinate(position.x, inverse_voxel_size),
+        voxelCoordinate(position.y, inverse_voxel_size),
+        voxelCoordinate(position.z, inverse_voxel_size),
+        static_cast<uint32_t>(i)});
+  }
+
+  // Sorting by (voxel, index) groups each voxel together with its lowest index point first,
+  // which becomes the representative of that voxel.
+  std::sort(
+    voxel_keys_.begin(), voxel_keys_.end(), [](const VoxelKey & lhs, const VoxelKey & rhs) {
+      return std::tie(lhs.x, lhs.y, lhs.z, lhs.index) < std::tie(rhs.x, rhs.y, rhs.z, rhs.index);
+    });
+
+  selected_.clear();
+  for (size_t i = 0; i < voxel_keys_.size(); ++i) {
+    if (i == 0 || !voxel_keys_[i].sameVoxel(voxel_keys_[i - 1])) {
+      selected_.push_back(voxel_keys_[i].index);
+    }
+  }
+  std::sort(selected_.begin(), selected_.end());
+}
+
+void PointCloudDownsampler::selectRandomSubset(size_t point_count)
+{
+  selected_.resize(point_count);
+  for (size_t i = 0; i < point_count; ++i) {
+    selected_[i] = static_cast<uint32_t>(i);
+  }
+
+  // partial Fisher-Yates shuffle: only the first target_point_count_ slots are drawn
+  for (size_t i = 0; i < target_point_count_; ++i) {
+    std::uniform_int_distribution<size_t> distribution(i, point_count - 1);
+    std::swap(selected_[i], selected_[distribution(random_engine_)]);
+  }
+  selected_.resize(target_point_count_);
+  std::sort(selected_.begin(), selected_.end());
+}
+
+void PointCloudDownsampler::compact(
+  V_PointCloudPoint & points, std::vector<uint32_t> & kept_indices) const
+{
+  // selected_ is sorted ascending, so the source index is never behind the destination
+  for (size_t i = 0; i < selected_.size(); ++i) {
+    points[i] = points[selected_[i]];
+  }
+  points.resize(selected_.size());
+  kept_indices.assign(selected_.begin(), selected_.end());
+}
+
+}  // namespace rviz_default_plugins
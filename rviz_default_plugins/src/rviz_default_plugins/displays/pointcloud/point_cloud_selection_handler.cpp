@@ -119,13 +119,14 @@ void PointCloudSelectionHandler::createProperties(
 
     IndexAndMessage hash_key(index, message.get());
     if (!property_hash_.contains(hash_key)) {
+      uint64_t message_index = cloud_info_->getMessageIndex(index);
       rviz_common::properties::Property * parent = createParentPropertyForPoint(
-        parent_property, index, message);
+        parent_property, message_index, message);
       property_hash_.insert(hash_key, parent);
 
       addPositionProperty(parent, index);
 
-      addAdditionalProperties(parent, index, message);
+      addAdditionalProperties(parent, message_index, message);
     }
   }
 }
@@ -169,7 +170,7 @@ void PointCloudSelectionHandler::onSelect(const rviz_common::interaction::Picked
 
     sensor_msgs::msg::PointCloud2::ConstSharedPtr message = cloud_info_->message_;
 
-    Ogre::Vector3 pos = cloud_info_->transformed_points_[index].position;
+    Ogre::Vector3 pos = cloud_info_->getPoints()[index].position;
     pos = cloud_info_->scene_node_->convertLocalToWorldPosition(pos);
 
     float size = box_size_ * 0.5f;
@@ -205,7 +206,7 @@ void PointCloudSelectionHandler::addPositionProperty(
   rviz_common::properties::VectorProperty * pos_prop =
     new rviz_common::properties::VectorProperty(
     "Position",
-    cloud_info_->transformed_points_[index].position,
+    cloud_info_->getPoints()[index].position,
     "",
     parent);
   pos_prop->setReadOnly(true);
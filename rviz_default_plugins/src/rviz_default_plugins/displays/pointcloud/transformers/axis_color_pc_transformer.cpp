@@ -65,40 +65,53 @@ bool AxisColorPCTransformer::transform(
   if (!(mask & PointCloudTransformer::Support_Color)) {
     return false;
   }
+  return colorPoints(cloud, transform, nullptr, points_out);
+}
 
+bool AxisColorPCTransformer::transformSelected(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+  uint32_t mask,
+  const Ogre::Matrix4 & transform,
+  const std::vector<uint32_t> & indices,
+  V_PointCloudPoint & points_out)
+{
+  if (!(mask & PointCloudTransformer::Support_Color)) {
+    return false;
+  }
+  return colorPoints(cloud, transform, &indices, points_out);
+}
+
+bool AxisColorPCTransformer::colorPoints(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+  const Ogre::Matrix4 & transform,
+  const std::vector<uint32_t> * indices,
+  V_PointCloudPoint & points_out)
+{
   int32_t xi = findChannelIndex(cloud, "x");
   int32_t yi = findChannelIndex(cloud, "y");
   int32_t zi = findChannelIndex(cloud, "z");
 
-  const uint32_t xoff = cloud->fields[xi].offset;
-  const uint32_t yoff = cloud->fields[yi].offset;
-  const uint32_t zoff = cloud->fields[zi].offset;
-  const uint32_t point_step = cloud->point_step;
   const uint32_t num_points = cloud->width * cloud->height;
-  uint8_t const * point = &cloud->data.front();
 
   // Fill a vector of floats with values based on the chosen axis.
   int axis = axis_property_->getOptionInt();
   std::vector<float> values;
-  values.reserve(num_points);
-  Ogre::Vector3 pos;
   if (use_fixed_frame_property_->getBool()) {
-    for (uint32_t i = 0; i < num_points; ++i, point += point_step) {
-      // TODO(anonymous): optimize this by only doing the multiplication needed
-      // for the desired output value, instead of doing all of them
-      // and then throwing most away.
-      pos.x = *reinterpret_cast<const float *>(point + xoff);
-      pos.y = *reinterpret_cast<const float *>(point + yoff);
-      pos.z = *reinterpret_cast<const float *>(point + zoff);
-
-      pos = transform * pos;
-      values.push_back(pos[axis]);
+    // only the row of the transform for the chosen axis is needed
+    const Ogre::Real * row = transform[axis];
+    values.resize(num_points);
+    bool decoded = forEachPointPosition(
+      *cloud, cloud->fields[xi], cloud->fields[yi], cloud->fields[zi],
+      [&values, row](size_t i, float x, float y, float z) {
+        values[i] = row[0] * x + row[1] * y + row[2] * z + row[3];
+      });
+    if (!decoded) {
+      return false;
     }
   } else {
-    const uint32_t offsets[3] = {xoff, yoff, zoff};
-    const uint32_t off = offsets[axis];
-    for (uint32_t i = 0; i < num_points; ++i, point += point_step) {
-      values.push_back(*reinterpret_cast<const float *>( point + off ));
+    const int32_t indices[3] = {xi, yi, zi};
+    if (!decodePointField(*cloud, cloud->fields[indices[axis]], values)) {
+      return false;
     }
   }
   float min_value_current = 9999.0f;
@@ -120,8 +133,9 @@ bool AxisColorPCTransformer::transform(
   if (range == 0) {
     range = 0.001f;
   }
-  for (uint32_t i = 0; i < num_points; ++i) {
-    float value = 1.0 - (values[i] - min_value_current) / range;
+  const size_t num_colored = indices ? indices->size() : num_points;
+  for (size_t i = 0; i < num_colored; ++i) {
+    float value = 1.0 - (values[indices ? (*indices)[i] : i] - min_value_current) / range;
     getRainbowColor(value, points_out[i].color);
   }
 
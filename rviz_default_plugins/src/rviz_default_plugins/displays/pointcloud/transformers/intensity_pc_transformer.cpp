@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include "rviz_default_plugins/displays/pointcloud/transformers/intensity_pc_transformer.hpp"
 
@@ -59,7 +60,28 @@ bool IntensityPCTransformer::transform(
   if (!(mask & Support_Color)) {
     return false;
   }
+  return colorPoints(cloud, nullptr, points_out);
+}
 
+bool IntensityPCTransformer::transformSelected(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+  uint32_t mask,
+  const Ogre::Matrix4 & transform,
+  const std::vector<uint32_t> & indices,
+  V_PointCloudPoint & points_out)
+{
+  (void) transform;
+  if (!(mask & Support_Color)) {
+    return false;
+  }
+  return colorPoints(cloud, &indices, points_out);
+}
+
+bool IntensityPCTransformer::colorPoints(
+  const sensor_msgs::msg::PointCloud2::ConstSharedPtr & cloud,
+  const std::vector<uint32_t> * indices,
+  V_PointCloudPoint & points_out)
+{
   int32_t index = findChannelIndex(cloud, channel_name_property_->getStdString());
 
   if (index == -1) {
@@ -73,18 +95,23 @@ bool IntensityPCTransformer::transform(
     }
   }
 
-  const uint32_t offset = cloud->fields[index].offset;
-  const uint8_t type = cloud->fields[index].datatype;
-  const uint32_t point_step = cloud->point_step;
-  const uint32_t num_points = cloud->width * cloud->height;
+  // decoded once, the bounds and the colors are computed from the same values
+  std::vector<float> values;
+  if (!decodePointField(*cloud, cloud->fields[index], values)) {
+    return false;
+  }
+  const size_t num_points = values.size();
+  const size_t num_colored = indices ? indices->size() : num_points;
+  auto value_of = [&values, indices](size_t i) {
+      return values[indices ? (*indices)[i] : i];
+    };
 
   float min_intensity = 999999.0f;
   float max_intensity = -999999.0f;
   if (auto_compute_intensity_bounds_property_->getBool()) {
-    for (uint32_t i = 0; i < num_points; ++i) {
-      float val = valueFromCloud<float>(cloud, offset, type, point_step, i);
-      min_intensity = std::min(val, min_intensity);
-      max_intensity = std::max(val, max_intensity);
+    for (size_t i = 0; i < num_points; ++i) {
+      min_intensity = std::min(values[i], min_intensity);
+      max_intensity = std::max(values[i], max_intensity);
     }
 
     min_intensity = std::max(-999999.0f, min_intensity);
@@ -107,18 +134,17 @@ bool IntensityPCTransformer::transform(
   Ogre::ColourValue min_color = min_color_property_->getOgreColor();
 
   if (use_rainbow_property_->getBool()) {
-    for (uint32_t i = 0; i < num_points; ++i) {
-      float val = valueFromCloud<float>(cloud, offset, type, point_step, i);
-      float value = 1.0f - (val - min_intensity) / diff_intensity;
-      if (invert_rainbow_property_->getBool()) {
+    const bool invert_rainbow = invert_rainbow_property_->getBool();
+    for (size_t i = 0; i < num_colored; ++i) {
+      float value = 1.0f - (value_of(i) - min_intensity) / diff_intensity;
+      if (invert_rainbow) {
         value = 1.0f - value;
       }
       getRainbowColor(value, points_out[i].color);
     }
   } else {
-    for (uint32_t i = 0; i < num_points; ++i) {
-      float val = valueFromCloud<float>(cloud, offset, type, point_step, i);
-      float normalized_intensity = (val - min_intensity) / diff_intensity;
+    for (size_t i = 0; i < num_colored; ++i) {
+      float normalized_intensity = (value_of(i) - min_intensity) / diff_intensity;
       normalized_intensity = std::min(1.0f, std::max(0.0f, normalized_intensity));
       points_out[i].color.r = max_color.r * normalized_intensity + min_color.r *
         (1.0f - normalized_intensity);
@@ -83,7 +83,7 @@ bool RGB8PCTransformer::transform(
     for (V_PointCloudPoint::iterator iter = points_out.begin(); iter != points_out.end();
       ++iter, rgb_ptr += point_step)
     {
-      uint32_t rgb = *reinterpret_cast<const uint32_t *>(rgb_ptr);
+      uint32_t rgb = readPointFieldValue<uint32_t>(rgb_ptr);
       iter->color.r = rgb_lut[(rgb >> 16) & 0xff];
       iter->color.g = rgb_lut[(rgb >> 8) & 0xff];
       iter->color.b = rgb_lut[rgb & 0xff];
@@ -93,7 +93,7 @@ bool RGB8PCTransformer::transform(
     for (V_PointCloudPoint::iterator iter = points_out.begin(); iter != points_out.end();
       ++iter, rgb_ptr += point_step)
     {
-      uint32_t rgb = *reinterpret_cast<const uint32_t *>(rgb_ptr);
+      uint32_t rgb = readPointFieldValue<uint32_t>(rgb_ptr);
       iter->color.r = rgb_lut[(rgb >> 16) & 0xff];
       iter->color.g = rgb_lut[(rgb >> 8) & 0xff];
       iter->color.b = rgb_lut[rgb & 0xff];
@@ -44,7 +44,11 @@ unsigned char RGBF32PCTransformer::supports(
     return PointCloudTransformer::Support_None;
   }
 
-  if (cloud->fields[ri].datatype == sensor_msgs::msg::PointField::FLOAT32) {
+  const uint8_t datatype = cloud->fields[ri].datatype;
+  if ((datatype == sensor_msgs::msg::PointField::FLOAT32 ||
+    datatype == sensor_msgs::msg::PointField::FLOAT64) &&
+    cloud->fields[gi].datatype == datatype && cloud->fields[bi].datatype == datatype)
+  {
     return Support_Color;
   }
 
@@ -72,15 +76,17 @@ bool RGBF32PCTransformer::transform(
   const uint32_t boff = cloud->fields[bi].offset;
   const uint32_t point_step = cloud->point_step;
   const uint32_t num_points = cloud->width * cloud->height;
-  uint8_t const * point = &cloud->data.front();
-  for (uint32_t i = 0; i < num_points; ++i, point += point_step) {
-    float r = *reinterpret_cast<const float *>(point + roff);
-    float g = *reinterpret_cast<const float *>(point + goff);
-    float b = *reinterpret_cast<const float *>(point + boff);
-    points_out[i].color = Ogre::ColourValue(r, g, b);
-  }
-
-  return true;
+  uint8_t const * point = cloud->data.data();
+  return dispatchPointFieldType(
+    cloud->fields[ri].datatype, [&](auto value) {
+      using T = decltype(value);
+      for (uint32_t i = 0; i < num_points; ++i, point += point_step) {
+        points_out[i].color = Ogre::ColourValue(
+          static_cast<float>(readPointFieldValue<T>(point + roff)),
+          static_cast<float>(readPointFieldValue<T>(point + goff)),
+          static_cast<float>(readPointFieldValue<T>(point + boff)));
+      }
+    });
 }
 
 }  // end namespace rviz_default_plugins
@@ -44,7 +44,11 @@ uint8_t XYZPCTransformer::supports(const sensor_msgs::msg::PointCloud2::ConstSha
     return PointCloudTransformer::Support_None;
   }
 
-  if (cloud->fields[xi].datatype == sensor_msgs::msg::PointField::FLOAT32) {
+  const uint8_t datatype = cloud->fields[xi].datatype;
+  if ((datatype == sensor_msgs::msg::PointField::FLOAT32 ||
+    datatype == sensor_msgs::msg::PointField::FLOAT64) &&
+    cloud->fields[yi].datatype == datatype && cloud->fields[zi].datatype == datatype)
+  {
     return PointCloudTransformer::Support_XYZ;
   }
 
@@ -66,23 +70,13 @@ bool XYZPCTransformer::transform(
   int32_t yi = findChannelIndex(cloud, "y");
   int32_t zi = findChannelIndex(cloud, "z");
 
-  const uint32_t xoff = cloud->fields[xi].offset;
-  const uint32_t yoff = cloud->fields[yi].offset;
-  const uint32_t zoff = cloud->fields[zi].offset;
-  const uint32_t point_step = cloud->point_step;
-  uint8_t const * point_x = &cloud->data.front() + xoff;
-  uint8_t const * point_y = &cloud->data.front() + yoff;
-  uint8_t const * point_z = &cloud->data.front() + zoff;
-  for (V_PointCloudPoint::iterator iter = points_out.begin(); iter != points_out.end();
-    ++iter, point_x += point_step,
-    point_y += point_step, point_z += point_step)
-  {
-    iter->position.x = *reinterpret_cast<const float *>(point_x);
-    iter->position.y = *reinterpret_cast<const float *>(point_y);
-    iter->position.z = *reinterpret_cast<const float *>(point_z);
-  }
-
-  return true;
+  return forEachPointPosition(
+    *cloud, cloud->fields[xi], cloud->fields[yi], cloud->fields[zi],
+    [&points_out](size_t i, float x, float y, float z) {
+      points_out[i].position.x = x;
+      points_out[i].position.y = y;
+      points_out[i].position.z = z;
+    });
 }
 
 }  // end namespace rviz_default_plugins
@@ -45,8 +45,8 @@
 #include "rviz_common/properties/float_property.hpp"
 #include "rviz_common/validate_floats.hpp"
 
-#include "rviz_rendering/objects/arrow.hpp"
-#include "rviz_rendering/objects/axes.hpp"
+#include "rviz_rendering/objects/arrow_batch.hpp"
+#include "rviz_rendering/objects/axes_batch.hpp"
 
 #include "rviz_default_plugins/displays/pose_array/flat_arrows_array.hpp"
 
@@ -77,10 +77,7 @@ PoseArrayDisplay::PoseArrayDisplay(
   scene_node_ = scene_node;
   scene_manager_ = context_->getSceneManager();
 
-  arrows2d_ = std::make_unique<FlatArrowsArray>(scene_manager_);
-  arrows2d_->createAndAttachManualObject(scene_node);
-  arrow_node_ = scene_node_->createChildSceneNode();
-  axes_node_ = scene_node_->createChildSceneNode();
+  createShapes(scene_node);
   updateShapeChoice();
 }
 
@@ -165,13 +162,29 @@ PoseArrayDisplay::~PoseArrayDisplay()
 void PoseArrayDisplay::onInitialize()
 {
   MFDClass::onInitialize();
-  arrows2d_ = std::make_unique<FlatArrowsArray>(scene_manager_);
-  arrows2d_->createAndAttachManualObject(scene_node_);
-  arrow_node_ = scene_node_->createChildSceneNode();
-  axes_node_ = scene_node_->createChildSceneNode();
+  createShapes(scene_node_);
   updateShapeChoice();
 }
 
+void PoseArrayDisplay::createShapes(Ogre::SceneNode * scene_node)
+{
+  arrows2d_ = std::make_unique<FlatArrowsArray>(scene_manager_);
+  arrows2d_->createAndAttachManualObject(scene_node);
+  // all 3d arrows and all axes are drawn as one batch each, instead of one scene node per pose
+  arrows3d_ = std::make_unique<rviz_rendering::ArrowBatch>(
+    scene_manager_,
+    scene_node,
+    arrow3d_shaft_length_property_->getFloat(),
+    arrow3d_shaft_radius_property_->getFloat(),
+    arrow3d_head_length_property_->getFloat(),
+    arrow3d_head_radius_property_->getFloat());
+  axes_ = std::make_unique<rviz_rendering::AxesBatch>(
+    scene_manager_,
+    scene_node,
+    axes_length_property_->getFloat(),
+    axes_radius_property_->getFloat());
+}
+
 void PoseArrayDisplay::processMessage(const geometry_msgs::msg::PoseArray::ConstSharedPtr msg)
 {
   if (!validateFloats(*msg)) {
@@ -221,18 +234,18 @@ void PoseArrayDisplay::updateDisplay()
   switch (shape) {
     case ShapeType::Arrow2d:
       updateArrows2d();
-      arrows3d_.clear();
-      axes_.clear();
+      arrows3d_->clear();
+      axes_->clear();
       break;
     case ShapeType::Arrow3d:
       updateArrows3d();
       arrows2d_->clear();
-      axes_.clear();
+      axes_->clear();
       break;
     case ShapeType::Axes:
       updateAxes();
       arrows2d_->clear();
-      arrows3d_.clear();
+      arrows3d_->clear();
       break;
   }
 }
@@ -248,68 +261,32 @@ void PoseArrayDisplay::updateArrows2d()
 
 void PoseArrayDisplay::updateArrows3d()
 {
-  while (arrows3d_.size() < poses_.size()) {
-    arrows3d_.push_back(makeArrow3d());
-  }
-  while (arrows3d_.size() > poses_.size()) {
-    arrows3d_.pop_back();
-  }
+  Ogre::ColourValue color = arrow_color_property_->getOgreColor();
+  color.a = arrow_alpha_property_->getFloat();
 
+  arrows3d_->clear();
+  arrows3d_->reserve(poses_.size());
   Ogre::Quaternion adjust_orientation(Ogre::Degree(-90), Ogre::Vector3::UNIT_Y);
-  for (std::size_t i = 0; i < poses_.size(); ++i) {
-    arrows3d_[i]->setPosition(poses_[i].position);
-    arrows3d_[i]->setOrientation(poses_[i].orientation * adjust_orientation);
+  for (const auto & pose : poses_) {
+    arrows3d_->addArrow(pose.position, pose.orientation * adjust_orientation, color);
   }
 }
 
 void PoseArrayDisplay::updateAxes()
 {
-  while (axes_.size() < poses_.size()) {
-    axes_.push_back(makeAxes());
+  axes_->clear();
+  axes_->reserve(poses_.size());
+  for (const auto & pose : poses_) {
+    axes_->addAxes(pose.position, pose.orientation);
   }
-  while (axes_.size() > poses_.size()) {
-    axes_.pop_back();
-  }
-  for (std::size_t i = 0; i < poses_.size(); ++i) {
-    axes_[i]->setPosition(poses_[i].position);
-    axes_[i]->setOrientation(poses_[i].orientation);
-  }
-}
-
-std::unique_ptr<rviz_rendering::Arrow> PoseArrayDisplay::makeArrow3d()
-{
-  Ogre::ColourValue color = arrow_color_property_->getOgreColor();
-  color.a = arrow_alpha_property_->getFloat();
-
-  auto arrow = std::make_unique<rviz_rendering::Arrow>(
-    scene_manager_,
-    arrow_node_,
-    arrow3d_shaft_length_property_->getFloat(),
-    arrow3d_shaft_radius_property_->getFloat(),
-    arrow3d_head_length_property_->getFloat(),
-    arrow3d_head_radius_property_->getFloat()
-  );
-
-  arrow->setColor(color);
-  return arrow;
-}
-
-std::unique_ptr<rviz_rendering::Axes> PoseArrayDisplay::makeAxes()
-{
-  return std::make_unique<rviz_rendering::Axes>(
-    scene_manager_,
-    axes_node_,
-    axes_length_property_->getFloat(),
-    axes_radius_property_->getFloat()
-  );
 }
 
 void PoseArrayDisplay::reset()
 {
   MFDClass::reset();
   arrows2d_->clear();
-  arrows3d_.clear();
-  axes_.clear();
+  arrows3d_->clear();
+  axes_->clear();
 }
 
 void PoseArrayDisplay::updateShapeChoice()
@@ -346,9 +323,7 @@ void PoseArrayDisplay::updateArrowColor()
   if (shape == ShapeType::Arrow2d) {
     updateArrows2d();
   } else if (shape == ShapeType::Arrow3d) {
-    for (const auto & arrow : arrows3d_) {
-      arrow->setColor(color);
-    }
+    arrows3d_->setColor(color);
   }
   context_->queueRender();
 }
@@ -361,22 +336,18 @@ void PoseArrayDisplay::updateArrow2dGeometry()
 
 void PoseArrayDisplay::updateArrow3dGeometry()
 {
-  for (const auto & arrow : arrows3d_) {
-    arrow->set(
-      arrow3d_shaft_length_property_->getFloat(),
-      arrow3d_shaft_radius_property_->getFloat(),
-      arrow3d_head_length_property_->getFloat(),
-      arrow3d_head_radius_property_->getFloat()
-    );
-  }
+  arrows3d_->set(
+    arrow3d_shaft_length_property_->getFloat(),
+    arrow3d_shaft_radius_property_->getFloat(),
+    arrow3d_head_length_property_->getFloat(),
+    arrow3d_head_radius_property_->getFloat()
+  );
   context_->queueRender();
 }
 
 void PoseArrayDisplay::updateAxesGeometry()
 {
-  for (const auto & axis : axes_) {
-    axis->set(axes_length_property_->getFloat(), axes_radius_property_->getFloat());
-  }
+  axes_->set(axes_length_property_->getFloat(), axes_radius_property_->getFloat());
   context_->queueRender();
 }
 
@@ -37,7 +37,6 @@
 
 #include "rviz_rendering/objects/arrow.hpp"
 #include "rviz_rendering/objects/axes.hpp"
-#include "rviz_rendering/objects/movable_text.hpp"
 #include "rviz_common/display_context.hpp"
 #include "rviz_common/properties/vector_property.hpp"
 #include "rviz_common/properties/quaternion_property.hpp"
@@ -53,7 +52,7 @@ FrameInfo::FrameInfo(TFDisplay * display)
   axes_(nullptr),
   axes_coll_(0),
   parent_arrow_(nullptr),
-  name_text_(nullptr),
+  name_label_(0),
   distance_to_parent_(0.0f),
   arrow_orientation_(Ogre::Quaternion::IDENTITY),
   tree_property_(nullptr)
@@ -79,9 +78,7 @@ void FrameInfo::updateVisibilityFromSelection()
 
 void FrameInfo::setEnabled(bool enabled)
 {
-  if (name_node_) {
-    setNamesVisible(display_->show_names_property_->getBool());
-  }
+  setNamesVisible(display_->show_names_property_->getBool());
 
   if (axes_) {
     setAxesVisible(display_->show_axes_property_->getBool());
@@ -112,8 +109,8 @@ void FrameInfo::updatePositionAndOrientation(
   axes_->setOrientation(orientation);
   axes_->setScale(Ogre::Vector3(scale, scale, scale));
 
-  name_node_->setPosition(position);
-  name_node_->setScale(scale, scale, scale);
+  display_->names_->setPosition(name_label_, position);
+  display_->names_->setCharacterHeight(name_label_, 0.1f * scale);
 
   position_property_->setVector(position);
   orientation_property_->setQuaternion(orientation);
@@ -142,7 +139,7 @@ void FrameInfo::setVisible(bool show_frame)
 void FrameInfo::setNamesVisible(bool show_names)
 {
   bool frame_enabled = enabled_property_->getBool();
-  name_node_->setVisible(show_names && frame_enabled);
+  display_->names_->setVisible(name_label_, show_names && frame_enabled);
 }
 
 void FrameInfo::setAxesVisible(bool show_axes)
@@ -188,20 +185,20 @@ void FrameInfo::updateColorForAge(double age, double frame_timeout) const
       axes_->setXColor(c);
       axes_->setYColor(c);
       axes_->setZColor(c);
-      name_text_->setColor(c);
+      display_->names_->setColor(name_label_, c);
       parent_arrow_->setColor(c.r, c.g, c.b, c.a);
     } else {
       double t = std::max(0.0, (one_third_timeout * 2 - age) / one_third_timeout);
       axes_->setXColor(lerpColor(axes_->getDefaultXColor(), grey, t));
       axes_->setYColor(lerpColor(axes_->getDefaultYColor(), grey, t));
       axes_->setZColor(lerpColor(axes_->getDefaultZColor(), grey, t));
-      name_text_->setColor(lerpColor(Ogre::ColourValue::White, grey, t));
+      display_->names_->setColor(name_label_, lerpColor(Ogre::ColourValue::White, grey, t));
       parent_arrow_->setShaftColor(lerpColor(ARROW_SHAFT_COLOR, grey, t));
       parent_arrow_->setHeadColor(lerpColor(ARROW_HEAD_COLOR, grey, t));
     }
   } else {
     axes_->setToDefaultColors();
-    name_text_->setColor(Ogre::ColourValue::White);
+    display_->names_->setColor(name_label_, Ogre::ColourValue::White);
     parent_arrow_->setHeadColor(ARROW_HEAD_COLOR);
     parent_arrow_->setShaftColor(ARROW_SHAFT_COLOR);
   }
@@ -165,6 +165,7 @@ TFDisplay::TFDisplay()
 TFDisplay::~TFDisplay()
 {
   if (initialized()) {
+    names_.reset();
     root_node_->removeAndDestroyAllChildren();
     scene_manager_->destroySceneNode(root_node_);
   }
@@ -177,6 +178,8 @@ void TFDisplay::onInitialize()
   root_node_ = scene_node_->createChildSceneNode();
 
   names_node_ = root_node_->createChildSceneNode();
+  names_ = std::make_unique<rviz_rendering::TextBatch>(scene_manager_, names_node_);
+  names_->setTextAlignment(MovableText::H_CENTER, MovableText::V_BELOW);
   arrows_node_ = root_node_->createChildSceneNode();
   axes_node_ = root_node_->createChildSceneNode();
 
@@ -374,11 +377,8 @@ FrameInfo * TFDisplay::createFrame(const std::string & frame)
     rviz_common::interaction::createSelectionHandler<FrameSelectionHandler>(info, this, context_);
   info->selection_handler_->addTrackedObjects(info->axes_->getSceneNode());
 
-  info->name_text_ = new MovableText(frame, "Liberation Sans", 0.1f);
-  info->name_text_->setTextAlignment(MovableText::H_CENTER, MovableText::V_BELOW);
-  info->name_node_ = names_node_->createChildSceneNode();
-  info->name_node_->attachObject(info->name_text_);
-  info->name_node_->setVisible(show_names_property_->getBool());
+  info->name_label_ = names_->addLabel(frame, Ogre::Vector3::ZERO, 0.1f);
+  names_->setVisible(info->name_label_, show_names_property_->getBool());
 
   info->parent_arrow_ = new Arrow(scene_manager_, arrows_node_, 1.0f, 0.01f, 1.0f, 0.08f);
   info->parent_arrow_->getSceneNode()->setVisible(false);
@@ -597,8 +597,7 @@ TFDisplay::M_FrameInfo::iterator TFDisplay::deleteFrame(
   delete frame->axes_;
   context_->getHandlerManager()->removeHandler(frame->axes_coll_);
   delete frame->parent_arrow_;
-  delete frame->name_text_;
-  scene_manager_->destroySceneNode(frame->name_node_);
+  names_->removeLabel(frame->name_label_);
   if (delete_properties) {
     delete frame->enabled_property_;
     delete frame->tree_property_;
@@ -617,8 +616,7 @@ void TFDisplay::deleteFrame(FrameInfo * frame, bool delete_properties)
   delete frame->axes_;
   context_->getHandlerManager()->removeHandler(frame->axes_coll_);
   delete frame->parent_arrow_;
-  delete frame->name_text_;
-  scene_manager_->destroySceneNode(frame->name_node_);
+  names_->removeLabel(frame->name_label_);
   if (delete_properties) {
     if (frame->enabled_property_) {
       delete frame->enabled_property_;
@@ -0,0 +1,468 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_default_plugins/transformation/sharded_tf_frame_transformer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tf2/exceptions.h"
+#include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
+#include "tf2_ros/qos.hpp"
+
+namespace rviz_default_plugins
+{
+namespace transformation
+{
+
+namespace
+{
+
+/// Report errors of the cache like the TFFrameTransformer reports errors of the tf2 buffer.
+template<typename Lookup>
+geometry_msgs::msg::TransformStamped lookupOrThrow(Lookup lookup)
+{
+  try {
+    return lookup();
+  } catch (const tf2::LookupException & exception) {
+    throw rviz_common::transformation::FrameTransformerException(
+            (std::string("[tf2::LookupException]: ") + exception.what()).c_str());
+  } catch (const tf2::ConnectivityException & exception) {
+    throw rviz_common::transformation::FrameTransformerException(
+            (std::string("[tf2::ConnectivityException]: ") + exception.what()).c_str());
+  } catch (const tf2::ExtrapolationException & exception) {
+    throw rviz_common::transformation::FrameTransformerException(
+            (std::string("[tf2::ExtrapolationException]: ") + exception.what()).c_str());
+  }
+}
+
+}  // namespace
+
+ShardedTFFrameTransformer::ShardedTFFrameTransformer()
+: TFFrameTransformer(),
+  cache_(std::make_unique<ShardedTransformCache>()),
+  worker_([this]() {work();})
+{}
+
+ShardedTFFrameTransformer::ShardedTFFrameTransformer(std::shared_ptr<TFWrapper> wrapper)
+: TFFrameTransformer(wrapper),
+  cache_(std::make_unique<ShardedTransformCache>(wrapper->getBuffer()->getCacheLength())),
+  worker_([this]() {work();})
+{}
+
+ShardedTFFrameTransformer::~ShardedTFFrameTransformer()
+{
+  if (listening_.valid()) {
+    // Cancelling before the executor started spinning has no effect, so repeat until it stopped.
+    do {
+      listener_executor_.cancel();
+    } while (listening_.wait_for(std::chrono::milliseconds(10)) != std::future_status::ready);
+  }
+  stopWorking();
+}
+
+void ShardedTFFrameTransformer::initialize(
+  rviz_common::ros_integration::RosNodeAbstractionIface::WeakPtr rviz_ros_node,
+  rclcpp::Clock::SharedPtr clock)
+{
+  tf_wrapper_->initializeBuffer(clock, rviz_ros_node.lock()->get_raw_node(), true);
+  cache_ = std::make_unique<ShardedTransformCache>(tf_wrapper_->getBuffer()->getCacheLength());
+  startListening();
+}
+
+void ShardedTFFrameTransformer::startListening()
+{
+  // Like the TransformListener of the TFFrameTransformer, transforms are received on a node of
+  // their own, spun by a dedicated thread, so that rendering does not hold them up.
+  listener_node_ = std::make_shared<rclcpp::Node>(
+    "sharded_transform_listener_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)),
+    rclcpp::NodeOptions().start_parameter_services(false).start_parameter_event_publisher(false));
+
+  tf_subscription_ = listener_node_->create_subscription<tf2_msgs::msg::TFMessage>(
+    "/tf", tf2_ros::DynamicListenerQoS(),
+    [this](tf2_msgs::msg::TFMessage::ConstSharedPtr message) {
+      setTransforms(message, "Authority undetectable", false);
+    });
+  tf_static_subscription_ = listener_node_->create_subscription<tf2_msgs::msg::TFMessage>(
+    "/tf_static", tf2_ros::StaticListenerQoS(),
+    [this](tf2_msgs::msg::TFMessage::ConstSharedPtr message) {
+      setTransforms(message, "Authority undetectable", true);
+    });
+
+  listener_executor_.add_node(listener_node_);
+  listening_ = std::async(std::launch::async, [this]() {listener_executor_.spin();});
+}
+
+void ShardedTFFrameTransformer::setTransforms(
+  const tf2_msgs::msg::TFMessage::ConstSharedPtr & message,
+  const std::string & authority,
+  bool is_static)
+{
+  // Requests answered by these transforms are posted after this task, so the tf2 buffer has
+  // the transforms by the time they are answered. It also reports invalid transforms, which the
+  // cache ignores.
+  post(
+    [this, message, authority, is_static]() {
+      if (auto buffer = tf_wrapper_->getBuffer()) {
+        for (const auto & transform : message->transforms) {
+          buffer->setTransform(transform, authority, is_static);
+        }
+      }
+    });
+  cache_->setTransforms(message->transforms, is_static);
+}
+
+void ShardedTFFrameTransformer::setTransform(
+  const geometry_msgs::msg::TransformStamped & transform,
+  const std::string & authority,
+  bool is_static)
+{
+  auto message = std::make_shared<tf2_msgs::msg::TFMessage>();
+  message->transforms.push_back(transform);
+  setTransforms(message, authority, is_static);
+}
+
+void ShardedTFFrameTransformer::post(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  worker_condition_.notify_one();
+}
+
+void ShardedTFFrameTransformer::work()
+{
+  std::unique_lock<std::mutex> lock(worker_mutex_);
+  while (!stopping_) {
+    if (!tasks_.empty()) {
+      auto tasks = std::move(tasks_);
+      tasks_.clear();
+      lock.unlock();
+      for (const auto & task : tasks) {
+        task();
+      }
+      lock.lock();
+      continue;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    auto expired_begin = std::partition(
+      timeouts_.begin(), timeouts_.end(),
+      [now](const RequestTimeout & timeout) {return timeout.deadline > now;});
+    if (expired_begin != timeouts_.end()) {
+      std::vector<RequestTimeout> expired(
+        std::make_move_iterator(expired_begin), std::make_move_iterator(timeouts_.end()));
+      timeouts_.erase(expired_begin, timeouts_.end());
+      lock.unlock();
+      for (const auto & timeout : expired) {
+        timeOut(timeout);
+      }
+      lock.lock();
+      continue;
+    }
+
+    if (timeouts_.empty()) {
+      worker_condition_.wait(lock);
+    } else {
+      worker_condition_.wait_until(
+        lock, std::min_element(
+          timeouts_.begin(), timeouts_.end(),
+          [](const RequestTimeout & lhs, const RequestTimeout & rhs) {
+            return lhs.deadline < rhs.deadline;
+          })->deadline);
+    }
+  }
+}
+
+void ShardedTFFrameTransformer::stopWorking()
+{
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    stopping_ = true;
+  }
+  worker_condition_.notify_one();
+  worker_.join();
+}
+
+tf2_ros::TransformStampedFuture ShardedTFFrameTransformer::waitForTransform(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time,
+  const tf2::Duration & timeout,
+  tf2_ros::TransformReadyCallback callback)
+{
+  auto request = std::make_shared<TransformRequest>();
+  request->target_frame = target_frame;
+  request->source_frame = source_frame;
+  request->time = time;
+  request->future = tf2_ros::TransformStampedFuture(request->promise.get_future());
+  request->callback = std::move(callback);
+
+  const tf2::TransformableRequestHandle handle = cache_->addTransformableRequest(
+    target_frame, source_frame, time,
+    [this, request](tf2::TransformableRequestHandle answered_handle) {
+      post([this, request, answered_handle]() {answer(request, answered_handle);});
+    });
+  tf2_ros::TransformStampedFuture future = request->future;
+  future.setHandle(handle);
+
+  if (handle == 0) {
+    // Answered right away, but still after the tf2 buffer has caught up.
+    post([this, request]() {answer(request, 0);});
+    return future;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  if (timeout < std::chrono::steady_clock::time_point::max() - now) {
+    {
+      std::lock_guard<std::mutex> lock(worker_mutex_);
+      timeouts_.push_back(
+        {now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout), handle,
+          request});
+    }
+    worker_condition_.notify_one();
+  }
+  return future;
+}
+
+void ShardedTFFrameTransformer::cancel(const tf2_ros::TransformStampedFuture & ts_future)
+{
+  const tf2::TransformableRequestHandle handle = ts_future.getHandle();
+  cache_->cancelTransformableRequest(handle);
+
+  std::lock_guard<std::mutex> lock(worker_mutex_);
+  timeouts_.erase(
+    std::remove_if(
+      timeouts_.begin(), timeouts_.end(),
+      [handle](const RequestTimeout & timeout) {return timeout.handle == handle;}),
+    timeouts_.end());
+}
+
+void ShardedTFFrameTransformer::answer(
+  const std::shared_ptr<TransformRequest> & request, tf2::TransformableRequestHandle handle)
+{
+  try {
+    request->promise.set_value(
+      cache_->lookupTransform(request->target_frame, request->source_frame, request->time));
+  } catch (const tf2::TransformException &) {
+    request->promise.set_exception(std::current_exception());
+  }
+
+  tf2_ros::TransformStampedFuture future = request->future;
+  future.setHandle(handle);
+  request->callback(future);
+}
+
+void ShardedTFFrameTransformer::timeOut(const RequestTimeout & timeout)
+{
+  // The request may have been answered in the meantime.
+  if (!cache_->cancelTransformableRequest(timeout.handle)) {
+    return;
+  }
+
+  const auto & request = timeout.request;
+  request->promise.set_exception(
+    std::make_exception_ptr(
+      tf2::TimeoutException(
+        "Timed out waiting for transform from " + request->source_frame + " to " +
+        request->target_frame + " with target time " + tf2::displayTimePoint(request->time))));
+
+  tf2_ros::TransformStampedFuture future = request->future;
+  future.setHandle(timeout.handle);
+  request->callback(future);
+}
+
+void ShardedTFFrameTransformer::clear()
+{
+  TFFrameTransformer::clear();
+  cache_->clear();
+}
+
+std::vector<std::string> ShardedTFFrameTransformer::getAllFrameNames() const
+{
+  return cache_->getAllFrameNames();
+}
+
+geometry_msgs::msg::PoseStamped ShardedTFFrameTransformer::transform(
+  const geometry_msgs::msg::PoseStamped & pose_in, const std::string & target_frame)
+{
+  const auto transform = lookupOrThrow(
+    [&]() {
+      return cache_->lookupTransform(
+        target_frame, pose_in.header.frame_id, tf2_ros::fromMsg(pose_in.header.stamp));
+    });
+
+  geometry_msgs::msg::PoseStamped pose_out;
+  tf2::doTransform(pose_in, pose_out, transform);
+  return pose_out;
+}
+
+bool ShardedTFFrameTransformer::frameHasProblems(
+  const std::string & frame, std::string & error) const
+{
+  if (!cache_->frameExists(frame)) {
+    error = "Frame [" + frame + "] does not exist";
+    return true;
+  }
+
+  return false;
+}
+
+geometry_msgs::msg::TransformStamped ShardedTFFrameTransformer::lookupTransform(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time) const
+{
+  return lookupOrThrow(
+    [&]() {return cache_->lookupTransform(target_frame, source_frame, time);});
+}
+
+geometry_msgs::msg::TransformStamped ShardedTFFrameTransformer::lookupTransform(
+  const std::string & target_frame,
+  const tf2::TimePoint & target_time,
+  const std::string & source_frame,
+  const tf2::TimePoint & source_time,
+  const std::string & fixed_frame) const
+{
+  return lookupOrThrow(
+    [&]() {
+      return lookupTransformInCache(
+        target_frame, target_time, source_frame, source_time, fixed_frame);
+    });
+}
+
+bool ShardedTFFrameTransformer::canTransform(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time,
+  std::string * error_msg) const
+{
+  std::string tf2_error;
+  if (cache_->canTransform(target_frame, source_frame, time, &tf2_error)) {
+    return true;
+  }
+
+  if (error_msg) {
+    describeTransformError(target_frame, source_frame, tf2_error, *error_msg);
+  }
+  return false;
+}
+
+bool ShardedTFFrameTransformer::canTransform(
+  const std::string & target_frame,
+  const tf2::TimePoint & target_time,
+  const std::string & source_frame,
+  const tf2::TimePoint & source_time,
+  const std::string & fixed_frame,
+  std::string * error_msg) const
+{
+  try {
+    lookupTransformInCache(target_frame, target_time, source_frame, source_time, fixed_frame);
+    return true;
+  } catch (const tf2::TransformException & exception) {
+    if (error_msg) {
+      describeTransformError(target_frame, source_frame, exception.what(), *error_msg);
+    }
+    return false;
+  }
+}
+
+std::vector<std::optional<geometry_msgs::msg::TransformStamped>>
+ShardedTFFrameTransformer::lookupTransforms(
+  const std::string & target_frame,
+  const std::vector<std::string> & source_frames,
+  const tf2::TimePoint & time) const
+{
+  return cache_->lookupTransforms(target_frame, source_frames, time);
+}
+
+void ShardedTFFrameTransformer::describeTransformError(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const std::string & tf2_error,
+  std::string & error) const
+{
+  // Same messages as the TFFrameTransformer.
+  bool target_frame_ok = !frameHasProblems(target_frame, error);
+  bool ok = target_frame_ok && !frameHasProblems(source_frame, error);
+
+  if (ok) {
+    error = "No transform to fixed frame [" + target_frame + "]. "
+      "TF error: [" + tf2_error + "]";
+    return;
+  }
+
+  error = target_frame_ok ?
+    "For frame [" + source_frame + "]: " + error :
+    "For frame [" + source_frame + "]: Fixed " + error;
+}
+
+geometry_msgs::msg::TransformStamped ShardedTFFrameTransformer::lookupTransformInCache(
+  const std::string & target_frame,
+  const tf2::TimePoint & target_time,
+  const std::string & source_frame,
+  const tf2::TimePoint & source_time,
+  const std::string & fixed_frame) const
+{
+  // Same as tf2::BufferCore, the source is transformed into the fixed frame at the source
+  // time and from there into the target frame at the target time.
+  auto source_in_fixed = cache_->lookupTransform(fixed_frame, source_frame, source_time);
+  auto fixed_in_target = cache_->lookupTransform(target_frame, fixed_frame, target_time);
+
+  tf2::Transform source_to_fixed;
+  tf2::Transform fixed_to_target;
+  tf2::fromMsg(source_in_fixed.transform, source_to_fixed);
+  tf2::fromMsg(fixed_in_target.transform, fixed_to_target);
+
+  geometry_msgs::msg::TransformStamped transform = fixed_in_target;
+  transform.child_frame_id = source_frame;
+  transform.transform = tf2::toMsg(fixed_to_target * source_to_fixed);
+  return transform;
+}
+
+}  // namespace transformation
+}  // namespace rviz_default_plugins
+
+#include <pluginlib/class_list_macros.hpp>  // NOLINT
+PLUGINLIB_EXPORT_CLASS(
+  rviz_default_plugins::transformation::ShardedTFFrameTransformer,
+  rviz_common::transformation::FrameTransformer)
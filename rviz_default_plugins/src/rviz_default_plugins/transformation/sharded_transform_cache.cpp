@@ -0,0 +1,580 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_default_plugins/transformation/sharded_transform_cache.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tf2/exceptions.h"
+#include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
+#include "tf2_ros/buffer_interface.h"
+
+namespace rviz_default_plugins
+{
+namespace transformation
+{
+
+namespace
+{
+
+std::string stripSlash(const std::string & frame)
+{
+  return !frame.empty() && frame[0] == '/' ? frame.substr(1) : frame;
+}
+
+geometry_msgs::msg::TransformStamped toTransformStamped(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time,
+  const tf2::Transform & transform)
+{
+  geometry_msgs::msg::TransformStamped transform_stamped;
+  transform_stamped.header.frame_id = target_frame;
+  transform_stamped.header.stamp = tf2_ros::toMsg(time);
+  transform_stamped.child_frame_id = source_frame;
+  transform_stamped.transform = tf2::toMsg(transform);
+  return transform_stamped;
+}
+
+}  // namespace
+
+ShardedTransformCache::ShardedTransformCache(tf2::Duration cache_time)
+: cache_time_(cache_time)
+{}
+
+void ShardedTransformCache::setTransform(
+  const geometry_msgs::msg::TransformStamped & transform, bool is_static)
+{
+  addTransform(transform, is_static);
+  testTransformableRequests();
+}
+
+void ShardedTransformCache::setTransforms(
+  const std::vector<geometry_msgs::msg::TransformStamped> & transforms, bool is_static)
+{
+  for (const auto & transform : transforms) {
+    addTransform(transform, is_static);
+  }
+  testTransformableRequests();
+}
+
+tf2::TransformableRequestHandle ShardedTransformCache::addTransformableRequest(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time,
+  TransformableCallback callback)
+{
+  // Transforms are added before their writer takes this lock to test the requests, so either
+  // the test below sees the transform or the writer sees the request.
+  std::lock_guard<std::mutex> lock(requests_mutex_);
+  if (isAnswerable(target_frame, source_frame, time)) {
+    return 0;
+  }
+  const tf2::TransformableRequestHandle handle = next_request_handle_++;
+  requests_.push_back({handle, target_frame, source_frame, time, std::move(callback)});
+  return handle;
+}
+
+bool ShardedTransformCache::cancelTransformableRequest(tf2::TransformableRequestHandle handle)
+{
+  std::lock_guard<std::mutex> lock(requests_mutex_);
+  auto request = std::find_if(
+    requests_.begin(), requests_.end(),
+    [handle](const TransformableRequest & pending) {return pending.handle == handle;});
+  if (request == requests_.end()) {
+    return false;
+  }
+  requests_.erase(request);
+  return true;
+}
+
+bool ShardedTransformCache::isValid(const geometry_msgs::msg::TransformStamped & transform)
+{
+  const std::string child = stripSlash(transform.child_frame_id);
+  const std::string parent = stripSlash(transform.header.frame_id);
+  if (child.empty() || parent.empty() || child == parent) {
+    return false;
+  }
+
+  const auto & translation = transform.transform.translation;
+  const auto & rotation = transform.transform.rotation;
+  if (std::isnan(translation.x) || std::isnan(translation.y) || std::isnan(translation.z) ||
+    std::isnan(rotation.x) || std::isnan(rotation.y) || std::isnan(rotation.z) ||
+    std::isnan(rotation.w))
+  {
+    return false;
+  }
+
+  // Same tolerance as tf2::BufferCore.
+  const double length2 = rotation.x * rotation.x + rotation.y * rotation.y +
+    rotation.z * rotation.z + rotation.w * rotation.w;
+  return std::abs(length2 - 1.0) <= 10e-3;
+}
+
+void ShardedTransformCache::addTransform(
+  const geometry_msgs::msg::TransformStamped & transform, bool is_static)
+{
+  // Invalid transforms are left to the caller to report.
+  if (!isValid(transform)) {
+    return;
+  }
+
+  const std::string child = stripSlash(transform.child_frame_id);
+  Sample sample;
+  sample.stamp = tf2_ros::fromMsg(transform.header.stamp);
+  sample.parent = stripSlash(transform.header.frame_id);
+  tf2::fromMsg(transform.transform, sample.transform);
+
+  // Roots have no history, but are registered to be known as frames.
+  findOrAddFrame(sample.parent);
+  auto frame = findOrAddFrame(child);
+
+  std::unique_lock<std::shared_mutex> lock(frame->mutex);
+  if (is_static) {
+    frame->is_static = true;
+    frame->samples.assign(1, sample);
+    return;
+  }
+  if (frame->is_static) {
+    frame->is_static = false;
+    frame->samples.clear();
+  }
+
+  auto & samples = frame->samples;
+  if (samples.empty() || samples.back().stamp < sample.stamp) {
+    samples.push_back(std::move(sample));
+  } else if (sample.stamp + cache_time_ < samples.back().stamp) {
+    return;
+  } else {
+    auto after = std::upper_bound(
+      samples.begin(), samples.end(), sample.stamp,
+      [](const tf2::TimePoint & stamp, const Sample & other) {return stamp < other.stamp;});
+    if (after != samples.begin() && std::prev(after)->stamp == sample.stamp) {
+      *std::prev(after) = std::move(sample);
+    } else {
+      samples.insert(after, std::move(sample));
+    }
+  }
+
+  while (samples.back().stamp - samples.front().stamp > cache_time_) {
+    samples.pop_front();
+  }
+}
+
+geometry_msgs::msg::TransformStamped ShardedTransformCache::lookupTransform(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time) const
+{
+  checkFrameExists(target_frame, "target_frame");
+  checkFrameExists(source_frame, "source_frame");
+
+  std::string common_ancestor;
+  const tf2::TimePoint resolved_time =
+    resolveTime(target_frame, source_frame, time, common_ancestor);
+  return toTransformStamped(
+    target_frame, source_frame, resolved_time,
+    lookupInAncestors(
+      target_frame, getAncestors(target_frame, resolved_time, common_ancestor), source_frame,
+      resolved_time));
+}
+
+std::vector<std::optional<geometry_msgs::msg::TransformStamped>>
+ShardedTransformCache::lookupTransforms(
+  const std::string & target_frame,
+  const std::vector<std::string> & source_frames,
+  const tf2::TimePoint & time) const
+{
+  std::vector<std::optional<geometry_msgs::msg::TransformStamped>> transforms(
+    source_frames.size());
+  if (!frameExists(target_frame)) {
+    return transforms;
+  }
+
+  // With a time of zero, the resolved time may differ between sources. The ancestors of the
+  // target are only looked up again when it does, or when a source joins the target's path
+  // above the ancestors walked so far.
+  std::optional<tf2::TimePoint> ancestors_time;
+  Ancestors target_ancestors;
+  std::string common_ancestor;
+  for (size_t i = 0; i < source_frames.size(); ++i) {
+    const std::string & source_frame = source_frames[i];
+    try {
+      checkFrameExists(source_frame, "source_frame");
+      const tf2::TimePoint resolved_time =
+        resolveTime(target_frame, source_frame, time, common_ancestor);
+      if (ancestors_time != resolved_time ||
+        (!common_ancestor.empty() && target_ancestors.count(common_ancestor) == 0))
+      {
+        target_ancestors = getAncestors(target_frame, resolved_time, common_ancestor);
+        ancestors_time = resolved_time;
+      }
+      transforms[i] = toTransformStamped(
+        target_frame, source_frame, resolved_time,
+        lookupInAncestors(target_frame, target_ancestors, source_frame, resolved_time));
+    } catch (const tf2::TransformException &) {
+    }
+  }
+  return transforms;
+}
+
+bool ShardedTransformCache::canTransform(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time,
+  std::string * error_msg) const
+{
+  try {
+    lookupTransform(target_frame, source_frame, time);
+    return true;
+  } catch (const tf2::TransformException & exception) {
+    if (error_msg) {
+      *error_msg = exception.what();
+    }
+    return false;
+  }
+}
+
+bool ShardedTransformCache::frameExists(const std::string & frame) const
+{
+  return findFrame(frame) != nullptr;
+}
+
+std::vector<std::string> ShardedTransformCache::getAllFrameNames() const
+{
+  std::vector<std::string> frame_names;
+  for (const auto & shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    for (const auto & frame : shard.frames) {
+      frame_names.push_back(frame.first);
+    }
+  }
+  return frame_names;
+}
+
+void ShardedTransformCache::clear()
+{
+  // Like tf2::BufferCore, static transforms are kept.
+  for (auto & shard : shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    for (auto & frame : shard.frames) {
+      std::unique_lock<std::shared_mutex> frame_lock(frame.second->mutex);
+      if (!frame.second->is_static) {
+        frame.second->samples.clear();
+      }
+    }
+  }
+}
+
+void ShardedTransformCache::testTransformableRequests()
+{
+  std::vector<TransformableRequest> answered;
+  {
+    std::lock_guard<std::mutex> lock(requests_mutex_);
+    auto pending_end = std::stable_partition(
+      requests_.begin(), requests_.end(), [this](const TransformableRequest & request) {
+        return !isAnswerable(request.target_frame, request.source_frame, request.time);
+      });
+    answered.assign(
+      std::make_move_iterator(pending_end), std::make_move_iterator(requests_.end()));
+    requests_.erase(pending_end, requests_.end());
+  }
+
+  // Callbacks may add or cancel requests themselves.
+  for (const auto & request : answered) {
+    request.callback(request.handle);
+  }
+}
+
+bool ShardedTransformCache::isAnswerable(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time) const
+{
+  if (!frameExists(target_frame) || !frameExists(source_frame)) {
+    return false;
+  }
+
+  std::string common_ancestor;
+  const tf2::TimePoint latest_time =
+    resolveTime(target_frame, source_frame, tf2::TimePointZero, common_ancestor);
+  if (common_ancestor.empty()) {
+    return false;
+  }
+
+  // Once every link of the path has data up to the time, more transforms cannot change the
+  // result: the lookup either succeeds or the time is older than the data kept.
+  return time == tf2::TimePointZero || latest_time == tf2::TimePointZero || time <= latest_time;
+}
+
+ShardedTransformCache::Shard & ShardedTransformCache::getShard(const std::string & frame) const
+{
+  return shards_[std::hash<std::string>{}(frame) % kShardCount];
+}
+
+std::shared_ptr<ShardedTransformCache::Frame> ShardedTransformCache::findFrame(
+  const std::string & frame) const
+{
+  const auto & shard = getShard(frame);
+  std::shared_lock<std::shared_mutex> lock(shard.mutex);
+  auto it = shard.frames.find(frame);
+  return it != shard.frames.end() ? it->second : nullptr;
+}
+
+std::shared_ptr<ShardedTransformCache::Frame> ShardedTransformCache::findOrAddFrame(
+  const std::string & frame)
+{
+  if (auto existing_frame = findFrame(frame)) {
+    return existing_frame;
+  }
+
+  auto & shard = getShard(frame);
+  std::unique_lock<std::shared_mutex> lock(shard.mutex);
+  auto & new_frame = shard.frames[frame];
+  if (!new_frame) {
+    new_frame = std::make_shared<Frame>();
+  }
+  return new_frame;
+}
+
+bool ShardedTransformCache::getLatestParent(
+  const std::string & frame,
+  std::string & parent,
+  std::optional<tf2::TimePoint> & stamp) const
+{
+  auto cached_frame = findFrame(frame);
+  if (!cached_frame) {
+    return false;
+  }
+
+  std::shared_lock<std::shared_mutex> lock(cached_frame->mutex);
+  if (cached_frame->samples.empty()) {
+    return false;
+  }
+  parent = cached_frame->samples.back().parent;
+  stamp = cached_frame->is_static ?
+    std::nullopt : std::optional<tf2::TimePoint>(cached_frame->samples.back().stamp);
+  return true;
+}
+
+bool ShardedTransformCache::getParentTransform(
+  const std::string & frame,
+  const tf2::TimePoint & time,
+  std::string & parent,
+  tf2::Transform & transform) const
+{
+  auto cached_frame = findFrame(frame);
+  if (!cached_frame) {
+    return false;
+  }
+
+  std::shared_lock<std::shared_mutex> lock(cached_frame->mutex);
+  const auto & samples = cached_frame->samples;
+  if (samples.empty()) {
+    return false;
+  }
+
+  if (cached_frame->is_static || time == tf2::TimePointZero) {
+    parent = samples.back().parent;
+    transform = samples.back().transform;
+    return true;
+  }
+
+  if (time < samples.front().stamp || time > samples.back().stamp) {
+    const bool into_past = time < samples.front().stamp;
+    throw tf2::ExtrapolationException(
+            std::string("Lookup would require extrapolation into the ") +
+            (into_past ? "past" : "future") + ". Requested time " + tf2::displayTimePoint(time) +
+            " but the " + (into_past ? "earliest" : "latest") + " data is at time " +
+            tf2::displayTimePoint(into_past ? samples.front().stamp : samples.back().stamp) +
+            ", when looking up transform from frame [" + frame + "] to frame [" +
+            samples.back().parent + "]");
+  }
+
+  auto after = std::lower_bound(
+    samples.begin(), samples.end(), time,
+    [](const Sample & sample, const tf2::TimePoint & stamp) {return sample.stamp < stamp;});
+  if (after->stamp == time) {
+    parent = after->parent;
+    transform = after->transform;
+    return true;
+  }
+
+  // Like tf2, samples with different parents are not interpolated.
+  auto before = std::prev(after);
+  parent = before->parent;
+  if (before->parent != after->parent) {
+    transform = before->transform;
+    return true;
+  }
+
+  const double ratio =
+    std::chrono::duration<double>(time - before->stamp).count() /
+    std::chrono::duration<double>(after->stamp - before->stamp).count();
+  tf2::Vector3 origin;
+  origin.setInterpolate3(
+    before->transform.getOrigin(), after->transform.getOrigin(), ratio);
+  transform = tf2::Transform(
+    tf2::slerp(before->transform.getRotation(), after->transform.getRotation(), ratio), origin);
+  return true;
+}
+
+tf2::TimePoint ShardedTransformCache::resolveTime(
+  const std::string & target_frame,
+  const std::string & source_frame,
+  const tf2::TimePoint & time,
+  std::string & common_ancestor) const
+{
+  struct Link
+  {
+    std::string frame;
+    std::optional<tf2::TimePoint> stamp;
+  };
+  auto get_path_to_root = [this](const std::string & frame) {
+      std::vector<Link> path;
+      std::string current = frame;
+      std::string parent;
+      std::optional<tf2::TimePoint> stamp;
+      while (path.size() < kMaxGraphDepth && getLatestParent(current, parent, stamp)) {
+        path.push_back({current, stamp});
+        current = parent;
+      }
+      path.push_back({current, std::nullopt});
+      return path;
+    };
+  const auto source_path = get_path_to_root(source_frame);
+  const auto target_path = get_path_to_root(target_frame);
+
+  // Only the links below the common ancestor are used by the lookup.
+  size_t source_end = source_path.size();
+  size_t target_end = target_path.size();
+  common_ancestor.clear();
+  for (size_t t = 0; t < target_path.size() && target_end == target_path.size(); ++t) {
+    for (size_t s = 0; s < source_path.size(); ++s) {
+      if (source_path[s].frame == target_path[t].frame) {
+        source_end = s;
+        target_end = t;
+        common_ancestor = target_path[t].frame;
+        break;
+      }
+    }
+  }
+
+  if (time != tf2::TimePointZero) {
+    return time;
+  }
+
+  std::optional<tf2::TimePoint> latest_common_time;
+  auto limit_time = [&latest_common_time](const Link & link) {
+      if (link.stamp && (!latest_common_time || *link.stamp < *latest_common_time)) {
+        latest_common_time = link.stamp;
+      }
+    };
+  std::for_each(source_path.begin(), source_path.begin() + source_end, limit_time);
+  std::for_each(target_path.begin(), target_path.begin() + target_end, limit_time);
+
+  // Paths of static transforms only are valid at any time.
+  return latest_common_time.value_or(tf2::TimePointZero);
+}
+
+ShardedTransformCache::Ancestors ShardedTransformCache::getAncestors(
+  const std::string & frame, const tf2::TimePoint & time, const std::string & last_frame) const
+{
+  Ancestors ancestors;
+  tf2::Transform to_frame = tf2::Transform::getIdentity();
+  std::string current = frame;
+  ancestors.emplace(current, to_frame);
+
+  std::string parent;
+  tf2::Transform parent_transform;
+  for (size_t depth = 0;
+    current != last_frame && getParentTransform(current, time, parent, parent_transform);
+    ++depth)
+  {
+    if (depth >= kMaxGraphDepth) {
+      throw tf2::ConnectivityException(
+              "The tf tree is invalid because it contains a loop at frame [" + frame + "]");
+    }
+    to_frame = parent_transform * to_frame;
+    current = parent;
+    ancestors.emplace(current, to_frame);
+  }
+  return ancestors;
+}
+
+tf2::Transform ShardedTransformCache::lookupInAncestors(
+  const std::string & target_frame,
+  const Ancestors & target_ancestors,
+  const std::string & source_frame,
+  const tf2::TimePoint & time) const
+{
+  tf2::Transform to_source = tf2::Transform::getIdentity();
+  std::string current = source_frame;
+  std::string parent;
+  tf2::Transform parent_transform;
+  for (size_t depth = 0; depth <= kMaxGraphDepth; ++depth) {
+    auto common_ancestor = target_ancestors.find(current);
+    if (common_ancestor != target_ancestors.end()) {
+      return common_ancestor->second.inverseTimes(to_source);
+    }
+    if (!getParentTransform(current, time, parent, parent_transform)) {
+      break;
+    }
+    to_source = parent_transform * to_source;
+    current = parent;
+  }
+  throw tf2::ConnectivityException(
+          "Could not find a connection between '" + target_frame + "' and '" + source_frame +
+          "' because they are not part of the same tree.");
+}
+
+void ShardedTransformCache::checkFrameExists(
+  const std::string & frame, const char * argument) const
+{
+  if (!frameExists(frame)) {
+    throw tf2::LookupException(
+            "\"" + frame + "\" passed to lookupTransform argument " + argument +
+            " does not exist. ");
+  }
+}
+
+}  // namespace transformation
+}  // namespace rviz_default_plugins
@@ -0,0 +1,122 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include "rviz_default_plugins/displays/camera/camera_render_schedule.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_default_plugins::displays::CameraRenderSchedule;
+
+namespace
+{
+const float kMillisecond = 1000000.0f;
+}  // namespace
+
+TEST(CameraRenderSchedule, renders_into_the_panel_without_rate_and_scale_limits) {
+  auto target = CameraRenderSchedule::getTarget(640, 480, 0.0f, 1.0f);
+
+  EXPECT_FALSE(target.offscreen);
+}
+
+TEST(CameraRenderSchedule, renders_offscreen_at_full_size_if_only_the_rate_is_limited) {
+  auto target = CameraRenderSchedule::getTarget(640, 480, 10.0f, 1.0f);
+
+  EXPECT_TRUE(target.offscreen);
+  EXPECT_THAT(target.width, Eq(640));
+  EXPECT_THAT(target.height, Eq(480));
+}
+
+TEST(CameraRenderSchedule, renders_offscreen_at_a_fraction_of_the_panel_size) {
+  auto target = CameraRenderSchedule::getTarget(640, 480, 0.0f, 0.5f);
+
+  EXPECT_TRUE(target.offscreen);
+  EXPECT_THAT(target.width, Eq(320));
+  EXPECT_THAT(target.height, Eq(240));
+}
+
+TEST(CameraRenderSchedule, offscreen_size_is_at_least_one_pixel) {
+  auto target = CameraRenderSchedule::getTarget(0, 3, 0.0f, 0.1f);
+
+  EXPECT_THAT(target.width, Eq(1));
+  EXPECT_THAT(target.height, Eq(1));
+}
+
+TEST(CameraRenderSchedule, renders_every_frame_without_a_rate_limit) {
+  CameraRenderSchedule schedule;
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(schedule.advance(0.0f, 16 * kMillisecond));
+  }
+}
+
+TEST(CameraRenderSchedule, renders_the_first_frame_and_then_at_the_render_rate) {
+  CameraRenderSchedule schedule;
+
+  int rendered = 0;
+  for (int i = 0; i < 100; ++i) {
+    rendered += schedule.advance(10.0f, 10 * kMillisecond) ? 1 : 0;
+  }
+
+  // one immediate frame, then one per 100 ms of the 1 s
+  EXPECT_THAT(rendered, Eq(10));
+}
+
+TEST(CameraRenderSchedule, rate_is_kept_if_frames_do_not_divide_the_period) {
+  CameraRenderSchedule schedule;
+  schedule.advance(10.0f, 0.0f);
+
+  int rendered = 0;
+  for (int i = 0; i < 300; ++i) {
+    rendered += schedule.advance(10.0f, 30 * kMillisecond) ? 1 : 0;
+  }
+
+  EXPECT_THAT(rendered, Eq(90));
+}
+
+TEST(CameraRenderSchedule, long_frames_do_not_cause_a_burst_of_renders) {
+  CameraRenderSchedule schedule;
+  schedule.advance(10.0f, 0.0f);
+
+  EXPECT_TRUE(schedule.advance(10.0f, 1000 * kMillisecond));
+  EXPECT_FALSE(schedule.advance(10.0f, 10 * kMillisecond));
+}
+
+TEST(CameraRenderSchedule, invalidate_renders_the_next_frame) {
+  CameraRenderSchedule schedule;
+  schedule.advance(1.0f, 0.0f);
+  EXPECT_FALSE(schedule.advance(1.0f, 10 * kMillisecond));
+
+  schedule.invalidate();
+
+  EXPECT_TRUE(schedule.advance(1.0f, 10 * kMillisecond));
+  EXPECT_FALSE(schedule.advance(1.0f, 10 * kMillisecond));
+}
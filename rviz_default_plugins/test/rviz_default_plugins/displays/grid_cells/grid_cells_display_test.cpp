@@ -30,6 +30,7 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -38,6 +39,7 @@
 #include "rviz_common/properties/float_property.hpp"
 
 #include "rviz_default_plugins/displays/grid_cells/grid_cells_display.hpp"
+#include "rviz_default_plugins/displays/grid_cells/grid_cells_texture.hpp"
 
 #include "../../scene_graph_introspection.hpp"
 #include "../display_test_fixture.hpp"
@@ -113,6 +115,7 @@ TEST_F(GridCellsDisplayFixture, processMessage_with_zero_size_does_not_add_messa
 
 TEST_F(GridCellsDisplayFixture, processMessage_fills_pointcloud_with_correct_grid_cells_message) {
   mockValidTransform();
+  display_->findProperty("Rasterize Cells")->setValue(false);
   auto msg = createGridCellsMessageWithTwoCells();
   display_->processMessage(msg);
 
@@ -139,3 +142,77 @@ TEST_F(GridCellsDisplayFixture, processMessage_clears_cloud_on_new_message) {
   EXPECT_THAT(point_clouds.size(), Eq(1u));
   EXPECT_THAT(point_clouds[0]->getPoints().size(), Eq(0u));
 }
+
+TEST_F(GridCellsDisplayFixture, processMessage_draws_cells_on_a_grid_as_texture) {
+  mockValidTransform();
+
+  auto msg = createGridCellsMessageWithTwoCells();
+  display_->processMessage(msg);
+
+  auto point_clouds = rviz_default_plugins::findAllPointClouds(scene_manager_->getRootSceneNode());
+  EXPECT_THAT(point_clouds[0]->getPoints().size(), Eq(0u));
+  auto quad = rviz_default_plugins::findOneManualObject(scene_manager_->getRootSceneNode());
+  ASSERT_TRUE(quad);
+  EXPECT_TRUE(quad->getVisible());
+}
+
+TEST_F(GridCellsDisplayFixture, processMessage_draws_cells_off_the_grid_as_tiles) {
+  mockValidTransform();
+
+  auto msg = createGridCellsMessageWithTwoCells();
+  msg->cells.push_back(point(0.5, 0, 0));
+  display_->processMessage(msg);
+
+  auto point_clouds = rviz_default_plugins::findAllPointClouds(scene_manager_->getRootSceneNode());
+  EXPECT_THAT(point_clouds[0]->getPoints().size(), Eq(3u));
+  auto quad = rviz_default_plugins::findOneManualObject(scene_manager_->getRootSceneNode());
+  ASSERT_TRUE(quad);
+  EXPECT_FALSE(quad->getVisible());
+}
+
+TEST_F(GridCellsDisplayFixture, grid_cells_texture_sets_a_texel_per_cell) {
+  rviz_default_plugins::displays::GridCellsTexture texture(
+    scene_manager_, scene_manager_->getRootSceneNode());
+
+  auto msg = createGridCellsMessageWithTwoCells(0.5f, 0.5f);
+  ASSERT_TRUE(texture.update(*msg));
+
+  // the cells are 4 cells apart along both axes, the texture is rounded up to a block
+  ASSERT_THAT(texture.getWidth(), Eq(64u));
+  ASSERT_THAT(texture.getHeight(), Eq(64u));
+  const auto & texels = texture.getTexels();
+  EXPECT_THAT(std::count(texels.begin(), texels.end(), 255), Eq(2));
+  EXPECT_THAT(texture.getUploadedRows(), Eq(64u));
+  EXPECT_THAT(texture.getSceneNode()->getScale(), Vector3Eq(Ogre::Vector3(32, 32, 1)));
+
+  // the cells are centered in the texture, the first one at texel (29, 29)
+  EXPECT_THAT(texels[29 * 64 + 29], Eq(255));
+  EXPECT_THAT(texels[33 * 64 + 33], Eq(255));
+  EXPECT_THAT(
+    texture.getSceneNode()->getPosition(), Vector3Eq(Ogre::Vector3(-15.75f, -15.75f, 0)));
+}
+
+TEST_F(GridCellsDisplayFixture, grid_cells_texture_only_uploads_changed_rows) {
+  rviz_default_plugins::displays::GridCellsTexture texture(
+    scene_manager_, scene_manager_->getRootSceneNode());
+
+  auto msg = createGridCellsMessageWithTwoCells();
+  ASSERT_TRUE(texture.update(*msg));
+
+  msg->cells[0] = point(2, 1, 0);
+  ASSERT_TRUE(texture.update(*msg));
+  EXPECT_THAT(texture.getUploadedRows(), Eq(1u));
+
+  ASSERT_TRUE(texture.update(*msg));
+  EXPECT_THAT(texture.getUploadedRows(), Eq(0u));
+}
+
+TEST_F(GridCellsDisplayFixture, grid_cells_texture_rejects_cells_not_in_one_plane) {
+  rviz_default_plugins::displays::GridCellsTexture texture(
+    scene_manager_, scene_manager_->getRootSceneNode());
+
+  auto msg = createGridCellsMessageWithTwoCells();
+  msg->cells[0].z = 1;
+  EXPECT_FALSE(texture.update(*msg));
+  EXPECT_FALSE(texture.isVisible());
+}
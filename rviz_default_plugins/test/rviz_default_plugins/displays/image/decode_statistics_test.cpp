@@ -0,0 +1,114 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+
+#include "rclcpp/time.hpp"
+
+#include "rviz_default_plugins/displays/image/decode_statistics.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_default_plugins::displays::DecodeStatistics;
+
+namespace
+{
+rclcpp::Time stamp(double seconds)
+{
+  return rclcpp::Time(static_cast<int64_t>(seconds * 1e9), RCL_ROS_TIME);
+}
+}  // namespace
+
+TEST(DecodeStatistics, frame_older_than_the_newest_decoded_one_is_skipped) {
+  DecodeStatistics statistics;
+
+  EXPECT_TRUE(statistics.frameDecoded(stamp(10.1), stamp(10.2)));
+  EXPECT_FALSE(statistics.frameDecoded(stamp(10.0), stamp(10.2)));
+  EXPECT_TRUE(statistics.frameDecoded(stamp(10.1), stamp(10.2)));
+
+  EXPECT_THAT(statistics.takeSummary().frames_skipped, Eq(1u));
+}
+
+TEST(DecodeStatistics, frame_after_a_jump_back_in_time_is_not_skipped) {
+  DecodeStatistics statistics;
+
+  EXPECT_TRUE(statistics.frameDecoded(stamp(60), stamp(60)));
+  EXPECT_TRUE(statistics.frameDecoded(stamp(5), stamp(5)));
+  EXPECT_TRUE(statistics.frameDecoded(stamp(5.1), stamp(5.1)));
+}
+
+TEST(DecodeStatistics, summary_contains_the_frames_decoded_since_the_last_summary) {
+  DecodeStatistics statistics;
+  const auto start = std::chrono::steady_clock::now();
+  statistics.takeSummary(start);
+
+  statistics.frameDecoded(stamp(10.0), stamp(10.1));
+  statistics.frameDecoded(stamp(10.1), stamp(10.3));
+  statistics.frameSkipped();
+  auto summary = statistics.takeSummary(start + std::chrono::milliseconds(500));
+
+  EXPECT_THAT(summary.frames_per_second, DoubleNear(4.0, 1e-6));
+  EXPECT_THAT(summary.average_latency, DoubleNear(0.15, 1e-6));
+  EXPECT_THAT(summary.frames_skipped, Eq(1u));
+
+  summary = statistics.takeSummary(start + std::chrono::milliseconds(1000));
+
+  EXPECT_THAT(summary.frames_per_second, Eq(0.0));
+  EXPECT_THAT(summary.frames_skipped, Eq(1u));
+}
+
+TEST(DecodeStatistics, unstamped_frames_do_not_count_towards_the_latency) {
+  DecodeStatistics statistics;
+
+  statistics.frameDecoded(stamp(0), stamp(100));
+
+  EXPECT_THAT(statistics.takeSummary().average_latency, Eq(0.0));
+}
+
+TEST(DecodeStatistics, summary_is_readable) {
+  DecodeStatistics::Summary summary{25.0, 0.04, 3};
+
+  EXPECT_THAT(
+    summary.toString().toStdString(),
+    StrEq("25.0 frames per second, 40.0 ms latency, 3 outdated frames skipped"));
+}
+
+TEST(DecodeStatistics, reset_forgets_the_newest_frame_and_the_skipped_frames) {
+  DecodeStatistics statistics;
+  statistics.frameDecoded(stamp(10.1), stamp(10.1));
+  statistics.frameDecoded(stamp(10.0), stamp(10.1));
+
+  statistics.reset();
+
+  EXPECT_TRUE(statistics.frameDecoded(stamp(10.0), stamp(10.1)));
+  EXPECT_THAT(statistics.takeSummary().frames_skipped, Eq(0u));
+}
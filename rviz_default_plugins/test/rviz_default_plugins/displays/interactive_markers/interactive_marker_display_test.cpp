@@ -0,0 +1,220 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "visualization_msgs/msg/interactive_marker_update.hpp"
+
+#include "rviz_default_plugins/displays/interactive_markers/interactive_marker_display.hpp"
+#include "../display_test_fixture.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_default_plugins::displays::InteractiveMarkerDisplay;
+using visualization_msgs::msg::InteractiveMarker;
+using visualization_msgs::msg::InteractiveMarkerPose;
+using visualization_msgs::msg::InteractiveMarkerUpdate;
+
+class InteractiveMarkerDisplayFixture : public DisplayTestFixture
+{
+public:
+  InteractiveMarkerDisplayFixture()
+  {
+    mockValidTransform();
+    display_ = std::make_unique<InteractiveMarkerDisplay>(context_.get());
+  }
+
+  ~InteractiveMarkerDisplayFixture() override
+  {
+    display_.reset();
+  }
+
+  /// A marker with a single control; a zero stamp locks it to its frame.
+  InteractiveMarker createMarker(const std::string & name, bool frame_locked)
+  {
+    InteractiveMarker marker;
+    marker.header.frame_id = fixed_frame;
+    if (!frame_locked) {
+      marker.header.stamp.sec = 1;
+    }
+    marker.name = name;
+    marker.scale = 1.0f;
+    marker.pose.orientation.w = 1.0;
+    marker.controls.resize(1);
+    marker.controls[0].name = "control";
+    return marker;
+  }
+
+  InteractiveMarkerPose createPose(const std::string & name, double x)
+  {
+    InteractiveMarkerPose pose;
+    pose.header.frame_id = fixed_frame;
+    pose.header.stamp.sec = 1;
+    pose.name = name;
+    pose.pose.position.x = x;
+    pose.pose.orientation.w = 1.0;
+    return pose;
+  }
+
+  void sendMarkers(const std::vector<InteractiveMarker> & markers)
+  {
+    auto update = std::make_shared<InteractiveMarkerUpdate>();
+    update->markers = markers;
+    display_->updateCallback(update);
+  }
+
+  void sendPose(const InteractiveMarkerPose & pose)
+  {
+    auto update = std::make_shared<InteractiveMarkerUpdate>();
+    update->poses.push_back(pose);
+    display_->updateCallback(update);
+  }
+
+  void sendErase(const std::string & name)
+  {
+    auto update = std::make_shared<InteractiveMarkerUpdate>();
+    update->erases.push_back(name);
+    display_->updateCallback(update);
+  }
+
+  /// Expect exactly the given number of reference pose lookups from now on.
+  void expectReferencePoseLookups(int times)
+  {
+    EXPECT_CALL(*frame_manager_, getTransform(_, _, _, _))
+    .Times(times)
+    .WillRepeatedly(Return(true));
+  }
+
+  std::unique_ptr<InteractiveMarkerDisplay> display_;
+};
+
+TEST_F(InteractiveMarkerDisplayFixture, only_the_newest_pose_of_a_marker_is_applied_per_frame) {
+  sendMarkers({createMarker("marker", false)});
+
+  sendPose(createPose("marker", 1.0));
+  sendPose(createPose("marker", 2.0));
+  sendPose(createPose("marker", 3.0));
+
+  EXPECT_THAT(display_->getPendingPoseCount(), Eq(1u));
+  EXPECT_THAT(display_->getInteractiveMarker("marker")->getPosition().x, FloatEq(0.0f));
+
+  expectReferencePoseLookups(1);
+  display_->update(0, 0);
+
+  EXPECT_THAT(display_->getPendingPoseCount(), Eq(0u));
+  EXPECT_THAT(display_->getInteractiveMarker("marker")->getPosition().x, FloatEq(3.0f));
+}
+
+TEST_F(InteractiveMarkerDisplayFixture, poses_of_different_markers_are_kept_apart) {
+  sendMarkers({createMarker("first", false), createMarker("second", false)});
+
+  sendPose(createPose("first", 1.0));
+  sendPose(createPose("second", 2.0));
+
+  EXPECT_THAT(display_->getPendingPoseCount(), Eq(2u));
+
+  display_->update(0, 0);
+
+  EXPECT_THAT(display_->getInteractiveMarker("first")->getPosition().x, FloatEq(1.0f));
+  EXPECT_THAT(display_->getInteractiveMarker("second")->getPosition().x, FloatEq(2.0f));
+}
+
+TEST_F(InteractiveMarkerDisplayFixture, a_full_marker_update_drops_the_queued_pose) {
+  sendMarkers({createMarker("marker", false)});
+  sendPose(createPose("marker", 1.0));
+
+  auto marker = createMarker("marker", false);
+  marker.pose.position.x = 5.0;
+  sendMarkers({marker});
+
+  EXPECT_THAT(display_->getPendingPoseCount(), Eq(0u));
+
+  expectReferencePoseLookups(0);
+  display_->update(0, 0);
+
+  EXPECT_THAT(display_->getInteractiveMarker("marker")->getPosition().x, FloatEq(5.0f));
+}
+
+TEST_F(InteractiveMarkerDisplayFixture, erasing_a_marker_drops_the_queued_pose) {
+  sendMarkers({createMarker("marker", false)});
+  sendPose(createPose("marker", 1.0));
+
+  sendErase("marker");
+
+  EXPECT_THAT(display_->getPendingPoseCount(), Eq(0u));
+  EXPECT_THAT(display_->getInteractiveMarker("marker"), IsNull());
+
+  expectReferencePoseLookups(0);
+  display_->update(0, 0);
+}
+
+TEST_F(InteractiveMarkerDisplayFixture, update_skips_markers_neither_frame_locked_nor_dragged) {
+  sendMarkers({createMarker("idle", false), createMarker("also_idle", false)});
+
+  expectReferencePoseLookups(0);
+  display_->update(0, 0);
+  display_->update(0, 0);
+}
+
+TEST_F(InteractiveMarkerDisplayFixture, update_refreshes_frame_locked_markers_every_frame) {
+  sendMarkers({createMarker("idle", false), createMarker("locked", true)});
+
+  expectReferencePoseLookups(2);
+  display_->update(0, 0);
+  display_->update(0, 0);
+}
+
+TEST_F(InteractiveMarkerDisplayFixture, needs_update_only_while_frame_locked_or_dragged) {
+  sendMarkers({createMarker("idle", false), createMarker("locked", true)});
+  auto idle = display_->getInteractiveMarker("idle");
+  auto locked = display_->getInteractiveMarker("locked");
+
+  EXPECT_FALSE(idle->needsUpdate());
+  EXPECT_TRUE(locked->needsUpdate());
+
+  idle->startDragging();
+  EXPECT_TRUE(idle->needsUpdate());
+
+  idle->stopDragging();
+  EXPECT_FALSE(idle->needsUpdate());
+}
+
+TEST_F(InteractiveMarkerDisplayFixture, a_stamped_pose_update_unlocks_a_frame_locked_marker) {
+  sendMarkers({createMarker("marker", true)});
+  ASSERT_TRUE(display_->getInteractiveMarker("marker")->needsUpdate());
+
+  sendPose(createPose("marker", 1.0));
+  display_->update(0, 0);
+
+  EXPECT_FALSE(display_->getInteractiveMarker("marker")->needsUpdate());
+}
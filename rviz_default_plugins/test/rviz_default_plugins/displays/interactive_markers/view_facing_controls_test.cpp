@@ -0,0 +1,268 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+#include <QApplication>  // NOLINT cpplint cannot handle include order
+
+#include <OgreCamera.h>
+#include <OgreRenderWindow.h>
+#include <OgreSceneNode.h>
+#include <OgreViewport.h>
+
+#include "visualization_msgs/msg/interactive_marker_control.hpp"
+
+#include "rviz_default_plugins/displays/interactive_markers/interactive_marker.hpp"
+#include "rviz_default_plugins/displays/interactive_markers/interactive_marker_control.hpp"
+#include "rviz_default_plugins/displays/interactive_markers/view_facing_controls.hpp"
+#include "../display_test_fixture.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_default_plugins::displays::InteractiveMarker;
+using rviz_default_plugins::displays::InteractiveMarkerControl;
+using rviz_default_plugins::displays::ViewFacingControls;
+using InteractiveMarkerControlMsg = visualization_msgs::msg::InteractiveMarkerControl;
+
+class ViewFacingControlsFixture : public DisplayTestFixture
+{
+public:
+  ViewFacingControlsFixture()
+  {
+    view_facing_controls_ = std::make_shared<ViewFacingControls>(scene_manager_);
+    marker_ = std::make_shared<InteractiveMarker>(
+      scene_manager_->getRootSceneNode(), context_.get(), view_facing_controls_);
+
+    camera_ = scene_manager_->createCamera("view_facing_controls_test_camera");
+    camera_node_ = scene_manager_->getRootSceneNode()->createChildSceneNode();
+    camera_node_->attachObject(camera_);
+    window_ = testing_environment_->createOgreRenderWindow();
+    viewport_ = window_->addViewport(camera_);
+  }
+
+  ~ViewFacingControlsFixture() override
+  {
+    controls_.clear();
+    marker_.reset();
+    view_facing_controls_.reset();
+    window_->removeAllViewports();
+    scene_manager_->destroyCamera(camera_);
+  }
+
+  /// A view facing control, with its own reference node unless one is given.
+  std::shared_ptr<InteractiveMarkerControl> createControl(
+    Ogre::SceneNode * reference_node = nullptr)
+  {
+    if (!reference_node) {
+      reference_node = scene_manager_->getRootSceneNode()->createChildSceneNode();
+    }
+    auto control = std::make_shared<InteractiveMarkerControl>(
+      context_.get(), reference_node, marker_.get());
+    control->processMessage(createMessage(InteractiveMarkerControlMsg::VIEW_FACING));
+    controls_.push_back(control);
+    reference_nodes_.push_back(reference_node);
+    return control;
+  }
+
+  InteractiveMarkerControlMsg createMessage(uint8_t orientation_mode)
+  {
+    InteractiveMarkerControlMsg message;
+    message.name = "control";
+    message.orientation.w = 1.0;
+    message.orientation_mode = orientation_mode;
+    message.interaction_mode = InteractiveMarkerControlMsg::NONE;
+    return message;
+  }
+
+  /// The control frame node is the first child the control creates on its reference node.
+  Ogre::Node * getControlFrameNode(size_t control_index)
+  {
+    return reference_nodes_[control_index]->getChild(0);
+  }
+
+  /// Render the scene once and return which controls were turned towards the camera.
+  std::vector<bool> render()
+  {
+    for (size_t i = 0; i < controls_.size(); ++i) {
+      getControlFrameNode(i)->setOrientation(Ogre::Quaternion::IDENTITY);
+    }
+    view_facing_controls_->preFindVisibleObjects(
+      scene_manager_, Ogre::SceneManager::IRS_NONE, viewport_);
+
+    std::vector<bool> turned;
+    for (size_t i = 0; i < controls_.size(); ++i) {
+      turned.push_back(getControlFrameNode(i)->getOrientation() != Ogre::Quaternion::IDENTITY);
+    }
+    return turned;
+  }
+
+  std::shared_ptr<ViewFacingControls> view_facing_controls_;
+  std::shared_ptr<InteractiveMarker> marker_;
+  std::vector<std::shared_ptr<InteractiveMarkerControl>> controls_;
+  std::vector<Ogre::SceneNode *> reference_nodes_;
+
+  Ogre::Camera * camera_;
+  Ogre::SceneNode * camera_node_;
+  Ogre::RenderWindow * window_;
+  Ogre::Viewport * viewport_;
+};
+
+TEST_F(ViewFacingControlsFixture, view_facing_controls_are_added_once) {
+  auto control = createControl();
+  createControl();
+
+  EXPECT_THAT(view_facing_controls_->size(), Eq(2u));
+
+  control->processMessage(createMessage(InteractiveMarkerControlMsg::VIEW_FACING));
+  EXPECT_THAT(view_facing_controls_->size(), Eq(2u));
+}
+
+TEST_F(ViewFacingControlsFixture, new_controls_are_turned_on_the_first_render) {
+  createControl();
+  createControl();
+
+  EXPECT_THAT(render(), ElementsAre(true, true));
+}
+
+TEST_F(ViewFacingControlsFixture, unchanged_controls_are_skipped) {
+  createControl();
+  createControl();
+  render();
+
+  EXPECT_THAT(render(), ElementsAre(false, false));
+}
+
+TEST_F(ViewFacingControlsFixture, only_invalidated_controls_are_turned_again) {
+  auto first = createControl();
+  createControl();
+  render();
+
+  view_facing_controls_->invalidate(first.get());
+
+  EXPECT_THAT(render(), ElementsAre(true, false));
+}
+
+TEST_F(ViewFacingControlsFixture, processing_a_message_again_invalidates_the_control) {
+  createControl();
+  auto second = createControl();
+  render();
+
+  second->processMessage(createMessage(InteractiveMarkerControlMsg::VIEW_FACING));
+
+  EXPECT_THAT(render(), ElementsAre(false, true));
+}
+
+TEST_F(ViewFacingControlsFixture, turning_the_camera_turns_all_controls) {
+  createControl();
+  createControl();
+  render();
+
+  camera_node_->yaw(Ogre::Degree(90));
+
+  EXPECT_THAT(render(), ElementsAre(true, true));
+}
+
+TEST_F(ViewFacingControlsFixture, turning_a_reference_frame_only_turns_its_controls) {
+  auto shared_reference_node = scene_manager_->getRootSceneNode()->createChildSceneNode();
+  createControl(shared_reference_node);
+  createControl();
+  createControl(shared_reference_node);
+  render();
+
+  shared_reference_node->roll(Ogre::Degree(90));
+
+  EXPECT_THAT(render(), ElementsAre(true, false, true));
+}
+
+TEST_F(ViewFacingControlsFixture, removing_a_control_keeps_the_indices_of_the_others_valid) {
+  auto first = createControl();
+  auto second = createControl();
+  auto third = createControl();
+  render();
+
+  // the last control is moved into the slot of the first one
+  first->processMessage(createMessage(InteractiveMarkerControlMsg::FIXED));
+  EXPECT_THAT(view_facing_controls_->size(), Eq(2u));
+
+  view_facing_controls_->invalidate(third.get());
+  EXPECT_THAT(render(), ElementsAre(false, false, true));
+
+  view_facing_controls_->invalidate(second.get());
+  EXPECT_THAT(render(), ElementsAre(false, true, false));
+
+  view_facing_controls_->invalidate(first.get());
+  EXPECT_THAT(render(), ElementsAre(false, false, false));
+}
+
+TEST_F(ViewFacingControlsFixture, removing_the_last_control_keeps_the_others) {
+  auto first = createControl();
+  auto second = createControl();
+  render();
+
+  view_facing_controls_->remove(second.get());
+  EXPECT_THAT(view_facing_controls_->size(), Eq(1u));
+
+  view_facing_controls_->invalidate(first.get());
+  view_facing_controls_->invalidate(second.get());
+  EXPECT_THAT(render(), ElementsAre(true, false));
+}
+
+TEST_F(ViewFacingControlsFixture, removing_an_unknown_control_does_nothing) {
+  auto first = createControl();
+  auto second = createControl();
+  view_facing_controls_->remove(second.get());
+
+  view_facing_controls_->remove(second.get());
+
+  EXPECT_THAT(view_facing_controls_->size(), Eq(1u));
+  EXPECT_THAT(render(), ElementsAre(true, false));
+}
+
+TEST_F(ViewFacingControlsFixture, destroying_a_control_removes_it) {
+  createControl();
+  auto second = createControl();
+  createControl();
+
+  controls_.erase(controls_.begin() + 1);
+  reference_nodes_.erase(reference_nodes_.begin() + 1);
+  second.reset();
+
+  EXPECT_THAT(view_facing_controls_->size(), Eq(2u));
+  EXPECT_THAT(render(), ElementsAre(true, true));
+}
+
+int main(int argc, char ** argv)
+{
+  QApplication app(argc, argv);
+  InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -36,9 +36,12 @@
 
 #include <OgreRoot.h>
 
+#include "rcl/time.h"
+
 #include "visualization_msgs/msg/marker.hpp"
 
 #include "rviz_common/display.hpp"
+#include "rviz_rendering/objects/text_batch.hpp"
 
 #include "rviz_default_plugins/displays/marker/marker_common.hpp"
 #include "rviz_default_plugins/displays/marker/markers/arrow_marker.hpp"
@@ -73,8 +76,25 @@ public:
     common_.reset();
   }
 
+  /// Hands out a ROS time clock whose time only moves when advanceClock() is called.
+  void useManualClock()
+  {
+    manual_clock_ = std::make_shared<rclcpp::Clock>(RCL_ROS_TIME);
+    rcl_enable_ros_time_override(manual_clock_->get_clock_handle());
+    rcl_set_ros_time_override(manual_clock_->get_clock_handle(), 1000000000);
+    EXPECT_CALL(*context_, getClock()).WillRepeatedly(Return(manual_clock_));
+  }
+
+  void advanceClock(const rclcpp::Duration & duration)
+  {
+    rcl_set_ros_time_override(
+      manual_clock_->get_clock_handle(),
+      (manual_clock_->now() + duration).nanoseconds());
+  }
+
   std::unique_ptr<rviz_default_plugins::displays::MarkerCommon> common_;
   std::unique_ptr<rviz_common::Display> display_;
+  std::shared_ptr<rclcpp::Clock> manual_clock_;
 };
 
 visualization_msgs::msg::Marker::SharedPtr createSharedPtrMessage(
@@ -357,11 +377,13 @@ TEST_F(MarkerCommonFixture, update_retransforms_frame_locked_messages) {
       SetArgReferee<3>(starting_position),
       SetArgReferee<4>(starting_orientation),
       Return(true)
-  ))
+  ));
+  // frame-locked markers are moved with the transform of their frame
+  EXPECT_CALL(*frame_manager_, getTransform(marker->header.frame_id, _, _, _))
   .WillOnce(
     DoAll(
-      SetArgReferee<3>(next_position),
-      SetArgReferee<4>(next_orientation),
+      SetArgReferee<2>(next_position),
+      SetArgReferee<3>(next_orientation),
       Return(true)));
 
   common_->processMessage(marker);
@@ -375,10 +397,80 @@ TEST_F(MarkerCommonFixture, update_retransforms_frame_locked_messages) {
 
   common_->update(0, 0);
 
-  EXPECT_THAT(pointCloud->getParentSceneNode()->getPosition(), Vector3Eq(next_position));
+  const auto & pose = marker->pose;
+  Ogre::Vector3 expected_position = next_position + next_orientation *
+    Ogre::Vector3(pose.position.x, pose.position.y, pose.position.z);
+  Ogre::Quaternion expected_orientation = next_orientation * Ogre::Quaternion(
+    pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+  expected_orientation.normalise();
+  EXPECT_THAT(pointCloud->getParentSceneNode()->getPosition(), Vector3Eq(expected_position));
   EXPECT_THAT(
     pointCloud->getParentSceneNode()->getOrientation(),
-    QuaternionEq(next_orientation));
+    QuaternionEq(expected_orientation));
+}
+
+TEST_F(MarkerCommonFixture, update_looks_up_the_frame_of_frame_locked_markers_once) {
+  mockValidTransform();
+  for (int id = 0; id < 3; ++id) {
+    auto marker = createSharedPtrMessage(
+      visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::POINTS, id);
+    marker->frame_locked = true;
+    common_->processMessage(marker);
+  }
+  Mock::VerifyAndClearExpectations(frame_manager_.get());
+
+  EXPECT_CALL(*frame_manager_, transform(_, _, _, _, _)).Times(0);  // NOLINT
+  EXPECT_CALL(*frame_manager_, getTransform(_, _, _, _))
+  .WillOnce(
+    DoAll(
+      SetArgReferee<2>(Ogre::Vector3(1, 2, 3)),
+      SetArgReferee<3>(Ogre::Quaternion::IDENTITY),
+      Return(true)));
+
+  common_->update(0, 0);
+
+  EXPECT_THAT(
+    rviz_default_plugins::findAllPointClouds(scene_manager_->getRootSceneNode()), SizeIs(3));
+}
+
+TEST_F(MarkerCommonFixture, update_removes_markers_once_their_lifetime_is_over) {
+  useManualClock();
+  mockValidTransform();
+  auto short_lived = createSharedPtrMessage(
+    visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::POINTS, 0);
+  short_lived->lifetime = rclcpp::Duration::from_nanoseconds(1000000);
+  auto long_lived = createSharedPtrMessage(
+    visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::POINTS, 1);
+  long_lived->lifetime = rclcpp::Duration::from_seconds(100);
+  common_->processMessage(short_lived);
+  common_->processMessage(long_lived);
+  EXPECT_THAT(
+    rviz_default_plugins::findAllPointClouds(scene_manager_->getRootSceneNode()), SizeIs(2));
+
+  advanceClock(rclcpp::Duration::from_seconds(1));
+  common_->update(0, 0);
+
+  EXPECT_THAT(
+    rviz_default_plugins::findAllPointClouds(scene_manager_->getRootSceneNode()), SizeIs(1));
+}
+
+TEST_F(MarkerCommonFixture, update_keeps_markers_whose_lifetime_was_renewed) {
+  useManualClock();
+  mockValidTransform();
+  auto marker = createSharedPtrMessage(
+    visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::POINTS, 0);
+  marker->lifetime = rclcpp::Duration::from_nanoseconds(1000000);
+  common_->processMessage(marker);
+
+  auto renewed = std::make_shared<visualization_msgs::msg::Marker>(*marker);
+  renewed->lifetime = rclcpp::Duration::from_seconds(100);
+  common_->processMessage(renewed);
+
+  advanceClock(rclcpp::Duration::from_seconds(1));
+  common_->update(0, 0);
+
+  EXPECT_THAT(
+    rviz_default_plugins::findAllPointClouds(scene_manager_->getRootSceneNode()), SizeIs(1));
 }
 
 TEST_F(MarkerCommonFixture, update_does_not_retransform_normal_messages) {
@@ -415,6 +507,154 @@ TEST_F(MarkerCommonFixture, update_does_not_retransform_normal_messages) {
     QuaternionEq(starting_orientation));
 }
 
+TEST_F(MarkerCommonFixture, update_skips_markers_whose_content_did_not_change) {
+  mockValidTransform();
+  auto marker = createSharedPtrMessage(
+    visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::POINTS);
+
+  common_->addMessage(marker);
+  common_->update(0, 0);
+  EXPECT_THAT(common_->getSkippedMarkerCount(), Eq(0u));
+
+  common_->addMessage(std::make_shared<visualization_msgs::msg::Marker>(*marker));
+  common_->update(0, 0);
+  EXPECT_THAT(common_->getSkippedMarkerCount(), Eq(1u));
+  ASSERT_TRUE(rviz_default_plugins::findOnePointCloud(scene_manager_->getRootSceneNode()));
+}
+
+TEST_F(MarkerCommonFixture, update_moves_text_markers_into_the_text_batch_while_enabled) {
+  mockValidTransform();
+  auto batch_text = display_->subProp("Batch Text");
+  batch_text->setValue(true);
+
+  common_->addMessage(
+    createSharedPtrMessage(
+      visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::TEXT_VIEW_FACING));
+  common_->update(0, 0);
+
+  ASSERT_TRUE(common_->getTextBatch());
+  EXPECT_THAT(common_->getTextBatch()->getLabelCount(), Eq(1u));
+  EXPECT_THAT(common_->getTextBatch()->getCaption(0), StrEq("Displaytext"));
+  EXPECT_FALSE(rviz_default_plugins::findOneMovableText(scene_manager_->getRootSceneNode()));
+
+  batch_text->setValue(false);
+  common_->update(0, 0);
+
+  EXPECT_FALSE(common_->getTextBatch());
+  auto text = rviz_default_plugins::findOneMovableText(scene_manager_->getRootSceneNode());
+  ASSERT_TRUE(text);
+  EXPECT_THAT(text->getCaption(), StrEq("Displaytext"));
+}
+
+TEST_F(MarkerCommonFixture, update_only_moves_markers_if_just_the_pose_changed) {
+  auto marker = createSharedPtrMessage(
+    visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::POINTS);
+
+  Ogre::Vector3 starting_position(1, 2, 3);
+  Ogre::Vector3 next_position(3, 4, 5);
+  Ogre::Quaternion orientation(0, 0, 1, 0);
+  EXPECT_CALL(
+    *frame_manager_,
+    transform(_, _, _, _, _))  // NOLINT
+  .WillOnce(
+    DoAll(
+      SetArgReferee<3>(starting_position),
+      SetArgReferee<4>(orientation),
+      Return(true)
+  ))
+  .WillOnce(
+    DoAll(
+      SetArgReferee<3>(next_position),
+      SetArgReferee<4>(orientation),
+      Return(true)));
+
+  common_->addMessage(marker);
+  common_->update(0, 0);
+  auto point_cloud = rviz_default_plugins::findOnePointCloud(scene_manager_->getRootSceneNode());
+  ASSERT_TRUE(point_cloud);
+  auto bounding_radius = point_cloud->getBoundingRadius();
+
+  auto moved_marker = std::make_shared<visualization_msgs::msg::Marker>(*marker);
+  moved_marker->pose.position.x += 2;
+  common_->addMessage(moved_marker);
+  common_->update(0, 0);
+
+  EXPECT_THAT(common_->getSkippedMarkerCount(), Eq(1u));
+  EXPECT_THAT(point_cloud->getParentSceneNode()->getPosition(), Vector3Eq(next_position));
+  EXPECT_THAT(point_cloud->getBoundingRadius(), FloatEq(bounding_radius));
+}
+
+TEST_F(MarkerCommonFixture, update_rebuilds_markers_whose_content_changed) {
+  mockValidTransform();
+  auto marker = createSharedPtrMessage(
+    visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::POINTS);
+
+  common_->addMessage(marker);
+  common_->update(0, 0);
+
+  auto recolored_marker = std::make_shared<visualization_msgs::msg::Marker>(*marker);
+  recolored_marker->color.r = 0.5f;
+  common_->addMessage(recolored_marker);
+  common_->update(0, 0);
+
+  EXPECT_THAT(common_->getSkippedMarkerCount(), Eq(0u));
+  auto point_cloud = rviz_default_plugins::findOnePointCloud(scene_manager_->getRootSceneNode());
+  ASSERT_TRUE(point_cloud);
+  EXPECT_THAT(point_cloud->getPoints()[0].color.r, FloatNear(0.5f, 1.0f / 255));
+}
+
+TEST_F(MarkerCommonFixture, update_applies_only_the_latest_queued_message_of_a_marker) {
+  EXPECT_CALL(*frame_manager_, transform(_, _, _, _, _))  // NOLINT
+  .Times(1)
+  .WillRepeatedly(Return(true));
+
+  for (auto const & text : {"first", "second", "third"}) {
+    auto marker = createSharedPtrMessage(
+      visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::TEXT_VIEW_FACING);
+    marker->text = text;
+    common_->addMessage(marker);
+  }
+  common_->update(0, 0);
+
+  auto text = rviz_default_plugins::findOneMovableText(scene_manager_->getRootSceneNode());
+  ASSERT_TRUE(text);
+  EXPECT_THAT(text->getCaption(), StrEq("third"));
+}
+
+TEST_F(MarkerCommonFixture, update_drops_queued_messages_before_a_deleteall) {
+  EXPECT_CALL(*frame_manager_, transform(_, _, _, _, _))  // NOLINT
+  .Times(1)
+  .WillRepeatedly(Return(true));
+
+  common_->addMessage(
+    createSharedPtrMessage(
+      visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::ARROW, 0));
+  common_->addMessage(
+    createSharedPtrMessage(
+      visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::ARROW, 1));
+  common_->addMessage(
+    createSharedPtrMessage(
+      visualization_msgs::msg::Marker::DELETEALL, visualization_msgs::msg::Marker::ARROW, 0));
+  common_->addMessage(
+    createSharedPtrMessage(
+      visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::ARROW, 2));
+  common_->update(0, 0);
+
+  EXPECT_THAT(rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode()), SizeIs(1));
+}
+
+TEST_F(MarkerCommonFixture, clearMarkers_drops_messages_which_were_not_applied_yet) {
+  EXPECT_CALL(*frame_manager_, transform(_, _, _, _, _)).Times(0);  // NOLINT
+
+  common_->addMessage(
+    createSharedPtrMessage(
+      visualization_msgs::msg::Marker::ADD, visualization_msgs::msg::Marker::ARROW, 0));
+  common_->clearMarkers();
+  common_->update(0, 0);
+
+  EXPECT_THAT(rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode()), IsEmpty());
+}
+
 TEST_F(MarkerCommonFixture, processMessage_adds_new_namespace_for_message) {
   mockValidTransform();
 
@@ -82,8 +82,8 @@ TEST_F(MarkersTestFixture, setMessage_sets_single_color_correctly) {
   auto point_cloud = rviz_default_plugins::findOnePointCloud(scene_manager_->getRootSceneNode());
 
   Ogre::ColourValue expected_color(0.0f, 1.0f, 1.0f, 1.0f);
-  EXPECT_THAT(point_cloud->getPoints()[0].color, Eq(expected_color));
-  EXPECT_THAT(point_cloud->getPoints()[1].color, Eq(expected_color));
+  EXPECT_THAT(point_cloud->getPoints()[0].color, ColourValueByteEq(expected_color));
+  EXPECT_THAT(point_cloud->getPoints()[1].color, ColourValueByteEq(expected_color));
 }
 
 TEST_F(MarkersTestFixture, setMessage_sets_per_point_color_correctly) {
@@ -93,6 +93,8 @@ TEST_F(MarkersTestFixture, setMessage_sets_per_point_color_correctly) {
   marker_->setMessage(createMessageWithColorPerPoint(visualization_msgs::msg::Marker::POINTS));
   auto point_cloud = rviz_default_plugins::findOnePointCloud(scene_manager_->getRootSceneNode());
 
-  EXPECT_THAT(point_cloud->getPoints()[0].color, Eq(Ogre::ColourValue(1.0f, 0.0f, 0.5f, 0.5f)));
-  EXPECT_THAT(point_cloud->getPoints()[1].color, Eq(Ogre::ColourValue(0.5f, 0.6f, 0.0f, 0.3f)));
+  EXPECT_THAT(
+    point_cloud->getPoints()[0].color, ColourValueByteEq(Ogre::ColourValue(1.0f, 0.0f, 0.5f, 0.5f)));
+  EXPECT_THAT(
+    point_cloud->getPoints()[1].color, ColourValueByteEq(Ogre::ColourValue(0.5f, 0.6f, 0.0f, 0.3f)));
 }
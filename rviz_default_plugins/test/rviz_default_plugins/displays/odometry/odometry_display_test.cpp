@@ -38,6 +38,7 @@
 #include <OgreRoot.h>
 
 #include "rviz_common/properties/enum_property.hpp"
+#include "rviz_common/properties/int_property.hpp"
 
 #include "rviz_default_plugins/displays/odometry/odometry_display.hpp"
 #include "../display_test_fixture.hpp"
@@ -101,6 +102,40 @@ std::array<double, 36> getCovariances3D()
   std::unique_ptr<rviz_default_plugins::displays::OdometryDisplay> display_;
 };
 
+// arrow heads are cones, arrow shafts and axes are cylinders
+size_t countCones(Ogre::SceneNode * scene_node)
+{
+  return rviz_default_plugins::countShapeBatchInstances(scene_node, rviz_rendering::Shape::Cone);
+}
+
+size_t countCylinders(Ogre::SceneNode * scene_node)
+{
+  return rviz_default_plugins::countShapeBatchInstances(
+    scene_node, rviz_rendering::Shape::Cylinder);
+}
+
+rviz_rendering::ShapeBatch * findArrowHeads(Ogre::SceneNode * scene_node)
+{
+  auto cones = rviz_default_plugins::findAllShapeBatches(scene_node, rviz_rendering::Shape::Cone);
+  return cones.empty() ? nullptr : cones[0];
+}
+
+// the shafts share the scene node of their arrow batch with the heads, the axes do not
+rviz_rendering::ShapeBatch * findCylinders(Ogre::SceneNode * scene_node, bool arrow_shafts)
+{
+  auto heads = findArrowHeads(scene_node);
+  for (auto batch : rviz_default_plugins::findAllShapeBatches(
+      scene_node, rviz_rendering::Shape::Cylinder))
+  {
+    bool is_arrow_shaft = heads &&
+      batch->getSceneNode()->getParentSceneNode() == heads->getSceneNode()->getParentSceneNode();
+    if (is_arrow_shaft == arrow_shafts) {
+      return batch;
+    }
+  }
+  return nullptr;
+}
+
 TEST_F(OdometryDisplayFixture, processMessage_returns_early_if_message_has_invalid_floats) {
   // to be sure that the early return is due to the message and not to the missing transform
   mockValidTransform();
@@ -109,10 +144,8 @@ TEST_F(OdometryDisplayFixture, processMessage_returns_early_if_message_has_inval
 
   display_->processMessage(invalid_pose_message);
 
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(arrows, IsEmpty());
-  EXPECT_THAT(axes, IsEmpty());
+  EXPECT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(0u));
+  EXPECT_THAT(countCylinders(scene_manager_->getRootSceneNode()), Eq(0u));
 }
 
 TEST_F(OdometryDisplayFixture, processMessage_returns_early_if_message_has_invalid_quaternions) {
@@ -123,10 +156,8 @@ TEST_F(OdometryDisplayFixture, processMessage_returns_early_if_message_has_inval
 
   display_->processMessage(invalid_orientation_message);
 
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(arrows, IsEmpty());
-  EXPECT_THAT(axes, IsEmpty());
+  EXPECT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(0u));
+  EXPECT_THAT(countCylinders(scene_manager_->getRootSceneNode()), Eq(0u));
 }
 
 TEST_F(OdometryDisplayFixture, processMessage_returns_early_if_transform_is_missing) {
@@ -135,10 +166,8 @@ TEST_F(OdometryDisplayFixture, processMessage_returns_early_if_transform_is_miss
 
   display_->processMessage(odometry_message);
 
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(arrows, IsEmpty());
-  EXPECT_THAT(axes, IsEmpty());
+  EXPECT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(0u));
+  EXPECT_THAT(countCylinders(scene_manager_->getRootSceneNode()), Eq(0u));
 }
 
 TEST_F(
@@ -147,19 +176,14 @@ TEST_F(
   mockValidTransform();
   auto odometry_message = createOdometryMessage();
   display_->processMessage(odometry_message);
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  ASSERT_THAT(arrows, SizeIs(1));
-  ASSERT_THAT(axes, SizeIs(1));
-  arrows[0]->removeAllChildren();
-  axes[0]->removeAllChildren();
+  // one arrow shaft and three axes
+  ASSERT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(1u));
+  ASSERT_THAT(countCylinders(scene_manager_->getRootSceneNode()), Eq(4u));
 
   display_->processMessage(odometry_message);
 
-  arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(arrows, IsEmpty());
-  EXPECT_THAT(axes, IsEmpty());
+  EXPECT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(1u));
+  EXPECT_THAT(countCylinders(scene_manager_->getRootSceneNode()), Eq(4u));
 }
 
 TEST_F(OdometryDisplayFixture, processMessage_sets_arrow_and_axes_according_to_message) {
@@ -172,14 +196,19 @@ TEST_F(OdometryDisplayFixture, processMessage_sets_arrow_and_axes_according_to_m
 
   display_->processMessage(odometry_message);
 
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  ASSERT_THAT(arrows, SizeIs(1));
-  ASSERT_THAT(axes, SizeIs(1));
-  EXPECT_THAT(arrows[0]->getPosition(), Vector3Eq(Ogre::Vector3(0, 1, 0)));
-  EXPECT_THAT(arrows[0]->getOrientation(), QuaternionEq(effective_arrow_orientation));
-  EXPECT_THAT(axes[0]->getPosition(), Vector3Eq(Ogre::Vector3(0, 1, 0)));
-  EXPECT_THAT(axes[0]->getOrientation(), QuaternionEq(Ogre::Quaternion(0, 0, 1, 0)));
+  auto shafts = findCylinders(scene_manager_->getRootSceneNode(), true);
+  auto axes = findCylinders(scene_manager_->getRootSceneNode(), false);
+  ASSERT_THAT(shafts, NotNull());
+  ASSERT_THAT(axes, NotNull());
+  ASSERT_THAT(shafts->getInstances(), SizeIs(1));
+  ASSERT_THAT(axes->getInstances(), SizeIs(3));
+  // shafts and x axes are centered half their length away from the pose
+  EXPECT_THAT(
+    shafts->getInstances()[0].transform.getTrans(),
+    Vector3Eq(Ogre::Vector3(0, 1, 0) + effective_arrow_orientation * Ogre::Vector3(0, 0.5f, 0)));
+  EXPECT_THAT(
+    axes->getInstances()[0].transform.getTrans(),
+    Vector3Eq(Ogre::Vector3(0, 1, 0) + Ogre::Quaternion(0, 0, 1, 0) * Ogre::Vector3(0.5f, 0, 0)));
 }
 
 TEST_F(
@@ -191,23 +220,39 @@ TEST_F(
 
   display_->processMessage(odometry_message);
 
-  EXPECT_TRUE(
-    rviz_default_plugins::arrowIsVisible(
-      rviz_default_plugins::findOneArrow(scene_manager_->getRootSceneNode())));
-  EXPECT_FALSE(
-    rviz_default_plugins::axesAreVisible(
-      rviz_default_plugins::findOneAxes(scene_manager_->getRootSceneNode())));
+  auto heads = findArrowHeads(scene_manager_->getRootSceneNode());
+  auto axes = findCylinders(scene_manager_->getRootSceneNode(), false);
+  ASSERT_THAT(heads, NotNull());
+  ASSERT_THAT(axes, NotNull());
+  EXPECT_TRUE(heads->getRenderable()->isVisible());
+  EXPECT_FALSE(axes->getRenderable()->isVisible());
 
   shape_property->setString("Axes");
   odometry_message->pose.pose.position.x = 35;
   display_->processMessage(odometry_message);
 
-  EXPECT_FALSE(
-    rviz_default_plugins::arrowIsVisible(
-      rviz_default_plugins::findOneArrow(scene_manager_->getRootSceneNode())));
-  EXPECT_TRUE(
-    rviz_default_plugins::axesAreVisible(
-      rviz_default_plugins::findOneAxes(scene_manager_->getRootSceneNode())));
+  EXPECT_FALSE(heads->getRenderable()->isVisible());
+  EXPECT_TRUE(axes->getRenderable()->isVisible());
+  EXPECT_THAT(axes->getInstances(), SizeIs(6));
+}
+
+TEST_F(OdometryDisplayFixture, update_keeps_only_the_newest_poses) {
+  mockValidTransform();
+  auto keep_property = static_cast<rviz_common::properties::IntProperty *>(display_->childAt(3));
+  ASSERT_THAT(keep_property->getNameStd(), StrEq("Keep"));
+  keep_property->setInt(2);
+
+  auto odometry_message = createOdometryMessage();
+  for (int i = 0; i < 3; ++i) {
+    odometry_message->pose.pose.position.x = 10.0 * i;
+    display_->processMessage(odometry_message);
+  }
+  ASSERT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(3u));
+
+  display_->update(0, 0);
+
+  EXPECT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(2u));
+  EXPECT_THAT(countCylinders(scene_manager_->getRootSceneNode()), Eq(8u));
 }
 
 TEST_F(OdometryDisplayFixture, processMessage_sets_covariance_visual_according_to_message) {
@@ -240,4 +285,6 @@ TEST_F(OdometryDisplayFixture, reset_clears_all_objects) {
   EXPECT_THAT(all_spheres, SizeIs(0));
   EXPECT_THAT(all_cylynders, SizeIs(0));
   EXPECT_THAT(all_cones, SizeIs(0));
+  EXPECT_THAT(countCones(scene_manager_->getRootSceneNode()), Eq(0u));
+  EXPECT_THAT(countCylinders(scene_manager_->getRootSceneNode()), Eq(0u));
 }
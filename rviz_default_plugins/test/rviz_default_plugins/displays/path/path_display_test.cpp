@@ -39,7 +39,7 @@
 #include <OgreManualObject.h>
 
 #include "visualization_msgs/msg/marker.hpp"
-#include "rviz_rendering/objects/arrow.hpp"
+#include "rviz_rendering/objects/shape_batch.hpp"
 #include "rviz_rendering/objects/shape.hpp"
 #include "../../scene_graph_introspection.hpp"
 
@@ -147,10 +147,15 @@ TEST_F(PathTestFixture, reset_removes_all_axes) {
   mockValidTransform(position, orientation);
 
   path_display_->processMessage(createPathMessage());
-  EXPECT_THAT(rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode()), SizeIs(2));
+  // three cylinders per pose
+  EXPECT_THAT(
+    rviz_default_plugins::countShapeBatchInstances(
+      scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cylinder), Eq(6u));
 
   path_display_->reset();
-  EXPECT_THAT(rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode()), SizeIs(0));
+  EXPECT_THAT(
+    rviz_default_plugins::countShapeBatchInstances(
+      scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cylinder), Eq(0u));
 }
 
 TEST_F(PathTestFixture, reset_removes_all_arrows) {
@@ -161,10 +166,14 @@ TEST_F(PathTestFixture, reset_removes_all_arrows) {
   mockValidTransform(position, orientation);
 
   path_display_->processMessage(createPathMessage());
-  EXPECT_THAT(rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode()), SizeIs(2));
+  EXPECT_THAT(
+    rviz_default_plugins::countShapeBatchInstances(
+      scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cone), Eq(2u));
 
   path_display_->reset();
-  EXPECT_THAT(rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode()), SizeIs(0));
+  EXPECT_THAT(
+    rviz_default_plugins::countShapeBatchInstances(
+      scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cone), Eq(0u));
 }
 
 TEST_F(PathTestFixture, processMessage_transforms_the_vertices_correctly) {
@@ -191,12 +200,15 @@ TEST_F(PathTestFixture, processMessage_adds_billboard_line_to_scene) {
 
   path_display_->processMessage(createPathMessage());
 
-  auto object = rviz_default_plugins::findOneBillboardChain(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(object->getNumberOfChains(), Eq(1u));
-  EXPECT_THAT(object->getNumChainElements(0), Eq(2u));
+  auto object = rviz_default_plugins::findOneThickLine(scene_manager_->getRootSceneNode());
+  object->updateBuffers();
+  EXPECT_THAT(object->getSegmentCount(), Eq(1u));
 
-  EXPECT_THAT(object->getChainElement(0, 0).position, Vector3Eq(Ogre::Vector3(4, 2, 0)));
-  EXPECT_THAT(object->getChainElement(0, 1).position, Vector3Eq(Ogre::Vector3(1, 1, 1)));
+  // Use bounding box to indirectly assert the vertices, the line is 0.03 wide
+  EXPECT_THAT(
+    object->getBoundingBox().getMinimum(), Vector3Eq(Ogre::Vector3(0.985f, 0.985f, -0.015f)));
+  EXPECT_THAT(
+    object->getBoundingBox().getMaximum(), Vector3Eq(Ogre::Vector3(4.015f, 2.015f, 1.015f)));
 }
 
 TEST_F(PathTestFixture, processMessage_adds_axes_to_scene) {
@@ -208,12 +220,17 @@ TEST_F(PathTestFixture, processMessage_adds_axes_to_scene) {
 
   path_display_->processMessage(createPathMessage());
 
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(axes, SizeIs(2));
-
-  auto axes_positions = rviz_default_plugins::getPositionsFromNodes(axes);
-  EXPECT_THAT(axes_positions, Contains(Vector3Eq(Ogre::Vector3(4, 2, 0))));
-  EXPECT_THAT(axes_positions, Contains(Vector3Eq(Ogre::Vector3(1, 1, 1))));
+  auto axes = rviz_default_plugins::findAllShapeBatches(
+    scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cylinder);
+  ASSERT_THAT(axes, SizeIs(1));
+  ASSERT_THAT(axes[0]->getInstances(), SizeIs(6));
+
+  // the z axes are centered half the default length of 0.3 above the poses
+  std::vector<Ogre::Vector3> z_axis_positions = {
+    axes[0]->getInstances()[2].transform.getTrans(),
+    axes[0]->getInstances()[5].transform.getTrans()};
+  EXPECT_THAT(z_axis_positions, Contains(Vector3Eq(Ogre::Vector3(4, 2, 0.15f))));
+  EXPECT_THAT(z_axis_positions, Contains(Vector3Eq(Ogre::Vector3(1, 1, 1.15f))));
 }
 
 TEST_F(PathTestFixture, processMessage_adds_arrows_to_scene) {
@@ -225,15 +242,16 @@ TEST_F(PathTestFixture, processMessage_adds_arrows_to_scene) {
 
   path_display_->processMessage(createPathMessage());
 
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(arrows, SizeIs(2));
-
-  auto arrow_positions = rviz_default_plugins::getPositionsFromNodes(arrows);
-  EXPECT_THAT(arrow_positions, Contains(Vector3Eq(Ogre::Vector3(1, 1, 1))));
-  EXPECT_THAT(arrow_positions, Contains(Vector3Eq(Ogre::Vector3(4, 2, 0))));
-
-  // default orientation is set to (0.5, -0.5, -0.5, -0.5) by arrow
-  auto default_orientation = Ogre::Quaternion(0.5f, -0.5f, -0.5f, -0.5f);
-  auto arrow_orientations = rviz_default_plugins::getOrientationsFromNodes(arrows);
-  EXPECT_THAT(arrow_orientations, Each(QuaternionEq(default_orientation)));
+  auto shafts = rviz_default_plugins::findAllShapeBatches(
+    scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cylinder);
+  ASSERT_THAT(shafts, SizeIs(1));
+  ASSERT_THAT(shafts[0]->getInstances(), SizeIs(2));
+
+  // the arrows point along x, so the shafts are centered half the default length of 0.1 in
+  // front of the poses
+  std::vector<Ogre::Vector3> shaft_positions = {
+    shafts[0]->getInstances()[0].transform.getTrans(),
+    shafts[0]->getInstances()[1].transform.getTrans()};
+  EXPECT_THAT(shaft_positions, Contains(Vector3Eq(Ogre::Vector3(1.05f, 1, 1))));
+  EXPECT_THAT(shaft_positions, Contains(Vector3Eq(Ogre::Vector3(4.05f, 2, 0))));
 }
@@ -0,0 +1,242 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <QObject>  // NOLINT cpplint cannot handle include order
+
+#include "nav_msgs/msg/occupancy_grid.hpp"
+#include "rcutils/allocator.h"
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "sensor_msgs/msg/point_cloud2.hpp"
+
+#include "rviz_default_plugins/displays/map/map_display.hpp"
+#include "rviz_default_plugins/displays/pointcloud/point_cloud2_display.hpp"
+#include "../pointcloud_messages.hpp"
+#include "./display_test_fixture.hpp"
+
+using namespace ::testing;  // NOLINT
+
+// Counts the heap allocations which are at least as large as the message payload. Smaller
+// allocations for headers, fields and bookkeeping are not counted, only copies of the payload
+// are that large.
+namespace
+{
+std::atomic<size_t> payload_size_threshold{std::numeric_limits<size_t>::max()};
+std::atomic<size_t> payload_allocations{0};
+
+void countAllocation(size_t size)
+{
+  if (size >= payload_size_threshold) {
+    ++payload_allocations;
+  }
+}
+
+class PayloadAllocationCounter
+{
+public:
+  explicit PayloadAllocationCounter(size_t payload_size)
+  {
+    payload_allocations = 0;
+    payload_size_threshold = payload_size;
+  }
+
+  ~PayloadAllocationCounter()
+  {
+    payload_size_threshold = std::numeric_limits<size_t>::max();
+  }
+
+  size_t count() const
+  {
+    return payload_allocations;
+  }
+};
+
+// rcutils allocator for serialized messages, which are not allocated with operator new.
+rcutils_allocator_t getCountingAllocator()
+{
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  allocator.allocate = [](size_t size, void *) {
+      countAllocation(size);
+      return std::malloc(size);
+    };
+  allocator.reallocate = [](void * pointer, size_t size, void *) {
+      countAllocation(size);
+      return std::realloc(pointer, size);
+    };
+  allocator.zero_allocate = [](size_t number_of_elements, size_t size_of_element, void *) {
+      countAllocation(number_of_elements * size_of_element);
+      return std::calloc(number_of_elements, size_of_element);
+    };
+  allocator.deallocate = [](void * pointer, void *) {std::free(pointer);};
+  return allocator;
+}
+}  // namespace
+
+void * operator new(std::size_t size)
+{
+  countAllocation(size);
+  void * pointer = std::malloc(size == 0 ? 1 : size);
+  if (!pointer) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void * pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void * pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+sensor_msgs::msg::PointCloud2::SharedPtr createDenseCloud()
+{
+  std::vector<rviz_default_plugins::Point> points;
+  for (int i = 0; i < 100000; ++i) {
+    points.emplace_back(i * 0.01f, i * 0.02f, 1.0f);
+  }
+  return rviz_default_plugins::createPointCloud2WithPoints(points);
+}
+
+nav_msgs::msg::OccupancyGrid::SharedPtr createMap()
+{
+  auto map = std::make_shared<nav_msgs::msg::OccupancyGrid>();
+  map->header.frame_id = "map_frame";
+  map->info.width = 1000;
+  map->info.height = 1000;
+  map->info.resolution = 0.05f;
+  map->info.origin.orientation.w = 1;
+  map->data.assign(map->info.width * map->info.height, 50);
+  return map;
+}
+
+class PayloadAllocationTestFixture : public DisplayTestFixture
+{
+};
+
+#ifdef _WIN32
+// Replacing operator new does not reach allocations made inside other DLLs.
+# define SKIP_ON_WINDOWS() GTEST_SKIP()
+#else
+# define SKIP_ON_WINDOWS()
+#endif
+
+TEST_F(PayloadAllocationTestFixture, dense_point_cloud_is_filtered_without_copying_the_payload) {
+  SKIP_ON_WINDOWS();
+  auto cloud = createDenseCloud();
+  rviz_default_plugins::displays::PointCloud2Display display;
+
+  PayloadAllocationCounter counter(cloud->data.size());
+  auto filtered = display.filterOutInvalidPoints(cloud);
+
+  EXPECT_THAT(counter.count(), Eq(0u));
+  EXPECT_THAT(filtered.get(), Eq(cloud.get()));
+}
+
+TEST_F(PayloadAllocationTestFixture, point_cloud_with_an_invalid_point_is_copied_once) {
+  SKIP_ON_WINDOWS();
+  auto cloud = createDenseCloud();
+  const float nan = std::nanf("");
+  std::memcpy(&cloud->data[cloud->point_step * 10], &nan, sizeof(float));
+  rviz_default_plugins::displays::PointCloud2Display display;
+
+  PayloadAllocationCounter counter(cloud->data.size());
+  auto filtered = display.filterOutInvalidPoints(cloud);
+
+  EXPECT_THAT(counter.count(), Eq(1u));
+  EXPECT_THAT(filtered->width, Eq(cloud->width - 1));
+}
+
+TEST_F(PayloadAllocationTestFixture, map_is_kept_without_copying_the_payload) {
+  SKIP_ON_WINDOWS();
+  auto map_display = std::make_shared<rviz_default_plugins::displays::MapDisplay>(context_.get());
+  // Only measure keeping the message, showMap() uploads the map into textures.
+  QObject::disconnect(
+    map_display.get(), SIGNAL(mapUpdated()), map_display.get(), SLOT(showMap()));
+  auto map = createMap();
+
+  PayloadAllocationCounter counter(map->data.size());
+  map_display->processMessage(map);
+
+  EXPECT_THAT(counter.count(), Eq(0u));
+}
+
+// The displays need the typed message. Taking a SerializedMessage instead of the typed
+// message does not avoid the payload allocation done by deserialization, it adds the
+// allocation of the serialized buffer.
+TEST_F(PayloadAllocationTestFixture, typed_subscription_allocates_the_payload_once) {
+  SKIP_ON_WINDOWS();
+  rclcpp::Serialization<sensor_msgs::msg::PointCloud2> serialization;
+  auto cloud = createDenseCloud();
+  rclcpp::SerializedMessage serialized;
+  serialization.serialize_message(cloud.get(), &serialized);
+
+  PayloadAllocationCounter counter(cloud->data.size());
+  // What the rmw layer does for a typed subscription.
+  sensor_msgs::msg::PointCloud2 taken;
+  serialization.deserialize_message(&serialized, &taken);
+
+  EXPECT_THAT(counter.count(), Eq(1u));
+}
+
+TEST_F(PayloadAllocationTestFixture, serialized_subscription_allocates_the_payload_twice) {
+  SKIP_ON_WINDOWS();
+  rclcpp::Serialization<sensor_msgs::msg::PointCloud2> serialization;
+  auto cloud = createDenseCloud();
+  rclcpp::SerializedMessage serialized;
+  serialization.serialize_message(cloud.get(), &serialized);
+
+  PayloadAllocationCounter counter(cloud->data.size());
+  // What the rmw layer does for a serialized subscription: copy into a new buffer.
+  rclcpp::SerializedMessage taken(serialized.size(), getCountingAllocator());
+  auto & taken_message = taken.get_rcl_serialized_message();
+  std::memcpy(
+    taken_message.buffer, serialized.get_rcl_serialized_message().buffer, serialized.size());
+  taken_message.buffer_length = serialized.size();
+  // What the display then has to do to get the typed message.
+  sensor_msgs::msg::PointCloud2 deserialized;
+  serialization.deserialize_message(&taken, &deserialized);
+
+  EXPECT_THAT(counter.count(), Eq(2u));
+}
@@ -0,0 +1,286 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_file_reader.hpp"
+#include "rviz_default_plugins/displays/point_cloud_map/point_cloud_octree.hpp"
+
+using namespace rviz_default_plugins::displays;  // NOLINT
+using namespace ::testing;  // NOLINT
+
+namespace
+{
+
+std::vector<OctreeFilePoint> createGrid(int size)
+{
+  std::vector<OctreeFilePoint> points;
+  for (int x = 0; x < size; ++x) {
+    for (int y = 0; y < size; ++y) {
+      for (int z = 0; z < size; ++z) {
+        points.push_back(
+          {static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), 10, 20, 30, 255});
+      }
+    }
+  }
+  return points;
+}
+
+std::string writeTemporaryFile(const std::string & name, const std::string & content)
+{
+  std::string path = testing::TempDir() + name;
+  std::ofstream file(path, std::ios::binary);
+  file << content;
+  return path;
+}
+
+std::string serialize(const OctreeFileHeader & header, const std::vector<OctreeFileNode> & nodes)
+{
+  std::string content(reinterpret_cast<const char *>(&header), sizeof(header));
+  content.append(
+    reinterpret_cast<const char *>(nodes.data()), nodes.size() * sizeof(OctreeFileNode));
+  return content;
+}
+
+OctreeFileHeader createHeader(uint32_t node_count)
+{
+  OctreeFileHeader header{};
+  std::memcpy(header.magic, "RVIZOCT", sizeof(header.magic));
+  header.version = 1;
+  header.node_count = node_count;
+  header.nodes_offset = sizeof(OctreeFileHeader);
+  header.points_offset = sizeof(OctreeFileHeader) + node_count * sizeof(OctreeFileNode);
+  return header;
+}
+
+bool isInside(const OctreeFilePoint & point, const OctreeFileNode & node)
+{
+  const float tolerance = 1e-4f;
+  return std::abs(point.x - node.center[0]) <= node.half_size + tolerance &&
+         std::abs(point.y - node.center[1]) <= node.half_size + tolerance &&
+         std::abs(point.z - node.center[2]) <= node.half_size + tolerance;
+}
+
+}  // namespace
+
+TEST(PointCloudOctreeBuilder, keeps_small_clouds_in_a_single_node) {
+  PointCloudOctreeBuilder builder(1000, 16);
+  builder.build(createGrid(5));
+
+  ASSERT_THAT(builder.getNodes(), SizeIs(1u));
+  EXPECT_THAT(builder.getNodes()[0].point_count, Eq(125u));
+  EXPECT_THAT(builder.getPoints(), SizeIs(125u));
+}
+
+TEST(PointCloudOctreeBuilder, splits_large_clouds_and_keeps_every_point_exactly_once) {
+  PointCloudOctreeBuilder builder(500, 4);
+  builder.build(createGrid(20));
+
+  const auto & nodes = builder.getNodes();
+  ASSERT_THAT(nodes.size(), Gt(1u));
+
+  uint64_t point_count = 0;
+  for (const auto & node : nodes) {
+    point_count += node.point_count;
+    EXPECT_THAT(node.point_count, Le(500u));
+    for (uint32_t i = 0; i < node.point_count; ++i) {
+      EXPECT_TRUE(isInside(builder.getPoints()[node.first_point + i], node));
+    }
+    for (uint32_t child : node.children) {
+      if (child != 0) {
+        EXPECT_THAT(nodes[child].depth, Eq(node.depth + 1));
+        EXPECT_THAT(nodes[child].half_size, FloatEq(node.half_size / 2));
+      }
+    }
+  }
+  EXPECT_THAT(point_count, Eq(8000u));
+}
+
+TEST(PointCloudOctree, reads_the_nodes_and_points_written_by_the_builder) {
+  PointCloudOctreeBuilder builder(500, 4);
+  builder.build(createGrid(20));
+  std::string path = testing::TempDir() + "point_cloud_octree_test.octree";
+  std::string error;
+  ASSERT_TRUE(builder.write(path, error)) << error;
+
+  PointCloudOctree octree;
+  ASSERT_TRUE(octree.open(path, error)) << error;
+  ASSERT_THAT(octree.getNodeCount(), Eq(builder.getNodes().size()));
+  EXPECT_THAT(octree.getPointCount(), Eq(8000u));
+
+  for (uint32_t i = 0; i < octree.getNodeCount(); ++i) {
+    const auto & node = octree.getNode(i);
+    const auto & expected_node = builder.getNodes()[i];
+    ASSERT_THAT(node.point_count, Eq(expected_node.point_count));
+    const OctreeFilePoint * points = octree.getPoints(node);
+    for (uint32_t j = 0; j < node.point_count; ++j) {
+      EXPECT_THAT(points[j].x, FloatEq(builder.getPoints()[expected_node.first_point + j].x));
+      EXPECT_THAT(points[j].g, Eq(20));
+    }
+  }
+
+  octree.close();
+  std::remove(path.c_str());
+}
+
+TEST(PointCloudOctree, rejects_files_which_are_no_octree) {
+  std::string path = writeTemporaryFile("not_an_octree.octree", "definitely not an octree");
+  PointCloudOctree octree;
+  std::string error;
+
+  EXPECT_FALSE(octree.open(path, error));
+  EXPECT_FALSE(octree.isOpen());
+  EXPECT_THAT(error, Not(IsEmpty()));
+  std::remove(path.c_str());
+}
+
+TEST(PointCloudFileReader, reads_ascii_pcd_files_with_packed_color) {
+  std::string path = writeTemporaryFile(
+    "ascii.pcd",
+    "# .PCD v0.7 - Point Cloud Data file format\n"
+    "VERSION 0.7\n"
+    "FIELDS x y z rgb\n"
+    "SIZE 4 4 4 4\n"
+    "TYPE F F F U\n"
+    "COUNT 1 1 1 1\n"
+    "WIDTH 2\n"
+    "HEIGHT 1\n"
+    "VIEWPOINT 0 0 0 1 0 0 0\n"
+    "POINTS 2\n"
+    "DATA ascii\n"
+    "1 2 3 16711680\n"
+    "4 5 6 255\n");
+  std::vector<OctreeFilePoint> points;
+  std::string error;
+
+  ASSERT_TRUE(readPointCloudFile(path, points, error)) << error;
+  ASSERT_THAT(points, SizeIs(2u));
+  EXPECT_THAT(points[0].x, FloatEq(1));
+  EXPECT_THAT(points[0].z, FloatEq(3));
+  EXPECT_THAT(points[0].r, Eq(255));
+  EXPECT_THAT(points[0].b, Eq(0));
+  EXPECT_THAT(points[1].y, FloatEq(5));
+  EXPECT_THAT(points[1].b, Eq(255));
+  std::remove(path.c_str());
+}
+
+TEST(PointCloudFileReader, reads_ascii_ply_files_with_color_properties) {
+  std::string path = writeTemporaryFile(
+    "ascii.ply",
+    "ply\n"
+    "format ascii 1.0\n"
+    "element vertex 2\n"
+    "property float x\n"
+    "property float y\n"
+    "property float z\n"
+    "property uchar red\n"
+    "property uchar green\n"
+    "property uchar blue\n"
+    "end_header\n"
+    "1 2 3 10 20 30\n"
+    "4 5 6 40 50 60\n");
+  std::vector<OctreeFilePoint> points;
+  std::string error;
+
+  ASSERT_TRUE(readPointCloudFile(path, points, error)) << error;
+  ASSERT_THAT(points, SizeIs(2u));
+  EXPECT_THAT(points[1].x, FloatEq(4));
+  EXPECT_THAT(points[1].r, Eq(40));
+  EXPECT_THAT(points[1].b, Eq(60));
+  EXPECT_THAT(points[1].a, Eq(255));
+  std::remove(path.c_str());
+}
+
+TEST(PointCloudFileReader, fails_for_unknown_file_extensions) {
+  std::vector<OctreeFilePoint> points;
+  std::string error;
+
+  EXPECT_FALSE(readPointCloudFile("map.xyz", points, error));
+  EXPECT_THAT(error, Not(IsEmpty()));
+}
+
+TEST(PointCloudOctree, rejects_files_whose_nodes_reference_themselves_as_child) {
+  std::vector<OctreeFileNode> nodes(2);
+  nodes[0].children[0] = 1;
+  nodes[1].children[3] = 1;
+  std::string path = writeTemporaryFile(
+    "self_referencing.octree", serialize(createHeader(2), nodes));
+  PointCloudOctree octree;
+  std::string error;
+
+  EXPECT_FALSE(octree.open(path, error));
+  EXPECT_FALSE(octree.isOpen());
+  EXPECT_THAT(error, HasSubstr("invalid child"));
+  std::remove(path.c_str());
+}
+
+TEST(PointCloudOctree, rejects_files_whose_point_range_overflows) {
+  std::vector<OctreeFileNode> nodes(1);
+  nodes[0].first_point = std::numeric_limits<uint64_t>::max();
+  nodes[0].point_count = 1;
+  std::string path = writeTemporaryFile("overflowing.octree", serialize(createHeader(1), nodes));
+  PointCloudOctree octree;
+  std::string error;
+
+  EXPECT_FALSE(octree.open(path, error));
+  EXPECT_THAT(error, HasSubstr("outside of the file"));
+  std::remove(path.c_str());
+}
+
+TEST(PointCloudOctree, rejects_files_whose_sections_are_misaligned_or_overlap_the_header) {
+  std::vector<OctreeFileNode> nodes(1);
+  auto misaligned = createHeader(1);
+  misaligned.nodes_offset += 4;
+  misaligned.points_offset += 4;
+  std::string content = serialize(misaligned, nodes);
+  content.insert(sizeof(OctreeFileHeader), 4, '\0');
+  auto overlapping = createHeader(1);
+  overlapping.nodes_offset = 0;
+  std::string misaligned_path = writeTemporaryFile("misaligned.octree", content);
+  std::string overlapping_path =
+    writeTemporaryFile("overlapping.octree", serialize(overlapping, nodes));
+  PointCloudOctree octree;
+  std::string error;
+
+  EXPECT_FALSE(octree.open(misaligned_path, error));
+  EXPECT_THAT(error, HasSubstr("misaligned"));
+  EXPECT_FALSE(octree.open(overlapping_path, error));
+  EXPECT_THAT(error, HasSubstr("misaligned"));
+  std::remove(misaligned_path.c_str());
+  std::remove(overlapping_path.c_str());
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include "rviz_default_plugins/displays/pointcloud/point_cloud_downsampler.hpp"
+
+using namespace rviz_default_plugins;  // NOLINT
+using namespace ::testing;  // NOLINT
+
+namespace
+{
+
+V_PointCloudPoint createPoints(const std::vector<Ogre::Vector3> & positions)
+{
+  V_PointCloudPoint points;
+  for (const auto & position : positions) {
+    points.push_back({position, Ogre::ColourValue(1, 1, 1)});
+  }
+  return points;
+}
+
+}  // namespace
+
+TEST(PointCloudDownsampler, does_not_filter_if_mode_is_none) {
+  PointCloudDownsampler downsampler;
+  auto points = createPoints({{0, 0, 0}, {0, 0, 0}, {1, 1, 1}});
+  std::vector<uint32_t> kept_indices;
+
+  EXPECT_FALSE(downsampler.filter(points, kept_indices));
+  EXPECT_THAT(points, SizeIs(3u));
+  EXPECT_THAT(kept_indices, IsEmpty());
+}
+
+TEST(PointCloudDownsampler, voxel_grid_keeps_the_first_point_of_each_voxel) {
+  PointCloudDownsampler downsampler;
+  downsampler.setMode(PointCloudDownsampler::VoxelGrid);
+  downsampler.setVoxelSize(1.0f);
+  auto points = createPoints(
+    {{0.1f, 0.1f, 0.1f}, {2.5f, 0, 0}, {0.9f, 0.9f, 0.9f}, {-0.5f, 0, 0}, {2.1f, 0.2f, 0}});
+  std::vector<uint32_t> kept_indices;
+
+  EXPECT_TRUE(downsampler.filter(points, kept_indices));
+
+  EXPECT_THAT(kept_indices, ElementsAre(0u, 1u, 3u));
+  ASSERT_THAT(points, SizeIs(3u));
+  EXPECT_THAT(points[0].position.x, FloatEq(0.1f));
+  EXPECT_THAT(points[1].position.x, FloatEq(2.5f));
+  EXPECT_THAT(points[2].position.x, FloatEq(-0.5f));
+}
+
+TEST(PointCloudDownsampler, voxel_grid_drops_invalid_points) {
+  PointCloudDownsampler downsampler;
+  downsampler.setMode(PointCloudDownsampler::VoxelGrid);
+  downsampler.setVoxelSize(1.0f);
+  auto points = createPoints({{std::nanf(""), 0, 0}, {5, 5, 5}});
+  std::vector<uint32_t> kept_indices;
+
+  EXPECT_TRUE(downsampler.filter(points, kept_indices));
+  EXPECT_THAT(kept_indices, ElementsAre(1u));
+}
+
+TEST(PointCloudDownsampler, voxel_grid_keeps_distant_points_in_separate_voxels) {
+  PointCloudDownsampler downsampler;
+  downsampler.setMode(PointCloudDownsampler::VoxelGrid);
+  downsampler.setVoxelSize(0.001f);
+  auto points = createPoints(
+    {{5000.0f, 0, 0}, {5000.5f, 0, 0}, {5000.0f, 0, 0}, {-8000.0f, 0, 0}, {-8000.5f, 0, 0}});
+  std::vector<uint32_t> kept_indices;
+
+  EXPECT_TRUE(downsampler.filter(points, kept_indices));
+  EXPECT_THAT(kept_indices, ElementsAre(0u, 1u, 3u, 4u));
+}
+
+TEST(PointCloudDownsampler, random_subsample_keeps_target_count_in_original_order) {
+  PointCloudDownsampler downsampler;
+  downsampler.setMode(PointCloudDownsampler::RandomSubsample);
+  downsampler.setTargetPointCount(10);
+  std::vector<Ogre::Vector3> positions;
+  for (int i = 0; i < 100; ++i) {
+    positions.emplace_back(static_cast<float>(i), 0.0f, 0.0f);
+  }
+  auto points = createPoints(positions);
+  std::vector<uint32_t> kept_indices;
+
+  EXPECT_TRUE(downsampler.filter(points, kept_indices));
+
+  ASSERT_THAT(points, SizeIs(10u));
+  ASSERT_THAT(kept_indices, SizeIs(10u));
+  for (size_t i = 0; i < kept_indices.size(); ++i) {
+    EXPECT_THAT(points[i].position.x, FloatEq(static_cast<float>(kept_indices[i])));
+    if (i > 0) {
+      EXPECT_THAT(kept_indices[i], Gt(kept_indices[i - 1]));
+    }
+  }
+}
+
+TEST(PointCloudDownsampler, random_subsample_does_not_filter_small_clouds) {
+  PointCloudDownsampler downsampler;
+  downsampler.setMode(PointCloudDownsampler::RandomSubsample);
+  downsampler.setTargetPointCount(10);
+  auto points = createPoints({{0, 0, 0}, {1, 1, 1}});
+  std::vector<uint32_t> kept_indices;
+
+  EXPECT_FALSE(downsampler.filter(points, kept_indices));
+  EXPECT_THAT(points, SizeIs(2u));
+}
@@ -122,3 +122,24 @@ TEST(
   ASSERT_THAT(points_out[1].color, Eq(Ogre::ColourValue(0.75, 1, 0)));  // 1/4
   ASSERT_THAT(points_out[2].color, Eq(Ogre::ColourValue(0, 1, 0.5)));  // 1/2
 }
+
+TEST(IntensityPCTransformer, transformSelected_computes_bounds_over_all_points) {
+  PointWithIntensity p1 = {0, 0, 0, 0};
+  PointWithIntensity p2 = {0, 0, 0, 1};
+  PointWithIntensity p3 = {0, 0, 0, 2};
+  auto cloud = createPointCloud2WithIntensity(std::vector<PointWithIntensity>{p1, p2, p3});
+
+  V_PointCloudPoint points_out;
+  points_out.resize(1);
+
+  QList<rviz_common::properties::Property *> out_props;
+
+  IntensityPCTransformer transformer;
+  transformer.createProperties(nullptr, PointCloudTransformer::Support_Color, out_props);
+
+  transformer.transformSelected(
+    cloud, PointCloudTransformer::Support_Color, Ogre::Matrix4::IDENTITY, {1}, points_out);
+
+  ASSERT_THAT(points_out, SizeIs(1));
+  ASSERT_THAT(points_out[0].color, Eq(Ogre::ColourValue(0, 1, 0.5)));  // 1/2
+}
@@ -57,6 +57,24 @@ TEST(RGB8PCTransformer, transform_returns_points_colored_in_their_rgb_color) {
   ASSERT_THAT(points_out[1].color, Eq(Ogre::ColourValue(1, 0, 1)));
 }
 
+TEST(RGB8PCTransformer, transformSelected_colors_only_the_selected_points) {
+  ColoredPoint p1 = {0, 0, 0, 0, 1, 0};
+  ColoredPoint p2 = {0, 0, 0, 1, 0, 1};
+  ColoredPoint p3 = {0, 0, 0, 0, 0, 1};
+  auto cloud = create8BitColoredPointCloud2(std::vector<ColoredPoint>{p1, p2, p3});
+
+  V_PointCloudPoint points_out;
+  points_out.resize(2);
+
+  RGB8PCTransformer transformer;
+  transformer.transformSelected(
+    cloud, PointCloudTransformer::Support_Color, Ogre::Matrix4::ZERO, {0, 2}, points_out);
+
+  ASSERT_THAT(points_out, SizeIs(2));
+  ASSERT_THAT(points_out[0].color, Eq(Ogre::ColourValue(0, 1, 0)));
+  ASSERT_THAT(points_out[1].color, Eq(Ogre::ColourValue(0, 0, 1)));
+}
+
 TEST(RGBF32PCTransformer, supports_returns_color_support_for_cloud_with_rgb_field) {
   ColoredPoint p1 = {0, 0, 0, 0, 0, 0};
   ColoredPoint p2 = {0, 0, 0, 1, 1, 1};
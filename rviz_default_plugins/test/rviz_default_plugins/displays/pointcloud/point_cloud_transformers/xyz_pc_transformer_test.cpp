@@ -30,6 +30,7 @@
 
 #include <gmock/gmock.h>
 
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -59,6 +60,31 @@ TEST(XYZPCTransformer, transform_returns_the_point_cloud_points) {
   ASSERT_THAT(points_out[1].position, Vector3Eq(Ogre::Vector3(4, 5, 6)));
 }
 
+TEST(XYZPCTransformer, transform_returns_the_points_of_a_float64_cloud) {
+  auto cloud = createPointCloud2WithPoints({{1, 2, 3}, {4, 5, 6}});
+  for (uint32_t i = 0; i < cloud->fields.size(); ++i) {
+    cloud->fields[i].offset = i * sizeof(double);
+    cloud->fields[i].datatype = sensor_msgs::msg::PointField::FLOAT64;
+  }
+  cloud->point_step = 3 * sizeof(double);
+  cloud->row_step = cloud->point_step * cloud->width;
+  std::vector<double> values = {1, 2, 3, 4, 5, 6};
+  cloud->data.resize(values.size() * sizeof(double));
+  std::memcpy(cloud->data.data(), values.data(), cloud->data.size());
+
+  V_PointCloudPoint points_out;
+  points_out.resize(2);
+
+  XYZPCTransformer transformer;
+  ASSERT_THAT(transformer.supports(cloud), Eq(PointCloudTransformer::Support_XYZ));
+  ASSERT_TRUE(
+    transformer.transform(
+      cloud, PointCloudTransformer::Support_XYZ, Ogre::Matrix4::ZERO, points_out));
+
+  ASSERT_THAT(points_out[0].position, Vector3Eq(Ogre::Vector3(1, 2, 3)));
+  ASSERT_THAT(points_out[1].position, Vector3Eq(Ogre::Vector3(4, 5, 6)));
+}
+
 TEST(XYZPCTransformer, transform_returns_false_if_cloud_doesnt_support_xyz) {
   auto cloud = createPointCloud2WithSquare();
 
@@ -34,7 +34,6 @@
 #include <vector>
 
 #include <OgreRoot.h>
-#include <OgreEntity.h>
 #include <OgreManualObject.h>
 
 #include "rviz_common/properties/float_property.hpp"
@@ -96,6 +95,29 @@ geometry_msgs::msg::PoseArray::SharedPtr createMessageWithOnePose()
   return message;
 }
 
+// the display keeps a batch for each shape, return the one currently in use
+rviz_rendering::ShapeBatch * findFilledShapeBatch(
+  Ogre::SceneNode * scene_node, rviz_rendering::Shape::Type type)
+{
+  for (auto batch : rviz_default_plugins::findAllShapeBatches(scene_node, type)) {
+    if (!batch->getInstances().empty()) {
+      return batch;
+    }
+  }
+  return nullptr;
+}
+
+size_t countCones(Ogre::SceneNode * scene_node)
+{
+  return rviz_default_plugins::countShapeBatchInstances(scene_node, rviz_rendering::Shape::Cone);
+}
+
+size_t countCylinders(Ogre::SceneNode * scene_node)
+{
+  return rviz_default_plugins::countShapeBatchInstances(
+    scene_node, rviz_rendering::Shape::Cylinder);
+}
+
 TEST_F(PoseArrayDisplayFixture, constructor_set_all_the_properties_in_the_right_order) {
   EXPECT_THAT(display_->childAt(2)->getNameStd(), Eq("Color"));
   EXPECT_THAT(display_->childAt(3)->getNameStd(), Eq("Alpha"));
@@ -167,8 +189,8 @@ TEST_F(PoseArrayDisplayFixture, setTransform_with_invalid_message_returns_early)
   msg->poses[0].position.x = nan("NaN");
   display_->processMessage(msg);
 
-  auto arrows_3d = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
+  auto arrows_3d = countCones(scene_manager_->getRootSceneNode());
+  auto axes = countCylinders(scene_manager_->getRootSceneNode());
   auto manual_object =
     rviz_default_plugins::findOneManualObject(scene_manager_->getRootSceneNode());
 
@@ -177,8 +199,8 @@ TEST_F(PoseArrayDisplayFixture, setTransform_with_invalid_message_returns_early)
   EXPECT_THAT(
     display_->getSceneNode()->getOrientation(), QuaternionEq(Ogre::Quaternion(1, 0, 0, 0)));
   EXPECT_THAT(manual_object->getBoundingRadius(), FloatEq(0));
-  EXPECT_THAT(arrows_3d, SizeIs(0));
-  EXPECT_THAT(axes, SizeIs(0));
+  EXPECT_THAT(arrows_3d, Eq(0u));
+  EXPECT_THAT(axes, Eq(0u));
 }
 
 TEST_F(PoseArrayDisplayFixture, setTransform_with_invalid_transform_returns_early) {
@@ -187,8 +209,8 @@ TEST_F(PoseArrayDisplayFixture, setTransform_with_invalid_transform_returns_earl
   auto msg = createMessageWithOnePose();
   display_->processMessage(msg);
 
-  auto arrows_3d = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto axes = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
+  auto arrows_3d = countCones(scene_manager_->getRootSceneNode());
+  auto axes = countCylinders(scene_manager_->getRootSceneNode());
   auto manual_object = rviz_default_plugins::findOneManualObject(
     scene_manager_->getRootSceneNode());
 
@@ -197,8 +219,8 @@ TEST_F(PoseArrayDisplayFixture, setTransform_with_invalid_transform_returns_earl
   EXPECT_THAT(
     display_->getSceneNode()->getOrientation(), QuaternionEq(Ogre::Quaternion(1, 0, 0, 0)));
   EXPECT_THAT(manual_object->getBoundingRadius(), FloatEq(0));
-  EXPECT_THAT(arrows_3d, SizeIs(0));
-  EXPECT_THAT(axes, SizeIs(0));
+  EXPECT_THAT(arrows_3d, Eq(0u));
+  EXPECT_THAT(axes, Eq(0u));
 }
 
 TEST_F(PoseArrayDisplayFixture, setTransform_sets_node_position_and_orientation_correctly) {
@@ -231,19 +253,27 @@ TEST_F(PoseArrayDisplayFixture, processMessage_sets_arrows3d_correctly) {
   display_->setShape("Arrow (3D)");
   display_->processMessage(msg);
 
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
+  auto shafts = findFilledShapeBatch(
+    scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cylinder);
+  auto heads = findFilledShapeBatch(
+    scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cone);
 
-  // The orientation is first manipulated by the display and then in setOrientation() in arrow.cpp
+  // The orientation is first manipulated by the display and then by the arrow batch, like in
+  // setOrientation() in arrow.cpp
   auto expected_orientation =
     Ogre::Quaternion(0, 1, 0, 1) *
     Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_Y) *
     Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_X);
   expected_orientation.normalise();
 
-  EXPECT_TRUE(rviz_default_plugins::arrowIsVisible(scene_manager_->getRootSceneNode()));
-  EXPECT_THAT(arrows, SizeIs(1));
-  rviz_default_plugins::assertArrowWithTransform(
-    scene_manager_, Ogre::Vector3(1, 2, 3), Ogre::Vector3(1, 1, 1), expected_orientation);
+  ASSERT_THAT(shafts, NotNull());
+  ASSERT_THAT(heads, NotNull());
+  ASSERT_THAT(shafts->getInstances(), SizeIs(1));
+  EXPECT_THAT(heads->getInstances(), SizeIs(1));
+  // the shaft is centered half its length in front of the pose
+  EXPECT_THAT(
+    shafts->getInstances()[0].transform.getTrans(),
+    Vector3Eq(Ogre::Vector3(1, 2, 3) + expected_orientation * Ogre::Vector3(0, 0.115f, 0)));
 }
 
 TEST_F(PoseArrayDisplayFixture, processMessage_sets_axes_correctly) {
@@ -253,15 +283,19 @@ TEST_F(PoseArrayDisplayFixture, processMessage_sets_axes_correctly) {
   display_->setShape("Axes");
   display_->processMessage(msg);
 
-  auto frames = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
+  auto axes_batch = findFilledShapeBatch(
+    scene_manager_->getRootSceneNode(), rviz_rendering::Shape::Cylinder);
 
   auto expected_orientation = Ogre::Quaternion(0, 1, 0, 1);
   expected_orientation.normalise();
 
-  EXPECT_TRUE(rviz_default_plugins::axesAreVisible(frames[0]));
-  EXPECT_THAT(frames, SizeIs(1));
-  EXPECT_THAT(frames[0]->getPosition(), Vector3Eq(Ogre::Vector3(1, 2, 3)));
-  EXPECT_THAT(frames[0]->getOrientation(), QuaternionEq(expected_orientation));
+  // one batch for all axes, holding one cylinder per axis
+  ASSERT_THAT(axes_batch, NotNull());
+  ASSERT_THAT(axes_batch->getInstances(), SizeIs(3));
+  EXPECT_THAT(
+    axes_batch->getInstances()[0].transform.getTrans(),
+    Vector3Eq(Ogre::Vector3(1, 2, 3) + expected_orientation * Ogre::Vector3(0.15f, 0, 0)));
+  EXPECT_THAT(axes_batch->getInstances()[0].color, Eq(Ogre::ColourValue(1, 0, 0, 1)));
 }
 
 TEST_F(PoseArrayDisplayFixture, processMessage_updates_the_display_correctly_after_shape_change) {
@@ -270,19 +304,16 @@ TEST_F(PoseArrayDisplayFixture, processMessage_updates_the_display_correctly_aft
   display_->setShape("Arrow (3D)");
   display_->processMessage(msg);
 
-  auto arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto frames = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  auto manual_object = rviz_default_plugins::findOneManualObject(
-    scene_manager_->getRootSceneNode());
-  EXPECT_THAT(arrows, SizeIs(1));
+  auto root_node = scene_manager_->getRootSceneNode();
+  auto manual_object = rviz_default_plugins::findOneManualObject(root_node);
+  // arrow shafts are cylinders as well
+  EXPECT_THAT(countCones(root_node), Eq(1u));
+  EXPECT_THAT(countCylinders(root_node), Eq(1u));
   EXPECT_THAT(manual_object->getBoundingRadius(), FloatEq(0));
-  EXPECT_THAT(frames, SizeIs(0));
 
   display_->setShape("Axes");
   display_->processMessage(msg);
-  auto post_update_arrows = rviz_default_plugins::findAllArrows(scene_manager_->getRootSceneNode());
-  auto post_update_frames = rviz_default_plugins::findAllAxes(scene_manager_->getRootSceneNode());
-  EXPECT_THAT(post_update_frames, SizeIs(1));
+  EXPECT_THAT(countCones(root_node), Eq(0u));
+  EXPECT_THAT(countCylinders(root_node), Eq(3u));
   EXPECT_THAT(manual_object->getBoundingRadius(), FloatEq(0));
-  EXPECT_THAT(post_update_arrows, SizeIs(0));
 }
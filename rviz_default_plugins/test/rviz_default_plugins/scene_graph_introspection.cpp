@@ -126,6 +126,36 @@ Ogre::BillboardChain * findOneBillboardChain(Ogre::SceneNode * scene_node)
   return objects.empty() ? nullptr : objects[0];
 }
 
+rviz_rendering::ThickLineRenderable * findOneThickLine(Ogre::SceneNode * scene_node)
+{
+  auto objects = findAllOgreObjectByType<rviz_rendering::ThickLineRenderable>(
+    scene_node, "ThickLine");
+  return objects.empty() ? nullptr : objects[0];
+}
+
+std::vector<rviz_rendering::ShapeBatch *> findAllShapeBatches(
+  Ogre::SceneNode * scene_node, rviz_rendering::Shape::Type type)
+{
+  auto renderables = findAllOgreObjectByType<rviz_rendering::ShapeBatchRenderable>(
+    scene_node, "ShapeBatch");
+  std::vector<rviz_rendering::ShapeBatch *> batches;
+  for (auto renderable : renderables) {
+    if (renderable->getShapeBatch()->getType() == type) {
+      batches.push_back(renderable->getShapeBatch());
+    }
+  }
+  return batches;
+}
+
+size_t countShapeBatchInstances(Ogre::SceneNode * scene_node, rviz_rendering::Shape::Type type)
+{
+  size_t count = 0;
+  for (auto batch : findAllShapeBatches(scene_node, type)) {
+    count += batch->getInstances().size();
+  }
+  return count;
+}
+
 rviz_rendering::MovableText * findOneMovableText(Ogre::SceneNode * scene_node)
 {
   auto objects = findAllOgreObjectByType<rviz_rendering::MovableText>(scene_node, "MovableText");
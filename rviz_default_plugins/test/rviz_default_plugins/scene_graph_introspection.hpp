@@ -45,6 +45,8 @@
 
 #include "rviz_rendering/objects/point_cloud.hpp"
 #include "rviz_rendering/objects/movable_text.hpp"
+#include "rviz_rendering/objects/shape_batch.hpp"
+#include "rviz_rendering/objects/thick_line.hpp"
 
 MATCHER_P(Vector3Eq, expected, "") {
   return Ogre::Math::Abs(expected.x - arg.x) < 0.0001f &&
@@ -66,6 +68,14 @@ MATCHER_P(ColourValueEq, expected, "") {
          Ogre::Math::Abs(expected.a - arg.a) < 0.0001f;
 }
 
+// colors of point clouds are stored with 8 bits per channel
+MATCHER_P(ColourValueByteEq, expected, "") {
+  return Ogre::Math::Abs(expected.r - arg.r) <= 1.0f / 255 &&
+         Ogre::Math::Abs(expected.g - arg.g) <= 1.0f / 255 &&
+         Ogre::Math::Abs(expected.b - arg.b) <= 1.0f / 255 &&
+         Ogre::Math::Abs(expected.a - arg.a) <= 1.0f / 255;
+}
+
 namespace rviz_default_plugins
 {
 void assertArrowWithTransform(
@@ -102,6 +112,12 @@ rviz_rendering::PointCloud * findOnePointCloud(Ogre::SceneNode * scene_node);
 
 Ogre::BillboardChain * findOneBillboardChain(Ogre::SceneNode * scene_node);
 
+rviz_rendering::ThickLineRenderable * findOneThickLine(Ogre::SceneNode * scene_node);
+
+std::vector<rviz_rendering::ShapeBatch *> findAllShapeBatches(
+  Ogre::SceneNode * scene_node, rviz_rendering::Shape::Type type);
+size_t countShapeBatchInstances(Ogre::SceneNode * scene_node, rviz_rendering::Shape::Type type);
+
 rviz_rendering::MovableText * findOneMovableText(Ogre::SceneNode * scene_node);
 
 Ogre::ManualObject * findOneManualObject(Ogre::SceneNode * scene_node);
@@ -0,0 +1,159 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "rclcpp/rclcpp.hpp"
+#include "tf2/exceptions.h"
+#include "tf2_ros/buffer.h"
+#include "geometry_msgs/msg/transform_stamped.hpp"
+
+#include "rviz_default_plugins/transformation/sharded_tf_frame_transformer.hpp"
+
+using namespace ::testing;  // NOLINT
+
+class ShardedTFFrameTransformerFixture : public testing::Test
+{
+public:
+  geometry_msgs::msg::TransformStamped getTransformStamped(
+    std::string frame = "frame", std::string fixed_frame = "fixed_frame", int32_t seconds = 0)
+  {
+    geometry_msgs::msg::TransformStamped transform_stamped;
+    transform_stamped.header.frame_id = fixed_frame;
+    transform_stamped.header.stamp.sec = seconds;
+    transform_stamped.child_frame_id = frame;
+    transform_stamped.transform.rotation.w = 1;
+    return transform_stamped;
+  }
+
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    auto clock = std::make_shared<rclcpp::Clock>(RCL_ROS_TIME);
+    auto node = std::make_shared<rclcpp::Node>("test_node");
+    tf_wrapper_ = std::make_shared<rviz_default_plugins::transformation::TFWrapper>();
+    tf_wrapper_->initializeBuffer(clock, node, false);
+    transformer_ =
+      std::make_unique<rviz_default_plugins::transformation::ShardedTFFrameTransformer>(
+      tf_wrapper_);
+  }
+
+  void TearDown() override
+  {
+    transformer_.reset();
+    rclcpp::shutdown();
+  }
+
+  tf2::TimePoint timeAt(int32_t seconds)
+  {
+    return tf2::TimePoint(std::chrono::seconds(seconds));
+  }
+
+  std::shared_ptr<rviz_default_plugins::transformation::TFWrapper> tf_wrapper_;
+  std::unique_ptr<rviz_default_plugins::transformation::ShardedTFFrameTransformer> transformer_;
+};
+
+TEST_F(ShardedTFFrameTransformerFixture, lookupTransform_reports_errors_like_the_tf_transformer) {
+  transformer_->setTransform(getTransformStamped(), "test", true);
+
+  EXPECT_THROW(
+    transformer_->lookupTransform("fixed_frame", "another_frame", tf2::TimePointZero),
+    rviz_common::transformation::FrameTransformerException);
+
+  std::string error;
+  EXPECT_FALSE(
+    transformer_->canTransform("fixed_frame", "another_frame", tf2::TimePointZero, &error));
+  EXPECT_THAT(error, StrEq("For frame [another_frame]: Frame [another_frame] does not exist"));
+}
+
+TEST_F(ShardedTFFrameTransformerFixture, waitForTransform_is_answered_once_the_transform_arrives) {
+  transformer_->setTransform(getTransformStamped("frame", "fixed_frame", 1), "test", false);
+  std::promise<bool> buffer_had_transform;
+
+  auto future = transformer_->waitForTransform(
+    "fixed_frame", "frame", timeAt(2), tf2::durationFromSec(10),
+    [this, &buffer_had_transform](const tf2_ros::TransformStampedFuture &) {
+      // Displays reading the tf2 buffer directly must find the transform as well.
+      buffer_had_transform.set_value(
+        tf_wrapper_->getBuffer()->canTransform("fixed_frame", "frame", timeAt(2)));
+    });
+  EXPECT_THAT(future.getHandle(), Ne(0u));
+  EXPECT_THAT(future.wait_for(std::chrono::milliseconds(50)), Eq(std::future_status::timeout));
+
+  transformer_->setTransform(getTransformStamped("frame", "fixed_frame", 2), "test", false);
+
+  ASSERT_THAT(future.wait_for(std::chrono::seconds(5)), Eq(std::future_status::ready));
+  EXPECT_THAT(future.get().header.frame_id, StrEq("fixed_frame"));
+  EXPECT_TRUE(buffer_had_transform.get_future().get());
+}
+
+TEST_F(ShardedTFFrameTransformerFixture, waitForTransform_answers_available_transforms) {
+  transformer_->setTransform(getTransformStamped("frame", "fixed_frame", 1), "test", false);
+
+  auto future = transformer_->waitForTransform(
+    "fixed_frame", "frame", timeAt(1), tf2::durationFromSec(10),
+    [](const tf2_ros::TransformStampedFuture &) {});
+
+  EXPECT_THAT(future.getHandle(), Eq(0u));
+  ASSERT_THAT(future.wait_for(std::chrono::seconds(5)), Eq(std::future_status::ready));
+  EXPECT_NO_THROW(future.get());
+}
+
+TEST_F(ShardedTFFrameTransformerFixture, waitForTransform_times_out) {
+  transformer_->setTransform(getTransformStamped("frame", "fixed_frame", 1), "test", false);
+  std::promise<void> called;
+
+  auto future = transformer_->waitForTransform(
+    "fixed_frame", "frame", timeAt(2), tf2::durationFromSec(0.05),
+    [&called](const tf2_ros::TransformStampedFuture &) {called.set_value();});
+
+  ASSERT_THAT(future.wait_for(std::chrono::seconds(5)), Eq(std::future_status::ready));
+  EXPECT_THROW(future.get(), tf2::TimeoutException);
+  called.get_future().get();
+}
+
+TEST_F(ShardedTFFrameTransformerFixture, cancelled_waits_are_not_answered) {
+  transformer_->setTransform(getTransformStamped("frame", "fixed_frame", 1), "test", false);
+  bool called = false;
+
+  auto future = transformer_->waitForTransform(
+    "fixed_frame", "frame", timeAt(2), tf2::durationFromSec(0.05),
+    [&called](const tf2_ros::TransformStampedFuture &) {called = true;});
+  transformer_->cancel(future);
+  transformer_->setTransform(getTransformStamped("frame", "fixed_frame", 2), "test", false);
+
+  EXPECT_THAT(future.wait_for(std::chrono::milliseconds(200)), Eq(std::future_status::timeout));
+  EXPECT_FALSE(called);
+}
@@ -0,0 +1,433 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "geometry_msgs/msg/transform_stamped.hpp"
+#include "tf2/exceptions.h"
+#include "tf2/time.h"
+
+#include "rviz_default_plugins/transformation/sharded_transform_cache.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_default_plugins::transformation::ShardedTransformCache;
+
+namespace
+{
+tf2::TimePoint timeAt(double seconds)
+{
+  return tf2::TimePoint(std::chrono::nanoseconds(static_cast<int64_t>(seconds * 1e9)));
+}
+
+geometry_msgs::msg::TransformStamped translation(
+  const std::string & parent, const std::string & child, double x, double seconds = 0)
+{
+  geometry_msgs::msg::TransformStamped transform;
+  transform.header.frame_id = parent;
+  transform.header.stamp.sec = static_cast<int32_t>(seconds);
+  transform.header.stamp.nanosec =
+    static_cast<uint32_t>((seconds - static_cast<int32_t>(seconds)) * 1e9);
+  transform.child_frame_id = child;
+  transform.transform.translation.x = x;
+  transform.transform.rotation.w = 1;
+  return transform;
+}
+}  // namespace
+
+TEST(ShardedTransformCache, lookupTransform_combines_the_transforms_along_the_path) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 1, 10), false);
+  cache.setTransform(translation("odom", "base_link", 2, 10), false);
+  cache.setTransform(translation("map", "camera", 5, 10), false);
+
+  auto transform = cache.lookupTransform("camera", "base_link", timeAt(10));
+
+  EXPECT_THAT(transform.header.frame_id, StrEq("camera"));
+  EXPECT_THAT(transform.child_frame_id, StrEq("base_link"));
+  EXPECT_THAT(transform.transform.translation.x, DoubleNear(-2, 1e-9));
+}
+
+TEST(ShardedTransformCache, lookupTransform_interpolates_between_samples) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "base_link", 0, 10), false);
+  cache.setTransform(translation("map", "base_link", 4, 11), false);
+
+  auto transform = cache.lookupTransform("map", "base_link", timeAt(10.25));
+
+  EXPECT_THAT(transform.transform.translation.x, DoubleNear(1, 1e-9));
+}
+
+TEST(ShardedTransformCache, lookupTransform_at_time_zero_uses_the_latest_common_time) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 1, 10), false);
+  cache.setTransform(translation("map", "odom", 3, 12), false);
+  cache.setTransform(translation("odom", "base_link", 0, 10), false);
+  cache.setTransform(translation("odom", "base_link", 0, 11), false);
+
+  auto transform = cache.lookupTransform("map", "base_link", tf2::TimePointZero);
+
+  EXPECT_THAT(transform.header.stamp.sec, Eq(11));
+  EXPECT_THAT(transform.header.stamp.nanosec, Eq(0u));
+  EXPECT_THAT(transform.transform.translation.x, DoubleNear(2, 1e-9));
+}
+
+TEST(ShardedTransformCache, static_transforms_are_valid_at_any_time) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("base_link", "laser", 1), true);
+  cache.setTransform(translation("map", "base_link", 2, 10), false);
+
+  auto transform = cache.lookupTransform("map", "laser", timeAt(10));
+
+  EXPECT_THAT(transform.transform.translation.x, DoubleNear(3, 1e-9));
+}
+
+TEST(ShardedTransformCache, lookupTransform_does_not_extrapolate) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "base_link", 0, 10), false);
+  cache.setTransform(translation("map", "base_link", 1, 11), false);
+
+  EXPECT_THROW(cache.lookupTransform("map", "base_link", timeAt(12)), tf2::ExtrapolationException);
+  EXPECT_THROW(cache.lookupTransform("map", "base_link", timeAt(9)), tf2::ExtrapolationException);
+}
+
+TEST(ShardedTransformCache, lookupTransform_throws_for_unknown_and_unconnected_frames) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "base_link", 0), true);
+  cache.setTransform(translation("world", "robot", 0), true);
+
+  EXPECT_THROW(cache.lookupTransform("map", "unknown", timeAt(0)), tf2::LookupException);
+  EXPECT_THROW(cache.lookupTransform("map", "robot", timeAt(0)), tf2::ConnectivityException);
+
+  std::string error;
+  EXPECT_FALSE(cache.canTransform("map", "robot", timeAt(0), &error));
+  EXPECT_THAT(error, HasSubstr("not part of the same tree"));
+}
+
+TEST(ShardedTransformCache, lookupTransforms_reports_frames_which_cannot_be_transformed) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "base_link", 1, 10), false);
+  cache.setTransform(translation("base_link", "laser", 2), true);
+
+  auto transforms = cache.lookupTransforms(
+    "map", {"laser", "unknown", "base_link"}, tf2::TimePointZero);
+
+  ASSERT_THAT(transforms, SizeIs(3));
+  ASSERT_TRUE(transforms[0].has_value());
+  EXPECT_THAT(transforms[0]->transform.translation.x, DoubleNear(3, 1e-9));
+  EXPECT_FALSE(transforms[1].has_value());
+  ASSERT_TRUE(transforms[2].has_value());
+  EXPECT_THAT(transforms[2]->transform.translation.x, DoubleNear(1, 1e-9));
+}
+
+TEST(ShardedTransformCache, lookupTransform_ignores_links_above_the_common_ancestor) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 0, 100), false);
+  cache.setTransform(translation("odom", "base_link", 1), true);
+  cache.setTransform(translation("odom", "laser", 2), true);
+
+  auto transform = cache.lookupTransform("base_link", "laser", timeAt(10));
+
+  EXPECT_THAT(transform.transform.translation.x, DoubleNear(1, 1e-9));
+}
+
+TEST(ShardedTransformCache, lookupTransforms_walks_further_up_for_sources_joining_higher) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 1, 10), false);
+  cache.setTransform(translation("odom", "base_link", 2, 10), false);
+  cache.setTransform(translation("base_link", "laser", 3), true);
+  cache.setTransform(translation("map", "camera", 5), true);
+
+  auto transforms = cache.lookupTransforms("base_link", {"laser", "camera"}, timeAt(10));
+
+  ASSERT_THAT(transforms, SizeIs(2));
+  ASSERT_TRUE(transforms[0].has_value());
+  EXPECT_THAT(transforms[0]->transform.translation.x, DoubleNear(3, 1e-9));
+  ASSERT_TRUE(transforms[1].has_value());
+  EXPECT_THAT(transforms[1]->transform.translation.x, DoubleNear(2, 1e-9));
+}
+
+TEST(ShardedTransformCache, clear_keeps_static_transforms) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 1), true);
+  cache.setTransform(translation("odom", "base_link", 2, 10), false);
+
+  cache.clear();
+
+  EXPECT_TRUE(cache.canTransform("map", "odom", timeAt(10)));
+  EXPECT_FALSE(cache.canTransform("map", "base_link", timeAt(10)));
+}
+
+TEST(ShardedTransformCache, samples_older_than_the_cache_time_are_dropped) {
+  ShardedTransformCache cache(std::chrono::seconds(1));
+  cache.setTransform(translation("map", "base_link", 0, 10), false);
+  cache.setTransform(translation("map", "base_link", 0, 12), false);
+
+  EXPECT_FALSE(cache.canTransform("map", "base_link", timeAt(10)));
+  EXPECT_TRUE(cache.canTransform("map", "base_link", timeAt(12)));
+}
+
+TEST(ShardedTransformCache, invalid_transforms_are_ignored) {
+  ShardedTransformCache cache;
+  auto not_a_number = translation("map", "odom", std::nan(""));
+  auto denormalized = translation("map", "base_link", 0);
+  denormalized.transform.rotation.w = 2;
+
+  cache.setTransform(translation("map", "map", 0), true);
+  cache.setTransform(translation("", "odom", 0), true);
+  cache.setTransform(not_a_number, true);
+  cache.setTransform(denormalized, true);
+
+  EXPECT_THAT(cache.getAllFrameNames(), IsEmpty());
+}
+
+TEST(ShardedTransformCache, addTransformableRequest_returns_zero_if_it_can_be_answered_now) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 1, 10), false);
+  bool called = false;
+
+  EXPECT_THAT(
+    cache.addTransformableRequest(
+      "map", "odom", timeAt(10), [&called](tf2::TransformableRequestHandle) {called = true;}),
+    Eq(0u));
+  EXPECT_FALSE(called);
+}
+
+TEST(ShardedTransformCache, setTransform_answers_the_requests_waiting_for_it) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 1, 10), false);
+  std::vector<tf2::TransformableRequestHandle> answered;
+  auto record = [&answered](tf2::TransformableRequestHandle handle) {answered.push_back(handle);};
+
+  auto later = cache.addTransformableRequest("map", "odom", timeAt(12), record);
+  auto unknown = cache.addTransformableRequest("map", "base_link", timeAt(10), record);
+  EXPECT_THAT(later, Ne(0u));
+  EXPECT_THAT(unknown, Ne(0u));
+
+  cache.setTransform(translation("map", "odom", 1, 11), false);
+  EXPECT_THAT(answered, IsEmpty());
+
+  cache.setTransforms(
+    {translation("map", "odom", 1, 12), translation("odom", "base_link", 1, 12)}, false);
+  EXPECT_THAT(answered, UnorderedElementsAre(later, unknown));
+  EXPECT_TRUE(cache.canTransform("map", "odom", timeAt(12)));
+}
+
+TEST(ShardedTransformCache, requests_for_times_older_than_the_data_are_answered) {
+  ShardedTransformCache cache(std::chrono::seconds(1));
+  cache.setTransform(translation("map", "odom", 1, 10), false);
+  bool called = false;
+  cache.addTransformableRequest(
+    "map", "odom", timeAt(12), [&called](tf2::TransformableRequestHandle) {called = true;});
+
+  cache.setTransform(translation("map", "odom", 1, 15), false);
+
+  // Like tf2, the request is answered and the lookup reports the error.
+  EXPECT_TRUE(called);
+  EXPECT_FALSE(cache.canTransform("map", "odom", timeAt(12)));
+}
+
+TEST(ShardedTransformCache, cancelled_requests_are_not_answered) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 1, 10), false);
+  bool called = false;
+  auto handle = cache.addTransformableRequest(
+    "map", "odom", timeAt(11), [&called](tf2::TransformableRequestHandle) {called = true;});
+
+  EXPECT_TRUE(cache.cancelTransformableRequest(handle));
+  EXPECT_FALSE(cache.cancelTransformableRequest(handle));
+  cache.setTransform(translation("map", "odom", 1, 11), false);
+
+  EXPECT_FALSE(called);
+}
+
+// Hammers the cache with lookups from many threads while transforms keep arriving. Every
+// lookup has to succeed and see a consistent transform, the throughput is recorded.
+TEST(ShardedTransformCache, concurrent_lookups_see_consistent_transforms) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 0), true);
+  cache.setTransform(translation("odom", "base_link", 1, 1), false);
+  for (int i = 0; i < 20; ++i) {
+    cache.setTransform(translation("base_link", "link_" + std::to_string(i), i), true);
+  }
+
+  const size_t reader_count = std::max(4u, std::thread::hardware_concurrency());
+  const int lookups_per_reader = 20000;
+  std::atomic<bool> readers_done(false);
+  std::atomic<int> failed_lookups(0);
+
+  std::thread writer([&]() {
+      // The translation of base_link equals its stamp, which the readers check.
+      for (double stamp = 1.001; !readers_done; stamp += 0.001) {
+        cache.setTransform(translation("odom", "base_link", stamp, stamp), false);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    });
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> readers;
+  for (size_t reader = 0; reader < reader_count; ++reader) {
+    readers.emplace_back(
+      [&, reader]() {
+        const std::string link = "link_" + std::to_string(reader % 20);
+        for (int i = 0; i < lookups_per_reader; ++i) {
+          try {
+            auto transform = cache.lookupTransform("map", link, tf2::TimePointZero);
+            const double stamp =
+              transform.header.stamp.sec + transform.header.stamp.nanosec * 1e-9;
+            const double expected_x = stamp + static_cast<double>(reader % 20);
+            if (std::abs(transform.transform.translation.x - expected_x) > 1e-6) {
+              ++failed_lookups;
+            }
+          } catch (const tf2::TransformException &) {
+            ++failed_lookups;
+          }
+        }
+      });
+  }
+  for (auto & reader : readers) {
+    reader.join();
+  }
+  const double seconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  readers_done = true;
+  writer.join();
+
+  EXPECT_THAT(failed_lookups.load(), Eq(0));
+  RecordProperty("reader_threads", static_cast<int>(reader_count));
+  RecordProperty(
+    "lookups_per_second",
+    static_cast<int>(static_cast<double>(reader_count * lookups_per_reader) / seconds));
+}
+
+// Same as above, while waiting threads keep requests for transforms which have not arrived yet
+// pending, like the message filters of the displays do. Lookups do not take the mutex of the
+// requests, so their throughput should stay close to the one without waiters.
+TEST(ShardedTransformCache, concurrent_lookups_are_not_held_up_by_waiting_requests) {
+  ShardedTransformCache cache;
+  cache.setTransform(translation("map", "odom", 0), true);
+  cache.setTransform(translation("odom", "base_link", 1, 1), false);
+  for (int i = 0; i < 20; ++i) {
+    cache.setTransform(translation("base_link", "link_" + std::to_string(i), i), true);
+  }
+
+  const size_t reader_count = std::max(4u, std::thread::hardware_concurrency());
+  const size_t waiter_count = 4;
+  const int pending_per_waiter = 50;
+  const int lookups_per_reader = 20000;
+  std::atomic<bool> readers_done(false);
+  std::atomic<bool> waiters_done(false);
+  std::atomic<double> latest_stamp(1.0);
+  std::atomic<int> failed_lookups(0);
+  std::atomic<int> answered_requests(0);
+
+  std::thread writer([&]() {
+      for (double stamp = 1.001; !waiters_done; stamp += 0.001) {
+        cache.setTransform(translation("odom", "base_link", stamp, stamp), false);
+        latest_stamp = stamp;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    });
+
+  std::vector<std::thread> waiters;
+  for (size_t waiter = 0; waiter < waiter_count; ++waiter) {
+    waiters.emplace_back(
+      [&, waiter]() {
+        const std::string link = "link_" + std::to_string(waiter);
+        std::atomic<int> pending(0);
+        while (!readers_done) {
+          if (pending >= pending_per_waiter) {
+            std::this_thread::yield();
+            continue;
+          }
+          const tf2::TimePoint time = timeAt(latest_stamp + 0.005);
+          ++pending;
+          auto answer = [&, time](tf2::TransformableRequestHandle) {
+              if (!cache.canTransform("map", link, time)) {
+                ++failed_lookups;
+              }
+              ++answered_requests;
+              --pending;
+            };
+          if (cache.addTransformableRequest("map", link, time, answer) == 0) {
+            answer(0);
+          }
+        }
+        // Requests still pending reference this thread's counter, the writer answers them.
+        while (pending > 0) {
+          std::this_thread::yield();
+        }
+      });
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> readers;
+  for (size_t reader = 0; reader < reader_count; ++reader) {
+    readers.emplace_back(
+      [&, reader]() {
+        const std::string link = "link_" + std::to_string(reader % 20);
+        for (int i = 0; i < lookups_per_reader; ++i) {
+          try {
+            cache.lookupTransform("map", link, tf2::TimePointZero);
+          } catch (const tf2::TransformException &) {
+            ++failed_lookups;
+          }
+        }
+      });
+  }
+  for (auto & reader : readers) {
+    reader.join();
+  }
+  const double seconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  readers_done = true;
+  for (auto & waiter : waiters) {
+    waiter.join();
+  }
+  waiters_done = true;
+  writer.join();
+
+  EXPECT_THAT(failed_lookups.load(), Eq(0));
+  EXPECT_THAT(answered_requests.load(), Gt(0));
+  RecordProperty("reader_threads", static_cast<int>(reader_count));
+  RecordProperty("waiting_requests", static_cast<int>(waiter_count * pending_per_waiter));
+  RecordProperty(
+    "lookups_per_second",
+    static_cast<int>(static_cast<double>(reader_count * lookups_per_reader) / seconds));
+  RecordProperty("answered_requests", answered_requests.load());
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_RENDERING__OBJECTS__ARROW_BATCH_HPP_
+#define RVIZ_RENDERING__OBJECTS__ARROW_BATCH_HPP_
+
+#include <memory>
+#include <vector>
+
+#include <OgreColourValue.h>
+#include <OgreMatrix4.h>
+#include <OgreQuaternion.h>
+#include <OgreVector.h>
+
+#include "rviz_rendering/objects/shape_batch.hpp"
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace Ogre
+{
+class SceneManager;
+class SceneNode;
+}
+
+namespace rviz_rendering
+{
+
+/**
+ * \class ArrowBatch
+ * \brief Displays many arrows of the same size, drawn with one ShapeBatch for all shafts and
+ * one for all heads.
+ *
+ * Arrows are placed like Arrow: with an identity orientation they point along negative z.
+ */
+class ArrowBatch
+{
+public:
+  /**
+   * \brief Constructor
+   * @param scene_manager Scene manager this object is a part of
+   * @param parent_node A scene node to use as the parent of this object.  If NULL, uses the root scene node.
+   * @param shaft_length Length of the arrows' shaft
+   * @param shaft_diameter Diameter of the arrows' shaft
+   * @param head_length Length of the arrows' head
+   * @param head_diameter Diameter of the arrows' head
+   */
+  RVIZ_RENDERING_PUBLIC
+  ArrowBatch(
+    Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node = nullptr,
+    float shaft_length = 1.0f, float shaft_diameter = 0.1f,
+    float head_length = 0.3f, float head_diameter = 0.2f);
+  RVIZ_RENDERING_PUBLIC
+  ~ArrowBatch();
+
+  RVIZ_RENDERING_PUBLIC
+  void clear();
+  RVIZ_RENDERING_PUBLIC
+  void reserve(size_t arrow_count);
+
+  RVIZ_RENDERING_PUBLIC
+  void addArrow(
+    const Ogre::Vector3 & position, const Ogre::Quaternion & orientation,
+    const Ogre::ColourValue & color);
+
+  /**
+   * \brief Set the parameters of all arrows
+   * @param shaft_length Length of the arrows' shaft
+   * @param shaft_diameter Diameter of the arrows' shaft
+   * @param head_length Length of the arrows' head
+   * @param head_diameter Diameter of the arrows' head
+   */
+  RVIZ_RENDERING_PUBLIC
+  void set(float shaft_length, float shaft_diameter, float head_length, float head_diameter);
+
+  /// Set the color of all arrows
+  RVIZ_RENDERING_PUBLIC
+  void setColor(const Ogre::ColourValue & color);
+
+  size_t getArrowCount() const {return arrows_.size();}
+
+  Ogre::SceneNode * getSceneNode() {return scene_node_;}
+
+  ShapeBatch * getShafts() {return shafts_.get();}
+  ShapeBatch * getHeads() {return heads_.get();}
+
+private:
+  struct ArrowPose
+  {
+    Ogre::Vector3 position;
+    Ogre::Quaternion orientation;
+    Ogre::ColourValue color;
+  };
+
+  void addInstances(const ArrowPose & arrow);
+
+  Ogre::SceneManager * scene_manager_;
+  Ogre::SceneNode * scene_node_;
+  std::unique_ptr<ShapeBatch> shafts_;
+  std::unique_ptr<ShapeBatch> heads_;
+
+  std::vector<ArrowPose> arrows_;
+  // transforms of the unit shapes relative to an arrow
+  Ogre::Matrix4 shaft_transform_;
+  Ogre::Matrix4 head_transform_;
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__OBJECTS__ARROW_BATCH_HPP_
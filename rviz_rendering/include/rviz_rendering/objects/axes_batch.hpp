@@ -0,0 +1,113 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_RENDERING__OBJECTS__AXES_BATCH_HPP_
+#define RVIZ_RENDERING__OBJECTS__AXES_BATCH_HPP_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <OgreMatrix4.h>
+#include <OgreQuaternion.h>
+#include <OgreVector.h>
+
+#include "rviz_rendering/objects/shape_batch.hpp"
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace Ogre
+{
+class SceneManager;
+class SceneNode;
+}
+
+namespace rviz_rendering
+{
+
+/**
+ * \class AxesBatch
+ * \brief Displays many sets of axes of the same size, drawn with a single ShapeBatch.
+ *
+ * The axes are colored like Axes: x red, y green and z blue.
+ */
+class AxesBatch
+{
+public:
+  /**
+   * \brief Constructor
+   * @param scene_manager Scene manager this object is a part of
+   * @param parent_node A scene node to use as the parent of this object.  If NULL, uses the root scene node.
+   * @param length Length of the axes
+   * @param radius Radius of the axes
+   */
+  RVIZ_RENDERING_PUBLIC
+  AxesBatch(
+    Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node = nullptr,
+    float length = 1.0f, float radius = 0.1f);
+  RVIZ_RENDERING_PUBLIC
+  ~AxesBatch();
+
+  RVIZ_RENDERING_PUBLIC
+  void clear();
+  RVIZ_RENDERING_PUBLIC
+  void reserve(size_t axes_count);
+
+  RVIZ_RENDERING_PUBLIC
+  void addAxes(const Ogre::Vector3 & position, const Ogre::Quaternion & orientation);
+
+  /**
+   * \brief Set the parameters of all axes
+   * @param length Length of the axes
+   * @param radius Radius of the axes
+   */
+  RVIZ_RENDERING_PUBLIC
+  void set(float length, float radius);
+
+  size_t getAxesCount() const {return poses_.size();}
+
+  Ogre::SceneNode * getSceneNode() {return scene_node_;}
+
+  ShapeBatch * getCylinders() {return cylinders_.get();}
+
+private:
+  void addInstances(const Ogre::Vector3 & position, const Ogre::Quaternion & orientation);
+
+  Ogre::SceneManager * scene_manager_;
+  Ogre::SceneNode * scene_node_;
+  std::unique_ptr<ShapeBatch> cylinders_;
+
+  std::vector<std::pair<Ogre::Vector3, Ogre::Quaternion>> poses_;
+  // transforms of the unit cylinders relative to a set of axes
+  Ogre::Matrix4 axis_transforms_[3];
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__OBJECTS__AXES_BATCH_HPP_
@@ -0,0 +1,97 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RVIZ_RENDERING__OBJECTS__POINT_BUDGET_HPP_
+#define RVIZ_RENDERING__OBJECTS__POINT_BUDGET_HPP_
+
+#include <cstdint>
+#include <memory>
+
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace rviz_rendering
+{
+
+/**
+ * \class PointBudget
+ * \brief Limits the number of points a group of PointClouds draws per frame.
+ *
+ * Every point cloud sharing a budget reports how many points it would like to draw.
+ * The demand of the previous frame determines a scale factor, which the point clouds
+ * apply to the density of each of their chunks in the current frame.
+ * Using the previous frame avoids ordering effects between point clouds and keeps the
+ * scale stable while the camera does not move.
+ * The displays share the global budget, so the limit holds for all of them together.
+ *
+ * Only to be used from the render thread.
+ */
+class PointBudget
+{
+public:
+  /// \param max_points Maximum number of points drawn per frame, 0 means unlimited.
+  RVIZ_RENDERING_PUBLIC
+  explicit PointBudget(uint64_t max_points = 0);
+
+  /// The budget shared by all point cloud displays.
+  RVIZ_RENDERING_PUBLIC
+  static std::shared_ptr<PointBudget> getGlobal();
+
+  RVIZ_RENDERING_PUBLIC
+  void setMaxPoints(uint64_t max_points);
+
+  RVIZ_RENDERING_PUBLIC
+  uint64_t getMaxPoints() const;
+
+  /**
+   * \brief Get the density scale for the given frame.
+   *
+   * The first call for a new frame number closes the accounting of the previous frame.
+   */
+  RVIZ_RENDERING_PUBLIC
+  float getScale(uint64_t frame_number);
+
+  /// Report points which would be drawn in the current frame without a budget.
+  RVIZ_RENDERING_PUBLIC
+  void addDemand(uint64_t number_of_points);
+
+  /// Number of points requested during the last completed frame.
+  RVIZ_RENDERING_PUBLIC
+  uint64_t getLastDemand() const;
+
+private:
+  uint64_t max_points_;
+  uint64_t frame_number_;
+  uint64_t current_demand_;
+  uint64_t last_demand_;
+  float scale_;
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__OBJECTS__POINT_BUDGET_HPP_
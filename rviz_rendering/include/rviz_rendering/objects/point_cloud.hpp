@@ -36,6 +36,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <OgreSimpleRenderable.h>
@@ -49,6 +50,7 @@
 #include <OgreHardwareBufferManager.h>
 #include <OgreSharedPtr.h>
 
+#include "point_budget.hpp"
 #include "point_cloud_renderable.hpp"
 #include "rviz_rendering/visibility_control.hpp"
 
@@ -126,6 +128,42 @@ public:
     Ogre::ColourValue color;
   };
 
+  /**
+   * \struct CompactPoint
+   * \brief Representation of a point with x/y/z position and an 8 bit per channel color
+   *
+   * Takes 16 instead of the 28 bytes of Point, this is how the points are kept in memory.
+   */
+  struct CompactPoint
+  {
+    CompactPoint() = default;
+
+    CompactPoint(const Ogre::Vector3 & position, const Ogre::ColourValue & color)
+    : position(position), color(color.getAsBYTE())
+    {}
+
+    explicit CompactPoint(const Point & point)
+    : CompactPoint(point.position, point.color)
+    {}
+
+    inline void setColor(const Ogre::ColourValue & colour)
+    {
+      color = colour.getAsBYTE();
+    }
+
+    inline Ogre::ColourValue getColor() const
+    {
+      Ogre::ColourValue colour;
+      colour.setAsBYTE(color);
+      return colour;
+    }
+
+    Ogre::Vector3 position;
+    /// Packed with Ogre::ColourValue::getAsBYTE(), as expected by the vertex buffers
+    Ogre::RGBA color;
+  };
+  static_assert(sizeof(CompactPoint) == 16, "unexpected padding in CompactPoint");
+
   /**
    * \brief Add points to this point cloud
    *
@@ -137,6 +175,16 @@ public:
     std::vector<Point>::iterator start_iterator,
     std::vector<Point>::iterator end_iterator);
 
+  /// Add points to this point cloud, without converting them.
+  RVIZ_RENDERING_PUBLIC
+  void addPoints(
+    std::vector<CompactPoint>::const_iterator start_iterator,
+    std::vector<CompactPoint>::const_iterator end_iterator);
+
+  /// Add points to this point cloud, taking over the vector if the cloud is empty.
+  RVIZ_RENDERING_PUBLIC
+  void addPoints(std::vector<CompactPoint> && points);
+
   /**
    * \brief Remove a number of points from this point cloud
    * \param num_points The number of points to pop
@@ -144,9 +192,20 @@ public:
   RVIZ_RENDERING_PUBLIC
   void popPoints(uint32_t num_points);
 
+  /// Copy of the points, converted to Point
   RVIZ_RENDERING_PUBLIC
   std::vector<Point> getPoints();
 
+  const std::vector<CompactPoint> & getCompactPoints() const {return points_;}
+
+  /// Bytes of memory held for the points of this cloud, excluding the vertex buffers
+  RVIZ_RENDERING_PUBLIC
+  size_t getMemoryUsage() const;
+
+  /// Bytes of the vertex buffers of this cloud
+  RVIZ_RENDERING_PUBLIC
+  size_t getVertexBufferMemoryUsage() const;
+
   /// Set type of rendering primitive to used; supports points, billboards, spheres and boxes.
   RVIZ_RENDERING_PUBLIC
   void setRenderMode(RenderMode mode);
@@ -195,6 +254,28 @@ public:
   RVIZ_RENDERING_PUBLIC
   void setHighlightColor(float r, float g, float b);
 
+  /**
+   * \brief Enable frustum culling and screen-space level of detail per renderable.
+   *
+   * Points added while this is enabled are grouped spatially, so that every renderable
+   * covers a compact region, and shuffled within each renderable, so that any leading part
+   * of it is a uniform subsample.
+   * Each frame, renderables outside of the camera frustum are skipped and the others draw
+   * roughly as many points as they cover pixels, further reduced to fit the point budget.
+   * Changing this setting regenerates the cloud.
+   */
+  RVIZ_RENDERING_PUBLIC
+  void setLevelOfDetailEnabled(bool enabled);
+
+  /**
+   * \brief Share a per-frame point budget between this and other point clouds, may be nullptr.
+   *
+   * A cloud drawn by several cameras in one frame reports the demand of its most
+   * demanding camera only.
+   */
+  RVIZ_RENDERING_PUBLIC
+  void setPointBudget(std::shared_ptr<PointBudget> point_budget);
+
   RVIZ_RENDERING_PUBLIC
   const Ogre::String & getMovableType() const override {return sm_Type;}
 
@@ -284,19 +365,31 @@ private:
   RVIZ_RENDERING_PUBLIC
   void finishRenderable(RenderableInternals internals, uint32_t vertex_count_of_renderable);
 
+  /// Write the points from first_point to the end of points_ to new renderables
+  RVIZ_RENDERING_PUBLIC
+  void addPointsToRenderables(size_t first_point);
+
   RVIZ_RENDERING_PUBLIC
   uint32_t getColorForPoint(
     uint32_t current_point,
-    std::vector<PointCloud::Point>::iterator point) const;
+    std::vector<CompactPoint>::const_iterator point) const;
 
   RVIZ_RENDERING_PUBLIC
   RenderableInternals addPointToHardwareBuffer(
     RenderableInternals internals,
-    std::vector<PointCloud::Point>::iterator point, uint32_t current_point);
+    std::vector<CompactPoint>::const_iterator point, uint32_t current_point);
+
+  RVIZ_RENDERING_PUBLIC
+  void computeSpatialOrder(
+    std::vector<CompactPoint>::const_iterator start_iterator,
+    std::vector<CompactPoint>::const_iterator stop_iterator);
+
+  RVIZ_RENDERING_PUBLIC
+  float getLevelOfDetail(const Ogre::AxisAlignedBox & world_box, size_t number_of_points) const;
 
   Ogre::AxisAlignedBox bounding_box_;       ///< The bounding box of this point cloud
 
-  typedef std::vector<Point> V_Point;
+  typedef std::vector<CompactPoint> V_Point;
   ///< The list of points we're displaying. Allocates to a high-water-mark.
   V_Point points_;
   uint32_t point_count_;                    ///< The number of points currently in #points_
@@ -322,6 +415,15 @@ private:
   bool current_mode_supports_geometry_shader_;
   Ogre::ColourValue pick_color_;
 
+  bool level_of_detail_enabled_;
+  std::shared_ptr<PointBudget> point_budget_;
+  ///< Frame for which demand_ was reported, a cloud drawn by several cameras counts once
+  uint64_t demand_frame_number_;
+  uint64_t demand_;
+  Ogre::Camera * current_camera_;
+  ///< Spatial key and index of the points being added, in the order written
+  std::vector<std::pair<uint32_t, uint32_t>> spatial_order_;
+
   static Ogre::String sm_Type;              ///< The "renderable type" used by Ogre
 };
 
@@ -80,6 +80,21 @@ public:
   // Avoid hidding parent class overload.
   using Ogre::SimpleRenderable::getRenderOperation;
 
+  /// Used by Ogre when rendering, only hands out the vertices selected by setLevelOfDetail()
+  RVIZ_RENDERING_PUBLIC
+  void getRenderOperation(Ogre::RenderOperation & op) override;
+
+  /**
+   * \brief Restrict rendering to the leading fraction of the points in this renderable.
+   * \param fraction Fraction of points to render, in [0, 1]
+   * \param vertices_per_point Number of vertices making up one point
+   */
+  RVIZ_RENDERING_PUBLIC
+  void setLevelOfDetail(float fraction, uint32_t vertices_per_point);
+
+  RVIZ_RENDERING_PUBLIC
+  size_t getRenderedVertexCount() const;
+
   RVIZ_RENDERING_PUBLIC
   Ogre::HardwareVertexBufferSharedPtr getBuffer();
 
@@ -112,6 +127,11 @@ private:
   void createAndBindBuffer(int num_points);
 
   PointCloud * parent_;
+
+  // shares declaration and binding with mRenderOp.vertexData, but has its own vertex range
+  std::unique_ptr<Ogre::VertexData> lod_vertex_data_;
+  float lod_fraction_;
+  uint32_t lod_vertices_per_point_;
 };
 typedef std::shared_ptr<PointCloudRenderable> PointCloudRenderablePtr;
 typedef std::deque<PointCloudRenderablePtr> PointCloudRenderableQueue;
@@ -130,6 +130,10 @@ public:
   RVIZ_RENDERING_PUBLIC
   Ogre::MaterialPtr getMaterial() {return material_;}
 
+  /// Name of the mesh resource used for the given type, empty for Mesh.
+  RVIZ_RENDERING_PUBLIC
+  static std::string getMeshName(Type shape_type);
+
   RVIZ_RENDERING_PUBLIC
   static Ogre::Entity * createEntity(
     const std::string & name, Type shape_type,
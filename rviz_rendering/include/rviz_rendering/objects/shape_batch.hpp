@@ -0,0 +1,230 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_RENDERING__OBJECTS__SHAPE_BATCH_HPP_
+#define RVIZ_RENDERING__OBJECTS__SHAPE_BATCH_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <OgreAxisAlignedBox.h>
+#include <OgreColourValue.h>
+#include <OgreHardwareIndexBuffer.h>
+#include <OgreHardwareVertexBuffer.h>
+#include <OgreMaterial.h>
+#include <OgreMatrix4.h>
+#include <OgreSimpleRenderable.h>
+#include <OgreVector.h>
+
+#include "rviz_rendering/objects/object.hpp"
+#include "rviz_rendering/objects/shape.hpp"
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace Ogre
+{
+class SceneManager;
+class SceneNode;
+class Quaternion;
+class Any;
+class Camera;
+}
+
+namespace rviz_rendering
+{
+
+class ShapeBatch;
+
+/**
+ * \class ShapeBatchRenderable
+ * \brief Renders all instances of a ShapeBatch in one draw call.
+ *
+ * The unit sized shape is copied into the vertex buffer once per instance, already transformed
+ * and colored, so the buffer only changes when the instances do.
+ */
+class ShapeBatchRenderable : public Ogre::SimpleRenderable
+{
+public:
+  RVIZ_RENDERING_PUBLIC
+  explicit ShapeBatchRenderable(ShapeBatch * parent);
+  RVIZ_RENDERING_PUBLIC
+  ~ShapeBatchRenderable() override;
+
+  RVIZ_RENDERING_PUBLIC
+  void markDirty() {dirty_ = true;}
+
+  /// Upload the instances of the parent batch, if they changed.
+  RVIZ_RENDERING_PUBLIC
+  void updateBuffers();
+
+  ShapeBatch * getShapeBatch() const {return parent_;}
+
+  /// Number of instances in the vertex buffer, exposed for testing
+  size_t getUploadedInstanceCount() const {return instance_count_;}
+
+  RVIZ_RENDERING_PUBLIC
+  Ogre::RenderOperation * getRenderOperation() {return &mRenderOp;}
+
+  // Avoid hidding parent class overload.
+  using Ogre::SimpleRenderable::getRenderOperation;
+
+  RVIZ_RENDERING_PUBLIC
+  void _updateRenderQueue(Ogre::RenderQueue * queue) override;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::String & getMovableType() const override {return sm_Type;}
+  RVIZ_RENDERING_PUBLIC
+  Ogre::Real getBoundingRadius() const override;
+  RVIZ_RENDERING_PUBLIC
+  Ogre::Real getSquaredViewDepth(const Ogre::Camera * cam) const override;
+
+  static Ogre::String sm_Type;
+
+private:
+  void reserveInstances(size_t instance_count);
+
+  ShapeBatch * parent_;
+  Ogre::HardwareVertexBufferSharedPtr vertex_buffer_;
+  Ogre::HardwareIndexBufferSharedPtr index_buffer_;
+  size_t instance_capacity_;
+  size_t instance_count_;
+  bool dirty_;
+};
+
+/**
+ * \class ShapeBatch
+ * \brief Displays many instances of one primitive shape, each with its own transform and color.
+ *
+ * Replaces one Shape, and with it one entity, scene node and material, per instance by a
+ * single renderable and material for all instances. Use it for large numbers of identical
+ * shapes, e.g. one arrow per pose.
+ */
+class ShapeBatch : public Object
+{
+public:
+  struct Instance
+  {
+    Ogre::Matrix4 transform;
+    Ogre::ColourValue color;
+  };
+
+  /**
+   * \brief Constructor
+   * @param shape_type Type of the shape, anything except Shape::Mesh
+   * @param scene_manager Scene manager this object is a part of
+   * @param parent_node A scene node to use as the parent of this object.  If NULL, uses the root scene node.
+   * @throws std::invalid_argument if shape_type is Shape::Mesh
+   */
+  RVIZ_RENDERING_PUBLIC
+  ShapeBatch(
+    Shape::Type shape_type, Ogre::SceneManager * scene_manager,
+    Ogre::SceneNode * parent_node = nullptr);
+  RVIZ_RENDERING_PUBLIC
+  ~ShapeBatch() override;
+
+  RVIZ_RENDERING_PUBLIC
+  void clear();
+  RVIZ_RENDERING_PUBLIC
+  void reserve(size_t instance_count);
+
+  /**
+   * \brief Add an instance of the shape
+   * @param transform Transform of the unit sized shape, relative to the scene node of the batch
+   * @param color Color of the instance
+   */
+  RVIZ_RENDERING_PUBLIC
+  void addInstance(const Ogre::Matrix4 & transform, const Ogre::ColourValue & color);
+  RVIZ_RENDERING_PUBLIC
+  void setInstanceColor(size_t index, const Ogre::ColourValue & color);
+
+  // overrides from Object
+  RVIZ_RENDERING_PUBLIC
+  void setOrientation(const Ogre::Quaternion & orientation) override;
+  RVIZ_RENDERING_PUBLIC
+  void setPosition(const Ogre::Vector3 & position) override;
+  RVIZ_RENDERING_PUBLIC
+  void setScale(const Ogre::Vector3 & scale) override;
+  /// Set the color of all instances
+  RVIZ_RENDERING_PUBLIC
+  void setColor(float r, float g, float b, float a) override;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::Vector3 & getPosition() override;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::Quaternion & getOrientation() override;
+
+  /**
+   * \brief Get the scene node associated with this object
+   * @return The scene node associated with this object
+   */
+  Ogre::SceneNode * getSceneNode() {return scene_node_;}
+
+  /**
+   * \brief We have no objects that we can set user data on
+   */
+  void setUserData(const Ogre::Any & data) override {(void) data;}
+
+  Ogre::MaterialPtr getMaterial() {return material_;}
+
+  Shape::Type getType() const {return type_;}
+
+  const std::vector<Instance> & getInstances() const {return instances_;}
+
+  /// Positions, normals and triangle indices of the unit sized shape
+  const std::vector<Ogre::Vector3> & getMeshPositions() const {return mesh_positions_;}
+  const std::vector<Ogre::Vector3> & getMeshNormals() const {return mesh_normals_;}
+  const std::vector<uint32_t> & getMeshIndices() const {return mesh_indices_;}
+
+  /// exposed for testing
+  ShapeBatchRenderable * getRenderable() {return renderable_;}
+
+private:
+  friend class ShapeBatchRenderable;
+
+  void loadMesh();
+  void updateBoundingBox();
+  /// Called by the renderable after uploading a new set of instances.
+  void updateAlphaBlending();
+
+  Shape::Type type_;
+  Ogre::SceneNode * scene_node_;
+  ShapeBatchRenderable * renderable_;
+  Ogre::MaterialPtr material_;
+
+  std::vector<Ogre::Vector3> mesh_positions_;
+  std::vector<Ogre::Vector3> mesh_normals_;
+  std::vector<uint32_t> mesh_indices_;
+  Ogre::AxisAlignedBox mesh_box_;
+
+  std::vector<Instance> instances_;
+  Ogre::AxisAlignedBox instances_box_;
+  bool transparent_;
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__OBJECTS__SHAPE_BATCH_HPP_
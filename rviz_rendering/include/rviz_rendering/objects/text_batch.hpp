@@ -0,0 +1,271 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_RENDERING__OBJECTS__TEXT_BATCH_HPP_
+#define RVIZ_RENDERING__OBJECTS__TEXT_BATCH_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <OgreAxisAlignedBox.h>
+#include <OgreColourValue.h>
+#include <OgreHardwareIndexBuffer.h>
+#include <OgreHardwareVertexBuffer.h>
+#include <OgreMaterial.h>
+#include <OgreSimpleRenderable.h>
+#include <OgreString.h>
+#include <OgreVector.h>
+
+#include "rviz_rendering/objects/movable_text.hpp"
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace Ogre
+{
+class Camera;
+class Font;
+class SceneManager;
+class SceneNode;
+}
+
+namespace rviz_rendering
+{
+
+class TextBatch;
+
+/// Vertex of a glyph quad, see text_billboard.vert
+struct TextBatchVertex
+{
+  float anchor[3];
+  float texture_coords[2];
+  float offset[2];
+  uint32_t color;
+};
+
+/**
+ * \class TextBatchChunk
+ * \brief Renders a group of labels of a TextBatch in one draw call.
+ *
+ * Every label owns a range of glyph quads in the vertex buffer, with some room to grow.
+ * Changing a label only rewrites its range, the chunk is only laid out again when a label
+ * outgrows its range or is removed.
+ */
+class TextBatchChunk : public Ogre::SimpleRenderable
+{
+public:
+  RVIZ_RENDERING_PUBLIC
+  explicit TextBatchChunk(TextBatch * parent);
+  RVIZ_RENDERING_PUBLIC
+  ~TextBatchChunk() override;
+
+  /// Upload the changed labels of this chunk.
+  RVIZ_RENDERING_PUBLIC
+  void updateBuffers();
+
+  /// Number of glyph quads in the vertex buffer, including unused room, exposed for testing
+  size_t getGlyphCount() const {return used_glyphs_;}
+  /// Number of labels placed in this chunk
+  size_t getLabelCount() const {return labels_.size();}
+
+  RVIZ_RENDERING_PUBLIC
+  Ogre::RenderOperation * getRenderOperation() {return &mRenderOp;}
+
+  // Avoid hidding parent class overload.
+  using Ogre::SimpleRenderable::getRenderOperation;
+
+  RVIZ_RENDERING_PUBLIC
+  void _updateRenderQueue(Ogre::RenderQueue * queue) override;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::String & getMovableType() const override {return sm_Type;}
+  RVIZ_RENDERING_PUBLIC
+  Ogre::Real getBoundingRadius() const override;
+  RVIZ_RENDERING_PUBLIC
+  Ogre::Real getSquaredViewDepth(const Ogre::Camera * cam) const override;
+
+  static Ogre::String sm_Type;
+
+private:
+  friend class TextBatch;
+
+  void reserveGlyphs(size_t glyph_count);
+  void layout();
+  void appendLabel(uint32_t label);
+  void markLabelDirty(uint32_t label);
+  void updateBoundingBox();
+
+  TextBatch * parent_;
+  std::vector<uint32_t> labels_;
+  std::vector<uint32_t> dirty_labels_;
+
+  // copy of the vertex buffer, so changed ranges can be uploaded without reading it back
+  std::vector<TextBatchVertex> vertices_;
+  Ogre::HardwareVertexBufferSharedPtr vertex_buffer_;
+  Ogre::HardwareIndexBufferSharedPtr index_buffer_;
+  size_t glyph_capacity_;
+  size_t used_glyphs_;
+
+  bool needs_layout_;
+  bool needs_full_upload_;
+};
+
+/**
+ * \class TextBatch
+ * \brief Displays many camera-facing text labels of one font with a few draw calls.
+ *
+ * Alternative to one MovableText per label. The glyphs of all labels are taken from the
+ * texture atlas of the font and packed into the vertex buffers of a few chunks, each of
+ * which is culled as a whole. A vertex shader turns the glyphs towards the camera, so the
+ * buffers only change when labels do, and then only in the ranges of the changed labels.
+ * Labels are laid out like a MovableText with the same font and character height.
+ */
+class TextBatch
+{
+public:
+  using LabelId = uint32_t;
+
+  /**
+   * \brief Constructor
+   * @param scene_manager Scene manager this object is a part of
+   * @param parent_node A scene node to use as the parent of this object.  If NULL, uses the root scene node.
+   * @param font_name Name of the font used for all labels
+   */
+  RVIZ_RENDERING_PUBLIC
+  explicit TextBatch(
+    Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node = nullptr,
+    const Ogre::String & font_name = "Liberation Sans");
+  RVIZ_RENDERING_PUBLIC
+  ~TextBatch();
+
+  /**
+   * \brief Add a label
+   * @param caption Text of the label, may contain line breaks
+   * @param position Anchor of the label, relative to the scene node of the batch
+   * @param char_height Height of a line of text
+   * @param color Color of the text
+   * @return Id of the new label, valid until it is removed
+   */
+  RVIZ_RENDERING_PUBLIC
+  LabelId addLabel(
+    const Ogre::String & caption, const Ogre::Vector3 & position,
+    Ogre::Real char_height = 1.0, const Ogre::ColourValue & color = Ogre::ColourValue::White);
+  RVIZ_RENDERING_PUBLIC
+  void removeLabel(LabelId label);
+  RVIZ_RENDERING_PUBLIC
+  void clear();
+
+  RVIZ_RENDERING_PUBLIC
+  void setCaption(LabelId label, const Ogre::String & caption);
+  RVIZ_RENDERING_PUBLIC
+  void setPosition(LabelId label, const Ogre::Vector3 & position);
+  RVIZ_RENDERING_PUBLIC
+  void setCharacterHeight(LabelId label, Ogre::Real char_height);
+  RVIZ_RENDERING_PUBLIC
+  void setColor(LabelId label, const Ogre::ColourValue & color);
+  RVIZ_RENDERING_PUBLIC
+  void setVisible(LabelId label, bool visible);
+
+  /// Alignment of all labels relative to their anchors
+  RVIZ_RENDERING_PUBLIC
+  void setTextAlignment(
+    MovableText::HorizontalAlignment horizontal_alignment,
+    MovableText::VerticalAlignment vertical_alignment);
+
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::String & getCaption(LabelId label) const;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::Vector3 & getPosition(LabelId label) const;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::ColourValue & getColor(LabelId label) const;
+  RVIZ_RENDERING_PUBLIC
+  bool getVisible(LabelId label) const;
+
+  size_t getLabelCount() const {return label_count_;}
+
+  Ogre::SceneNode * getSceneNode() {return scene_node_;}
+
+  Ogre::MaterialPtr getMaterial() {return material_;}
+
+  /// exposed for testing
+  const std::vector<std::unique_ptr<TextBatchChunk>> & getChunks() const {return chunks_;}
+
+  /// Maximum number of labels in one chunk
+  static const size_t LABELS_PER_CHUNK;
+
+private:
+  friend class TextBatchChunk;
+
+  struct Label
+  {
+    Ogre::String caption;
+    Ogre::Vector3 position;
+    Ogre::Real char_height;
+    Ogre::ColourValue color;
+    bool visible;
+    bool in_use;
+    bool dirty;
+
+    uint32_t chunk;
+    uint32_t first_glyph;
+    uint32_t glyph_capacity;
+    uint32_t glyph_count;
+    // largest distance of a glyph corner from the anchor
+    float radius;
+  };
+
+  Label & getLabel(LabelId label);
+  const Label & getLabel(LabelId label) const;
+  void updateLabel(LabelId label, bool layout_changed);
+  void measureLabel(Label & label) const;
+  Ogre::AxisAlignedBox getLabelBox(const Label & label) const;
+  /// Write the glyphs of the label to dest, padded with empty glyphs to its capacity.
+  void writeLabel(const Label & label, TextBatchVertex * dest) const;
+
+  /// Calls add_glyph(left, top, width, character) for every glyph, laid out like MovableText.
+  template<typename GlyphCallback>
+  void forEachGlyph(const Label & label, GlyphCallback add_glyph) const;
+
+  Ogre::SceneManager * scene_manager_;
+  Ogre::SceneNode * scene_node_;
+  Ogre::Font * font_;
+  Ogre::MaterialPtr material_;
+  float space_width_factor_;
+
+  MovableText::HorizontalAlignment horizontal_alignment_;
+  MovableText::VerticalAlignment vertical_alignment_;
+
+  std::vector<Label> labels_;
+  std::vector<LabelId> free_labels_;
+  size_t label_count_;
+  std::vector<std::unique_ptr<TextBatchChunk>> chunks_;
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__OBJECTS__TEXT_BATCH_HPP_
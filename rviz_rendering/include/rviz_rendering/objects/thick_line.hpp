@@ -0,0 +1,225 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_RENDERING__OBJECTS__THICK_LINE_HPP_
+#define RVIZ_RENDERING__OBJECTS__THICK_LINE_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <OgreAxisAlignedBox.h>
+#include <OgreColourValue.h>
+#include <OgreHardwareIndexBuffer.h>
+#include <OgreHardwareVertexBuffer.h>
+#include <OgreMaterial.h>
+#include <OgreSharedPtr.h>
+#include <OgreSimpleRenderable.h>
+#include <OgreVector.h>
+
+#include "rviz_rendering/objects/object.hpp"
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace Ogre
+{
+class SceneManager;
+class SceneNode;
+class Quaternion;
+class Any;
+class Camera;
+}
+
+namespace rviz_rendering
+{
+
+class ThickLine;
+
+/**
+ * \class ThickLineRenderable
+ * \brief Renders all segments of a ThickLine in one draw call.
+ *
+ * Every segment is stored as a quad of four vertices, each knowing the other end of its
+ * segment. The vertex shader moves them sideways to face the camera, so the buffers only
+ * change when the line does, not when the camera moves.
+ */
+class ThickLineRenderable : public Ogre::SimpleRenderable
+{
+public:
+  RVIZ_RENDERING_PUBLIC
+  explicit ThickLineRenderable(ThickLine * parent);
+  RVIZ_RENDERING_PUBLIC
+  ~ThickLineRenderable() override;
+
+  RVIZ_RENDERING_PUBLIC
+  void markDirty() {dirty_ = true;}
+
+  /// Upload the segments of the parent line, if they changed.
+  RVIZ_RENDERING_PUBLIC
+  void updateBuffers();
+
+  /// Number of segments in the vertex buffer, exposed for testing
+  size_t getSegmentCount() const {return segment_count_;}
+
+  RVIZ_RENDERING_PUBLIC
+  Ogre::RenderOperation * getRenderOperation() {return &mRenderOp;}
+
+  // Avoid hidding parent class overload.
+  using Ogre::SimpleRenderable::getRenderOperation;
+
+  RVIZ_RENDERING_PUBLIC
+  void _updateRenderQueue(Ogre::RenderQueue * queue) override;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::String & getMovableType() const override {return sm_Type;}
+  RVIZ_RENDERING_PUBLIC
+  Ogre::Real getBoundingRadius() const override;
+  RVIZ_RENDERING_PUBLIC
+  Ogre::Real getSquaredViewDepth(const Ogre::Camera * cam) const override;
+
+  static Ogre::String sm_Type;
+
+private:
+  void reserveSegments(size_t segment_count);
+
+  ThickLine * parent_;
+  Ogre::HardwareVertexBufferSharedPtr vertex_buffer_;
+  Ogre::HardwareIndexBufferSharedPtr index_buffer_;
+  size_t segment_capacity_;
+  size_t segment_count_;
+  bool dirty_;
+};
+
+/**
+ * \class ThickLine
+ * \brief Displays multi-segment line strips of a given width which always face the camera.
+ *
+ * Drop-in replacement for BillboardLine. Positions, colors and widths of all lines are kept in
+ * a single vertex buffer which is expanded to camera-facing quads in a vertex shader, instead of
+ * recomputing billboard chains on the CPU every frame.
+ * Unlike BillboardLine, consecutive segments are not mitred, they overlap at the joints.
+ */
+class ThickLine : public Object
+{
+public:
+  struct Point
+  {
+    Ogre::Vector3 position;
+    Ogre::ColourValue color;
+  };
+
+  /**
+   * \brief Constructor
+   * @param manager Scene manager this object is a part of
+   * @param parent_node A scene node to use as the parent of this object.  If NULL, uses the root scene node.
+   */
+  RVIZ_RENDERING_PUBLIC
+  explicit ThickLine(Ogre::SceneManager * manager, Ogre::SceneNode * parent_node = nullptr);
+  RVIZ_RENDERING_PUBLIC
+  ~ThickLine() override;
+
+  RVIZ_RENDERING_PUBLIC
+  void clear();
+  RVIZ_RENDERING_PUBLIC
+  void finishLine();
+  RVIZ_RENDERING_PUBLIC
+  void addPoint(const Ogre::Vector3 & point);
+  RVIZ_RENDERING_PUBLIC
+  void addPoint(const Ogre::Vector3 & point, const Ogre::ColourValue & color);
+
+  RVIZ_RENDERING_PUBLIC
+  void setLineWidth(float width);
+
+  /// Only used to reserve memory, lines are not limited in length.
+  RVIZ_RENDERING_PUBLIC
+  void setMaxPointsPerLine(uint32_t max);
+  RVIZ_RENDERING_PUBLIC
+  void setNumLines(uint32_t num);
+
+  // overrides from Object
+  RVIZ_RENDERING_PUBLIC
+  void setOrientation(const Ogre::Quaternion & orientation) override;
+  RVIZ_RENDERING_PUBLIC
+  void setPosition(const Ogre::Vector3 & position) override;
+  RVIZ_RENDERING_PUBLIC
+  void setScale(const Ogre::Vector3 & scale) override;
+  RVIZ_RENDERING_PUBLIC
+  void setColor(float r, float g, float b, float a) override;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::Vector3 & getPosition() override;
+  RVIZ_RENDERING_PUBLIC
+  const Ogre::Quaternion & getOrientation() override;
+
+  /**
+   * \brief Get the scene node associated with this object
+   * @return The scene node associated with this object
+   */
+  Ogre::SceneNode * getSceneNode() {return scene_node_;}
+
+  /**
+   * \brief We have no objects that we can set user data on
+   */
+  void setUserData(const Ogre::Any & data) override {(void) data;}
+
+  Ogre::MaterialPtr getMaterial() {return material_;}
+
+  float getLineWidth() const {return width_;}
+
+  /// Points of all lines, the first point of each line is given by getLineStarts()
+  const std::vector<Point> & getPoints() const {return points_;}
+  const std::vector<uint32_t> & getLineStarts() const {return line_starts_;}
+
+  /// exposed for testing
+  ThickLineRenderable * getRenderable() {return renderable_;}
+
+private:
+  friend class ThickLineRenderable;
+
+  void addPointInternal(const Ogre::Vector3 & point, const Ogre::ColourValue & color);
+  void updateBoundingBox();
+  /// Called by the renderable after uploading a new set of points.
+  void updateAlphaBlending();
+
+  Ogre::SceneNode * scene_node_;
+  ThickLineRenderable * renderable_;
+  Ogre::MaterialPtr material_;
+
+  Ogre::ColourValue color_;
+  float width_;
+
+  uint32_t num_lines_;
+  uint32_t max_points_per_line_;
+
+  std::vector<Point> points_;
+  std::vector<uint32_t> line_starts_;
+  Ogre::AxisAlignedBox points_box_;
+  bool transparent_;
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__OBJECTS__THICK_LINE_HPP_
@@ -0,0 +1,125 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_RENDERING__VERTEX_BUFFER_POOL_HPP_
+#define RVIZ_RENDERING__VERTEX_BUFFER_POOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <OgreHardwareVertexBuffer.h>
+
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace rviz_rendering
+{
+
+/**
+ * \class VertexBufferPool
+ * \brief Recycles dynamic hardware vertex buffers, shared by all point clouds.
+ *
+ * Buffers are handed out in size classes, four per doubling of the vertex count, and kept
+ * when they are released, so that clouds arriving at a high rate do not keep creating and
+ * destroying buffers on the GPU. Recycled buffers should be locked with HBL_DISCARD, so the
+ * driver does not have to wait until earlier frames using them are done.
+ *
+ * Only to be used from the thread which renders.
+ */
+class VertexBufferPool
+{
+public:
+  struct Statistics
+  {
+    /// Number of buffers handed out
+    uint64_t acquired = 0;
+    /// Number of buffers handed out which were recycled
+    uint64_t reused = 0;
+    /// Bytes of all buffers created by the pool and not destroyed yet, in use or idle
+    size_t resident_bytes = 0;
+    /// Bytes of the released buffers waiting to be reused
+    size_t idle_bytes = 0;
+
+    double getHitRate() const
+    {
+      return acquired > 0 ? static_cast<double>(reused) / static_cast<double>(acquired) : 0.0;
+    }
+  };
+
+  RVIZ_RENDERING_PUBLIC
+  static VertexBufferPool & getSingleton();
+
+  /**
+   * \brief Get a buffer of at least vertex_count vertices.
+   * @return A buffer of the size class of vertex_count, which may contain old data
+   */
+  RVIZ_RENDERING_PUBLIC
+  Ogre::HardwareVertexBufferSharedPtr acquire(size_t vertex_size, size_t vertex_count);
+
+  /// Hand a buffer from acquire() back, once nothing renders it anymore.
+  RVIZ_RENDERING_PUBLIC
+  void release(const Ogre::HardwareVertexBufferSharedPtr & buffer);
+
+  /// Destroy all idle buffers, has to happen before the render system goes away.
+  RVIZ_RENDERING_PUBLIC
+  void clearIdleBuffers();
+
+  /// Released buffers beyond this many idle bytes are destroyed instead of kept.
+  RVIZ_RENDERING_PUBLIC
+  void setMaxIdleBytes(size_t max_idle_bytes);
+
+  RVIZ_RENDERING_PUBLIC
+  Statistics getStatistics() const {return statistics_;}
+
+  /// Number of vertices of the buffers handed out for vertex_count vertices
+  RVIZ_RENDERING_PUBLIC
+  static size_t getSizeClass(size_t vertex_count);
+
+  RVIZ_RENDERING_PUBLIC
+  static const size_t DEFAULT_MAX_IDLE_BYTES;
+
+private:
+  VertexBufferPool();
+
+  /// Stop accounting for a buffer, it is destroyed with its last reference
+  void forget(const Ogre::HardwareVertexBufferSharedPtr & buffer);
+
+  // idle buffers by vertex size and size class
+  std::map<std::pair<size_t, size_t>, std::vector<Ogre::HardwareVertexBufferSharedPtr>>
+  idle_buffers_;
+  size_t max_idle_bytes_;
+  Statistics statistics_;
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__VERTEX_BUFFER_POOL_HPP_
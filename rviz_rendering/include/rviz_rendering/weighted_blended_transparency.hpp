@@ -0,0 +1,93 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef RVIZ_RENDERING__WEIGHTED_BLENDED_TRANSPARENCY_HPP_
+#define RVIZ_RENDERING__WEIGHTED_BLENDED_TRANSPARENCY_HPP_
+
+#include <string>
+
+#include <OgreMaterial.h>
+
+#include "rviz_rendering/visibility_control.hpp"
+
+namespace Ogre
+{
+class Viewport;
+}
+
+namespace rviz_rendering
+{
+
+/**
+ * \class WeightedBlendedTransparency
+ * \brief Order-independent transparency for a viewport.
+ *
+ * Instead of sorting translucent objects back to front and blending them one by one, the
+ * compositor rviz/WeightedBlendedTransparency renders them in any order into an accumulation
+ * target, which is then composited over the opaque scene in a single pass. The result is an
+ * approximation, weighted towards near and opaque fragments.
+ *
+ * A material takes part once it has been passed to updateMaterial(), which
+ * MaterialManager::enableAlphaBlending() and PointCloud::setAlpha() do. Translucent materials
+ * whose fragment program has no weighted blended variant keep their sorted blending.
+ */
+class RVIZ_RENDERING_PUBLIC WeightedBlendedTransparency
+{
+public:
+  /// Material scheme of the translucent objects
+  static const char * const SCHEME;
+  /// Material scheme of the opaque objects
+  static const char * const OPAQUE_SCHEME;
+  static const char * const COMPOSITOR;
+
+  /**
+   * \brief Add or remove the compositor on the viewport.
+   * @return False if it could not be enabled, e.g. because float render targets are not
+   * supported, in which case the viewport is left as it is.
+   */
+  static bool setEnabled(Ogre::Viewport * viewport, bool enabled);
+
+  static bool isEnabled(Ogre::Viewport * viewport);
+
+  /**
+   * \brief Add techniques for the weighted blended schemes to a translucent material.
+   *
+   * The techniques are derived from the first pass of the default technique, so this has to
+   * be called again after its blending changed. Opaque materials lose the techniques again.
+   */
+  static void updateMaterial(const Ogre::MaterialPtr & material);
+
+  /// Name of the weighted blended variant of a fragment program, empty if there is none
+  static std::string getFragmentProgram(const Ogre::Pass * pass);
+};
+
+}  // namespace rviz_rendering
+
+#endif  // RVIZ_RENDERING__WEIGHTED_BLENDED_TRANSPARENCY_HPP_
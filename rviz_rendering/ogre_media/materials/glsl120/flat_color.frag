@@ -6,8 +6,16 @@ uniform vec4 highlight;
 uniform float alpha;
 
 
+#ifdef WEIGHTED_BLENDED
+void writeWeightedBlended(vec4 color);
+#endif
+
 void main()
 {
   vec3 col = gl_Color.xyz + gl_Color.xyz * highlight.xyz;
+#ifdef WEIGHTED_BLENDED
+  writeWeightedBlended(vec4(col, gl_Color.a * alpha));
+#else
   gl_FragColor = vec4(col, gl_Color.a * alpha);
+#endif
 }
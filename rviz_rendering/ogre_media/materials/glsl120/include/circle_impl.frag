@@ -1,9 +1,17 @@
 #version 120
 
+#ifdef WEIGHTED_BLENDED
+void writeWeightedBlended(vec4 color);
+#endif
+
 // rasterizes a circle of radius 0.5
 void circleImpl( vec4 color, float ax, float ay )
 {
   float rsquared = ax*ax+ay*ay;
   float a = (0.25 - rsquared) * 4.0;
+#ifdef WEIGHTED_BLENDED
+  writeWeightedBlended(vec4(color.rgb, color.a * ceil(a)));
+#else
   gl_FragColor = vec4(color.rgb, color.a * ceil(a));
+#endif
 }
@@ -0,0 +1,17 @@
+#version 120
+
+// Writes a fragment for weighted blended order-independent transparency
+// (McGuire and Bavoil, JCGT 2013) into the two targets of rviz/WeightedBlendedTransparency.
+// Target 0 is blended with one/one for the color and zero/one_minus_src_alpha for the alpha,
+// so it sums up the weighted premultiplied colors and keeps the product of (1 - alpha),
+// the revealage. Target 1 sums up the weights.
+
+void writeWeightedBlended(vec4 color)
+{
+  // favours near and opaque fragments, clamped to the range of 16 bit floats
+  float weight = clamp(
+    pow(min(1.0, color.a * 10.0) + 0.01, 3.0) * 1e8 * pow(1.0 - gl_FragCoord.z * 0.9, 3.0),
+    1e-2, 3e3);
+  gl_FragData[0] = vec4(color.rgb * color.a * weight, color.a);
+  gl_FragData[1] = vec4(color.a * weight);
+}
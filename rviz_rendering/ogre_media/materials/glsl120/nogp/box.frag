@@ -10,6 +10,10 @@ uniform float alpha;
 const float lightness[6] = float[] (
     0.9, 0.5, 0.6, 0.6, 1.0, 0.4 );
 
+#ifdef WEIGHTED_BLENDED
+void writeWeightedBlended(vec4 color);
+#endif
+
 void main()
 {
   float ax;
@@ -68,5 +72,9 @@ void main()
   col = col + col * highlight.xyz;
 
 
+#ifdef WEIGHTED_BLENDED
+  writeWeightedBlended(vec4(col.r, col.g, col.b, alpha * gl_Color.a ));
+#else
   gl_FragColor = vec4(col.r, col.g, col.b, alpha * gl_Color.a );
+#endif
 }
@@ -0,0 +1,22 @@
+#version 120
+
+// Computes the position of a text glyph vertex so all labels
+// of a text batch face the camera.
+// The vertex position is the anchor of the label, the second
+// texture coords hold the offset of the vertex from the anchor
+// along the screen axes.
+
+uniform mat4 worldviewproj_matrix;
+uniform mat4 inverse_worldview_matrix;
+
+void main()
+{
+  vec3 right = normalize(inverse_worldview_matrix[0].xyz);
+  vec3 up = normalize(inverse_worldview_matrix[1].xyz);
+
+  vec4 pos = gl_Vertex + vec4( right * gl_MultiTexCoord1.x + up * gl_MultiTexCoord1.y, 0.0 );
+
+  gl_Position = worldviewproj_matrix * pos;
+  gl_TexCoord[0] = gl_MultiTexCoord0;
+  gl_FrontColor = gl_Color;
+}
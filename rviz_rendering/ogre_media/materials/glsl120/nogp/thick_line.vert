@@ -0,0 +1,36 @@
+#version 120
+
+// Computes the position of a thick line vertex so the resulting
+// segment quad will face the camera.
+// The texture coords hold the other end of the segment (xyz)
+// and the signed half width of the line (w).
+
+uniform mat4 worldviewproj_matrix;
+uniform vec4 camera_pos;
+
+#ifdef WITH_DEPTH
+  //include:
+  void passDepth( vec4 pos );
+#endif
+
+void main()
+{
+  vec3 along = gl_MultiTexCoord0.xyz - gl_Vertex.xyz;
+  vec3 at = camera_pos.xyz - gl_Vertex.xyz;
+  vec3 side = cross(along, at);
+
+  // segments pointing at the camera collapse to a point
+  float side_length = length(side);
+  if (side_length > 0.0) {
+    side = side / side_length;
+  }
+
+  vec4 pos = gl_Vertex + vec4( side * gl_MultiTexCoord0.w, 0.0 );
+
+  gl_Position = worldviewproj_matrix * pos;
+  gl_FrontColor = gl_Color;
+
+#ifdef WITH_DEPTH
+  passDepth( pos );
+#endif
+}
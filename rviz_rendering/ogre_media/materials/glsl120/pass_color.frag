@@ -2,7 +2,15 @@
 
 // Passes the fragment color unchanged 
 
+#ifdef WEIGHTED_BLENDED
+void writeWeightedBlended(vec4 color);
+#endif
+
 void main()
 {
+#ifdef WEIGHTED_BLENDED
+  writeWeightedBlended(gl_Color);
+#else
   gl_FragColor = gl_Color;
+#endif
 }
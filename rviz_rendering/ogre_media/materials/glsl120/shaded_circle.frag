@@ -6,6 +6,10 @@ uniform vec4 highlight;
 uniform float alpha;
 
 
+#ifdef WEIGHTED_BLENDED
+void writeWeightedBlended(vec4 color);
+#endif
+
 void main()
 {
   float ax = gl_TexCoord[0].x-0.5;
@@ -18,5 +22,9 @@ void main()
 
   col = col + col * highlight.xyz;
   
+#ifdef WEIGHTED_BLENDED
+  writeWeightedBlended(vec4(col, alpha * ceil(a) * gl_Color.a));
+#else
   gl_FragColor = vec4(col, alpha * ceil(a) * gl_Color.a);
+#endif
 }
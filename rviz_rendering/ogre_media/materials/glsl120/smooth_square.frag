@@ -5,6 +5,10 @@
 uniform vec4 highlight;
 uniform float alpha;
 
+#ifdef WEIGHTED_BLENDED
+void writeWeightedBlended(vec4 color);
+#endif
+
 void main()
 {
   float ax = gl_TexCoord[0].x-0.5;
@@ -21,5 +25,9 @@ void main()
   
   col = col + col * highlight.xyz;
 
+#ifdef WEIGHTED_BLENDED
+  writeWeightedBlended(vec4(col.r, col.g, col.b, alpha * gl_Color.a ));
+#else
   gl_FragColor = vec4(col.r, col.g, col.b, alpha * gl_Color.a );
+#endif
 }
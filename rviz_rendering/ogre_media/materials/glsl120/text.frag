@@ -0,0 +1,10 @@
+#version 120
+
+// Draws a glyph of a font texture in the vertex color.
+
+uniform sampler2D font_texture;
+
+void main()
+{
+  gl_FragColor = gl_Color * texture2D( font_texture, gl_TexCoord[0].xy );
+}
@@ -0,0 +1,19 @@
+#version 120
+
+// Composites the translucent fragments accumulated by weighted blended transparency
+// over the opaque scene
+
+uniform sampler2D scene;
+uniform sampler2D accumulation;
+uniform sampler2D weights;
+
+void main()
+{
+  vec4 opaque = texture2D(scene, gl_TexCoord[0].xy);
+  vec4 accum = texture2D(accumulation, gl_TexCoord[0].xy);
+  float revealage = accum.a;
+  float weight = texture2D(weights, gl_TexCoord[0].xy).r;
+
+  vec3 translucent = accum.rgb / max(weight, 1e-5);
+  gl_FragColor = vec4(mix(translucent, opaque.rgb, revealage), opaque.a);
+}
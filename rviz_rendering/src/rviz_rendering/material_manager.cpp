@@ -36,6 +36,8 @@
 #include <OgreMaterial.h>
 #include <OgreTechnique.h>
 
+#include "rviz_rendering/weighted_blended_transparency.hpp"
+
 namespace rviz_rendering
 {
 
@@ -107,6 +109,7 @@ void MaterialManager::enableAlphaBlending(Ogre::MaterialPtr material, float alph
     material->setSceneBlending(Ogre::SBT_REPLACE);
     material->setDepthWriteEnabled(true);
   }
+  WeightedBlendedTransparency::updateMaterial(material);
 }
 
 void MaterialManager::enableAlphaBlending(
@@ -0,0 +1,130 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_rendering/objects/arrow_batch.hpp"
+
+#include <memory>
+
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+
+namespace rviz_rendering
+{
+
+ArrowBatch::ArrowBatch(
+  Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node, float shaft_length,
+  float shaft_diameter, float head_length, float head_diameter)
+: scene_manager_(scene_manager)
+{
+  if (!parent_node) {
+    parent_node = scene_manager_->getRootSceneNode();
+  }
+
+  scene_node_ = parent_node->createChildSceneNode();
+
+  shafts_ = std::make_unique<ShapeBatch>(Shape::Cylinder, scene_manager_, scene_node_);
+  heads_ = std::make_unique<ShapeBatch>(Shape::Cone, scene_manager_, scene_node_);
+
+  set(shaft_length, shaft_diameter, head_length, head_diameter);
+}
+
+ArrowBatch::~ArrowBatch()
+{
+  shafts_.reset();
+  heads_.reset();
+  scene_manager_->destroySceneNode(scene_node_);
+}
+
+void ArrowBatch::clear()
+{
+  arrows_.clear();
+  shafts_->clear();
+  heads_->clear();
+}
+
+void ArrowBatch::reserve(size_t arrow_count)
+{
+  arrows_.reserve(arrow_count);
+  shafts_->reserve(arrow_count);
+  heads_->reserve(arrow_count);
+}
+
+void ArrowBatch::addArrow(
+  const Ogre::Vector3 & position, const Ogre::Quaternion & orientation,
+  const Ogre::ColourValue & color)
+{
+  arrows_.push_back({position, orientation, color});
+  addInstances(arrows_.back());
+}
+
+void ArrowBatch::addInstances(const ArrowPose & arrow)
+{
+  // "forward" (negative z) is the identity orientation, as for Arrow
+  Ogre::Matrix4 arrow_transform;
+  arrow_transform.makeTransform(
+    arrow.position, Ogre::Vector3::UNIT_SCALE,
+    arrow.orientation * Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_X));
+
+  shafts_->addInstance(arrow_transform * shaft_transform_, arrow.color);
+  heads_->addInstance(arrow_transform * head_transform_, arrow.color);
+}
+
+void ArrowBatch::set(
+  float shaft_length, float shaft_diameter, float head_length, float head_diameter)
+{
+  shaft_transform_.makeTransform(
+    Ogre::Vector3(0.0f, shaft_length / 2.0f, 0.0f),
+    Ogre::Vector3(shaft_diameter, shaft_length, shaft_diameter),
+    Ogre::Quaternion::IDENTITY);
+
+  // the cone mesh is centered on its origin, move its base to the end of the shaft
+  head_transform_.makeTransform(
+    Ogre::Vector3(0.0f, shaft_length, 0.0f),
+    Ogre::Vector3(head_diameter, head_length, head_diameter),
+    Ogre::Quaternion::IDENTITY);
+  head_transform_ = head_transform_ * Ogre::Matrix4::getTrans(0.0f, 0.5f, 0.0f);
+
+  shafts_->clear();
+  heads_->clear();
+  for (const auto & arrow : arrows_) {
+    addInstances(arrow);
+  }
+}
+
+void ArrowBatch::setColor(const Ogre::ColourValue & color)
+{
+  for (auto & arrow : arrows_) {
+    arrow.color = color;
+  }
+  shafts_->setColor(color.r, color.g, color.b, color.a);
+  heads_->setColor(color.r, color.g, color.b, color.a);
+}
+
+}  // namespace rviz_rendering
@@ -0,0 +1,112 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_rendering/objects/axes_batch.hpp"
+
+#include <memory>
+#include <utility>
+
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+
+#include "rviz_rendering/objects/axes.hpp"
+
+namespace rviz_rendering
+{
+
+AxesBatch::AxesBatch(
+  Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node, float length, float radius)
+: scene_manager_(scene_manager)
+{
+  if (!parent_node) {
+    parent_node = scene_manager_->getRootSceneNode();
+  }
+
+  scene_node_ = parent_node->createChildSceneNode();
+
+  cylinders_ = std::make_unique<ShapeBatch>(Shape::Cylinder, scene_manager_, scene_node_);
+
+  set(length, radius);
+}
+
+AxesBatch::~AxesBatch()
+{
+  cylinders_.reset();
+  scene_manager_->destroySceneNode(scene_node_);
+}
+
+void AxesBatch::clear()
+{
+  poses_.clear();
+  cylinders_->clear();
+}
+
+void AxesBatch::reserve(size_t axes_count)
+{
+  poses_.reserve(axes_count);
+  cylinders_->reserve(3 * axes_count);
+}
+
+void AxesBatch::addAxes(const Ogre::Vector3 & position, const Ogre::Quaternion & orientation)
+{
+  poses_.emplace_back(position, orientation);
+  addInstances(position, orientation);
+}
+
+void AxesBatch::addInstances(const Ogre::Vector3 & position, const Ogre::Quaternion & orientation)
+{
+  Ogre::Matrix4 axes_transform;
+  axes_transform.makeTransform(position, Ogre::Vector3::UNIT_SCALE, orientation);
+
+  cylinders_->addInstance(axes_transform * axis_transforms_[0], Axes::getDefaultXColor());
+  cylinders_->addInstance(axes_transform * axis_transforms_[1], Axes::getDefaultYColor());
+  cylinders_->addInstance(axes_transform * axis_transforms_[2], Axes::getDefaultZColor());
+}
+
+void AxesBatch::set(float length, float radius)
+{
+  // the cylinder mesh is aligned with y, same placement as in Axes
+  Ogre::Vector3 scale(radius, length, radius);
+  axis_transforms_[0].makeTransform(
+    Ogre::Vector3(length / 2.0f, 0.0f, 0.0f), scale,
+    Ogre::Quaternion(Ogre::Degree(-90), Ogre::Vector3::UNIT_Z));
+  axis_transforms_[1].makeTransform(
+    Ogre::Vector3(0.0f, length / 2.0f, 0.0f), scale, Ogre::Quaternion::IDENTITY);
+  axis_transforms_[2].makeTransform(
+    Ogre::Vector3(0.0f, 0.0f, length / 2.0f), scale,
+    Ogre::Quaternion(Ogre::Degree(90), Ogre::Vector3::UNIT_X));
+
+  cylinders_->clear();
+  for (const auto & pose : poses_) {
+    addInstances(pose.first, pose.second);
+  }
+}
+
+}  // namespace rviz_rendering
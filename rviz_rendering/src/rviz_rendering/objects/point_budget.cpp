@@ -0,0 +1,85 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "rviz_rendering/objects/point_budget.hpp"
+
+namespace rviz_rendering
+{
+
+PointBudget::PointBudget(uint64_t max_points)
+: max_points_(max_points),
+  frame_number_(0),
+  current_demand_(0),
+  last_demand_(0),
+  scale_(1.0f)
+{}
+
+std::shared_ptr<PointBudget> PointBudget::getGlobal()
+{
+  static auto budget = std::make_shared<PointBudget>();
+  return budget;
+}
+
+void PointBudget::setMaxPoints(uint64_t max_points)
+{
+  max_points_ = max_points;
+}
+
+uint64_t PointBudget::getMaxPoints() const
+{
+  return max_points_;
+}
+
+float PointBudget::getScale(uint64_t frame_number)
+{
+  if (frame_number != frame_number_) {
+    frame_number_ = frame_number;
+    last_demand_ = current_demand_;
+    current_demand_ = 0;
+
+    if (max_points_ > 0 && last_demand_ > max_points_) {
+      scale_ = static_cast<float>(static_cast<double>(max_points_) / last_demand_);
+    } else {
+      scale_ = 1.0f;
+    }
+  }
+  return scale_;
+}
+
+void PointBudget::addDemand(uint64_t number_of_points)
+{
+  current_demand_ += number_of_points;
+}
+
+uint64_t PointBudget::getLastDemand() const
+{
+  return last_demand_;
+}
+
+}  // namespace rviz_rendering
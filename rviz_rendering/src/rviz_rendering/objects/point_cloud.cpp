@@ -33,7 +33,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <memory>
+#include <random>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include <OgreSceneManager.h>
@@ -49,10 +53,12 @@
 #include <OgreSharedPtr.h>
 #include <OgreTechnique.h>
 #include <OgreCamera.h>
+#include <OgreViewport.h>
 
 #include "rviz_rendering/custom_parameter_indices.hpp"
 #include "rviz_rendering/logging.hpp"
 #include "rviz_rendering/material_manager.hpp"
+#include "rviz_rendering/weighted_blended_transparency.hpp"
 
 // TODO(greimela): Add again after clearing up the module dependencies
 // #include "rviz_rendering/selection/forwards.hpp"
@@ -208,7 +214,11 @@ PointCloud::PointCloud()
   common_direction_(Ogre::Vector3::NEGATIVE_UNIT_Z),
   common_up_vector_(Ogre::Vector3::UNIT_Y),
   color_by_index_(false),
-  current_mode_supports_geometry_shader_(false)
+  current_mode_supports_geometry_shader_(false),
+  level_of_detail_enabled_(false),
+  demand_frame_number_(0),
+  demand_(0),
+  current_camera_(nullptr)
 {
   std::stringstream ss;
   static int count = 0;
@@ -319,7 +329,7 @@ void PointCloud::regenerateAll()
 
   clear();
 
-  addPoints(points.begin(), points.end());
+  addPoints(std::move(points));
 }
 
 void PointCloud::setColorByIndex(bool set)
@@ -337,6 +347,21 @@ void PointCloud::setHighlightColor(float r, float g, float b)
   }
 }
 
+void PointCloud::setLevelOfDetailEnabled(bool enabled)
+{
+  if (level_of_detail_enabled_ == enabled) {
+    return;
+  }
+  level_of_detail_enabled_ = enabled;
+  regenerateAll();
+}
+
+void PointCloud::setPointBudget(std::shared_ptr<PointBudget> point_budget)
+{
+  point_budget_ = std::move(point_budget);
+  demand_ = 0;
+}
+
 void PointCloud::setRenderMode(RenderMode mode)
 {
   render_mode_ = mode;
@@ -422,6 +447,7 @@ void setAlphaBlending(const Ogre::MaterialPtr & mat)
     mat->getBestTechnique()->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
     mat->getBestTechnique()->setDepthWriteEnabled(false);
   }
+  WeightedBlendedTransparency::updateMaterial(mat);
 }
 
 void setReplace(const Ogre::MaterialPtr & mat)
@@ -430,6 +456,7 @@ void setReplace(const Ogre::MaterialPtr & mat)
     mat->getBestTechnique()->setSceneBlending(Ogre::SBT_REPLACE);
     mat->getBestTechnique()->setDepthWriteEnabled(true);
   }
+  WeightedBlendedTransparency::updateMaterial(mat);
 }
 
 void PointCloud::setAlpha(float alpha, bool per_point_alpha)
@@ -461,7 +488,7 @@ void PointCloud::setAlpha(float alpha, bool per_point_alpha)
 void PointCloud::setColor(const Ogre::ColourValue & color)
 {
   for (auto & point : points_) {
-    point.setColor(color.r, color.g, color.b, color.a);
+    point.setColor(color);
   }
   regenerateAll();
 }
@@ -473,28 +500,72 @@ void PointCloud::addPoints(
   if (stop_iterator - start_iterator <= 0) {
     return;
   }
-  auto num_points = static_cast<uint32_t>(std::distance(start_iterator, stop_iterator));
+  size_t first_point = points_.size();
+  points_.reserve(first_point + std::distance(start_iterator, stop_iterator));
+  for (auto point = start_iterator; point != stop_iterator; ++point) {
+    points_.emplace_back(*point);
+  }
+
+  addPointsToRenderables(first_point);
+}
+
+void PointCloud::addPoints(
+  std::vector<CompactPoint>::const_iterator start_iterator,
+  std::vector<CompactPoint>::const_iterator stop_iterator)
+{
+  if (stop_iterator - start_iterator <= 0) {
+    return;
+  }
+  size_t first_point = points_.size();
   points_.insert(points_.cend(), start_iterator, stop_iterator);
 
+  addPointsToRenderables(first_point);
+}
+
+void PointCloud::addPoints(std::vector<CompactPoint> && points)
+{
+  if (points.empty()) {
+    return;
+  }
+  size_t first_point = points_.size();
+  if (points_.empty()) {
+    points_ = std::move(points);
+  } else {
+    points_.insert(points_.cend(), points.cbegin(), points.cend());
+  }
+
+  addPointsToRenderables(first_point);
+}
+
+void PointCloud::addPointsToRenderables(size_t first_point)
+{
+  auto start_iterator = points_.cbegin() + first_point;
+  auto stop_iterator = points_.cend();
+  auto num_points = static_cast<uint32_t>(std::distance(start_iterator, stop_iterator));
+
+  if (level_of_detail_enabled_) {
+    computeSpatialOrder(start_iterator, stop_iterator);
+  }
+
   RenderableInternals internals = createNewRenderable(num_points);
 
-  for (auto current_point = start_iterator; current_point < stop_iterator; ++current_point) {
+  for (uint32_t i = 0; i < num_points; ++i) {
+    uint32_t point_index = level_of_detail_enabled_ ? spatial_order_[i].second : i;
+    auto current_point = start_iterator + point_index;
     if (internals.bufferIsFull()) {
       assert(internals.noBufferOverflowOccurred());
 
-      finishRenderable(
-        internals,
-        static_cast<uint32_t>(internals.rend->getBuffer()->getNumVertices()));
+      finishRenderable(internals, internals.buffer_size);
 
-      internals = createNewRenderable(static_cast<uint32_t>(stop_iterator - current_point));
+      internals = createNewRenderable(num_points - i);
     }
     internals.aabb.merge(current_point->position);
-    internals = addPointToHardwareBuffer(
-      internals, current_point,
-      static_cast<uint32_t>(current_point - start_iterator));
+    internals = addPointToHardwareBuffer(internals, current_point, point_index);
   }
 
   finishRenderable(internals, internals.current_vertex_count);
+  // only needed while writing, do not hold on to it for large clouds
+  std::vector<std::pair<uint32_t, uint32_t>>().swap(spatial_order_);
 
   point_count_ += num_points;
 
@@ -503,6 +574,70 @@ void PointCloud::addPoints(
   }
 }
 
+namespace
+{
+
+// spreads the lower 10 bits of value so that there are two zero bits between each of them
+inline uint32_t spreadBits(uint32_t value)
+{
+  value &= 0x3ff;
+  value = (value | (value << 16)) & 0x030000ff;
+  value = (value | (value << 8)) & 0x0300f00f;
+  value = (value | (value << 4)) & 0x030c30c3;
+  value = (value | (value << 2)) & 0x09249249;
+  return value;
+}
+
+inline uint32_t quantize(float value, float minimum, float scale)
+{
+  if (!std::isfinite(value)) {
+    return 0;
+  }
+  return static_cast<uint32_t>(std::min(std::max((value - minimum) * scale, 0.0f), 1023.0f));
+}
+
+}  // namespace
+
+void PointCloud::computeSpatialOrder(
+  std::vector<CompactPoint>::const_iterator start_iterator,
+  std::vector<CompactPoint>::const_iterator stop_iterator)
+{
+  auto num_points = static_cast<uint32_t>(stop_iterator - start_iterator);
+
+  Ogre::AxisAlignedBox box;
+  for (auto point = start_iterator; point != stop_iterator; ++point) {
+    if (point->position.isNaN()) {
+      continue;
+    }
+    box.merge(point->position);
+  }
+  if (box.isNull()) {
+    box.setExtents(Ogre::Vector3::ZERO, Ogre::Vector3::ZERO);
+  }
+  Ogre::Vector3 minimum = box.getMinimum();
+  float scale = 1023.0f / std::max(box.getSize().length(), 1e-6f);
+
+  // sort along a z-order curve, so that consecutive points, and therefore renderables,
+  // cover compact regions of space
+  spatial_order_.resize(num_points);
+  for (uint32_t i = 0; i < num_points; ++i) {
+    const Ogre::Vector3 & position = (start_iterator + i)->position;
+    spatial_order_[i].first = spreadBits(quantize(position.x, minimum.x, scale)) |
+      spreadBits(quantize(position.y, minimum.y, scale)) << 1 |
+      spreadBits(quantize(position.z, minimum.z, scale)) << 2;
+    spatial_order_[i].second = i;
+  }
+  std::sort(spatial_order_.begin(), spatial_order_.end());
+
+  // shuffle within each renderable, so that a leading part of it is a uniform subsample
+  uint32_t points_per_renderable = std::max(VERTEX_BUFFER_CAPACITY / getVerticesPerPoint(), 1u);
+  std::minstd_rand random_engine;
+  for (uint32_t begin = 0; begin < num_points; begin += points_per_renderable) {
+    uint32_t end = std::min(begin + points_per_renderable, num_points);
+    std::shuffle(spatial_order_.begin() + begin, spatial_order_.begin() + end, random_engine);
+  }
+}
+
 PointCloud::RenderableInternals
 PointCloud::createNewRenderable(uint32_t number_of_points_to_be_added)
 {
@@ -513,8 +648,9 @@ PointCloud::createNewRenderable(uint32_t number_of_points_to_be_added)
 
   internals.rend = createRenderable(internals.buffer_size, getRenderOperationType());
 
+  // the buffer may be recycled and still be in use by a previous frame
   internals.float_buffer = reinterpret_cast<float *>(internals.rend->getBuffer()
-    ->lock(Ogre::HardwareBuffer::HBL_NO_OVERWRITE));
+    ->lock(Ogre::HardwareBuffer::HBL_DISCARD));
 
   internals.aabb.setNull();
   return internals;
@@ -553,7 +689,7 @@ PointCloud::finishRenderable(
 
 uint32_t PointCloud::getColorForPoint(
   uint32_t current_point,
-  std::vector<PointCloud::Point>::iterator point) const
+  std::vector<PointCloud::CompactPoint>::const_iterator point) const
 {
   uint32_t color;
 
@@ -567,7 +703,7 @@ uint32_t PointCloud::getColorForPoint(
     c.b = (color & 0xff) / 255.0f;
     color = c.getAsBYTE();
   } else {
-    color = point->color.getAsBYTE();
+    color = point->color;
   }
   return color;
 }
@@ -575,7 +711,7 @@ uint32_t PointCloud::getColorForPoint(
 PointCloud::RenderableInternals
 PointCloud::addPointToHardwareBuffer(
   PointCloud::RenderableInternals internals,
-  std::vector<PointCloud::Point>::iterator point, uint32_t current_point)
+  std::vector<PointCloud::CompactPoint>::const_iterator point, uint32_t current_point)
 {
   uint32_t color = getColorForPoint(current_point, point);
   float * vertices = getVertices();
@@ -620,6 +756,16 @@ void PointCloud::popPoints(uint32_t num_points)
   points_.erase(points_.begin(), points_.begin() + num_points);
   point_count_ -= num_points;
 
+  if (level_of_detail_enabled_) {
+    // points are not stored in order, so the remaining ones are rewritten
+    if (point_count_ == 0) {
+      clear();
+    } else {
+      regenerateAll();
+    }
+    return;
+  }
+
   uint32_t vpp = getVerticesPerPoint();
   size_t popped_count = removePointsFromRenderables(num_points, vpp);
   (void) popped_count;
@@ -635,7 +781,26 @@ void PointCloud::popPoints(uint32_t num_points)
 
 std::vector<PointCloud::Point> PointCloud::getPoints()
 {
-  return points_;
+  std::vector<Point> points(points_.size());
+  for (size_t i = 0; i < points_.size(); ++i) {
+    points[i].position = points_[i].position;
+    points[i].color = points_[i].getColor();
+  }
+  return points;
+}
+
+size_t PointCloud::getMemoryUsage() const
+{
+  return points_.capacity() * sizeof(CompactPoint);
+}
+
+size_t PointCloud::getVertexBufferMemoryUsage() const
+{
+  size_t bytes = 0;
+  for (const auto & renderable : renderables_) {
+    bytes += renderable->getBuffer()->getSizeInBytes();
+  }
+  return bytes;
 }
 
 size_t PointCloud::removePointsFromRenderables(
@@ -666,7 +831,7 @@ void PointCloud::resetBoundingBoxForCurrentPoints()
 {
   bounding_box_.setNull();
   for (uint32_t i = 0; i < point_count_; ++i) {
-    Point & p = points_[i];
+    const CompactPoint & p = points_[i];
     bounding_box_.merge(p.position);
   }
 }
@@ -674,13 +839,80 @@ void PointCloud::resetBoundingBoxForCurrentPoints()
 void PointCloud::_notifyCurrentCamera(Ogre::Camera * camera)
 {
   Ogre::MovableObject::_notifyCurrentCamera(camera);
+  current_camera_ = camera;
 }
 
 void PointCloud::_updateRenderQueue(Ogre::RenderQueue * queue)
 {
+  // the selection passes need every point
+  if (!level_of_detail_enabled_ || color_by_index_ || !current_camera_) {
+    for (auto & renderable : renderables_) {
+      if (level_of_detail_enabled_) {
+        renderable->setLevelOfDetail(1.0f, getVerticesPerPoint());
+      }
+      queue->addRenderable(renderable.get());
+    }
+    return;
+  }
+
+  float budget_scale = 1.0f;
+  if (point_budget_) {
+    uint64_t frame_number = Ogre::Root::getSingleton().getNextFrameNumber();
+    budget_scale = point_budget_->getScale(frame_number);
+    if (frame_number != demand_frame_number_) {
+      demand_frame_number_ = frame_number;
+      demand_ = 0;
+    }
+  }
+  uint64_t demand = 0;
+  uint32_t vertices_per_point = getVerticesPerPoint();
+  const Ogre::Affine3 & transform = _getParentNodeFullTransform();
+
   for (auto & renderable : renderables_) {
+    Ogre::AxisAlignedBox world_box = renderable->getBoundingBox();
+    world_box.transform(transform);
+    if (!current_camera_->isVisible(world_box)) {
+      continue;
+    }
+
+    size_t number_of_points =
+      renderable->getRenderOperation()->vertexData->vertexCount / vertices_per_point;
+    float level_of_detail = getLevelOfDetail(world_box, number_of_points);
+    demand += static_cast<uint64_t>(number_of_points * level_of_detail);
+
+    renderable->setLevelOfDetail(level_of_detail * budget_scale, vertices_per_point);
     queue->addRenderable(renderable.get());
   }
+
+  // Every viewport and camera pass updates the render queue, but the budget only has to
+  // cover the most demanding one of them.
+  if (point_budget_ && demand > demand_) {
+    point_budget_->addDemand(demand - demand_);
+    demand_ = demand;
+  }
+}
+
+float PointCloud::getLevelOfDetail(
+  const Ogre::AxisAlignedBox & world_box, size_t number_of_points) const
+{
+  Ogre::Viewport * viewport = current_camera_->getViewport();
+  if (!viewport || number_of_points == 0 ||
+    current_camera_->getProjectionType() != Ogre::PT_PERSPECTIVE)
+  {
+    return 1.0f;
+  }
+
+  float radius = world_box.getHalfSize().length();
+  float distance = current_camera_->getDerivedPosition().distance(world_box.getCenter());
+  if (distance <= radius) {
+    return 1.0f;
+  }
+
+  // draw about one point per pixel covered by the bounding sphere of the renderable
+  float pixel_radius = radius / (distance * Ogre::Math::Tan(current_camera_->getFOVy() * 0.5f)) *
+    0.5f * static_cast<float>(viewport->getActualHeight());
+  float covered_pixels = Ogre::Math::PI * pixel_radius * pixel_radius;
+  return std::min(covered_pixels / static_cast<float>(number_of_points), 1.0f);
 }
 
 void PointCloud::_notifyAttached(Ogre::Node * parent, bool isTagPoint)
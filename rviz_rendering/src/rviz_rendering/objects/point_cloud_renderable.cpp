@@ -36,6 +36,7 @@
 #include <OgreCamera.h>
 
 #include "rviz_rendering/objects/point_cloud.hpp"
+#include "rviz_rendering/vertex_buffer_pool.hpp"
 
 namespace rviz_rendering
 {
@@ -43,15 +44,22 @@ namespace rviz_rendering
 PointCloudRenderable::PointCloudRenderable(
   PointCloud * parent, int num_points, bool
   use_tex_coords, Ogre::RenderOperation::OperationType operationType)
-: parent_(parent)
+: parent_(parent),
+  lod_fraction_(1.0f),
+  lod_vertices_per_point_(1)
 {
   initializeRenderOperation(operationType);
   specifyBufferContent(use_tex_coords);
   createAndBindBuffer(num_points);
+
+  lod_vertex_data_ = std::make_unique<Ogre::VertexData>(
+    mRenderOp.vertexData->vertexDeclaration, mRenderOp.vertexData->vertexBufferBinding);
 }
 
 PointCloudRenderable::~PointCloudRenderable()
 {
+  VertexBufferPool::getSingleton().release(getBuffer());
+  lod_vertex_data_.reset();
   delete mRenderOp.vertexData;
   delete mRenderOp.indexData;
 }
@@ -61,6 +69,34 @@ Ogre::HardwareVertexBufferSharedPtr PointCloudRenderable::getBuffer()
   return mRenderOp.vertexData->vertexBufferBinding->getBuffer(0);
 }
 
+void PointCloudRenderable::getRenderOperation(Ogre::RenderOperation & op)
+{
+  op = mRenderOp;
+  if (lod_fraction_ < 1.0f) {
+    lod_vertex_data_->vertexStart = mRenderOp.vertexData->vertexStart;
+    lod_vertex_data_->vertexCount = getRenderedVertexCount();
+    op.vertexData = lod_vertex_data_.get();
+  }
+}
+
+void PointCloudRenderable::setLevelOfDetail(float fraction, uint32_t vertices_per_point)
+{
+  lod_fraction_ = std::min(std::max(fraction, 0.0f), 1.0f);
+  lod_vertices_per_point_ = std::max(vertices_per_point, 1u);
+}
+
+size_t PointCloudRenderable::getRenderedVertexCount() const
+{
+  size_t vertex_count = mRenderOp.vertexData->vertexCount;
+  if (lod_fraction_ >= 1.0f) {
+    return vertex_count;
+  }
+  // always keep whole points and at least one of them
+  auto point_count = static_cast<size_t>(
+    static_cast<float>(vertex_count / lod_vertices_per_point_) * lod_fraction_);
+  return std::min(std::max<size_t>(point_count, 1) * lod_vertices_per_point_, vertex_count);
+}
+
 void PointCloudRenderable::_notifyCurrentCamera(Ogre::Camera * camera)
 {
   Ogre::SimpleRenderable::_notifyCurrentCamera(camera);
@@ -123,11 +159,9 @@ void PointCloudRenderable::specifyBufferContent(bool use_tex_coords)
 
 void PointCloudRenderable::createAndBindBuffer(int num_points)
 {
-  Ogre::HardwareVertexBufferSharedPtr vertexBuffer =
-    Ogre::HardwareBufferManager::getSingleton().createVertexBuffer(
-    mRenderOp.vertexData->vertexDeclaration->getVertexSize(0),
-    num_points,
-    Ogre::HardwareBuffer::HBU_DYNAMIC);
+  // may be larger than num_points and hold the vertices of another cloud
+  Ogre::HardwareVertexBufferSharedPtr vertexBuffer = VertexBufferPool::getSingleton().acquire(
+    mRenderOp.vertexData->vertexDeclaration->getVertexSize(0), num_points);
 
   mRenderOp.vertexData->vertexBufferBinding->setBinding(0, vertexBuffer);
 }
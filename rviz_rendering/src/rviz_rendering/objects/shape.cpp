@@ -49,39 +49,41 @@
 namespace rviz_rendering
 {
 
-Ogre::Entity *
-Shape::createEntity(
-  const std::string & name,
-  Type type,
-  Ogre::SceneManager * scene_manager)
+std::string Shape::getMeshName(Type type)
 {
-  if (type == Mesh) {
-    return nullptr;  // the entity is initialized after the vertex data was specified
-  }
-  std::string mesh_name;
   switch (type) {
     case Cone:
-      mesh_name = "rviz_cone.mesh";
-      break;
+      return "rviz_cone.mesh";
 
     case Cube:
-      mesh_name = "rviz_cube.mesh";
-      break;
+      return "rviz_cube.mesh";
 
     case Cylinder:
-      mesh_name = "rviz_cylinder.mesh";
-      break;
+      return "rviz_cylinder.mesh";
 
     case Sphere:
-      mesh_name = "rviz_sphere.mesh";
-      break;
+      return "rviz_sphere.mesh";
+
+    case Mesh:
+      return "";
 
     default:
       throw std::runtime_error("unexpected mesh entity type");
   }
+}
+
+Ogre::Entity *
+Shape::createEntity(
+  const std::string & name,
+  Type type,
+  Ogre::SceneManager * scene_manager)
+{
+  if (type == Mesh) {
+    return nullptr;  // the entity is initialized after the vertex data was specified
+  }
 
   return scene_manager->createEntity(
-    name, mesh_name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+    name, getMeshName(type), Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
 }
 
 Shape::Shape(Type type, Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node)
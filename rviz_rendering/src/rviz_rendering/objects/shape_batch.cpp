@@ -0,0 +1,431 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_rendering/objects/shape_batch.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <OgreCamera.h>
+#include <OgreHardwareBufferManager.h>
+#include <OgreMaterialManager.h>
+#include <OgreMatrix3.h>
+#include <OgreMesh.h>
+#include <OgreMeshManager.h>
+#include <OgrePass.h>
+#include <OgreQuaternion.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreSubMesh.h>
+#include <OgreTechnique.h>
+
+#include "rviz_rendering/material_manager.hpp"
+
+namespace rviz_rendering
+{
+
+namespace
+{
+
+struct InstanceVertex
+{
+  float position[3];
+  float normal[3];
+  uint32_t color;
+};
+static_assert(sizeof(InstanceVertex) == 28, "unexpected padding in InstanceVertex");
+
+void readVectors(
+  const Ogre::VertexData * vertex_data, const Ogre::VertexElement * element,
+  std::vector<Ogre::Vector3> & vectors)
+{
+  if (!element) {
+    vectors.resize(vectors.size() + vertex_data->vertexCount, Ogre::Vector3::ZERO);
+    return;
+  }
+
+  Ogre::HardwareVertexBufferSharedPtr buffer =
+    vertex_data->vertexBufferBinding->getBuffer(element->getSource());
+  const size_t vertex_size = buffer->getVertexSize();
+  auto vertex = static_cast<unsigned char *>(buffer->lock(Ogre::HardwareBuffer::HBL_READ_ONLY));
+  vertex += vertex_data->vertexStart * vertex_size;
+  for (size_t i = 0; i < vertex_data->vertexCount; ++i, vertex += vertex_size) {
+    float * value;
+    element->baseVertexPointerToElement(vertex, &value);
+    vectors.emplace_back(value[0], value[1], value[2]);
+  }
+  buffer->unlock();
+}
+
+size_t readVertices(
+  const Ogre::VertexData * vertex_data,
+  std::vector<Ogre::Vector3> & positions, std::vector<Ogre::Vector3> & normals)
+{
+  const size_t base = positions.size();
+  const Ogre::VertexDeclaration * declaration = vertex_data->vertexDeclaration;
+  readVectors(vertex_data, declaration->findElementBySemantic(Ogre::VES_POSITION), positions);
+  readVectors(vertex_data, declaration->findElementBySemantic(Ogre::VES_NORMAL), normals);
+  return base;
+}
+
+void readIndices(const Ogre::IndexData * index_data, size_t base, std::vector<uint32_t> & indices)
+{
+  Ogre::HardwareIndexBufferSharedPtr buffer = index_data->indexBuffer;
+  void * data = buffer->lock(Ogre::HardwareBuffer::HBL_READ_ONLY);
+  const size_t end = index_data->indexStart + index_data->indexCount;
+  if (buffer->getType() == Ogre::HardwareIndexBuffer::IT_32BIT) {
+    auto source = static_cast<const uint32_t *>(data);
+    for (size_t i = index_data->indexStart; i < end; ++i) {
+      indices.push_back(static_cast<uint32_t>(source[i] + base));
+    }
+  } else {
+    auto source = static_cast<const uint16_t *>(data);
+    for (size_t i = index_data->indexStart; i < end; ++i) {
+      indices.push_back(static_cast<uint32_t>(source[i] + base));
+    }
+  }
+  buffer->unlock();
+}
+
+Ogre::AxisAlignedBox transformBox(const Ogre::AxisAlignedBox & box, const Ogre::Matrix4 & transform)
+{
+  Ogre::AxisAlignedBox result;
+  const Ogre::Vector3 & min = box.getMinimum();
+  const Ogre::Vector3 & max = box.getMaximum();
+  for (int corner = 0; corner < 8; ++corner) {
+    result.merge(
+      transform * Ogre::Vector3(
+        corner & 1 ? max.x : min.x,
+        corner & 2 ? max.y : min.y,
+        corner & 4 ? max.z : min.z));
+  }
+  return result;
+}
+
+}  // namespace
+
+Ogre::String ShapeBatchRenderable::sm_Type = "ShapeBatch";
+
+ShapeBatchRenderable::ShapeBatchRenderable(ShapeBatch * parent)
+: parent_(parent),
+  instance_capacity_(0),
+  instance_count_(0),
+  dirty_(false)
+{
+  mRenderOp.operationType = Ogre::RenderOperation::OT_TRIANGLE_LIST;
+  mRenderOp.useIndexes = true;
+  mRenderOp.vertexData = new Ogre::VertexData;
+  mRenderOp.vertexData->vertexStart = 0;
+  mRenderOp.vertexData->vertexCount = 0;
+  mRenderOp.indexData = new Ogre::IndexData;
+  mRenderOp.indexData->indexStart = 0;
+  mRenderOp.indexData->indexCount = 0;
+
+  Ogre::VertexDeclaration * declaration = mRenderOp.vertexData->vertexDeclaration;
+  size_t offset = 0;
+  declaration->addElement(0, offset, Ogre::VET_FLOAT3, Ogre::VES_POSITION);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT3);
+  declaration->addElement(0, offset, Ogre::VET_FLOAT3, Ogre::VES_NORMAL);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT3);
+  declaration->addElement(0, offset, Ogre::VET_COLOUR, Ogre::VES_DIFFUSE);
+
+  mBox.setNull();
+}
+
+ShapeBatchRenderable::~ShapeBatchRenderable()
+{
+  delete mRenderOp.vertexData;
+  delete mRenderOp.indexData;
+}
+
+void ShapeBatchRenderable::reserveInstances(size_t instance_count)
+{
+  if (instance_count <= instance_capacity_) {
+    return;
+  }
+  // grow geometrically, so batches filled over several messages do not reallocate every time
+  instance_capacity_ = std::max<size_t>(instance_count, 2 * instance_capacity_);
+
+  const auto & mesh_positions = parent_->getMeshPositions();
+  const auto & mesh_indices = parent_->getMeshIndices();
+
+  vertex_buffer_ = Ogre::HardwareBufferManager::getSingleton().createVertexBuffer(
+    sizeof(InstanceVertex),
+    instance_capacity_ * mesh_positions.size(),
+    Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY);
+  mRenderOp.vertexData->vertexBufferBinding->setBinding(0, vertex_buffer_);
+
+  // The indices only depend on the number of instances, so they are written once per allocation
+  index_buffer_ = Ogre::HardwareBufferManager::getSingleton().createIndexBuffer(
+    Ogre::HardwareIndexBuffer::IT_32BIT,
+    instance_capacity_ * mesh_indices.size(),
+    Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY);
+  mRenderOp.indexData->indexBuffer = index_buffer_;
+
+  auto indices = static_cast<uint32_t *>(index_buffer_->lock(Ogre::HardwareBuffer::HBL_DISCARD));
+  for (size_t instance = 0; instance < instance_capacity_; ++instance) {
+    auto first = static_cast<uint32_t>(instance * mesh_positions.size());
+    for (uint32_t index : mesh_indices) {
+      *indices++ = first + index;
+    }
+  }
+  index_buffer_->unlock();
+}
+
+void ShapeBatchRenderable::updateBuffers()
+{
+  if (!dirty_) {
+    return;
+  }
+  dirty_ = false;
+
+  const auto & instances = parent_->getInstances();
+  const auto & mesh_positions = parent_->getMeshPositions();
+  const auto & mesh_normals = parent_->getMeshNormals();
+
+  instance_count_ = instances.size();
+  mRenderOp.vertexData->vertexCount = instance_count_ * mesh_positions.size();
+  mRenderOp.indexData->indexCount = instance_count_ * parent_->getMeshIndices().size();
+  if (instance_count_ == 0) {
+    return;
+  }
+
+  reserveInstances(instance_count_);
+
+  auto vertex = static_cast<InstanceVertex *>(
+    vertex_buffer_->lock(
+      0, mRenderOp.vertexData->vertexCount * sizeof(InstanceVertex),
+      Ogre::HardwareBuffer::HBL_DISCARD));
+  for (const auto & instance : instances) {
+    // normals are transformed by the inverse transpose to stay correct under non-uniform scale
+    Ogre::Matrix3 normal_matrix = instance.transform.linear().Inverse().Transpose();
+    uint32_t color = instance.color.getAsBYTE();
+    for (size_t i = 0; i < mesh_positions.size(); ++i) {
+      Ogre::Vector3 position = instance.transform * mesh_positions[i];
+      Ogre::Vector3 normal = (normal_matrix * mesh_normals[i]).normalisedCopy();
+      vertex->position[0] = position.x;
+      vertex->position[1] = position.y;
+      vertex->position[2] = position.z;
+      vertex->normal[0] = normal.x;
+      vertex->normal[1] = normal.y;
+      vertex->normal[2] = normal.z;
+      vertex->color = color;
+      ++vertex;
+    }
+  }
+  vertex_buffer_->unlock();
+}
+
+void ShapeBatchRenderable::_updateRenderQueue(Ogre::RenderQueue * queue)
+{
+  if (dirty_) {
+    updateBuffers();
+    parent_->updateAlphaBlending();
+  }
+  if (instance_count_ > 0) {
+    Ogre::SimpleRenderable::_updateRenderQueue(queue);
+  }
+}
+
+Ogre::Real ShapeBatchRenderable::getBoundingRadius() const
+{
+  if (mBox.isNull()) {
+    return 0.0f;
+  }
+  return Ogre::Math::Sqrt(
+    std::max(
+      mBox.getMaximum().squaredLength(),
+      mBox.getMinimum().squaredLength()));
+}
+
+Ogre::Real ShapeBatchRenderable::getSquaredViewDepth(const Ogre::Camera * cam) const
+{
+  return (cam->getDerivedPosition() - mBox.getCenter()).squaredLength();
+}
+
+ShapeBatch::ShapeBatch(
+  Shape::Type shape_type, Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node)
+: Object(scene_manager),
+  type_(shape_type),
+  transparent_(false)
+{
+  if (shape_type == Shape::Mesh) {
+    throw std::invalid_argument("ShapeBatch only supports primitive shapes, not Shape::Mesh");
+  }
+
+  if (!parent_node) {
+    parent_node = scene_manager_->getRootSceneNode();
+  }
+
+  scene_node_ = parent_node->createChildSceneNode();
+
+  loadMesh();
+
+  static int count = 0;
+  std::string material_name = "ShapeBatchMaterial" + std::to_string(count++);
+  material_ = MaterialManager::createMaterialWithLighting(material_name);
+  Ogre::Pass * pass = material_->getTechnique(0)->getPass(0);
+  pass->setVertexColourTracking(Ogre::TVC_AMBIENT | Ogre::TVC_DIFFUSE);
+  material_->load();
+
+  renderable_ = new ShapeBatchRenderable(this);
+  renderable_->setMaterial(material_);
+  scene_node_->attachObject(renderable_);
+
+  clear();
+}
+
+ShapeBatch::~ShapeBatch()
+{
+  scene_node_->detachObject(renderable_);
+  delete renderable_;
+
+  scene_manager_->destroySceneNode(scene_node_);
+
+  material_->unload();
+  Ogre::MaterialManager::getSingleton().remove(material_->getName(), "rviz_rendering");
+}
+
+void ShapeBatch::loadMesh()
+{
+  Ogre::MeshPtr mesh = Ogre::MeshManager::getSingleton().load(
+    Shape::getMeshName(type_), Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+
+  // submeshes sharing the vertices of the mesh must only copy them once
+  bool shared_vertices_read = false;
+  size_t shared_base = 0;
+  for (const Ogre::SubMesh * submesh : mesh->getSubMeshes()) {
+    if (submesh->operationType != Ogre::RenderOperation::OT_TRIANGLE_LIST) {
+      continue;
+    }
+    size_t base;
+    if (submesh->useSharedVertices) {
+      if (!shared_vertices_read) {
+        shared_base = readVertices(mesh->sharedVertexData, mesh_positions_, mesh_normals_);
+        shared_vertices_read = true;
+      }
+      base = shared_base;
+    } else {
+      base = readVertices(submesh->vertexData, mesh_positions_, mesh_normals_);
+    }
+    readIndices(submesh->indexData, base, mesh_indices_);
+  }
+
+  mesh_box_.setNull();
+  for (const auto & position : mesh_positions_) {
+    mesh_box_.merge(position);
+  }
+}
+
+void ShapeBatch::clear()
+{
+  instances_.clear();
+  instances_box_.setNull();
+  updateBoundingBox();
+  renderable_->markDirty();
+}
+
+void ShapeBatch::reserve(size_t instance_count)
+{
+  instances_.reserve(instance_count);
+}
+
+void ShapeBatch::addInstance(const Ogre::Matrix4 & transform, const Ogre::ColourValue & color)
+{
+  instances_.push_back({transform, color});
+  if (!mesh_box_.isNull()) {
+    instances_box_.merge(transformBox(mesh_box_, transform));
+  }
+  updateBoundingBox();
+  renderable_->markDirty();
+}
+
+void ShapeBatch::setInstanceColor(size_t index, const Ogre::ColourValue & color)
+{
+  instances_[index].color = color;
+  renderable_->markDirty();
+}
+
+void ShapeBatch::updateBoundingBox()
+{
+  renderable_->setBoundingBox(instances_box_);
+}
+
+void ShapeBatch::updateAlphaBlending()
+{
+  bool transparent = std::any_of(
+    instances_.begin(), instances_.end(), [](const Instance & instance) {
+      return instance.color.a < unit_alpha_threshold;
+    });
+  if (transparent == transparent_) {
+    return;
+  }
+  transparent_ = transparent;
+
+  MaterialManager::enableAlphaBlending(material_, transparent_ ? 0.0f : 1.0f);
+}
+
+void ShapeBatch::setPosition(const Ogre::Vector3 & position)
+{
+  scene_node_->setPosition(position);
+}
+
+void ShapeBatch::setOrientation(const Ogre::Quaternion & orientation)
+{
+  scene_node_->setOrientation(orientation);
+}
+
+void ShapeBatch::setScale(const Ogre::Vector3 & scale)
+{
+  scene_node_->setScale(scale);
+}
+
+void ShapeBatch::setColor(float r, float g, float b, float a)
+{
+  Ogre::ColourValue color(r, g, b, a);
+  for (auto & instance : instances_) {
+    instance.color = color;
+  }
+  renderable_->markDirty();
+}
+
+const Ogre::Vector3 & ShapeBatch::getPosition()
+{
+  return scene_node_->getPosition();
+}
+
+const Ogre::Quaternion & ShapeBatch::getOrientation()
+{
+  return scene_node_->getOrientation();
+}
+
+}  // namespace rviz_rendering
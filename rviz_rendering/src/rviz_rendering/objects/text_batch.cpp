@@ -0,0 +1,616 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_rendering/objects/text_batch.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <OgreCamera.h>
+#include <OgreHardwareBufferManager.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreTechnique.h>
+#include <Overlay/OgreFont.h>  // NOLINT: cpplint cannot handle include order here
+#include <Overlay/OgreFontManager.h>  // NOLINT: cpplint cannot handle include order here
+
+#define MATERIAL_GROUP "rviz_rendering"
+
+namespace rviz_rendering
+{
+
+namespace
+{
+
+const size_t VERTICES_PER_GLYPH = 4;
+const size_t INDICES_PER_GLYPH = 6;
+
+// same as the default line spacing of MovableText, in world units
+const float line_spacing = 0.005f;
+
+static_assert(sizeof(TextBatchVertex) == 32, "unexpected padding in TextBatchVertex");
+
+/// Labels get some room to grow, so small caption changes do not move other labels.
+uint32_t roundUpGlyphCapacity(uint32_t glyph_count)
+{
+  return std::max<uint32_t>(4, (glyph_count + 3) & ~3u);
+}
+
+void setVertex(
+  TextBatchVertex & vertex, const Ogre::Vector3 & anchor, float u, float v, float x, float y,
+  uint32_t color)
+{
+  vertex.anchor[0] = anchor.x;
+  vertex.anchor[1] = anchor.y;
+  vertex.anchor[2] = anchor.z;
+  vertex.texture_coords[0] = u;
+  vertex.texture_coords[1] = v;
+  vertex.offset[0] = x;
+  vertex.offset[1] = y;
+  vertex.color = color;
+}
+
+}  // namespace
+
+Ogre::String TextBatchChunk::sm_Type = "TextBatch";
+
+TextBatchChunk::TextBatchChunk(TextBatch * parent)
+: parent_(parent),
+  glyph_capacity_(0),
+  used_glyphs_(0),
+  needs_layout_(false),
+  needs_full_upload_(false)
+{
+  mRenderOp.operationType = Ogre::RenderOperation::OT_TRIANGLE_LIST;
+  mRenderOp.useIndexes = true;
+  mRenderOp.vertexData = new Ogre::VertexData;
+  mRenderOp.vertexData->vertexStart = 0;
+  mRenderOp.vertexData->vertexCount = 0;
+  mRenderOp.indexData = new Ogre::IndexData;
+  mRenderOp.indexData->indexStart = 0;
+  mRenderOp.indexData->indexCount = 0;
+
+  Ogre::VertexDeclaration * declaration = mRenderOp.vertexData->vertexDeclaration;
+  size_t offset = 0;
+  declaration->addElement(0, offset, Ogre::VET_FLOAT3, Ogre::VES_POSITION);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT3);
+  declaration->addElement(0, offset, Ogre::VET_FLOAT2, Ogre::VES_TEXTURE_COORDINATES, 0);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT2);
+  declaration->addElement(0, offset, Ogre::VET_FLOAT2, Ogre::VES_TEXTURE_COORDINATES, 1);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT2);
+  declaration->addElement(0, offset, Ogre::VET_COLOUR, Ogre::VES_DIFFUSE);
+
+  mBox.setNull();
+}
+
+TextBatchChunk::~TextBatchChunk()
+{
+  delete mRenderOp.vertexData;
+  delete mRenderOp.indexData;
+}
+
+void TextBatchChunk::appendLabel(uint32_t label_id)
+{
+  auto & label = parent_->getLabel(label_id);
+  label.first_glyph = static_cast<uint32_t>(used_glyphs_);
+  label.glyph_capacity = roundUpGlyphCapacity(label.glyph_count);
+  used_glyphs_ += label.glyph_capacity;
+  vertices_.resize(used_glyphs_ * VERTICES_PER_GLYPH);
+  markLabelDirty(label_id);
+}
+
+void TextBatchChunk::markLabelDirty(uint32_t label_id)
+{
+  auto & label = parent_->getLabel(label_id);
+  if (!label.dirty) {
+    label.dirty = true;
+    dirty_labels_.push_back(label_id);
+  }
+}
+
+void TextBatchChunk::layout()
+{
+  needs_layout_ = false;
+  used_glyphs_ = 0;
+  dirty_labels_.clear();
+  for (auto label_id : labels_) {
+    parent_->getLabel(label_id).dirty = false;
+    appendLabel(label_id);
+  }
+  vertices_.resize(used_glyphs_ * VERTICES_PER_GLYPH);
+  needs_full_upload_ = true;
+}
+
+void TextBatchChunk::reserveGlyphs(size_t glyph_count)
+{
+  if (glyph_count <= glyph_capacity_) {
+    return;
+  }
+  glyph_capacity_ = std::max<size_t>(glyph_count, 2 * glyph_capacity_);
+  needs_full_upload_ = true;
+
+  vertex_buffer_ = Ogre::HardwareBufferManager::getSingleton().createVertexBuffer(
+    sizeof(TextBatchVertex),
+    glyph_capacity_ * VERTICES_PER_GLYPH,
+    Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY);
+  mRenderOp.vertexData->vertexBufferBinding->setBinding(0, vertex_buffer_);
+
+  // The indices only depend on the number of glyphs, so they are written once per allocation
+  index_buffer_ = Ogre::HardwareBufferManager::getSingleton().createIndexBuffer(
+    Ogre::HardwareIndexBuffer::IT_32BIT,
+    glyph_capacity_ * INDICES_PER_GLYPH,
+    Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY);
+  mRenderOp.indexData->indexBuffer = index_buffer_;
+
+  auto indices = static_cast<uint32_t *>(index_buffer_->lock(Ogre::HardwareBuffer::HBL_DISCARD));
+  for (size_t glyph = 0; glyph < glyph_capacity_; ++glyph) {
+    auto first = static_cast<uint32_t>(glyph * VERTICES_PER_GLYPH);
+    // top left, bottom left, top right, bottom right
+    *indices++ = first;
+    *indices++ = first + 1;
+    *indices++ = first + 2;
+    *indices++ = first + 2;
+    *indices++ = first + 1;
+    *indices++ = first + 3;
+  }
+  index_buffer_->unlock();
+}
+
+void TextBatchChunk::updateBuffers()
+{
+  if (needs_layout_) {
+    layout();
+  }
+  if (dirty_labels_.empty() && !needs_full_upload_) {
+    return;
+  }
+
+  size_t first_dirty_glyph = used_glyphs_;
+  size_t end_dirty_glyph = 0;
+  for (auto label_id : dirty_labels_) {
+    auto & label = parent_->getLabel(label_id);
+    label.dirty = false;
+    parent_->writeLabel(label, &vertices_[label.first_glyph * VERTICES_PER_GLYPH]);
+    first_dirty_glyph = std::min<size_t>(first_dirty_glyph, label.first_glyph);
+    end_dirty_glyph = std::max<size_t>(end_dirty_glyph, label.first_glyph + label.glyph_capacity);
+  }
+  dirty_labels_.clear();
+  updateBoundingBox();
+
+  mRenderOp.vertexData->vertexCount = used_glyphs_ * VERTICES_PER_GLYPH;
+  mRenderOp.indexData->indexCount = used_glyphs_ * INDICES_PER_GLYPH;
+  if (used_glyphs_ == 0) {
+    needs_full_upload_ = false;
+    return;
+  }
+
+  reserveGlyphs(used_glyphs_);
+
+  if (needs_full_upload_) {
+    first_dirty_glyph = 0;
+    end_dirty_glyph = used_glyphs_;
+    needs_full_upload_ = false;
+  }
+  const size_t glyph_size = VERTICES_PER_GLYPH * sizeof(TextBatchVertex);
+  vertex_buffer_->writeData(
+    first_dirty_glyph * glyph_size,
+    (end_dirty_glyph - first_dirty_glyph) * glyph_size,
+    &vertices_[first_dirty_glyph * VERTICES_PER_GLYPH],
+    first_dirty_glyph == 0 && end_dirty_glyph == used_glyphs_);
+}
+
+void TextBatchChunk::updateBoundingBox()
+{
+  Ogre::AxisAlignedBox box;
+  for (auto label_id : labels_) {
+    box.merge(parent_->getLabelBox(parent_->getLabel(label_id)));
+  }
+  setBoundingBox(box);
+}
+
+void TextBatchChunk::_updateRenderQueue(Ogre::RenderQueue * queue)
+{
+  updateBuffers();
+  if (used_glyphs_ > 0) {
+    Ogre::SimpleRenderable::_updateRenderQueue(queue);
+  }
+}
+
+Ogre::Real TextBatchChunk::getBoundingRadius() const
+{
+  if (mBox.isNull()) {
+    return 0.0f;
+  }
+  return Ogre::Math::Sqrt(
+    std::max(
+      mBox.getMaximum().squaredLength(),
+      mBox.getMinimum().squaredLength()));
+}
+
+Ogre::Real TextBatchChunk::getSquaredViewDepth(const Ogre::Camera * cam) const
+{
+  return (cam->getDerivedPosition() - mBox.getCenter()).squaredLength();
+}
+
+const size_t TextBatch::LABELS_PER_CHUNK = 256;
+
+TextBatch::TextBatch(
+  Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node,
+  const Ogre::String & font_name)
+: scene_manager_(scene_manager),
+  horizontal_alignment_(MovableText::H_CENTER),
+  vertical_alignment_(MovableText::V_BELOW),
+  label_count_(0)
+{
+  if (!parent_node) {
+    parent_node = scene_manager_->getRootSceneNode();
+  }
+
+  scene_node_ = parent_node->createChildSceneNode();
+
+  font_ = Ogre::FontManager::getSingleton().getByName(font_name, MATERIAL_GROUP).get();
+  if (!font_) {
+    throw Ogre::Exception(
+            Ogre::Exception::ERR_ITEM_NOT_FOUND, "Could not find font " +
+            font_name, "TextBatch::TextBatch");
+  }
+  font_->load();
+  // Same default space width as MovableText, relative to the character height
+  space_width_factor_ = font_->getGlyphAspectRatio('A');
+
+  static int count = 0;
+  std::string material_name = "TextBatchMaterial" + std::to_string(count++);
+  material_ = font_->getMaterial()->clone(material_name);
+  Ogre::Pass * pass = material_->getTechnique(0)->getPass(0);
+  pass->setVertexProgram("rviz/glsl120/nogp/text_billboard.vert");
+  pass->setFragmentProgram("rviz/glsl120/text.frag");
+  material_->setCullingMode(Ogre::CULL_NONE);
+  material_->setDepthCheckEnabled(true);
+  material_->setDepthBias(1.0, 1.0);
+  material_->setDepthWriteEnabled(false);
+  material_->setLightingEnabled(false);
+  material_->load();
+}
+
+TextBatch::~TextBatch()
+{
+  for (auto & chunk : chunks_) {
+    scene_node_->detachObject(chunk.get());
+  }
+  chunks_.clear();
+
+  scene_manager_->destroySceneNode(scene_node_);
+
+  Ogre::MaterialManager::getSingleton().remove(material_->getName(), MATERIAL_GROUP);
+}
+
+TextBatch::Label & TextBatch::getLabel(LabelId label)
+{
+  assert(label < labels_.size() && labels_[label].in_use);
+  return labels_[label];
+}
+
+const TextBatch::Label & TextBatch::getLabel(LabelId label) const
+{
+  assert(label < labels_.size() && labels_[label].in_use);
+  return labels_[label];
+}
+
+TextBatch::LabelId TextBatch::addLabel(
+  const Ogre::String & caption, const Ogre::Vector3 & position, Ogre::Real char_height,
+  const Ogre::ColourValue & color)
+{
+  LabelId id;
+  if (free_labels_.empty()) {
+    id = static_cast<LabelId>(labels_.size());
+    labels_.emplace_back();
+  } else {
+    id = free_labels_.back();
+    free_labels_.pop_back();
+  }
+
+  auto chunk = std::find_if(
+    chunks_.begin(), chunks_.end(), [](const std::unique_ptr<TextBatchChunk> & chunk) {
+      return chunk->labels_.size() < LABELS_PER_CHUNK;
+    });
+  if (chunk == chunks_.end()) {
+    chunks_.push_back(std::make_unique<TextBatchChunk>(this));
+    chunks_.back()->setMaterial(material_);
+    scene_node_->attachObject(chunks_.back().get());
+    chunk = chunks_.end() - 1;
+  }
+
+  Label & label = labels_[id];
+  label.caption = caption;
+  label.position = position;
+  label.char_height = char_height;
+  label.color = color;
+  label.visible = true;
+  label.in_use = true;
+  label.dirty = false;
+  label.chunk = static_cast<uint32_t>(chunk - chunks_.begin());
+  measureLabel(label);
+
+  (*chunk)->labels_.push_back(id);
+  (*chunk)->appendLabel(id);
+  (*chunk)->updateBoundingBox();
+  ++label_count_;
+
+  return id;
+}
+
+void TextBatch::removeLabel(LabelId label_id)
+{
+  Label & label = getLabel(label_id);
+  auto & chunk = chunks_[label.chunk];
+  auto & chunk_labels = chunk->labels_;
+  chunk_labels.erase(std::find(chunk_labels.begin(), chunk_labels.end(), label_id));
+  auto & dirty_labels = chunk->dirty_labels_;
+  dirty_labels.erase(
+    std::remove(dirty_labels.begin(), dirty_labels.end(), label_id), dirty_labels.end());
+  // the other labels are moved into the freed range
+  chunk->needs_layout_ = true;
+
+  label.in_use = false;
+  label.caption.clear();
+  free_labels_.push_back(label_id);
+  --label_count_;
+}
+
+void TextBatch::clear()
+{
+  for (auto & chunk : chunks_) {
+    scene_node_->detachObject(chunk.get());
+  }
+  chunks_.clear();
+  labels_.clear();
+  free_labels_.clear();
+  label_count_ = 0;
+}
+
+void TextBatch::setCaption(LabelId label, const Ogre::String & caption)
+{
+  if (getLabel(label).caption != caption) {
+    getLabel(label).caption = caption;
+    updateLabel(label, true);
+  }
+}
+
+void TextBatch::setPosition(LabelId label, const Ogre::Vector3 & position)
+{
+  if (getLabel(label).position != position) {
+    getLabel(label).position = position;
+    updateLabel(label, false);
+  }
+}
+
+void TextBatch::setCharacterHeight(LabelId label, Ogre::Real char_height)
+{
+  if (getLabel(label).char_height != char_height) {
+    getLabel(label).char_height = char_height;
+    updateLabel(label, true);
+  }
+}
+
+void TextBatch::setColor(LabelId label, const Ogre::ColourValue & color)
+{
+  if (getLabel(label).color != color) {
+    getLabel(label).color = color;
+    updateLabel(label, false);
+  }
+}
+
+void TextBatch::setVisible(LabelId label, bool visible)
+{
+  if (getLabel(label).visible != visible) {
+    getLabel(label).visible = visible;
+    updateLabel(label, false);
+  }
+}
+
+void TextBatch::setTextAlignment(
+  MovableText::HorizontalAlignment horizontal_alignment,
+  MovableText::VerticalAlignment vertical_alignment)
+{
+  if (horizontal_alignment_ == horizontal_alignment &&
+    vertical_alignment_ == vertical_alignment)
+  {
+    return;
+  }
+  horizontal_alignment_ = horizontal_alignment;
+  vertical_alignment_ = vertical_alignment;
+  for (LabelId id = 0; id < labels_.size(); ++id) {
+    if (labels_[id].in_use) {
+      updateLabel(id, true);
+    }
+  }
+}
+
+const Ogre::String & TextBatch::getCaption(LabelId label) const
+{
+  return getLabel(label).caption;
+}
+
+const Ogre::Vector3 & TextBatch::getPosition(LabelId label) const
+{
+  return getLabel(label).position;
+}
+
+const Ogre::ColourValue & TextBatch::getColor(LabelId label) const
+{
+  return getLabel(label).color;
+}
+
+bool TextBatch::getVisible(LabelId label) const
+{
+  return getLabel(label).visible;
+}
+
+void TextBatch::updateLabel(LabelId label_id, bool layout_changed)
+{
+  Label & label = getLabel(label_id);
+  auto & chunk = chunks_[label.chunk];
+  if (layout_changed) {
+    measureLabel(label);
+    if (label.glyph_count > label.glyph_capacity) {
+      chunk->needs_layout_ = true;
+    }
+  }
+  chunk->markLabelDirty(label_id);
+  // The culling happens before the chunk is updated, so the new extent has to be known now.
+  // The box is shrunk again when the chunk is uploaded.
+  Ogre::AxisAlignedBox box = chunk->getBoundingBox();
+  box.merge(getLabelBox(label));
+  chunk->setBoundingBox(box);
+}
+
+template<typename GlyphCallback>
+void TextBatch::forEachGlyph(const Label & label, GlyphCallback add_glyph) const
+{
+  const float char_height = label.char_height;
+  const float space_width = space_width_factor_ * char_height;
+
+  size_t line_count = 1;
+  float total_width = 0.0f;
+  float current_width = 0.0f;
+  for (auto & character : label.caption) {
+    if (character == '\n') {
+      ++line_count;
+      total_width = std::max(total_width, current_width);
+      current_width = 0.0f;
+    } else if (character == ' ') {
+      current_width += space_width;
+    } else {
+      current_width += font_->getGlyphAspectRatio(character) * char_height;
+    }
+  }
+  total_width = std::max(total_width, current_width);
+  float total_height = char_height + (line_count - 1) * (char_height + line_spacing);
+
+  float starting_left;
+  switch (horizontal_alignment_) {
+    case MovableText::H_LEFT:
+      starting_left = 0.0f;
+      break;
+    case MovableText::H_CENTER:
+      starting_left = -0.5f * total_width;
+      break;
+    default:
+      throw std::runtime_error("unexpected horizontal alignment");
+  }
+
+  float top;
+  switch (vertical_alignment_) {
+    case MovableText::V_ABOVE:
+      top = total_height;
+      break;
+    case MovableText::V_CENTER:
+      top = 0.5f * total_height;
+      break;
+    case MovableText::V_BELOW:
+      top = 0.0f;
+      break;
+    default:
+      throw std::runtime_error("unexpected vertical alignment");
+  }
+
+  float left = starting_left;
+  for (auto & character : label.caption) {
+    if (character == '\n') {
+      left = starting_left;
+      top -= char_height + line_spacing;
+      continue;
+    }
+    if (character == ' ') {
+      left += space_width;
+      continue;
+    }
+    float width = font_->getGlyphAspectRatio(character) * char_height;
+    add_glyph(left, top, width, character);
+    left += width;
+  }
+}
+
+void TextBatch::measureLabel(Label & label) const
+{
+  uint32_t glyph_count = 0;
+  float squared_radius = 0.0f;
+  forEachGlyph(
+    label, [&](float left, float top, float width, char character) {
+      (void) character;
+      ++glyph_count;
+      float bottom = top - label.char_height;
+      float max_x = std::max(std::abs(left), std::abs(left + width));
+      float max_y = std::max(std::abs(top), std::abs(bottom));
+      squared_radius = std::max(squared_radius, max_x * max_x + max_y * max_y);
+    });
+  label.glyph_count = glyph_count;
+  label.radius = std::sqrt(squared_radius);
+}
+
+Ogre::AxisAlignedBox TextBatch::getLabelBox(const Label & label) const
+{
+  if (!label.visible || label.glyph_count == 0) {
+    return Ogre::AxisAlignedBox();
+  }
+  // the glyphs can turn to any direction
+  Ogre::Vector3 extent(label.radius);
+  return Ogre::AxisAlignedBox(label.position - extent, label.position + extent);
+}
+
+void TextBatch::writeLabel(const Label & label, TextBatchVertex * dest) const
+{
+  TextBatchVertex * end = dest + label.glyph_capacity * VERTICES_PER_GLYPH;
+  if (label.visible) {
+    const uint32_t color = label.color.getAsBYTE();
+    forEachGlyph(
+      label, [&](float left, float top, float width, char character) {
+        const auto & coords = font_->getGlyphTexCoords(character);
+        float bottom = top - label.char_height;
+        float right = left + width;
+        setVertex(*dest++, label.position, coords.left, coords.top, left, top, color);
+        setVertex(*dest++, label.position, coords.left, coords.bottom, left, bottom, color);
+        setVertex(*dest++, label.position, coords.right, coords.top, right, top, color);
+        setVertex(*dest++, label.position, coords.right, coords.bottom, right, bottom, color);
+      });
+  }
+  // unused room collapses to the anchor and is not rasterized
+  while (dest != end) {
+    setVertex(*dest++, label.position, 0.0f, 0.0f, 0.0f, 0.0f, 0);
+  }
+}
+
+}  // namespace rviz_rendering
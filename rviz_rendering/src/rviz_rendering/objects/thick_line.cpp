@@ -0,0 +1,383 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_rendering/objects/thick_line.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+#include <OgreCamera.h>
+#include <OgreHardwareBufferManager.h>
+#include <OgreMaterialManager.h>
+#include <OgreQuaternion.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreTechnique.h>
+
+#include "rviz_rendering/custom_parameter_indices.hpp"
+#include "rviz_rendering/material_manager.hpp"
+
+namespace rviz_rendering
+{
+
+namespace
+{
+
+const size_t VERTICES_PER_SEGMENT = 4;
+const size_t INDICES_PER_SEGMENT = 6;
+
+struct SegmentVertex
+{
+  float position[3];
+  // other end of the segment and signed half width
+  float other_end_and_offset[4];
+  uint32_t color;
+};
+static_assert(sizeof(SegmentVertex) == 32, "unexpected padding in SegmentVertex");
+
+void setVertex(
+  SegmentVertex & vertex, const ThickLine::Point & point, const ThickLine::Point & other_end,
+  float offset)
+{
+  vertex.position[0] = point.position.x;
+  vertex.position[1] = point.position.y;
+  vertex.position[2] = point.position.z;
+  vertex.other_end_and_offset[0] = other_end.position.x;
+  vertex.other_end_and_offset[1] = other_end.position.y;
+  vertex.other_end_and_offset[2] = other_end.position.z;
+  vertex.other_end_and_offset[3] = offset;
+  vertex.color = point.color.getAsBYTE();
+}
+
+}  // namespace
+
+Ogre::String ThickLineRenderable::sm_Type = "ThickLine";
+
+ThickLineRenderable::ThickLineRenderable(ThickLine * parent)
+: parent_(parent),
+  segment_capacity_(0),
+  segment_count_(0),
+  dirty_(false)
+{
+  mRenderOp.operationType = Ogre::RenderOperation::OT_TRIANGLE_LIST;
+  mRenderOp.useIndexes = true;
+  mRenderOp.vertexData = new Ogre::VertexData;
+  mRenderOp.vertexData->vertexStart = 0;
+  mRenderOp.vertexData->vertexCount = 0;
+  mRenderOp.indexData = new Ogre::IndexData;
+  mRenderOp.indexData->indexStart = 0;
+  mRenderOp.indexData->indexCount = 0;
+
+  Ogre::VertexDeclaration * declaration = mRenderOp.vertexData->vertexDeclaration;
+  size_t offset = 0;
+  declaration->addElement(0, offset, Ogre::VET_FLOAT3, Ogre::VES_POSITION);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT3);
+  declaration->addElement(0, offset, Ogre::VET_FLOAT4, Ogre::VES_TEXTURE_COORDINATES, 0);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT4);
+  declaration->addElement(0, offset, Ogre::VET_COLOUR, Ogre::VES_DIFFUSE);
+
+  mBox.setNull();
+  // read by the depth shader
+  setCustomParameter(RVIZ_RENDERING_ALPHA_PARAMETER, Ogre::Vector4(1.0f, 0.0f, 0.0f, 0.0f));
+}
+
+ThickLineRenderable::~ThickLineRenderable()
+{
+  delete mRenderOp.vertexData;
+  delete mRenderOp.indexData;
+}
+
+void ThickLineRenderable::reserveSegments(size_t segment_count)
+{
+  if (segment_count <= segment_capacity_) {
+    return;
+  }
+  // grow geometrically, so lines built up over several messages do not reallocate every time
+  segment_capacity_ = std::max<size_t>(segment_count, 2 * segment_capacity_);
+
+  vertex_buffer_ = Ogre::HardwareBufferManager::getSingleton().createVertexBuffer(
+    sizeof(SegmentVertex),
+    segment_capacity_ * VERTICES_PER_SEGMENT,
+    Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY);
+  mRenderOp.vertexData->vertexBufferBinding->setBinding(0, vertex_buffer_);
+
+  // The indices only depend on the number of segments, so they are written once per allocation
+  index_buffer_ = Ogre::HardwareBufferManager::getSingleton().createIndexBuffer(
+    Ogre::HardwareIndexBuffer::IT_32BIT,
+    segment_capacity_ * INDICES_PER_SEGMENT,
+    Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY);
+  mRenderOp.indexData->indexBuffer = index_buffer_;
+
+  auto indices = static_cast<uint32_t *>(index_buffer_->lock(Ogre::HardwareBuffer::HBL_DISCARD));
+  for (size_t segment = 0; segment < segment_capacity_; ++segment) {
+    auto first = static_cast<uint32_t>(segment * VERTICES_PER_SEGMENT);
+    *indices++ = first;
+    *indices++ = first + 1;
+    *indices++ = first + 3;
+    *indices++ = first;
+    *indices++ = first + 3;
+    *indices++ = first + 2;
+  }
+  index_buffer_->unlock();
+}
+
+void ThickLineRenderable::updateBuffers()
+{
+  if (!dirty_) {
+    return;
+  }
+  dirty_ = false;
+
+  const auto & points = parent_->getPoints();
+  const auto & line_starts = parent_->getLineStarts();
+  const float half_width = parent_->getLineWidth() / 2.0f;
+
+  size_t segment_count = 0;
+  for (size_t line = 0; line < line_starts.size(); ++line) {
+    size_t end = line + 1 < line_starts.size() ? line_starts[line + 1] : points.size();
+    if (end > line_starts[line] + 1) {
+      segment_count += end - line_starts[line] - 1;
+    }
+  }
+
+  segment_count_ = segment_count;
+  mRenderOp.vertexData->vertexCount = segment_count * VERTICES_PER_SEGMENT;
+  mRenderOp.indexData->indexCount = segment_count * INDICES_PER_SEGMENT;
+  if (segment_count == 0) {
+    return;
+  }
+
+  reserveSegments(segment_count);
+
+  auto vertex = static_cast<SegmentVertex *>(
+    vertex_buffer_->lock(
+      0, segment_count * VERTICES_PER_SEGMENT * sizeof(SegmentVertex),
+      Ogre::HardwareBuffer::HBL_DISCARD));
+  for (size_t line = 0; line < line_starts.size(); ++line) {
+    size_t end = line + 1 < line_starts.size() ? line_starts[line + 1] : points.size();
+    for (size_t i = line_starts[line]; i + 1 < end; ++i) {
+      const auto & start = points[i];
+      const auto & finish = points[i + 1];
+      // The shader offsets each vertex along cross(other end - vertex, camera - vertex),
+      // which points the opposite way for the far end, hence the flipped offsets there.
+      setVertex(*vertex++, start, finish, half_width);
+      setVertex(*vertex++, start, finish, -half_width);
+      setVertex(*vertex++, finish, start, -half_width);
+      setVertex(*vertex++, finish, start, half_width);
+    }
+  }
+  vertex_buffer_->unlock();
+}
+
+void ThickLineRenderable::_updateRenderQueue(Ogre::RenderQueue * queue)
+{
+  if (dirty_) {
+    updateBuffers();
+    parent_->updateAlphaBlending();
+  }
+  if (segment_count_ > 0) {
+    Ogre::SimpleRenderable::_updateRenderQueue(queue);
+  }
+}
+
+Ogre::Real ThickLineRenderable::getBoundingRadius() const
+{
+  if (mBox.isNull()) {
+    return 0.0f;
+  }
+  return Ogre::Math::Sqrt(
+    std::max(
+      mBox.getMaximum().squaredLength(),
+      mBox.getMinimum().squaredLength()));
+}
+
+Ogre::Real ThickLineRenderable::getSquaredViewDepth(const Ogre::Camera * cam) const
+{
+  return (cam->getDerivedPosition() - mBox.getCenter()).squaredLength();
+}
+
+ThickLine::ThickLine(Ogre::SceneManager * scene_manager, Ogre::SceneNode * parent_node)
+: Object(scene_manager),
+  width_(0.1f),
+  num_lines_(1),
+  max_points_per_line_(100),
+  transparent_(false)
+{
+  if (!parent_node) {
+    parent_node = scene_manager_->getRootSceneNode();
+  }
+
+  scene_node_ = parent_node->createChildSceneNode();
+
+  static int count = 0;
+  std::string material_name = "ThickLineMaterial" + std::to_string(count++);
+  material_ = Ogre::MaterialManager::getSingleton().getByName("rviz/ThickLine")->clone(
+    material_name);
+  material_->load();
+
+  renderable_ = new ThickLineRenderable(this);
+  renderable_->setMaterial(material_);
+  scene_node_->attachObject(renderable_);
+
+  points_box_.setNull();
+  clear();
+}
+
+ThickLine::~ThickLine()
+{
+  scene_node_->detachObject(renderable_);
+  delete renderable_;
+
+  scene_manager_->destroySceneNode(scene_node_);
+
+  Ogre::MaterialManager::getSingleton().remove(material_);
+}
+
+void ThickLine::clear()
+{
+  points_.clear();
+  line_starts_.assign(1, 0);
+  points_box_.setNull();
+  updateBoundingBox();
+  renderable_->markDirty();
+}
+
+void ThickLine::setMaxPointsPerLine(uint32_t max)
+{
+  max_points_per_line_ = max;
+  points_.reserve(static_cast<size_t>(max_points_per_line_) * num_lines_);
+}
+
+void ThickLine::setNumLines(uint32_t num)
+{
+  num_lines_ = num;
+  points_.reserve(static_cast<size_t>(max_points_per_line_) * num_lines_);
+  line_starts_.reserve(num_lines_);
+}
+
+void ThickLine::finishLine()
+{
+  line_starts_.push_back(static_cast<uint32_t>(points_.size()));
+
+  assert(line_starts_.size() <= num_lines_);
+}
+
+void ThickLine::addPoint(const Ogre::Vector3 & point)
+{
+  addPoint(point, color_);
+}
+
+void ThickLine::addPoint(const Ogre::Vector3 & point, const Ogre::ColourValue & color)
+{
+  points_.push_back({point, color});
+  points_box_.merge(point);
+  updateBoundingBox();
+  renderable_->markDirty();
+}
+
+void ThickLine::updateBoundingBox()
+{
+  if (points_box_.isNull()) {
+    renderable_->setBoundingBox(points_box_);
+    return;
+  }
+  // the quads extend half the width beyond the points in every direction
+  Ogre::Vector3 padding(width_ / 2.0f);
+  renderable_->setBoundingBox(
+    Ogre::AxisAlignedBox(
+      points_box_.getMinimum() - padding, points_box_.getMaximum() + padding));
+}
+
+void ThickLine::updateAlphaBlending()
+{
+  bool transparent = std::any_of(
+    points_.begin(), points_.end(), [](const Point & point) {
+      return point.color.a < unit_alpha_threshold;
+    });
+  if (transparent == transparent_) {
+    return;
+  }
+  transparent_ = transparent;
+
+  Ogre::Technique * technique = material_->getTechnique(0);
+  if (transparent_) {
+    technique->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
+    technique->setDepthWriteEnabled(false);
+  } else {
+    technique->setSceneBlending(Ogre::SBT_REPLACE);
+    technique->setDepthWriteEnabled(true);
+  }
+}
+
+void ThickLine::setLineWidth(float width)
+{
+  width_ = width;
+  updateBoundingBox();
+  renderable_->markDirty();
+}
+
+void ThickLine::setPosition(const Ogre::Vector3 & position)
+{
+  scene_node_->setPosition(position);
+}
+
+void ThickLine::setOrientation(const Ogre::Quaternion & orientation)
+{
+  scene_node_->setOrientation(orientation);
+}
+
+void ThickLine::setScale(const Ogre::Vector3 & scale)
+{
+  // Setting scale doesn't really make sense here
+  (void) scale;
+}
+
+void ThickLine::setColor(float r, float g, float b, float a)
+{
+  color_ = Ogre::ColourValue(r, g, b, a);
+
+  for (auto & point : points_) {
+    point.color = color_;
+  }
+  renderable_->markDirty();
+}
+
+const Ogre::Vector3 & ThickLine::getPosition()
+{
+  return scene_node_->getPosition();
+}
+
+const Ogre::Quaternion & ThickLine::getOrientation()
+{
+  return scene_node_->getOrientation();
+}
+
+}  // namespace rviz_rendering
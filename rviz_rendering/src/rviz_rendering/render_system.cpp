@@ -47,6 +47,7 @@
 #include "rviz_rendering/material_manager.hpp"
 #include "rviz_rendering/logging.hpp"
 #include "rviz_rendering/resource_config.hpp"
+#include "rviz_rendering/vertex_buffer_pool.hpp"
 
 #include "string_helper.hpp"
 
@@ -86,6 +87,7 @@ void RenderSystem::Destroy()
   OGRE_DELETE this->ogre_overlay_system_;
   this->ogre_overlay_system_ = nullptr;
   if (this->ogre_root_) {
+    VertexBufferPool::getSingleton().clearIdleBuffers();
     try {
       // TODO(anyone): do we need to catch segfault on delete?
       OGRE_DELETE this->ogre_root_;
@@ -0,0 +1,141 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_rendering/vertex_buffer_pool.hpp"
+
+#include <algorithm>
+
+#include <OgreHardwareBufferManager.h>
+
+namespace rviz_rendering
+{
+
+const size_t VertexBufferPool::DEFAULT_MAX_IDLE_BYTES = 128 * 1024 * 1024;
+
+namespace
+{
+// small buffers are not worth a size class of their own
+const size_t MIN_SIZE_CLASS = 64;
+}  // namespace
+
+VertexBufferPool & VertexBufferPool::getSingleton()
+{
+  // never destroyed, the buffers must not outlive the HardwareBufferManager,
+  // see clearIdleBuffers()
+  static auto pool = new VertexBufferPool();
+  return *pool;
+}
+
+VertexBufferPool::VertexBufferPool()
+: max_idle_bytes_(DEFAULT_MAX_IDLE_BYTES)
+{}
+
+size_t VertexBufferPool::getSizeClass(size_t vertex_count)
+{
+  if (vertex_count <= MIN_SIZE_CLASS) {
+    return MIN_SIZE_CLASS;
+  }
+  // round up to 4, 5, 6 or 7 times a power of two, which wastes at most a quarter
+  size_t step = MIN_SIZE_CLASS / 4;
+  while (vertex_count > step * 8) {
+    step *= 2;
+  }
+  return (vertex_count + step - 1) / step * step;
+}
+
+Ogre::HardwareVertexBufferSharedPtr VertexBufferPool::acquire(
+  size_t vertex_size, size_t vertex_count)
+{
+  size_t size_class = getSizeClass(vertex_count);
+  ++statistics_.acquired;
+
+  auto idle = idle_buffers_.find({vertex_size, size_class});
+  if (idle != idle_buffers_.end() && !idle->second.empty()) {
+    auto buffer = idle->second.back();
+    idle->second.pop_back();
+    statistics_.idle_bytes -= buffer->getSizeInBytes();
+    ++statistics_.reused;
+    return buffer;
+  }
+
+  auto buffer = Ogre::HardwareBufferManager::getSingleton().createVertexBuffer(
+    vertex_size, size_class, Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY_DISCARDABLE);
+  statistics_.resident_bytes += buffer->getSizeInBytes();
+  return buffer;
+}
+
+void VertexBufferPool::release(const Ogre::HardwareVertexBufferSharedPtr & buffer)
+{
+  if (!buffer) {
+    return;
+  }
+  if (!Ogre::HardwareBufferManager::getSingletonPtr() ||
+    statistics_.idle_bytes + buffer->getSizeInBytes() > max_idle_bytes_ ||
+    getSizeClass(buffer->getNumVertices()) != buffer->getNumVertices())
+  {
+    forget(buffer);
+    return;
+  }
+  idle_buffers_[{buffer->getVertexSize(), buffer->getNumVertices()}].push_back(buffer);
+  statistics_.idle_bytes += buffer->getSizeInBytes();
+}
+
+void VertexBufferPool::clearIdleBuffers()
+{
+  for (auto & idle : idle_buffers_) {
+    for (const auto & buffer : idle.second) {
+      forget(buffer);
+    }
+  }
+  idle_buffers_.clear();
+  statistics_.idle_bytes = 0;
+}
+
+void VertexBufferPool::setMaxIdleBytes(size_t max_idle_bytes)
+{
+  max_idle_bytes_ = max_idle_bytes;
+  // drop the largest buffers first, they are the least likely to be needed again
+  for (auto idle = idle_buffers_.rbegin();
+    idle != idle_buffers_.rend() && statistics_.idle_bytes > max_idle_bytes_; ++idle)
+  {
+    while (!idle->second.empty() && statistics_.idle_bytes > max_idle_bytes_) {
+      statistics_.idle_bytes -= idle->second.back()->getSizeInBytes();
+      forget(idle->second.back());
+      idle->second.pop_back();
+    }
+  }
+}
+
+void VertexBufferPool::forget(const Ogre::HardwareVertexBufferSharedPtr & buffer)
+{
+  statistics_.resident_bytes -= std::min(statistics_.resident_bytes, buffer->getSizeInBytes());
+}
+
+}  // namespace rviz_rendering
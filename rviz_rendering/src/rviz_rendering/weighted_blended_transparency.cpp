@@ -0,0 +1,220 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "rviz_rendering/weighted_blended_transparency.hpp"
+
+#include <memory>
+#include <string>
+
+#include <OgreCompositorChain.h>
+#include <OgreCompositorManager.h>
+#include <OgreGpuProgramManager.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRenderSystem.h>
+#include <OgreRenderSystemCapabilities.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#include <OgreViewport.h>
+
+#include "rviz_rendering/logging.hpp"
+
+namespace rviz_rendering
+{
+
+const char * const WeightedBlendedTransparency::SCHEME = "WeightedBlended";
+const char * const WeightedBlendedTransparency::OPAQUE_SCHEME = "WeightedBlendedOpaque";
+const char * const WeightedBlendedTransparency::COMPOSITOR = "rviz/WeightedBlendedTransparency";
+
+namespace
+{
+
+const char * const TECHNIQUE_NAME = "weighted_blended";
+const char * const OPAQUE_TECHNIQUE_NAME = "weighted_blended_opaque";
+const char * const PROGRAM_VARIANT = "(weighted_blended)";
+// for passes without a fragment program, which pass on the color of the fixed function pipeline
+const char * const VERTEX_COLOR_PROGRAM = "rviz/glsl120/pass_color.frag(weighted_blended)";
+
+/// Keeps the opaque objects, which have no technique for the translucent scheme, out of its pass.
+class SkipOpaqueListener : public Ogre::MaterialManager::Listener
+{
+public:
+  SkipOpaqueListener()
+  {
+    // a technique without passes does not add anything to the render queue
+    material_ = Ogre::MaterialManager::getSingleton().create(
+      "rviz/WeightedBlendedSkip", "rviz_rendering");
+    material_->removeAllTechniques();
+    skip_ = material_->createTechnique();
+    skip_->setSchemeName(WeightedBlendedTransparency::SCHEME);
+  }
+
+  Ogre::Technique * handleSchemeNotFound(
+    unsigned short scheme_index, const Ogre::String & scheme_name,
+    Ogre::Material * original_material, unsigned short lod_index,
+    const Ogre::Renderable * renderable) override
+  {
+    (void) scheme_index;
+    (void) original_material;
+    (void) lod_index;
+    (void) renderable;
+    return scheme_name == WeightedBlendedTransparency::SCHEME ? skip_ : nullptr;
+  }
+
+private:
+  Ogre::MaterialPtr material_;
+  Ogre::Technique * skip_;
+};
+
+void installSkipOpaqueListener()
+{
+  static std::unique_ptr<SkipOpaqueListener> listener;
+  if (!listener) {
+    listener = std::make_unique<SkipOpaqueListener>();
+    Ogre::MaterialManager::getSingleton().addListener(listener.get());
+  }
+}
+
+bool isSupported()
+{
+  const auto * capabilities = Ogre::Root::getSingleton().getRenderSystem()->getCapabilities();
+  return capabilities->hasCapability(Ogre::RSC_TEXTURE_FLOAT) &&
+         capabilities->hasCapability(Ogre::RSC_MRT_DIFFERENT_BIT_DEPTHS) &&
+         capabilities->getNumMultiRenderTargets() >= 2;
+}
+
+Ogre::Technique * getDefaultTechnique(const Ogre::MaterialPtr & material)
+{
+  for (auto * technique : material->getTechniques()) {
+    if (technique->getSchemeName() == Ogre::MaterialManager::DEFAULT_SCHEME_NAME) {
+      return technique;
+    }
+  }
+  return nullptr;
+}
+
+void removeTechniques(const Ogre::MaterialPtr & material)
+{
+  for (auto i = material->getNumTechniques(); i > 0; --i) {
+    const auto & name = material->getTechnique(i - 1)->getName();
+    if (name == TECHNIQUE_NAME || name == OPAQUE_TECHNIQUE_NAME) {
+      material->removeTechnique(i - 1);
+    }
+  }
+}
+
+}  // namespace
+
+bool WeightedBlendedTransparency::setEnabled(Ogre::Viewport * viewport, bool enabled)
+{
+  auto & compositor_manager = Ogre::CompositorManager::getSingleton();
+  if (!enabled) {
+    if (isEnabled(viewport)) {
+      compositor_manager.setCompositorEnabled(viewport, COMPOSITOR, false);
+      compositor_manager.removeCompositor(viewport, COMPOSITOR);
+    }
+    return true;
+  }
+  if (isEnabled(viewport)) {
+    return true;
+  }
+
+  if (!isSupported()) {
+    RVIZ_RENDERING_LOG_WARNING(
+      "Order-independent transparency needs float multiple render targets, "
+      "which are not supported by the graphics driver.");
+    return false;
+  }
+  installSkipOpaqueListener();
+  if (!compositor_manager.addCompositor(viewport, COMPOSITOR)) {
+    RVIZ_RENDERING_LOG_WARNING_STREAM("Could not add the compositor " << COMPOSITOR);
+    return false;
+  }
+  compositor_manager.setCompositorEnabled(viewport, COMPOSITOR, true);
+  return true;
+}
+
+bool WeightedBlendedTransparency::isEnabled(Ogre::Viewport * viewport)
+{
+  auto & compositor_manager = Ogre::CompositorManager::getSingleton();
+  if (!compositor_manager.hasCompositorChain(viewport)) {
+    return false;
+  }
+  auto * instance = compositor_manager.getCompositorChain(viewport)->getCompositor(COMPOSITOR);
+  return instance && instance->getEnabled();
+}
+
+void WeightedBlendedTransparency::updateMaterial(const Ogre::MaterialPtr & material)
+{
+  removeTechniques(material);
+
+  auto * technique = getDefaultTechnique(material);
+  if (!technique || technique->getNumPasses() != 1 || !technique->isTransparent()) {
+    return;
+  }
+  auto * pass = technique->getPass(0);
+  auto fragment_program = getFragmentProgram(pass);
+  if (fragment_program.empty()) {
+    return;
+  }
+
+  auto * weighted_blended = material->createTechnique();
+  weighted_blended->setName(TECHNIQUE_NAME);
+  weighted_blended->setSchemeName(SCHEME);
+  auto * weighted_blended_pass = weighted_blended->createPass();
+  *weighted_blended_pass = *pass;
+  weighted_blended_pass->setFragmentProgram(fragment_program);
+  weighted_blended_pass->setSeparateSceneBlending(
+    Ogre::SBF_ONE, Ogre::SBF_ONE, Ogre::SBF_ZERO, Ogre::SBF_ONE_MINUS_SOURCE_ALPHA);
+  weighted_blended_pass->setDepthWriteEnabled(false);
+  // the order does not matter anymore, so there is no need to sort
+  weighted_blended_pass->setTransparentSortingEnabled(false);
+
+  // keeps the object out of the opaque pass
+  auto * opaque = material->createTechnique();
+  opaque->setName(OPAQUE_TECHNIQUE_NAME);
+  opaque->setSchemeName(OPAQUE_SCHEME);
+}
+
+std::string WeightedBlendedTransparency::getFragmentProgram(const Ogre::Pass * pass)
+{
+  if (!pass->hasFragmentProgram()) {
+    // the fixed function pipeline would apply the textures, which we can not do
+    return pass->getNumTextureUnitStates() == 0 ? VERTEX_COLOR_PROGRAM : "";
+  }
+
+  std::string variant = pass->getFragmentProgramName() + PROGRAM_VARIANT;
+  if (!Ogre::GpuProgramManager::getSingleton().getByName(variant, "rviz_rendering")) {
+    return "";
+  }
+  return variant;
+}
+
+}  // namespace rviz_rendering
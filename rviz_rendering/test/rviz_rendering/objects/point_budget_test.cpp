@@ -0,0 +1,81 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include "rviz_rendering/objects/point_budget.hpp"
+
+using namespace ::testing;  // NOLINT
+
+TEST(PointBudget, scale_is_one_without_demand) {
+  rviz_rendering::PointBudget budget(100);
+
+  EXPECT_THAT(budget.getScale(1), FloatEq(1.0f));
+}
+
+TEST(PointBudget, scale_is_one_if_demand_fits_the_budget) {
+  rviz_rendering::PointBudget budget(100);
+
+  budget.getScale(1);
+  budget.addDemand(60);
+  budget.addDemand(40);
+
+  EXPECT_THAT(budget.getScale(2), FloatEq(1.0f));
+  EXPECT_THAT(budget.getLastDemand(), Eq(100u));
+}
+
+TEST(PointBudget, scale_reduces_the_previous_frame_demand_to_the_budget) {
+  rviz_rendering::PointBudget budget(100);
+
+  budget.getScale(1);
+  budget.addDemand(400);
+
+  EXPECT_THAT(budget.getScale(2), FloatEq(0.25f));
+  // repeated queries within the same frame don't change the scale
+  budget.addDemand(100);
+  EXPECT_THAT(budget.getScale(2), FloatEq(0.25f));
+  EXPECT_THAT(budget.getScale(3), FloatEq(1.0f));
+}
+
+TEST(PointBudget, zero_means_unlimited) {
+  rviz_rendering::PointBudget budget;
+
+  budget.getScale(1);
+  budget.addDemand(1000000);
+
+  EXPECT_THAT(budget.getScale(2), FloatEq(1.0f));
+}
+
+TEST(PointBudget, global_budget_is_shared) {
+  auto budget = rviz_rendering::PointBudget::getGlobal();
+
+  EXPECT_THAT(budget, NotNull());
+  EXPECT_THAT(rviz_rendering::PointBudget::getGlobal(), Eq(budget));
+}
@@ -80,7 +80,7 @@ TEST_F(PointCloudRenderableTestFixture, getBoundingRadius_returns_radius_from_co
 
 TEST_F(PointCloudRenderableTestFixture, renderable_contains_a_correctly_filled_buffer) {
   size_t vertex_size = renderable_->getBuffer()->getVertexSize();
-  size_t number_of_vertices = renderable_->getBuffer()->getNumVertices();
+  size_t number_of_vertices = renderable_->getRenderOperation()->vertexData->vertexCount;
 
   size_t size_of_single_vertex {0};
   size_t vertices_added {0};
@@ -114,3 +114,23 @@ TEST_F(
 
   ASSERT_THAT(renderable_->getSquaredViewDepth(camera), Eq(2));
 }
+
+TEST_F(PointCloudRenderableTestFixture, setLevelOfDetail_limits_rendered_vertices_to_whole_points) {
+  renderable_->getRenderOperation()->vertexData->vertexCount = 30;
+
+  renderable_->setLevelOfDetail(0.5f, 3);
+
+  Ogre::RenderOperation op;
+  renderable_->getRenderOperation(op);
+  ASSERT_THAT(op.vertexData->vertexCount, Eq(15u));
+  // the buffer itself is still fully referenced
+  ASSERT_THAT(renderable_->getRenderOperation()->vertexData->vertexCount, Eq(30u));
+
+  renderable_->setLevelOfDetail(0.0f, 3);
+  renderable_->getRenderOperation(op);
+  ASSERT_THAT(op.vertexData->vertexCount, Eq(3u));
+
+  renderable_->setLevelOfDetail(1.0f, 3);
+  renderable_->getRenderOperation(op);
+  ASSERT_THAT(op.vertexData->vertexCount, Eq(30u));
+}
@@ -33,6 +33,7 @@
 
 #include <memory>
 #include <regex>
+#include <utility>
 #include <vector>
 
 #include <QApplication>  // NOLINT
@@ -85,6 +86,43 @@ TEST_F(PointCloudTestFixture, addPoints_for_the_first_time_adds_renderable) {
   ASSERT_THAT(renderables, SizeIs(1u));
 }
 
+TEST_F(PointCloudTestFixture, addPoints_takes_over_compact_points_without_copying_them) {
+  auto point_cloud = std::make_shared<rviz_rendering::PointCloud>();
+  std::vector<rviz_rendering::PointCloud::CompactPoint> points;
+  for (const auto & point : squareCenteredAtZero) {
+    points.emplace_back(point);
+  }
+  const auto * data = points.data();
+
+  point_cloud->addPoints(std::move(points));
+
+  ASSERT_THAT(point_cloud->getCompactPoints(), SizeIs(4u));
+  EXPECT_THAT(point_cloud->getCompactPoints().data(), Eq(data));
+  EXPECT_THAT(
+    point_cloud->getMemoryUsage(), Eq(4 * sizeof(rviz_rendering::PointCloud::CompactPoint)));
+  EXPECT_THAT(point_cloud->getVertexBufferMemoryUsage(), Gt(0u));
+  ASSERT_THAT(
+    point_cloud->getBoundingBox(),
+    AllOf(
+      HasMinimum(Ogre::Vector3(-1, -1, 0)),
+      HasMaximum(Ogre::Vector3(1, 1, 0))
+  ));
+}
+
+TEST_F(PointCloudTestFixture, getPoints_returns_colors_with_8_bits_per_channel) {
+  auto point_cloud = std::make_shared<rviz_rendering::PointCloud>();
+  std::vector<rviz_rendering::PointCloud::Point> points{
+    {Ogre::Vector3(1, 2, 3), Ogre::ColourValue(0.2f, 0.4f, 0.6f, 0.8f)}};
+
+  point_cloud->addPoints(points.begin(), points.end());
+
+  auto color = point_cloud->getPoints()[0].color;
+  EXPECT_THAT(color.r, FloatNear(0.2f, 1.0f / 255));
+  EXPECT_THAT(color.g, FloatNear(0.4f, 1.0f / 255));
+  EXPECT_THAT(color.b, FloatNear(0.6f, 1.0f / 255));
+  EXPECT_THAT(color.a, FloatNear(0.8f, 1.0f / 255));
+}
+
 TEST_F(PointCloudTestFixture, addPoints_many_points_gets_a_good_bounding_box_for_points) {
   auto point_cloud = std::make_shared<rviz_rendering::PointCloud>();
 
@@ -182,6 +220,38 @@ TEST_F(PointCloudTestFixture, popPoints_removes_bounding_box_when_completely_emp
   ASSERT_TRUE(point_cloud->getBoundingBox().isNull());
 }
 
+TEST_F(PointCloudTestFixture, level_of_detail_keeps_points_in_insertion_order) {
+  auto point_cloud = std::make_shared<rviz_rendering::PointCloud>();
+  point_cloud->setLevelOfDetailEnabled(true);
+  point_cloud->addPoints(squareCenteredAtZero.begin(), squareCenteredAtZero.end());
+
+  auto points = point_cloud->getPoints();
+  ASSERT_THAT(points, SizeIs(4u));
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_THAT(points[i].position, Vector3Eq(squareCenteredAtZero[i].position));
+  }
+  ASSERT_THAT(point_cloud->getRenderables(), SizeIs(1u));
+}
+
+TEST_F(PointCloudTestFixture, popPoints_with_level_of_detail_keeps_remaining_points) {
+  auto point_cloud = std::make_shared<rviz_rendering::PointCloud>();
+  point_cloud->setLevelOfDetailEnabled(true);
+  point_cloud->addPoints(squareCenteredAtZero.begin(), squareCenteredAtZero.end());
+
+  point_cloud->popPoints(2);
+
+  ASSERT_THAT(point_cloud->getPoints(), SizeIs(2u));
+  ASSERT_THAT(
+    point_cloud->getBoundingBox(),
+    AllOf(
+      HasMinimum(squareCenteredAtZero[3].position),
+      HasMaximum(squareCenteredAtZero[2].position)
+  ));
+
+  point_cloud->popPoints(2);
+  ASSERT_THAT(point_cloud->getRenderables(), IsEmpty());
+}
+
 TEST_F(PointCloudTestFixture, setHighlightColor_sets_correct_CustomParameter) {
   auto point_cloud = std::make_shared<rviz_rendering::PointCloud>();
   point_cloud->addPoints(singlePointArray.begin(), singlePointArray.end());
@@ -251,7 +321,8 @@ TEST_F(
   auto renderables = point_cloud->getRenderables();
   for (auto const & renderable : renderables) {
     size_t number_of_vertices_per_point = point_cloud->getVerticesPerPoint();
-    ASSERT_THAT(renderable->getBuffer()->getNumVertices(), Eq(number_of_vertices_per_point));
+    ASSERT_THAT(
+      renderable->getRenderOperation()->vertexData->vertexCount, Eq(number_of_vertices_per_point));
   }
 
   point_cloud->setRenderMode(rviz_rendering::PointCloud::RM_BOXES);
@@ -259,7 +330,8 @@ TEST_F(
   renderables = point_cloud->getRenderables();
   for (auto const & renderable : renderables) {
     size_t number_of_vertices_per_box = point_cloud->getVerticesPerPoint();
-    ASSERT_THAT(renderable->getBuffer()->getNumVertices(), Eq(number_of_vertices_per_box));
+    ASSERT_THAT(
+      renderable->getRenderOperation()->vertexData->vertexCount, Eq(number_of_vertices_per_box));
   }
 }
 
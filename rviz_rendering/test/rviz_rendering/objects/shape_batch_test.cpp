@@ -0,0 +1,151 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <stdexcept>
+
+#include <OgreRoot.h>
+
+#include "../ogre_testing_environment.hpp"
+#include "rviz_rendering/objects/arrow_batch.hpp"
+#include "rviz_rendering/objects/axes_batch.hpp"
+#include "rviz_rendering/objects/shape_batch.hpp"
+
+using namespace ::testing;  // NOLINT
+
+class ShapeBatchTestFixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    testing_environment_ = std::make_shared<rviz_rendering::OgreTestingEnvironment>();
+    testing_environment_->setUpOgreTestEnvironment();
+  }
+
+  std::shared_ptr<rviz_rendering::OgreTestingEnvironment> testing_environment_;
+};
+
+TEST_F(ShapeBatchTestFixture, all_instances_are_merged_into_one_vertex_buffer) {
+  rviz_rendering::ShapeBatch batch(
+    rviz_rendering::Shape::Cube, Ogre::Root::getSingletonPtr()->createSceneManager());
+  ASSERT_THAT(batch.getMeshPositions(), Not(IsEmpty()));
+
+  batch.addInstance(Ogre::Matrix4::IDENTITY, Ogre::ColourValue::Red);
+  batch.addInstance(Ogre::Matrix4::getTrans(2, 0, 0), Ogre::ColourValue::Blue);
+  batch.getRenderable()->updateBuffers();
+
+  auto render_operation = batch.getRenderable()->getRenderOperation();
+  EXPECT_THAT(batch.getRenderable()->getUploadedInstanceCount(), Eq(2u));
+  EXPECT_THAT(render_operation->vertexData->vertexCount, Eq(2 * batch.getMeshPositions().size()));
+  EXPECT_THAT(render_operation->indexData->indexCount, Eq(2 * batch.getMeshIndices().size()));
+}
+
+TEST_F(ShapeBatchTestFixture, bounding_box_contains_all_transformed_instances) {
+  rviz_rendering::ShapeBatch batch(
+    rviz_rendering::Shape::Cube, Ogre::Root::getSingletonPtr()->createSceneManager());
+
+  Ogre::Matrix4 scaled;
+  scaled.makeTransform(
+    Ogre::Vector3(2, 0, 0), Ogre::Vector3(1, 2, 4), Ogre::Quaternion::IDENTITY);
+  batch.addInstance(Ogre::Matrix4::IDENTITY, Ogre::ColourValue::Red);
+  batch.addInstance(scaled, Ogre::ColourValue::Red);
+
+  auto bounding_box = batch.getRenderable()->getBoundingBox();
+  EXPECT_THAT(bounding_box.getMinimum().x, FloatNear(-0.5f, 0.0001f));
+  EXPECT_THAT(bounding_box.getMaximum().x, FloatNear(2.5f, 0.0001f));
+  EXPECT_THAT(bounding_box.getMinimum().y, FloatNear(-1.0f, 0.0001f));
+  EXPECT_THAT(bounding_box.getMaximum().z, FloatNear(2.0f, 0.0001f));
+}
+
+TEST_F(ShapeBatchTestFixture, setColor_changes_color_of_all_instances) {
+  rviz_rendering::ShapeBatch batch(
+    rviz_rendering::Shape::Sphere, Ogre::Root::getSingletonPtr()->createSceneManager());
+  batch.addInstance(Ogre::Matrix4::IDENTITY, Ogre::ColourValue::Red);
+  batch.addInstance(Ogre::Matrix4::getTrans(2, 0, 0), Ogre::ColourValue::Blue);
+
+  batch.setColor(0.3f, 0.4f, 0.5f, 0.2f);
+
+  for (const auto & instance : batch.getInstances()) {
+    EXPECT_THAT(instance.color, Eq(Ogre::ColourValue(0.3f, 0.4f, 0.5f, 0.2f)));
+  }
+}
+
+TEST_F(ShapeBatchTestFixture, clear_removes_all_instances) {
+  rviz_rendering::ShapeBatch batch(
+    rviz_rendering::Shape::Cylinder, Ogre::Root::getSingletonPtr()->createSceneManager());
+  batch.addInstance(Ogre::Matrix4::IDENTITY, Ogre::ColourValue::Red);
+  batch.getRenderable()->updateBuffers();
+
+  batch.clear();
+  batch.getRenderable()->updateBuffers();
+
+  EXPECT_THAT(batch.getInstances(), IsEmpty());
+  EXPECT_THAT(batch.getRenderable()->getUploadedInstanceCount(), Eq(0u));
+  EXPECT_TRUE(batch.getRenderable()->getBoundingBox().isNull());
+}
+
+TEST_F(ShapeBatchTestFixture, constructor_rejects_meshes) {
+  EXPECT_THROW(
+    rviz_rendering::ShapeBatch(
+      rviz_rendering::Shape::Mesh, Ogre::Root::getSingletonPtr()->createSceneManager()),
+    std::invalid_argument);
+}
+
+TEST_F(ShapeBatchTestFixture, arrow_batch_points_along_negative_z_by_default) {
+  rviz_rendering::ArrowBatch arrows(
+    Ogre::Root::getSingletonPtr()->createSceneManager(), nullptr, 1.0f, 0.1f, 0.5f, 0.2f);
+
+  arrows.addArrow(Ogre::Vector3::ZERO, Ogre::Quaternion::IDENTITY, Ogre::ColourValue::Red);
+
+  EXPECT_THAT(arrows.getArrowCount(), Eq(1u));
+  EXPECT_THAT(arrows.getShafts()->getInstances(), SizeIs(1));
+  EXPECT_THAT(arrows.getHeads()->getInstances(), SizeIs(1));
+  auto bounding_box = arrows.getHeads()->getRenderable()->getBoundingBox();
+  EXPECT_THAT(bounding_box.getMinimum().z, FloatNear(-1.5f, 0.0001f));
+  EXPECT_THAT(bounding_box.getMaximum().z, FloatNear(-1.0f, 0.0001f));
+}
+
+TEST_F(ShapeBatchTestFixture, axes_batch_uses_three_cylinders_per_pose) {
+  rviz_rendering::AxesBatch axes(Ogre::Root::getSingletonPtr()->createSceneManager());
+
+  axes.addAxes(Ogre::Vector3::ZERO, Ogre::Quaternion::IDENTITY);
+  axes.addAxes(Ogre::Vector3(1, 2, 3), Ogre::Quaternion::IDENTITY);
+  axes.set(2.0f, 0.2f);
+
+  EXPECT_THAT(axes.getAxesCount(), Eq(2u));
+  ASSERT_THAT(axes.getCylinders()->getInstances(), SizeIs(6));
+  EXPECT_THAT(
+    axes.getCylinders()->getInstances()[0].color, Eq(Ogre::ColourValue(1, 0, 0, 1)));
+  auto bounding_box = axes.getCylinders()->getRenderable()->getBoundingBox();
+  EXPECT_THAT(bounding_box.getMaximum().z, FloatNear(5.0f, 0.0001f));
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+
+#include <OgreRoot.h>
+
+#include "../ogre_testing_environment.hpp"
+#include "rviz_rendering/objects/text_batch.hpp"
+
+using namespace ::testing;  // NOLINT
+
+class TextBatchTestFixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    testing_environment_ = std::make_shared<rviz_rendering::OgreTestingEnvironment>();
+    testing_environment_->setUpOgreTestEnvironment();
+    batch_ = std::make_unique<rviz_rendering::TextBatch>(
+      Ogre::Root::getSingletonPtr()->createSceneManager());
+  }
+
+  void TearDown()
+  {
+    batch_.reset();
+  }
+
+  rviz_rendering::TextBatchChunk * firstChunk()
+  {
+    auto chunk = batch_->getChunks().front().get();
+    chunk->updateBuffers();
+    return chunk;
+  }
+
+  std::shared_ptr<rviz_rendering::OgreTestingEnvironment> testing_environment_;
+  std::unique_ptr<rviz_rendering::TextBatch> batch_;
+};
+
+TEST_F(TextBatchTestFixture, labels_of_one_batch_share_a_chunk) {
+  batch_->addLabel("base_link", Ogre::Vector3(0, 0, 0));
+  batch_->addLabel("odom", Ogre::Vector3(1, 0, 0));
+
+  ASSERT_THAT(batch_->getChunks(), SizeIs(1));
+  EXPECT_THAT(batch_->getLabelCount(), Eq(2u));
+  EXPECT_THAT(firstChunk()->getLabelCount(), Eq(2u));
+}
+
+TEST_F(TextBatchTestFixture, spaces_and_line_breaks_take_no_glyphs) {
+  batch_->addLabel("a b\nc", Ogre::Vector3(0, 0, 0));
+
+  // three glyphs, rounded up to the room reserved for a label
+  auto chunk = firstChunk();
+  EXPECT_THAT(chunk->getGlyphCount(), Eq(4u));
+  EXPECT_THAT(chunk->getRenderOperation()->vertexData->vertexCount, Eq(16u));
+  EXPECT_THAT(chunk->getRenderOperation()->indexData->indexCount, Eq(24u));
+}
+
+TEST_F(TextBatchTestFixture, changing_a_caption_within_its_room_keeps_the_layout) {
+  auto first = batch_->addLabel("abc", Ogre::Vector3(0, 0, 0));
+  batch_->addLabel("def", Ogre::Vector3(1, 0, 0));
+  auto glyph_count = firstChunk()->getGlyphCount();
+
+  batch_->setCaption(first, "abcd");
+
+  EXPECT_THAT(firstChunk()->getGlyphCount(), Eq(glyph_count));
+  EXPECT_THAT(batch_->getCaption(first), StrEq("abcd"));
+}
+
+TEST_F(TextBatchTestFixture, growing_a_caption_beyond_its_room_grows_the_chunk) {
+  auto first = batch_->addLabel("abc", Ogre::Vector3(0, 0, 0));
+  batch_->addLabel("def", Ogre::Vector3(1, 0, 0));
+  auto glyph_count = firstChunk()->getGlyphCount();
+
+  batch_->setCaption(first, "abcdefghijk");
+
+  EXPECT_THAT(firstChunk()->getGlyphCount(), Gt(glyph_count));
+}
+
+TEST_F(TextBatchTestFixture, removed_labels_free_their_glyphs) {
+  auto first = batch_->addLabel("abc", Ogre::Vector3(0, 0, 0));
+  batch_->addLabel("def", Ogre::Vector3(1, 0, 0));
+  auto glyph_count = firstChunk()->getGlyphCount();
+
+  batch_->removeLabel(first);
+
+  EXPECT_THAT(batch_->getLabelCount(), Eq(1u));
+  EXPECT_THAT(firstChunk()->getGlyphCount(), Eq(glyph_count / 2));
+}
+
+TEST_F(TextBatchTestFixture, removed_label_ids_are_reused) {
+  auto first = batch_->addLabel("abc", Ogre::Vector3(0, 0, 0));
+  batch_->removeLabel(first);
+
+  auto second = batch_->addLabel("def", Ogre::Vector3(0, 0, 0));
+
+  EXPECT_THAT(second, Eq(first));
+  EXPECT_THAT(batch_->getCaption(second), StrEq("def"));
+}
+
+TEST_F(TextBatchTestFixture, bounding_box_contains_visible_labels_only) {
+  batch_->addLabel("abc", Ogre::Vector3(0, 0, 0), 0.1f);
+  auto far_away = batch_->addLabel("def", Ogre::Vector3(10, 0, 0), 0.1f);
+
+  EXPECT_TRUE(firstChunk()->getBoundingBox().contains(Ogre::Vector3(10, 0, 0)));
+
+  batch_->setVisible(far_away, false);
+
+  EXPECT_FALSE(batch_->getVisible(far_away));
+  EXPECT_FALSE(firstChunk()->getBoundingBox().contains(Ogre::Vector3(10, 0, 0)));
+  EXPECT_TRUE(firstChunk()->getBoundingBox().contains(Ogre::Vector3(0, 0, 0)));
+}
+
+TEST_F(TextBatchTestFixture, bounding_box_follows_moved_labels_before_the_upload) {
+  auto label = batch_->addLabel("abc", Ogre::Vector3(0, 0, 0), 0.1f);
+  firstChunk();
+
+  batch_->setPosition(label, Ogre::Vector3(5, 5, 5));
+
+  EXPECT_TRUE(
+    batch_->getChunks().front()->getBoundingBox().contains(Ogre::Vector3(5, 5, 5)));
+}
+
+TEST_F(TextBatchTestFixture, labels_beyond_the_chunk_size_go_to_a_new_chunk) {
+  for (size_t i = 0; i < rviz_rendering::TextBatch::LABELS_PER_CHUNK + 1; ++i) {
+    batch_->addLabel("frame_" + std::to_string(i), Ogre::Vector3(0, 0, 0));
+  }
+
+  ASSERT_THAT(batch_->getChunks(), SizeIs(2));
+  EXPECT_THAT(
+    batch_->getChunks()[0]->getLabelCount(), Eq(rviz_rendering::TextBatch::LABELS_PER_CHUNK));
+  EXPECT_THAT(batch_->getChunks()[1]->getLabelCount(), Eq(1u));
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+
+#include <OgreRoot.h>
+
+#include "../ogre_testing_environment.hpp"
+#include "rviz_rendering/objects/thick_line.hpp"
+
+using namespace ::testing;  // NOLINT
+
+class ThickLineTestFixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    testing_environment_ = std::make_shared<rviz_rendering::OgreTestingEnvironment>();
+    testing_environment_->setUpOgreTestEnvironment();
+  }
+
+  std::shared_ptr<rviz_rendering::OgreTestingEnvironment> testing_environment_;
+};
+
+std::unique_ptr<rviz_rendering::ThickLine> twoLines()
+{
+  auto two_lines = std::make_unique<rviz_rendering::ThickLine>(
+    Ogre::Root::getSingletonPtr()->createSceneManager());
+  two_lines->setMaxPointsPerLine(3);
+  two_lines->setNumLines(2);
+  two_lines->addPoint(Ogre::Vector3(1, 1, 0));
+  two_lines->addPoint(Ogre::Vector3(1, -1, 0));
+  two_lines->addPoint(Ogre::Vector3(-1, -1, 0));
+  two_lines->finishLine();
+  two_lines->addPoint(Ogre::Vector3(-1, 1, 0));
+  two_lines->addPoint(Ogre::Vector3(-1, -1, 0));
+  return two_lines;
+}
+
+TEST_F(ThickLineTestFixture, lines_are_split_into_segments) {
+  auto lines = twoLines();
+
+  lines->getRenderable()->updateBuffers();
+
+  EXPECT_THAT(lines->getRenderable()->getSegmentCount(), Eq(3u));
+  EXPECT_THAT(lines->getRenderable()->getRenderOperation()->vertexData->vertexCount, Eq(12u));
+  EXPECT_THAT(lines->getRenderable()->getRenderOperation()->indexData->indexCount, Eq(18u));
+}
+
+TEST_F(ThickLineTestFixture, lines_with_a_single_point_have_no_segments) {
+  rviz_rendering::ThickLine line(Ogre::Root::getSingletonPtr()->createSceneManager());
+  line.addPoint(Ogre::Vector3(1, 1, 1));
+  line.finishLine();
+  line.addPoint(Ogre::Vector3(2, 2, 2));
+
+  line.getRenderable()->updateBuffers();
+
+  EXPECT_THAT(line.getRenderable()->getSegmentCount(), Eq(0u));
+}
+
+TEST_F(ThickLineTestFixture, bounding_box_contains_points_and_line_width) {
+  auto lines = twoLines();
+
+  lines->setLineWidth(0.2f);
+
+  auto bounding_box = Ogre::AxisAlignedBox(
+    Ogre::Vector3(-1.1f, -1.1f, -0.1f), Ogre::Vector3(1.1f, 1.1f, 0.1f));
+  EXPECT_THAT(lines->getRenderable()->getBoundingBox(), Eq(bounding_box));
+}
+
+TEST_F(ThickLineTestFixture, setColor_changes_color_of_all_points) {
+  auto lines = twoLines();
+
+  lines->setColor(0.3f, 0.4f, 0.5f, 0.2f);
+
+  for (const auto & point : lines->getPoints()) {
+    EXPECT_THAT(point.color, Eq(Ogre::ColourValue(0.3f, 0.4f, 0.5f, 0.2f)));
+  }
+}
+
+TEST_F(ThickLineTestFixture, clear_removes_all_segments) {
+  auto lines = twoLines();
+  lines->getRenderable()->updateBuffers();
+
+  lines->clear();
+  lines->getRenderable()->updateBuffers();
+
+  EXPECT_THAT(lines->getPoints(), IsEmpty());
+  EXPECT_THAT(lines->getRenderable()->getSegmentCount(), Eq(0u));
+  EXPECT_TRUE(lines->getRenderable()->getBoundingBox().isNull());
+}
+
+TEST_F(ThickLineTestFixture, vertex_buffer_grows_with_the_number_of_segments) {
+  rviz_rendering::ThickLine line(Ogre::Root::getSingletonPtr()->createSceneManager());
+  line.setMaxPointsPerLine(100000);
+  for (unsigned int i = 0; i < 100000; i++) {
+    line.addPoint(Ogre::Vector3(0, 0, i * 0.1f));
+  }
+
+  line.getRenderable()->updateBuffers();
+
+  EXPECT_THAT(line.getRenderable()->getSegmentCount(), Eq(99999u));
+  EXPECT_THAT(
+    line.getRenderable()->getRenderOperation()->vertexData->vertexBufferBinding->getBuffer(0)
+    ->getNumVertices(), Ge(4u * 99999u));
+}
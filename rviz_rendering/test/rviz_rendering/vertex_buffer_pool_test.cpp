@@ -0,0 +1,115 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+#include "./ogre_testing_environment.hpp"
+#include "rviz_rendering/vertex_buffer_pool.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_rendering::VertexBufferPool;
+
+class VertexBufferPoolTestFixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    testing_environment_ = std::make_shared<rviz_rendering::OgreTestingEnvironment>();
+    testing_environment_->setUpOgreTestEnvironment();
+    VertexBufferPool::getSingleton().clearIdleBuffers();
+    VertexBufferPool::getSingleton().setMaxIdleBytes(VertexBufferPool::DEFAULT_MAX_IDLE_BYTES);
+  }
+
+  std::shared_ptr<rviz_rendering::OgreTestingEnvironment> testing_environment_;
+};
+
+TEST(VertexBufferPoolTest, size_classes_waste_at_most_a_quarter_of_a_buffer) {
+  EXPECT_THAT(VertexBufferPool::getSizeClass(1), Eq(64u));
+  EXPECT_THAT(VertexBufferPool::getSizeClass(64), Eq(64u));
+  EXPECT_THAT(VertexBufferPool::getSizeClass(65), Eq(80u));
+  EXPECT_THAT(VertexBufferPool::getSizeClass(129), Eq(160u));
+  EXPECT_THAT(VertexBufferPool::getSizeClass(368640), Eq(393216u));
+
+  for (size_t vertex_count = 65; vertex_count < 100000; vertex_count += 7) {
+    size_t size_class = VertexBufferPool::getSizeClass(vertex_count);
+    EXPECT_THAT(size_class, Ge(vertex_count));
+    EXPECT_THAT(size_class, Le(vertex_count + vertex_count / 4));
+  }
+}
+
+TEST_F(VertexBufferPoolTestFixture, released_buffers_are_reused_for_the_same_size_class) {
+  auto & pool = VertexBufferPool::getSingleton();
+  auto before = pool.getStatistics();
+
+  auto buffer = pool.acquire(16, 1000);
+  EXPECT_THAT(buffer->getNumVertices(), Eq(VertexBufferPool::getSizeClass(1000)));
+  auto * first = buffer.get();
+  pool.release(buffer);
+  buffer.reset();
+  EXPECT_THAT(pool.getStatistics().idle_bytes, Eq(before.idle_bytes + first->getSizeInBytes()));
+
+  auto reused = pool.acquire(16, 990);
+  EXPECT_THAT(reused.get(), Eq(first));
+  EXPECT_THAT(pool.getStatistics().acquired, Eq(before.acquired + 2));
+  EXPECT_THAT(pool.getStatistics().reused, Eq(before.reused + 1));
+  EXPECT_THAT(pool.getStatistics().idle_bytes, Eq(before.idle_bytes));
+
+  auto other_vertex_size = pool.acquire(28, 1000);
+  EXPECT_THAT(other_vertex_size.get(), Ne(first));
+  pool.release(reused);
+  pool.release(other_vertex_size);
+}
+
+TEST_F(VertexBufferPoolTestFixture, idle_buffers_beyond_the_limit_are_destroyed) {
+  auto & pool = VertexBufferPool::getSingleton();
+  std::vector<Ogre::HardwareVertexBufferSharedPtr> buffers;
+  for (int i = 0; i < 4; ++i) {
+    buffers.push_back(pool.acquire(16, 1024));
+  }
+  size_t buffer_bytes = buffers.front()->getSizeInBytes();
+  size_t resident_bytes = pool.getStatistics().resident_bytes;
+
+  pool.setMaxIdleBytes(2 * buffer_bytes);
+  for (const auto & buffer : buffers) {
+    pool.release(buffer);
+  }
+  buffers.clear();
+
+  EXPECT_THAT(pool.getStatistics().idle_bytes, Eq(2 * buffer_bytes));
+  EXPECT_THAT(pool.getStatistics().resident_bytes, Eq(resident_bytes - 2 * buffer_bytes));
+
+  pool.clearIdleBuffers();
+  EXPECT_THAT(pool.getStatistics().idle_bytes, Eq(0u));
+  EXPECT_THAT(pool.getStatistics().resident_bytes, Eq(resident_bytes - 4 * buffer_bytes));
+}
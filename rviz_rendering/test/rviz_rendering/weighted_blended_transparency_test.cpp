@@ -0,0 +1,126 @@
+// Copyright (c) 2026, Open Source Robotics Foundation, Inc.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreTechnique.h>
+
+#include "./ogre_testing_environment.hpp"
+#include "rviz_rendering/material_manager.hpp"
+#include "rviz_rendering/weighted_blended_transparency.hpp"
+
+using namespace ::testing;  // NOLINT
+
+using rviz_rendering::WeightedBlendedTransparency;
+
+class WeightedBlendedTransparencyTestFixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    testing_environment_ = std::make_shared<rviz_rendering::OgreTestingEnvironment>();
+    testing_environment_->setUpOgreTestEnvironment();
+  }
+
+  std::shared_ptr<rviz_rendering::OgreTestingEnvironment> testing_environment_;
+};
+
+Ogre::Technique * findTechnique(const Ogre::MaterialPtr & material, const std::string & scheme)
+{
+  for (auto technique : material->getTechniques()) {
+    if (technique->getSchemeName() == scheme) {
+      return technique;
+    }
+  }
+  return nullptr;
+}
+
+TEST_F(
+  WeightedBlendedTransparencyTestFixture,
+  translucent_point_cloud_material_gets_a_weighted_blended_technique) {
+  auto material = Ogre::MaterialManager::getSingleton().getByName(
+    "rviz/PointCloudFlatSquare", "rviz_rendering")->clone("WeightedBlendedTestPoints");
+  material->getTechnique(0)->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
+  material->getTechnique(0)->setDepthWriteEnabled(false);
+
+  WeightedBlendedTransparency::updateMaterial(material);
+
+  auto technique = findTechnique(material, WeightedBlendedTransparency::SCHEME);
+  ASSERT_THAT(technique, NotNull());
+  ASSERT_THAT(technique->getNumPasses(), Eq(1u));
+  auto pass = technique->getPass(0);
+  EXPECT_THAT(
+    pass->getFragmentProgramName(), Eq("rviz/glsl120/flat_color.frag(weighted_blended)"));
+  EXPECT_THAT(
+    pass->getVertexProgramName(),
+    Eq(material->getTechnique(0)->getPass(0)->getVertexProgramName()));
+  EXPECT_FALSE(pass->getDepthWriteEnabled());
+  EXPECT_THAT(pass->getSourceBlendFactor(), Eq(Ogre::SBF_ONE));
+  EXPECT_THAT(pass->getDestBlendFactorAlpha(), Eq(Ogre::SBF_ONE_MINUS_SOURCE_ALPHA));
+
+  auto opaque = findTechnique(material, WeightedBlendedTransparency::OPAQUE_SCHEME);
+  ASSERT_THAT(opaque, NotNull());
+  EXPECT_THAT(opaque->getNumPasses(), Eq(0u));
+}
+
+TEST_F(WeightedBlendedTransparencyTestFixture, opaque_material_loses_the_techniques_again) {
+  auto material = rviz_rendering::MaterialManager::createMaterialWithLighting(
+    "WeightedBlendedTestShape");
+
+  rviz_rendering::MaterialManager::enableAlphaBlending(material, 0.5f);
+  EXPECT_THAT(findTechnique(material, WeightedBlendedTransparency::SCHEME), NotNull());
+  EXPECT_THAT(
+    findTechnique(material, WeightedBlendedTransparency::SCHEME)->getPass(0)
+    ->getFragmentProgramName(), Eq("rviz/glsl120/pass_color.frag(weighted_blended)"));
+
+  rviz_rendering::MaterialManager::enableAlphaBlending(material, 0.5f);
+  EXPECT_THAT(material->getNumTechniques(), Eq(3u));
+
+  rviz_rendering::MaterialManager::enableAlphaBlending(material, 1.0f);
+  EXPECT_THAT(findTechnique(material, WeightedBlendedTransparency::SCHEME), IsNull());
+  EXPECT_THAT(findTechnique(material, WeightedBlendedTransparency::OPAQUE_SCHEME), IsNull());
+  EXPECT_THAT(material->getNumTechniques(), Eq(1u));
+}
+
+TEST_F(WeightedBlendedTransparencyTestFixture, textured_material_keeps_sorted_blending) {
+  auto material = rviz_rendering::MaterialManager::createMaterialWithNoLighting(
+    "WeightedBlendedTestTexture");
+  material->getTechnique(0)->getPass(0)->createTextureUnitState();
+
+  rviz_rendering::MaterialManager::enableAlphaBlending(material, 0.5f);
+
+  EXPECT_THAT(material->getNumTechniques(), Eq(1u));
+  EXPECT_TRUE(material->getTechnique(0)->isTransparent());
+}